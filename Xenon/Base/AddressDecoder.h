@@ -0,0 +1,113 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Base {
+
+//
+// Physical address decoder.
+//
+// Holds a sorted array of non overlapping address ranges, each mapped to a target (usually a
+// device pointer). Lookups are a binary search over a handful of entries, and never lock.
+// Tables are rebuilt by the owning bus whenever its device layout changes (device attach, BAR
+// programming): a new table is built with Begin()/Map() and made visible with Publish(), so
+// readers on other threads always see a complete table. Published tables are never written again,
+// the replaced ones are kept until the decoder is destroyed, as a reader may still be searching
+// them and lookups don't write anything to say so. Layouts change a few dozen times per boot at
+// most, so that's a few KiB.
+//
+template <typename T, size_t maxRanges = 64>
+class AddressDecoder {
+public:
+  AddressDecoder() {
+    tables.push_back(std::make_unique<Table>());
+    active.store(tables.back().get(), std::memory_order_relaxed);
+  }
+
+  // Starts building a new table. The current one stays active until Publish() is called.
+  void Begin() {
+    building = std::make_unique<Table>();
+  }
+
+  // Maps [start, start + size) to target. Ranges mapped earlier take priority, so only the parts
+  // of the range not covered yet are added.
+  bool Map(u64 start, u64 size, T target) {
+    Table &table = *building;
+    const u64 end = start + size;
+    u64 current = start;
+    while (current < end) {
+      // Find the first range that ends after current
+      size_t idx = 0;
+      while (idx < table.count && table.ranges[idx].end <= current) {
+        idx++;
+      }
+      u64 gapEnd = end;
+      if (idx < table.count) {
+        if (table.ranges[idx].start <= current) {
+          // Already covered, skip past it
+          current = table.ranges[idx].end;
+          continue;
+        }
+        gapEnd = std::min(end, table.ranges[idx].start);
+      }
+      if (table.count == maxRanges) {
+        return false;
+      }
+      // Insert the uncovered part, keeping the array sorted
+      for (size_t i = table.count; i > idx; i--) {
+        table.ranges[i] = table.ranges[i - 1];
+      }
+      table.ranges[idx] = { current, gapEnd, target };
+      table.count++;
+      current = gapEnd;
+    }
+    return true;
+  }
+
+  // Makes the table built since Begin() visible to Lookup().
+  void Publish() {
+    tables.push_back(std::move(building));
+    active.store(tables.back().get(), std::memory_order_release);
+  }
+
+  // Returns the target mapped at address, or a default constructed T if unmapped.
+  T Lookup(u64 address) const {
+    const Table &table = *active.load(std::memory_order_acquire);
+    const Range *begin = table.ranges.data();
+    const Range *end = begin + table.count;
+    // First range starting after address, the candidate is the one right before it
+    const Range *it = std::upper_bound(begin, end, address,
+      [](u64 addr, const Range &range) { return addr < range.start; });
+    T target{};
+    if (it != begin) {
+      --it;
+      if (address < it->end)
+        target = it->target;
+    }
+    return target;
+  }
+
+private:
+  struct Range {
+    u64 start = 0;
+    u64 end = 0;
+    T target{};
+  };
+  struct Table {
+    std::array<Range, maxRanges> ranges{};
+    size_t count = 0;
+  };
+  // Every table published so far, the last one is active
+  std::vector<std::unique_ptr<Table>> tables{};
+  std::atomic<const Table*> active = nullptr;
+  // Table between Begin() and Publish(), only touched by the owning bus
+  std::unique_ptr<Table> building{};
+};
+
+} // namespace Base
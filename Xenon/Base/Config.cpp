@@ -275,6 +275,7 @@ bool _smc::verify_toml(toml::value &value) {
 
 void _xcpu::from_toml(const toml::value &value) {
   ramSize = toml::find_or<std::string>(value, "RAMSize", ramSize);
+  ramHugePages = toml::find_or<bool>(value, "RAMHugePages", ramHugePages);
   elfLoader = toml::find_or<bool>(value, "ElfLoader", elfLoader);
   clocksPerInstruction = toml::find_or<s32&>(value, "CPI", clocksPerInstruction);
   overrideInitSkip = toml::find_or<bool>(value, "OverrideHWInit", overrideInitSkip);
@@ -289,6 +290,12 @@ void _xcpu::to_toml(toml::value &value) {
   value["RAMSize"].comments().push_back("# 512MiB = 536.870912MB");
   value["RAMSize"].comments().push_back("# 1GiB = 1024MiB");
 
+  value["RAMHugePages"].comments().clear();
+  value["RAMHugePages"] = ramHugePages;
+  value["RAMHugePages"].comments().push_back("# Backs RAM with 2MiB pages, lowers TLB pressure on guest memory accesses");
+  value["RAMHugePages"].comments().push_back("# Uses reserved huge pages (vm.nr_hugepages) if available, otherwise transparent huge pages");
+  value["RAMHugePages"].comments().push_back("# Linux only, ignored elsewhere");
+
   value["ElfLoader"].comments().clear();
   value["ElfLoader"] = elfLoader;
   value["ElfLoader"].comments().push_back("# Disables normal codeflow and loads an elf from ElfBinary");
@@ -320,6 +327,7 @@ void _xcpu::to_toml(toml::value &value) {
 bool _xcpu::verify_toml(toml::value &value) {
   to_toml(value);
   cache_value(ramSize);
+  cache_value(ramHugePages);
   cache_value(elfLoader);
   cache_value(clocksPerInstruction);
   cache_value(overrideInitSkip);
@@ -327,6 +335,7 @@ bool _xcpu::verify_toml(toml::value &value) {
   cache_value(HW_INIT_SKIP_2);
   from_toml(value);
   verify_value(ramSize);
+  verify_value(ramHugePages);
   verify_value(elfLoader);
   verify_value(clocksPerInstruction);
   verify_value(overrideInitSkip);
@@ -337,18 +346,39 @@ bool _xcpu::verify_toml(toml::value &value) {
 
 void _xgpu::from_toml(const toml::value &value) {
   internal.from_toml("Internal", value);
+  shaderCache = toml::find_or<bool>(value, "ShaderCache", shaderCache);
+  dumpShaders = toml::find_or<bool>(value, "DumpShaders", dumpShaders);
+  asyncShaders = toml::find_or<bool>(value, "AsyncShaders", asyncShaders);
 }
 void _xgpu::to_toml(toml::value &value) {
   value["Internal"].comments().clear();
   internal.to_toml(value["Internal"]);
   value["Internal"].comments().push_back("# Internal Resolution (The width of what XeLL uses, do not modify)");
+  value["ShaderCache"].comments().clear();
+  value["ShaderCache"] = shaderCache;
+  value["ShaderCache"].comments().push_back("# Stores translated shaders on disk, so shaders seen before skip SPIR-V emission");
+  value["ShaderCache"].comments().push_back("# Entries from another emulator version are deleted on startup");
+  value["DumpShaders"].comments().clear();
+  value["DumpShaders"] = dumpShaders;
+  value["DumpShaders"].comments().push_back("# Writes the microcode (.bin) and SPIR-V (.spv) of every new shader to 'shaders/spirv', for debugging");
+  value["AsyncShaders"].comments().clear();
+  value["AsyncShaders"] = asyncShaders;
+  value["AsyncShaders"].comments().push_back("# Shaders are always translated in the background, this picks what happens to draws using them meanwhile");
+  value["AsyncShaders"].comments().push_back("# true - The draws are skipped, no stutter but objects can pop in");
+  value["AsyncShaders"].comments().push_back("# false - The draws (and everything after them) wait for the shaders, frames keep being presented");
 }
 bool _xgpu::verify_toml(toml::value &value) {
   to_toml(value);
   cache_value(internal);
+  cache_value(shaderCache);
+  cache_value(dumpShaders);
+  cache_value(asyncShaders);
   from_toml(value);
   verify_value(internal.width);
   verify_value(internal.height);
+  verify_value(shaderCache);
+  verify_value(dumpShaders);
+  verify_value(asyncShaders);
   return true;
 }
 
@@ -358,17 +388,20 @@ void _filepaths::from_toml(const toml::value &value) {
   nand = toml::find_or<std::string>(value, "Nand", nand);
   oddImage = toml::find_or<std::string>(value, "ODDImage", oddImage);
   elfBinary = toml::find_or<std::string>(value, "ElfBinary", elfBinary);
+  hooks = toml::find_or<std::string>(value, "Hooks", hooks);
 }
 void _filepaths::to_toml(toml::value &value) {
   value.comments().clear();
   value.comments().push_back("# Only Fuses, OneBL, and Nand are required");
   value.comments().push_back("# ElfBinary is used in the elf loader");
   value.comments().push_back("# ODDImage is Optical Disc Drive Image, takes an ISO file for Linux");
+  value.comments().push_back("# Hooks is the guest hooks file for the kernel in use, created with the built-in ones if missing");
   value["Fuses"] = fuses;
   value["OneBL"] = oneBl;
   value["Nand"] = nand;
   value["ODDImage"] = oddImage;
   value["ElfBinary"] = elfBinary;
+  value["Hooks"] = hooks;
 }
 bool _filepaths::verify_toml(toml::value &value) {
   to_toml(value);
@@ -377,12 +410,14 @@ bool _filepaths::verify_toml(toml::value &value) {
   cache_value(nand);
   cache_value(oddImage);
   cache_value(elfBinary);
+  cache_value(hooks);
   from_toml(value);
   verify_value(fuses);
   verify_value(oneBl);
   verify_value(nand);
   verify_value(oddImage);
   verify_value(elfBinary);
+  verify_value(hooks);
   return true;
 }
 
@@ -441,6 +476,10 @@ void _highlyExperimental::from_toml(const toml::value &value) {
   tmpConsoleRevison = toml::find_or<s32&>(value, "ConsoleRevison", tmpConsoleRevison);
   consoleRevison = static_cast<eConsoleRevision>(tmpConsoleRevison);
   cpuExecutor = toml::find_or<std::string>(value, "CPUExecutor", cpuExecutor);
+  jitCache = toml::find_or<bool>(value, "JITCache", jitCache);
+  fastFPU = toml::find_or<bool>(value, "FastFPU", fastFPU);
+  scheduler = toml::find_or<std::string>(value, "Scheduler", scheduler);
+  schedulerQuantum = toml::find_or<s32&>(value, "SchedulerQuantum", schedulerQuantum);
   clocksPerInstructionBypass = toml::find_or<s32&>(value, "CPIBypass", clocksPerInstructionBypass);
 }
 void _highlyExperimental::to_toml(toml::value &value) {
@@ -454,10 +493,29 @@ void _highlyExperimental::to_toml(toml::value &value) {
   value["CPUExecutor"].comments().clear();
   value["CPUExecutor"] = cpuExecutor;
   value["CPUExecutor"].comments().push_back("# PowerPC CPU Executor:");
-  value["CPUExecutor"].comments().push_back("# Interpreted - Cached Interpreter, uses regular interpreted execution with caching");
+  value["CPUExecutor"].comments().push_back("# Interpreted - Interpreter, fetches and decodes every instruction as it runs");
+  value["CPUExecutor"].comments().push_back("# Cached - Cached Interpreter, runs blocks of predecoded instructions");
   value["CPUExecutor"].comments().push_back("# JIT - Just In Time compilation, runs opcodes in 'blocks'");
   value["CPUExecutor"].comments().push_back("# Hybrid - JIT with Cached Interpreter fallback, uses faster block system with Interpreter opcodes");
   value["CPUExecutor"].comments().push_back("# [WARN] This is unfinished, you *will* break the emulator changing this");
+  value["JITCache"].comments().clear();
+  value["JITCache"] = jitCache;
+  value["JITCache"].comments().push_back("# Stores compiled JIT blocks on disk, so later boots of the same image start faster");
+  value["JITCache"].comments().push_back("# Delete the 'jitcache' folder if you suspect a stale cache");
+  value["FastFPU"].comments().clear();
+  value["FastFPU"] = fastFPU;
+  value["FastFPU"].comments().push_back("# Runs floating point arithmetic on the host FPU directly, skipping most of the FPSCR bookkeeping");
+  value["FastFPU"].comments().push_back("# Results are the same, but FPSCR[FI, FR, XX] aren't updated and FPRF is only computed when read");
+  value["FastFPU"].comments().push_back("# Only used while no FP exception is enabled and the FPU is in IEEE mode");
+  value["Scheduler"].comments().clear();
+  value["Scheduler"] = scheduler;
+  value["Scheduler"].comments().push_back("# How PPUs and devices are scheduled:");
+  value["Scheduler"].comments().push_back("# Relaxed - Everything runs free on its own thread, fastest");
+  value["Scheduler"].comments().push_back("# Deterministic - One runs at a time in fixed quantums, guest time comes from a virtual clock");
+  value["Scheduler"].comments().push_back("# Reproducible runs for benchmarking and regression testing, at the cost of speed");
+  value["SchedulerQuantum"].comments().clear();
+  value["SchedulerQuantum"] = schedulerQuantum;
+  value["SchedulerQuantum"].comments().push_back("# Instructions each hardware thread runs per turn in Deterministic mode");
   value["CPIBypass"].comments().clear();
   value["CPIBypass"] = clocksPerInstructionBypass;
   value["CPIBypass"].comments().push_back("# Zero will use the estimated CPI for your system (view XCPU for more info)");
@@ -466,10 +524,18 @@ bool _highlyExperimental::verify_toml(toml::value &value) {
   to_toml(value);
   cache_value(consoleRevison);
   cache_value(cpuExecutor);
+  cache_value(jitCache);
+  cache_value(fastFPU);
+  cache_value(scheduler);
+  cache_value(schedulerQuantum);
   cache_value(clocksPerInstructionBypass);
   from_toml(value);
   verify_value(consoleRevison);
   verify_value(cpuExecutor);
+  verify_value(jitCache);
+  verify_value(fastFPU);
+  verify_value(scheduler);
+  verify_value(schedulerQuantum);
   verify_value(clocksPerInstructionBypass);
   return true;
 }
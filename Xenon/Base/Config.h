@@ -166,6 +166,8 @@ inline struct _smc {
 inline struct _xcpu {
   // CPU RAM Size
   std::string ramSize = "512MiB";
+  // Backs RAM with huge pages when possible (explicit, then transparent)
+  bool ramHugePages = false;
   // Loads an elf from the ElfBinary path
   bool elfLoader = false;
   // CPI for your system, do not modify
@@ -187,6 +189,12 @@ inline struct _xcpu {
 inline struct _xgpu {
   // Internal Resolution | The resolution XeLL uses
   _resolution internal{ 1280, 720 };
+  // Keeps translated shaders on disk between runs
+  bool shaderCache = true;
+  // Also writes the raw microcode and SPIR-V of every new shader to shaders/spirv
+  bool dumpShaders = false;
+  // Skips draws whose shaders are still being translated, instead of holding them back
+  bool asyncShaders = true;
 
   // TOML Conversion
   void to_toml(toml::value &value);
@@ -208,6 +216,8 @@ inline struct _filepaths {
   std::string oddImage = "xenon.iso";
   // Elf binary path
   std::string elfBinary = "kernel.elf";
+  // Guest hooks for the kernel version in use
+  std::string hooks = "hooks/17489.toml";
 
   // Corrects the paths on first time creation
   void correct(const fs::path &basePath) {
@@ -221,6 +231,8 @@ inline struct _filepaths {
     oddImage = oddImagePath.string();
     auto elfBinaryPath = basePath / elfBinary;
     elfBinary = elfBinaryPath.string();
+    auto hooksPath = basePath / hooks;
+    hooks = hooksPath.string();
   }
 
   // TOML Conversion
@@ -270,10 +282,21 @@ enum class eConsoleRevision : const u8 {
 inline struct _highlyExperimental {
   eConsoleRevision consoleRevison = eConsoleRevision::Corona;
   // Executor modes:
-  // Interpreted - Cached Interpreter
-  // Hybrid - JIT with Cached Interpreter fallback
+  // Interpreted - Interpreter
+  // Cached - Cached Interpreter
   // JIT - Just In Time
+  // Hybrid - JIT with Cached Interpreter fallback
   std::string cpuExecutor = "Interpreted";
+  // Keeps compiled JIT blocks on disk between runs
+  bool jitCache = true;
+  // Computes FP results on the host directly, FPSCR is only kept up to date where code can see it
+  bool fastFPU = false;
+  // Scheduler modes:
+  // Relaxed - PPUs and devices run free on their own threads
+  // Deterministic - One runs at a time, in fixed quantums against a virtual clock
+  std::string scheduler = "Relaxed";
+  // Instructions per hardware thread per turn in Deterministic mode
+  s32 schedulerQuantum = 4096;
   s32 clocksPerInstructionBypass = 0;
 
   // TOML Conversion
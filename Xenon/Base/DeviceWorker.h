@@ -0,0 +1,74 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace Base {
+
+//
+// Parks a device thread while it has nothing to do.
+//
+// The device makes work visible to its thread (a command register write, a new ring buffer write
+// pointer...) and then calls Notify. The thread sleeps in Wait/WaitUntil until that happens, its
+// predicate holds or, for WaitUntil, a deadline passes. Stop wakes it up for good.
+//
+class DeviceWorker {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  // Wakes the worker, call once the work is visible to it.
+  void Notify() {
+    {
+      std::lock_guard lock(mutex);
+      signaled = true;
+    }
+    cv.notify_one();
+  }
+
+  // Makes every current and future wait return false.
+  void Stop() {
+    {
+      std::lock_guard lock(mutex);
+      stopped = true;
+    }
+    cv.notify_all();
+  }
+
+  bool IsStopped() {
+    std::lock_guard lock(mutex);
+    return stopped;
+  }
+
+  // Waits until pred holds or Notify is called. Returns false once stopped.
+  template <typename Pred>
+  bool Wait(Pred &&pred) {
+    return WaitUntil(Clock::time_point::max(), std::forward<Pred>(pred));
+  }
+
+  // Same as Wait, also returning when deadline passes.
+  template <typename Pred>
+  bool WaitUntil(Clock::time_point deadline, Pred &&pred) {
+    std::unique_lock lock(mutex);
+    const auto wake = [&] { return stopped || signaled || pred(); };
+    // wait_until overflows on some implementations with the max time point
+    if (deadline == Clock::time_point::max()) {
+      cv.wait(lock, wake);
+    } else {
+      cv.wait_until(lock, deadline, wake);
+    }
+    signaled = false;
+    return !stopped;
+  }
+
+private:
+  std::mutex mutex;
+  std::condition_variable cv;
+  // Set by Notify, consumed by the next wait
+  bool signaled = false;
+  bool stopped = false;
+};
+
+} // namespace Base
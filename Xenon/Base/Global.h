@@ -19,6 +19,7 @@ inline std::atomic<bool> XeShutdonSignaled{ false };
 inline std::atomic<bool> XePaused{ false };
 
 class Xenon;
+namespace Xe { class Scheduler; }
 
 // Handles system pause
 namespace Base {
@@ -49,6 +50,8 @@ extern void Reboot(u32 type);
 
 extern Xenon *GetCPU();
 
+extern Xe::Scheduler *GetScheduler();
+
 } // namespace XeMain
 
 // Global shutdown handler
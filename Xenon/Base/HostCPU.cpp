@@ -0,0 +1,74 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#include "Arch.h"
+#include "Types.h"
+
+#include "HostCPU.h"
+
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace Base {
+
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+static void cpuid(u32 leaf, u32 subLeaf, u32 regs[4]) {
+#ifdef _MSC_VER
+  int info[4] = {};
+  __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subLeaf));
+  for (int i = 0; i != 4; i++) {
+    regs[i] = static_cast<u32>(info[i]);
+  }
+#else
+  __cpuid_count(leaf, subLeaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static u64 xgetbv(u32 index) {
+#ifdef _MSC_VER
+  return _xgetbv(index);
+#else
+  u32 eax = 0, edx = 0;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+  return (static_cast<u64>(edx) << 32) | eax;
+#endif
+}
+
+static HostCPUFeatures DetectHostCPUFeatures() {
+  HostCPUFeatures features{};
+  u32 regs[4] = {};
+  cpuid(0, 0, regs);
+  const u32 maxLeaf = regs[0];
+  if (maxLeaf < 1)
+    return features;
+
+  cpuid(1, 0, regs);
+  const u32 ecx = regs[2];
+  features.sse41 = ecx & (1 << 19);
+  // The OS has to save XMM and YMM on context switches for any of the VEX encoded extensions
+  const bool osxsave = ecx & (1 << 27);
+  const bool osYmm = osxsave && (xgetbv(0) & 0x6) == 0x6;
+  features.avx = osYmm && (ecx & (1 << 28));
+  features.fma = features.avx && (ecx & (1 << 12));
+  if (maxLeaf >= 7) {
+    cpuid(7, 0, regs);
+    features.avx2 = features.avx && (regs[1] & (1 << 5));
+  }
+  return features;
+}
+#else
+static HostCPUFeatures DetectHostCPUFeatures() {
+  return {};
+}
+#endif
+
+const HostCPUFeatures &GetHostCPUFeatures() {
+  static const HostCPUFeatures features = DetectHostCPUFeatures();
+  return features;
+}
+
+} // namespace Base
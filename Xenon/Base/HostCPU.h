@@ -0,0 +1,18 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#pragma once
+
+namespace Base {
+
+// Instruction set extensions of the host CPU, beyond the SSSE3 baseline we're built with
+struct HostCPUFeatures {
+  bool sse41 = false;
+  bool avx = false;
+  bool avx2 = false;
+  bool fma = false;
+};
+
+// Detected once, on first use. AVX based features also require the OS to save the YMM state.
+const HostCPUFeatures &GetHostCPUFeatures();
+
+} // namespace Base
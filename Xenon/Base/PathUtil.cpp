@@ -69,6 +69,8 @@ static auto UserPaths = [] {
     fs::create_directory(currentDir / SHADER_DIR / "cache");
     fs::create_directory(currentDir / SHADER_DIR / "spirv");
     fs::create_directory(currentDir / SHADER_DIR / "opengl");
+    insert_path(PathType::JITCacheDir, currentDir / JIT_CACHE_DIR);
+    insert_path(PathType::SaveStateDir, currentDir / SAVE_STATE_DIR);
   }
   else {
     insert_path(PathType::RootDir, currentDir, false);
@@ -78,6 +80,8 @@ static auto UserPaths = [] {
     fs::create_directory(binaryDir / SHADER_DIR / "cache");
     fs::create_directory(binaryDir / SHADER_DIR / "spirv");
     fs::create_directory(binaryDir / SHADER_DIR / "opengl");
+    insert_path(PathType::JITCacheDir, binaryDir / JIT_CACHE_DIR);
+    insert_path(PathType::SaveStateDir, binaryDir / SAVE_STATE_DIR);
   }
   return paths;
 }();
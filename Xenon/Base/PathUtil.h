@@ -15,7 +15,9 @@ enum class PathType {
   RootDir,    // Execution Path
   ConsoleDir, // Where Xenon gets the console files
   LogDir,     // Where log files are stored
-  ShaderDir   // Where shaders are stored
+  ShaderDir,  // Where shaders are stored
+  JITCacheDir, // Where compiled JIT blocks are cached
+  SaveStateDir // Where save states are stored
 };
 
 enum FileType {
@@ -37,6 +39,10 @@ constexpr auto LOG_DIR = "log";
 
 constexpr auto SHADER_DIR = "shaders";
 
+constexpr auto JIT_CACHE_DIR = "jitcache";
+
+constexpr auto SAVE_STATE_DIR = "states";
+
 constexpr auto LOG_FILE = "xenon_log.txt";
 
 // Converts a given fs::path to a UTF8 string.
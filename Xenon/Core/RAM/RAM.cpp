@@ -1,5 +1,12 @@
 // Copyright 2025 Xenon Emulator Project. All rights reserved.
 
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include "Base/Config.h"
 #include "Base/Logging/Log.h"
 #include "Base/Hash.h"
 
@@ -83,56 +90,218 @@ RAM::RAM(const std::string &deviceName, u64 startAddress, std::string size, bool
     }
   }
   UpdateEndAddress(GetStartAddress() + ramSize);
-  ramData = std::make_unique<STRIP_UNIQUE_ARR(ramData)>(ramSize);
-  if (!ramData.get()) {
+  AllocateCodePages();
+  if (!Allocate()) {
     LOG_CRITICAL(System, "RAM failed to allocate! This is really bad!");
     Base::SystemPause();
-  } else {
-    memset(ramData.get(), 0xCD, ramSize);
   }
 }
 RAM::~RAM() {
-  ramData.reset();
+  Release();
 }
 
 void RAM::Reset() {
-  if (!ramData.get()) {
-    ramData = std::make_unique<STRIP_UNIQUE_ARR(ramData)>(ramSize);
-    memset(ramData.get(), 0xCD, ramSize);
+  // Everything compiled from RAM is gone
+  NotifyWrite(0, ramSize);
+  if (!ramData) {
+    Allocate();
   } else {
-    memset(ramData.get(), 0xCD, ramSize);
+    Decommit();
   }
 }
 
 void RAM::Resize(u64 size) {
+  // Host pointers only move when the size does
+  if (ramData && size != ramSize)
+    Release();
   ramSize = size;
-  if (!ramData.get()) {
-    ramData = std::make_unique<STRIP_UNIQUE_ARR(ramData)>(ramSize);
+  AllocateCodePages();
+  if (!ramData) {
+    Allocate();
   }
 }
 
 void RAM::Read(u64 readAddress, u8 *data, u64 size) {
   const u64 offset = static_cast<u32>(readAddress - RAM_START_ADDR);
-  memcpy(data, ramData.get() + offset, size);
+  memcpy(data, ramData + offset, size);
   if (false)
     LOG_TRACE(Xenon, "Reading {:#08x} bytes from {:#08x}", size, readAddress);
 }
 
 void RAM::Write(u64 writeAddress, const u8 *data, u64 size) {
   const u32 offset = static_cast<u32>(writeAddress - RAM_START_ADDR);
-  memcpy(ramData.get() + offset, data, size);
+  memcpy(ramData + offset, data, size);
+  NotifyWrite(offset, size);
   if (false)
     LOG_TRACE(Xenon, "Writing {:#08x} bytes to {:#08x}", size, writeAddress);
 }
 
 void RAM::MemSet(u64 writeAddress, s32 data, u64 size) {
   const u32 offset = static_cast<u32>(writeAddress - RAM_START_ADDR);
-  memset(ramData.get() + offset, data, size);
+  memset(ramData + offset, data, size);
+  NotifyWrite(offset, size);
   if (false)
     LOG_TRACE(Xenon, "Setting {:#08x} to {:#02x} for {:#08x} bytes", writeAddress, data, size);
 }
 
 u8 *RAM::GetPointerToAddress(u32 address) {
   const u64 offset = static_cast<u32>(address - RAM_START_ADDR);
-  return ramData.get() + offset;
+  return ramData + offset;
+}
+
+bool RAM::Allocate() {
+  hugePages = false;
+  mappedSize = (ramSize + RAM_HOST_PAGE_SIZE - 1) & ~static_cast<u64>(RAM_HOST_PAGE_SIZE - 1);
+  if (!mappedSize)
+    return false;
+#ifdef _WIN32
+  // Committed pages are demand-zero, Windows only backs them once they're touched
+  ramData = static_cast<u8*>(VirtualAlloc(nullptr, mappedSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+#else
+  void *mapping = MAP_FAILED;
+#ifdef MAP_HUGETLB
+  if (Config::xcpu.ramHugePages) {
+    // Explicit huge pages need to be reserved by the admin (vm.nr_hugepages), try them first
+    const u64 hugeSize = (ramSize + RAM_HUGE_PAGE_SIZE - 1) & ~static_cast<u64>(RAM_HUGE_PAGE_SIZE - 1);
+    mapping = mmap(nullptr, hugeSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_HUGETLB, -1, 0);
+    if (mapping != MAP_FAILED) {
+      mappedSize = hugeSize;
+      hugePages = true;
+    }
+  }
+#endif
+  if (mapping == MAP_FAILED) {
+    mapping = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+#ifdef MADV_HUGEPAGE
+    // Fall back to transparent huge pages, the kernel promotes the range when it can
+    if (mapping != MAP_FAILED && Config::xcpu.ramHugePages)
+      hugePages = madvise(mapping, mappedSize, MADV_HUGEPAGE) == 0;
+#endif
+  }
+  ramData = mapping != MAP_FAILED ? static_cast<u8*>(mapping) : nullptr;
+#endif
+  if (!ramData) {
+    mappedSize = 0;
+    return false;
+  }
+  LOG_INFO(System, "RAM mapped at 0x{:X} (0x{:X} bytes{})", reinterpret_cast<u64>(ramData), mappedSize, hugePages ? ", huge pages" : "");
+  return true;
+}
+
+void RAM::Release() {
+  if (!ramData)
+    return;
+#ifdef _WIN32
+  VirtualFree(ramData, 0, MEM_RELEASE);
+#else
+  munmap(ramData, mappedSize);
+#endif
+  ramData = nullptr;
+  mappedSize = 0;
+  hugePages = false;
+}
+
+void RAM::Decommit() {
+#ifdef _WIN32
+  // Decommitting and committing again gives back zeroed pages at the same address
+  if (VirtualFree(ramData, mappedSize, MEM_DECOMMIT) &&
+      VirtualAlloc(ramData, mappedSize, MEM_COMMIT, PAGE_READWRITE))
+    return;
+#else
+  // Private anonymous pages read as zero again once dropped
+  if (madvise(ramData, mappedSize, MADV_DONTNEED) == 0)
+    return;
+#endif
+  LOG_WARNING(System, "RAM: Failed to release pages on reset, clearing them instead");
+  memset(ramData, 0, ramSize);
+}
+
+void RAM::MarkCodePage(u64 address, u8 owner) {
+  const u64 page = address >> RAM_CODE_PAGE_SHIFT;
+  if (page >= codePageCount)
+    return;
+  codePages[page].fetch_or(1 << owner, std::memory_order_acq_rel);
+  codePagesTracked.store(true, std::memory_order_relaxed);
+}
+
+void RAM::TakeDirtyCodePages(u8 owner, std::vector<u32> &pages) {
+  CodePageOwner &codeOwner = codePageOwners[owner];
+  std::lock_guard lock(codeOwner.lock);
+  pages.swap(codeOwner.dirtyPages);
+  codeOwner.dirtyPages.clear();
+  codeOwner.dirty.store(false, std::memory_order_release);
+}
+
+static u64 RotateLeft64(u64 value, u32 shift) {
+  return (value << shift) | (value >> (64 - shift));
+}
+
+static u64 FinalMix64(u64 value) {
+  value ^= value >> 33;
+  value *= 0xFF51AFD7ED558CCDULL;
+  value ^= value >> 33;
+  value *= 0xC4CEB9FE1A85EC53ULL;
+  value ^= value >> 33;
+  return value;
+}
+
+// Page hash for save states, only used to spot changes. MurmurHash3 x64 128, pages have no tail.
+// A collision drops a changed page from an incremental state, so it needs the full 128 bits.
+static RAM::StatePageHash HashStatePage(const u8 *page) {
+  constexpr u64 c1 = 0x87C37B91114253D5ULL;
+  constexpr u64 c2 = 0x4CF5AD432745937FULL;
+  u64 h1 = 0, h2 = 0;
+  for (u64 i = 0; i != RAM_STATE_PAGE_SIZE; i += 16) {
+    u64 k1 = 0, k2 = 0;
+    memcpy(&k1, page + i, sizeof(k1));
+    memcpy(&k2, page + i + 8, sizeof(k2));
+    h1 ^= RotateLeft64(k1 * c1, 31) * c2;
+    h1 = (RotateLeft64(h1, 27) + h2) * 5 + 0x52DCE729;
+    h2 ^= RotateLeft64(k2 * c2, 33) * c1;
+    h2 = (RotateLeft64(h2, 31) + h1) * 5 + 0x38495AB5;
+  }
+  h1 ^= RAM_STATE_PAGE_SIZE;
+  h2 ^= RAM_STATE_PAGE_SIZE;
+  h1 += h2;
+  h2 += h1;
+  h1 = FinalMix64(h1);
+  h2 = FinalMix64(h2);
+  h1 += h2;
+  h2 += h1;
+  return { h1, h2 };
+}
+
+void RAM::CollectChangedStatePages(std::vector<u32> &pages, bool all) {
+  pages.clear();
+  const u64 pageCount = ramSize >> RAM_STATE_PAGE_SHIFT;
+  if (!statePageHashes) {
+    statePageHashes = std::make_unique<STRIP_UNIQUE_ARR(statePageHashes)>(pageCount);
+    all = true;
+  }
+  for (u64 page = 0; page != pageCount; page++) {
+    const StatePageHash hash = HashStatePage(ramData + (page << RAM_STATE_PAGE_SHIFT));
+    if (all || hash.low != statePageHashes[page].low || hash.high != statePageHashes[page].high)
+      pages.push_back(static_cast<u32>(page));
+    statePageHashes[page] = hash;
+  }
+}
+
+void RAM::AllocateCodePages() {
+  codePageCount = (ramSize + (1ULL << RAM_CODE_PAGE_SHIFT) - 1) >> RAM_CODE_PAGE_SHIFT;
+  codePages = std::make_unique<STRIP_UNIQUE_ARR(codePages)>(codePageCount);
+  // Page count changed, there's nothing to compare against anymore
+  statePageHashes.reset();
+}
+
+void RAM::QueueCodePage(u64 page) {
+  // The page is clean again until it gets compiled from
+  const u8 owners = codePages[page].exchange(0, std::memory_order_acq_rel);
+  for (u8 owner = 0; owner < RAM_CODE_PAGE_OWNERS; owner++) {
+    if (!(owners & (1 << owner)))
+      continue;
+    CodePageOwner &codeOwner = codePageOwners[owner];
+    std::lock_guard lock(codeOwner.lock);
+    codeOwner.dirtyPages.push_back(static_cast<u32>(page));
+    codeOwner.dirty.store(true, std::memory_order_release);
+  }
 }
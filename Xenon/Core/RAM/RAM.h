@@ -2,12 +2,37 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "Base/SystemDevice.h"
 
 #define RAM_START_ADDR 0
 
+// Granularity of the RAM mapping, pages are committed by the host on first touch.
+#define RAM_HOST_PAGE_SIZE 0x1000
+// Alignment used when the RAM is backed by huge pages.
+#define RAM_HUGE_PAGE_SIZE 0x200000
+
+// Page size used for JIT code tracking.
+#define RAM_CODE_PAGE_SHIFT 12
+// Amount of JIT instances that can own code pages, one per PPU.
+#define RAM_CODE_PAGE_OWNERS 3
+// Page size used for save states.
+#define RAM_STATE_PAGE_SHIFT 12
+#define RAM_STATE_PAGE_SIZE (1ULL << RAM_STATE_PAGE_SHIFT)
+
+//
+// Main memory.
+//
+// Backed by an anonymous host mapping that is reserved once and committed lazily, so pages the
+// guest never touches cost nothing. Reset releases the pages back to the host instead of filling
+// them, which makes them read as zero again. Host pointers returned by GetPointerToAddress and
+// GetPointerToRange stay valid until the RAM is destroyed or resized.
+//
 class RAM : public SystemDevice {
 public:
   RAM(const std::string &deviceName, u64 startAddress, std::string size,
@@ -20,10 +45,99 @@ public:
   void MemSet(u64 writeAddress, s32 data, u64 size) override;
 
   u8 *GetPointerToAddress(u32 address);
+  // Host pointer to [address, address + size), nullptr when the range doesn't fit in RAM.
+  // Meant for the MMU, CP and DMA engines, which access guest memory in place.
+  u8 *GetPointerToRange(u64 address, u64 size) {
+    const u64 offset = address - RAM_START_ADDR;
+    if (!ramData || address < RAM_START_ADDR || offset > ramSize || size > ramSize - offset)
+      return nullptr;
+    return ramData + offset;
+  }
   u64 GetSize() {
     return ramSize;
   }
+  // Whether the mapping is backed by huge pages (explicit or transparent).
+  bool UsesHugePages() const {
+    return hugePages;
+  }
+
+  //
+  // JIT code page tracking
+  //
+
+  // Marks the page containing address as holding code compiled by owner (the PPU id).
+  void MarkCodePage(u64 address, u8 owner);
+  // Must be called for every write to RAM that doesn't go trough Write/MemSet (host pointer
+  // accesses, DMA). Queues the code pages in [address, address + size) for invalidation.
+  void NotifyWrite(u64 address, u64 size) {
+    if (!codePagesTracked.load(std::memory_order_relaxed) || size == 0)
+      return;
+    const u64 firstPage = address >> RAM_CODE_PAGE_SHIFT;
+    const u64 lastPage = std::min((address + size - 1) >> RAM_CODE_PAGE_SHIFT, codePageCount - 1);
+    for (u64 page = firstPage; page <= lastPage; page++) {
+      if (codePages[page].load(std::memory_order_relaxed))
+        QueueCodePage(page);
+    }
+  }
+  // Same as NotifyWrite, from a host address returned by GetPointerToAddress.
+  void NotifyHostWrite(const u8 *hostAddress, u64 size) {
+    NotifyWrite(static_cast<u64>(hostAddress - ramData), size);
+  }
+  // Returns true when owner has written code pages waiting to be invalidated.
+  bool HasDirtyCodePages(u8 owner) const {
+    return codePageOwners[owner].dirty.load(std::memory_order_acquire);
+  }
+  // Owner bitmask of every code page, polled by JIT stores that write to host memory directly.
+  const std::atomic<u8> *GetCodePageMap() const {
+    return codePages.get();
+  }
+  // Flag polled by generated code, same as HasDirtyCodePages.
+  const std::atomic<bool> *GetDirtyCodePagesFlag(u8 owner) const {
+    return &codePageOwners[owner].dirty;
+  }
+  // Moves the written code pages of owner into pages.
+  void TakeDirtyCodePages(u8 owner, std::vector<u32> &pages);
+
+  //
+  // Save state page tracking
+  //
+
+  // 128 bit hash of a state page
+  struct StatePageHash {
+    u64 low = 0;
+    u64 high = 0;
+  };
+  // Fills pages with the state pages that changed since the last call, or all of them. Pages are
+  // compared by hash instead of tracking writes, as JIT and host pointer stores don't go trough RAM.
+  void CollectChangedStatePages(std::vector<u32> &pages, bool all);
 private:
+  // Maps ramSize bytes of zeroed, lazily committed memory.
+  bool Allocate();
+  // Unmaps the RAM.
+  void Release();
+  // Gives every page back to the host, they read as zero afterwards.
+  void Decommit();
+  // (Re)allocates the code page map for the current RAM size.
+  void AllocateCodePages();
+  // Clears a code page and queues it for invalidation on all of its owners.
+  void QueueCodePage(u64 page);
+
   u64 ramSize = 0;
-  std::unique_ptr<u8[]> ramData{};
+  // Size of the host mapping, ramSize rounded up to the page size used.
+  u64 mappedSize = 0;
+  u8 *ramData = nullptr;
+  bool hugePages = false;
+
+  // Bitmask of the owners with code on each page.
+  std::unique_ptr<std::atomic<u8>[]> codePages{};
+  u64 codePageCount = 0;
+  // Set once any page holds code, so writes are free while the JIT is unused.
+  std::atomic<bool> codePagesTracked = false;
+  // Hash of every state page when the last state was saved or loaded.
+  std::unique_ptr<StatePageHash[]> statePageHashes{};
+  struct CodePageOwner {
+    std::mutex lock{};
+    std::vector<u32> dirtyPages{};
+    std::atomic<bool> dirty = false;
+  } codePageOwners[RAM_CODE_PAGE_OWNERS];
 };
@@ -59,6 +59,7 @@ HostBridge::HostBridge(u64 ramSize) {
   hostBridgeConfigSpace.configSpaceHeader.BAR4 = 0xE2010000;
   hostBridgeConfigSpace.configSpaceHeader.BAR5 = 0xE2030000;
   biuRegs.ramSize = ramSize;
+  rebuildAddressDecoder();
 }
 
 HostBridge::~HostBridge() {
@@ -70,20 +71,24 @@ void HostBridge::RegisterXGPU(std::shared_ptr<Xe::Xenos::XGPU> xgpu) {
   std::lock_guard lck(mutex);
 
   xGPU = std::move(xgpu);
+  rebuildAddressDecoder();
 }
 
 void HostBridge::RegisterPCIBridge(std::shared_ptr<PCIBridge> bridge) {
   std::lock_guard lck(mutex);
 
   pciBridge = std::move(bridge);
+  rebuildAddressDecoder();
 }
 
 bool HostBridge::Read(u64 readAddress, u8 *data, u64 size) {
   MICROPROFILE_SCOPEI("[Xe::PCI]", "HostBridge::Read", MP_AUTO);
-  std::lock_guard lck(mutex);
+
+  const eHostBridgeTarget target = addressDecoder.Lookup(static_cast<u32>(readAddress));
 
   // Reading from host bridge registers?
-  if (isAddressMappedinBAR(static_cast<u32>(readAddress))) {
+  if (target == eHostBridgeTarget::HostBridge) {
+    std::lock_guard lck(mutex);
     switch (readAddress) {
     // HostBridge
     case 0xE0020000:
@@ -117,13 +122,13 @@ bool HostBridge::Read(u64 readAddress, u8 *data, u64 size) {
   }
 
   // Check if this address is in the PCI Bridge
-  if (xGPU->IsAddressMappedInBAR(static_cast<u32>(readAddress))) {
+  if (target == eHostBridgeTarget::XGPU) {
     xGPU->Read(readAddress, data, size);
     return true;
   }
 
   // Check if this address is in the PCI Bridge
-  if (pciBridge->IsAddressMappedinBAR(static_cast<u32>(readAddress))) {
+  if (target == eHostBridgeTarget::PCIBridge) {
     pciBridge->Read(readAddress, data, size);
     return true;
   }
@@ -134,7 +139,6 @@ bool HostBridge::Read(u64 readAddress, u8 *data, u64 size) {
 
 bool HostBridge::Write(u64 writeAddress, const u8 *data, u64 size) {
   MICROPROFILE_SCOPEI("[Xe::PCI]", "HostBridge::Write", MP_AUTO);
-  std::lock_guard lck(mutex);
 
   // If we are not UART, send it to log
   if (false) {
@@ -145,8 +149,11 @@ bool HostBridge::Write(u64 writeAddress, const u8 *data, u64 size) {
     LOG_DEBUG(HostBridge, "Address: 0x{:X} | Data({},0x{:X}): {}", writeAddress, size, size, ss.str());
   }
 
+  const eHostBridgeTarget target = addressDecoder.Lookup(static_cast<u32>(writeAddress));
+
   // Writing to host bridge registers?
-  if (isAddressMappedinBAR(static_cast<u32>(writeAddress))) {
+  if (target == eHostBridgeTarget::HostBridge) {
+    std::lock_guard lck(mutex);
     switch (writeAddress) {
     // HostBridge
     case 0xE0020000:
@@ -225,13 +232,13 @@ bool HostBridge::Write(u64 writeAddress, const u8 *data, u64 size) {
   }
 
   // Check if this address is mapped on the GPU
-  if (xGPU->IsAddressMappedInBAR(static_cast<u32>(writeAddress))) {
+  if (target == eHostBridgeTarget::XGPU) {
     xGPU->Write(writeAddress, data, size);
     return true;
   }
 
   // Check if this address is in the PCI Bridge
-  if (pciBridge->IsAddressMappedinBAR(static_cast<u32>(writeAddress))) {
+  if (target == eHostBridgeTarget::PCIBridge) {
     pciBridge->Write(writeAddress, data, size);
     return true;
   }
@@ -242,10 +249,12 @@ bool HostBridge::Write(u64 writeAddress, const u8 *data, u64 size) {
 
 bool HostBridge::MemSet(u64 writeAddress, s32 data, u64 size) {
   MICROPROFILE_SCOPEI("[Xe::PCI]", "HostBridge::MemSet", MP_AUTO);
-  std::lock_guard lck(mutex);
+
+  const eHostBridgeTarget target = addressDecoder.Lookup(static_cast<u32>(writeAddress));
 
   // Writing to host bridge registers?
-  if (isAddressMappedinBAR(static_cast<u32>(writeAddress))) {
+  if (target == eHostBridgeTarget::HostBridge) {
+    std::lock_guard lck(mutex);
     switch (writeAddress) {
     // HostBridge
     case 0xE0020000:
@@ -325,13 +334,13 @@ bool HostBridge::MemSet(u64 writeAddress, s32 data, u64 size) {
   }
 
   // Check if this address is mapped on the GPU
-  if (xGPU->IsAddressMappedInBAR(static_cast<u32>(writeAddress))) {
+  if (target == eHostBridgeTarget::XGPU) {
     xGPU->MemSet(writeAddress, data, size);
     return true;
   }
 
   // Check if this address is in the PCI Bridge
-  if (pciBridge->IsAddressMappedinBAR(static_cast<u32>(writeAddress))) {
+  if (target == eHostBridgeTarget::PCIBridge) {
     pciBridge->MemSet(writeAddress, data, size);
     return true;
   }
@@ -398,6 +407,8 @@ bool HostBridge::ConfigWrite(u64 writeAddress, const u8 *data, u64 size) {
                 writeAddress, tmp);
       break;
     }
+    // BAR's may have been (re)programmed
+    rebuildAddressDecoder();
     return true;
   }
 
@@ -406,17 +417,27 @@ bool HostBridge::ConfigWrite(u64 writeAddress, const u8 *data, u64 size) {
   return pciBridge->ConfigWrite(writeAddress, data, size);
 }
 
-bool HostBridge::isAddressMappedinBAR(u32 address) {
-  #define ADDRESS_BOUNDS_CHECK(a, b) (address >= a && address <= (a + b))
-
-  if (ADDRESS_BOUNDS_CHECK(hostBridgeConfigSpace.configSpaceHeader.BAR0, XGPU_DEVICE_SIZE) ||
-      ADDRESS_BOUNDS_CHECK(hostBridgeConfigSpace.configSpaceHeader.BAR1, XGPU_DEVICE_SIZE) ||
-      ADDRESS_BOUNDS_CHECK(hostBridgeConfigSpace.configSpaceHeader.BAR2, XGPU_DEVICE_SIZE) ||
-      ADDRESS_BOUNDS_CHECK(hostBridgeConfigSpace.configSpaceHeader.BAR3, XGPU_DEVICE_SIZE) ||
-      ADDRESS_BOUNDS_CHECK(hostBridgeConfigSpace.configSpaceHeader.BAR4, XGPU_DEVICE_SIZE) ||
-      ADDRESS_BOUNDS_CHECK(hostBridgeConfigSpace.configSpaceHeader.BAR5, XGPU_DEVICE_SIZE)) {
-    return true;
+void HostBridge::rebuildAddressDecoder() {
+  addressDecoder.Begin();
+  // Host Bridge registers take priority, then the GPU and then the PCI Bridge.
+  // BAR ranges on this bus are inclusive of their end address.
+  const u32 hostBridgeBARs[6] = {
+    hostBridgeConfigSpace.configSpaceHeader.BAR0, hostBridgeConfigSpace.configSpaceHeader.BAR1,
+    hostBridgeConfigSpace.configSpaceHeader.BAR2, hostBridgeConfigSpace.configSpaceHeader.BAR3,
+    hostBridgeConfigSpace.configSpaceHeader.BAR4, hostBridgeConfigSpace.configSpaceHeader.BAR5
+  };
+  for (const u32 bar : hostBridgeBARs) {
+    addressDecoder.Map(bar, XGPU_DEVICE_SIZE + 1, eHostBridgeTarget::HostBridge);
   }
-
-  return false;
+  if (xGPU.get()) {
+    for (const u32 bar : xGPU->GetBARs()) {
+      addressDecoder.Map(bar, XGPU_DEVICE_SIZE + 1, eHostBridgeTarget::XGPU);
+    }
+  }
+  if (pciBridge.get()) {
+    for (const u32 bar : pciBridge->GetBARs()) {
+      addressDecoder.Map(bar, PCI_BRIDGE_SIZE, eHostBridgeTarget::PCIBridge);
+    }
+  }
+  addressDecoder.Publish();
 }
@@ -4,6 +4,8 @@
 
 #include "PCIe.h"
 
+#include "Base/AddressDecoder.h"
+
 #include "Core/RootBus/HostBridge/PCIBridge/PCIBridge.h"
 
 #include "Core/XGPU/XGPU.h"
@@ -45,6 +47,14 @@ struct BIU_REGS {
   u32 REG_E1040078;
 };
 
+// Targets of the Host Bridge address decoder
+enum class eHostBridgeTarget : u8 {
+  None,
+  HostBridge,
+  XGPU,
+  PCIBridge
+};
+
 class HostBridge {
 public:
   HostBridge(u64 ramSize);
@@ -82,8 +92,12 @@ private:
   // Pointer to the registered PCI Bridge
   std::shared_ptr<PCIBridge> pciBridge{};
 
+  // Physical address to target lookup, rebuilt whenever a BAR is programmed
+  Base::AddressDecoder<eHostBridgeTarget> addressDecoder{};
+
   // Helpers
-  bool isAddressMappedinBAR(u32 address);
+  // Rebuilds the address decode table from the current BAR's of this bus
+  void rebuildAddressDecoder();
 
   HOSTBRIDGE_REGS hostBridgeRegs{};
   BIU_REGS biuRegs{};
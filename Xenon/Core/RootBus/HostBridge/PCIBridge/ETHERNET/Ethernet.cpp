@@ -350,3 +350,11 @@ void Xe::PCIDev::ETHERNET::ConfigWrite(u64 writeAddress, const u8 *data, u64 siz
 
   memcpy(&pciConfigSpace.data[static_cast<u8>(writeAddress)], &tmp, size);
 }
+
+void Xe::PCIDev::ETHERNET::DoState(StateStream &stream) {
+  PCIDevice::DoState(stream);
+  stream.Do(mdioRegisters);
+  stream.Do(ethPciState);
+  stream.Do(rxEnabled);
+  stream.Do(txEnabled);
+}
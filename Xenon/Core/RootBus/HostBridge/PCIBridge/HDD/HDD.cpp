@@ -270,6 +270,15 @@ void Xe::PCIDev::HDD::ConfigWrite(u64 writeAddress, const u8 *data, u64 size) {
   memcpy(&pciConfigSpace.data[static_cast<u8>(writeAddress)], &tmp, size);
 }
 
+void Xe::PCIDev::HDD::DoState(StateStream &stream) {
+  PCIDevice::DoState(stream);
+  stream.Do(ataDeviceState.ataReadState);
+  stream.Do(ataDeviceState.ataWriteState);
+  stream.Do(ataDeviceState.ataIdentifyData);
+  stream.DoVector(ataDeviceState.readBuffer);
+  stream.DoVector(ataDeviceState.writeBufferl);
+}
+
 void Xe::PCIDev::HDD::ataCopyIdentifyDeviceData() {
   if (!ataDeviceState.readBuffer.empty())
     LOG_ERROR(HDD, "Read buffer not empty!");
@@ -359,6 +359,7 @@ public:
   void MemSet(u64 writeAddress, s32 data, u64 size) override;
   void ConfigRead(u64 readAddress, u8* data, u64 size) override;
   void ConfigWrite(u64 writeAddress, const u8* data, u64 size) override;
+  void DoState(StateStream &stream) override;
 
 private:
   // PCI Bridge pointer. Used for Interrupts.
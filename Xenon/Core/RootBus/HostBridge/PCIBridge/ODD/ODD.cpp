@@ -160,7 +160,11 @@ void Xe::PCIDev::ODD::processSCSICommand() {
 void Xe::PCIDev::ODD::doDMA() {
   for (;;) {
     // Read the first entry of the table in memory
-    u8* DMAPointer = mainMemory->GetPointerToAddress(atapiState.atapiRegs.dmaTableOffsetReg + atapiState.dmaState.currentTableOffset);
+    u8* DMAPointer = mainMemory->GetPointerToRange(atapiState.atapiRegs.dmaTableOffsetReg + atapiState.dmaState.currentTableOffset, 8);
+    if (!DMAPointer) {
+      LOG_ERROR(ODD, "DMA: PRD table at 0x{:X} is outside of RAM", atapiState.atapiRegs.dmaTableOffsetReg);
+      return;
+    }
     // Each entry is 64 bit long
     memcpy(&atapiState.dmaState, DMAPointer, 8);
 
@@ -176,7 +180,11 @@ void Xe::PCIDev::ODD::doDMA() {
     // The address in memory to be written to/read from
     u32 bufferAddress = atapiState.dmaState.currentPRD.physAddress;
     // Buffer Pointer in main memory
-    u8 *bufferInMemory = mainMemory->GetPointerToAddress(bufferAddress);
+    u8 *bufferInMemory = mainMemory->GetPointerToRange(bufferAddress, size);
+    if (!bufferInMemory) {
+      LOG_ERROR(ODD, "DMA: Buffer at 0x{:X} (0x{:X} bytes) is outside of RAM", bufferAddress, size);
+      return;
+    }
 
     if (readOperation) {
       // Reading from us
@@ -186,6 +194,7 @@ void Xe::PCIDev::ODD::doDMA() {
       if (size == 0)
         return;
       memcpy(bufferInMemory, atapiState.dataReadBuffer.get(), size);
+      mainMemory->NotifyHostWrite(bufferInMemory, size);
       atapiState.dataReadBuffer.resize(size);
     } else {
       // Writing to us
@@ -690,3 +699,14 @@ void Xe::PCIDev::ODD::ConfigWrite(u64 writeAddress, const u8 *data, u64 size) {
   memcpy(&pciConfigSpace.data[static_cast<u8>(writeAddress)], &tmp, size);
   LOG_DEBUG(ODD, "ConfigWrite to reg 0x{:X}, data 0x{:X}", writeReg * 4, tmp);
 }
+
+void Xe::PCIDev::ODD::DoState(StateStream &stream) {
+  PCIDevice::DoState(stream);
+  stream.Do(atapiState.atapiRegs);
+  atapiState.dataReadBuffer.DoState(stream);
+  atapiState.dataWriteBuffer.DoState(stream);
+  stream.Do(atapiState.atapiInquiryData);
+  stream.Do(atapiState.atapiIdentifyData);
+  stream.Do(atapiState.scsiCBD);
+  stream.Do(atapiState.dmaState);
+}
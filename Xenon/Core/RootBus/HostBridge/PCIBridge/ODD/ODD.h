@@ -62,6 +62,23 @@ public:
     }
     return false;
   }
+  // Saves or restores the buffer contents and the transfer position
+  void DoState(StateStream &stream) {
+    u32 length = _data ? _size : 0;
+    u32 pointer = _data ? _pointer : 0;
+    stream.Do(length);
+    stream.Do(pointer);
+    if (stream.IsLoading()) {
+      if (stream.Failed())
+        return;
+      if (length)
+        init(length, false);
+      _size = length;
+      _pointer = pointer;
+    }
+    if (length)
+      stream.DoArray(_data.get(), length);
+  }
 private:
   std::unique_ptr<u8[]> _data;
   u32 _size;
@@ -499,6 +516,7 @@ public:
   void MemSet(u64 writeAddress, s32 data, u64 size) override;
   void ConfigRead(u64 readAddress, u8* data, u64 size) override;
   void ConfigWrite(u64 writeAddress, const u8* data, u64 size) override;
+  void DoState(StateStream &stream) override;
 
 private:
   // PCI Bridge pointer. Used for Interrupts.
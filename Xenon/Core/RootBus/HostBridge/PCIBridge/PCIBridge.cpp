@@ -1,5 +1,7 @@
 // Copyright 2025 Xenon Emulator Project. All rights reserved.
 
+#include <map>
+
 #include "Base/Logging/Log.h"
 #include "Base/Global.h"
 
@@ -253,18 +255,6 @@ void PCIBridge::CancelInterrupt(u8 prio) {
   }
 }
 
-bool PCIBridge::IsAddressMappedinBAR(u32 address) {
-  u32 bar0 = pciBridgeConfig.configSpaceHeader.BAR0;
-  u32 bar1 = pciBridgeConfig.configSpaceHeader.BAR1;
-
-  if ((address >= bar0 && address < (bar0 + PCI_BRIDGE_SIZE)) ||
-      (address >= bar1 && address < (bar1 + PCI_BRIDGE_SIZE))) {
-    return true;
-  }
-
-  return false;
-}
-
 void PCIBridge::AddPCIDevice(std::shared_ptr<PCIDevice> device) {
   if (!device.get()) {
     LOG_CRITICAL(PCIBridge, "Failed to attach a device!");
@@ -274,6 +264,25 @@ void PCIBridge::AddPCIDevice(std::shared_ptr<PCIDevice> device) {
   LOG_INFO(PCIBridge, "Attached: {}", device->GetDeviceName());
 
   connectedPCIDevices.insert({ device->GetDeviceName(), device });
+  rebuildAddressDecoder();
+}
+
+void PCIBridge::DoState(Xe::StateStream &stream) {
+  stream.DoMarker("PCIBridge");
+  stream.Do(pciBridgeConfig);
+  stream.Do(pciBridgeState);
+  stream.DoArray(pciBridgeConfigSpace, sizeof(pciBridgeConfigSpace));
+  // By name, the map order isn't stable
+  std::map<std::string, PCIDevice*> devices{};
+  for (auto &[name, device] : connectedPCIDevices)
+    devices.emplace(name, device.get());
+  for (auto &[name, device] : devices) {
+    stream.DoMarker(name.c_str());
+    device->DoState(stream);
+  }
+  // BARs may have moved
+  if (stream.IsLoading())
+    rebuildAddressDecoder();
 }
 
 void PCIBridge::ResetPCIDevice(std::shared_ptr<PCIDevice> device) {
@@ -288,6 +297,7 @@ void PCIBridge::ResetPCIDevice(std::shared_ptr<PCIDevice> device) {
     it->second.reset();
     connectedPCIDevices.erase(it);
     connectedPCIDevices.insert({ device->GetDeviceName(), device });
+    rebuildAddressDecoder();
   } else {
     LOG_CRITICAL(PCIBridge, "Failed to reset device! '{}' never existed.", it->first);
   }
@@ -351,12 +361,10 @@ bool PCIBridge::Read(u64 readAddress, u8 *data, u64 size) {
   }
 
   // Try writing to one of the attached devices.
-  for (auto &[name, dev] : connectedPCIDevices) {
-    if (dev->IsAddressMappedInBAR(static_cast<u32>(readAddress))) {
-      // Hit
-      dev->Read(readAddress, data, size);
-      return true;
-    }
+  if (PCIDevice *dev = addressDecoder.Lookup(static_cast<u32>(readAddress))) {
+    // Hit
+    dev->Read(readAddress, data, size);
+    return true;
   }
   memset(data, 0xFF, size);
   return false;
@@ -487,12 +495,10 @@ bool PCIBridge::Write(u64 writeAddress, const u8 *data, u64 size) {
   }
 
   // Try writing to one of the attached devices.
-  for (auto &[name, dev] : connectedPCIDevices) {
-    if (dev->IsAddressMappedInBAR(static_cast<u32>(writeAddress))) {
-      // Hit
-      dev->Write(writeAddress, data, size);
-      return true;
-    }
+  if (PCIDevice *dev = addressDecoder.Lookup(static_cast<u32>(writeAddress))) {
+    // Hit
+    dev->Write(writeAddress, data, size);
+    return true;
   }
   return false;
 }
@@ -622,12 +628,10 @@ bool PCIBridge::MemSet(u64 writeAddress, s32 data, u64 size) {
   }
 
   // Try writing to one of the attached devices
-  for (auto &[name, dev] : connectedPCIDevices) {
-    if (dev->IsAddressMappedInBAR(static_cast<u32>(writeAddress))) {
-      // Hit
-      dev->MemSet(writeAddress, data, size);
-      return true;
-    }
+  if (PCIDevice *dev = addressDecoder.Lookup(static_cast<u32>(writeAddress))) {
+    // Hit
+    dev->MemSet(writeAddress, data, size);
+    return true;
   }
   return false;
 }
@@ -769,6 +773,8 @@ bool PCIBridge::ConfigWrite(u64 writeAddress, const u8 *data, u64 size) {
       // Hit!
       LOG_TRACE(PCIBridge, "Config write to '{}+0x{:X}'", name, configAddr.regOffset);
       dev->ConfigWrite(writeAddress, data, size);
+      // BAR's may have been (re)programmed
+      rebuildAddressDecoder();
       return true;
     }
   }
@@ -776,3 +782,15 @@ bool PCIBridge::ConfigWrite(u64 writeAddress, const u8 *data, u64 size) {
   LOG_ERROR(PCIBridge, "Config write to unimplemented device '{}'", currentDevName);
   return false;
 }
+
+void PCIBridge::rebuildAddressDecoder() {
+  addressDecoder.Begin();
+  for (auto &[name, dev] : connectedPCIDevices) {
+    for (const u32 bar : dev->GetBARs()) {
+      if (!addressDecoder.Map(bar, dev->GetDeviceSize(), dev.get())) {
+        LOG_CRITICAL(PCIBridge, "Address decoder is full, unable to map {}", name);
+      }
+    }
+  }
+  addressDecoder.Publish();
+}
@@ -2,11 +2,13 @@
 
 #pragma once
 
+#include <array>
 #include <cstring>
 #include <unordered_map>
 
 #include "PCIDevice.h"
 
+#include "Base/AddressDecoder.h"
 #include "Core/RootBus/HostBridge/PCIe.h"
 #include "Core/XCPU/IIC/IIC.h"
 
@@ -84,9 +86,10 @@ public:
   PCIBridge();
   ~PCIBridge();
 
-  // Checks wheter the current address belongs to the PCI bridge via
-  // the BAR's
-  bool IsAddressMappedinBAR(u32 address);
+  // Returns the BAR's of the PCI bridge, each one maps PCI_BRIDGE_SIZE bytes
+  std::array<u32, 2> GetBARs() {
+    return { pciBridgeConfig.configSpaceHeader.BAR0, pciBridgeConfig.configSpaceHeader.BAR1 };
+  }
 
   void AddPCIDevice(std::shared_ptr<PCIDevice> device);
 
@@ -104,6 +107,9 @@ public:
   bool RouteInterrupt(u8 prio);
   void CancelInterrupt(u8 prio);
 
+  // Saves or restores the bridge and every attached device
+  void DoState(Xe::StateStream &stream);
+
 private:
   // IIC Pointer used for interrupts
   Xe::XCPU::IIC::XenonIIC *xenonIIC;
@@ -111,6 +117,10 @@ private:
   // Connected device pointers
   std::unordered_map<std::string, std::shared_ptr<PCIDevice>> connectedPCIDevices;
 
+  // Physical address to device lookup, rebuilt whenever a device is attached or a BAR is programmed
+  Base::AddressDecoder<PCIDevice*> addressDecoder{};
+  void rebuildAddressDecoder();
+
   // Current bridge config
   PCI_PCI_BRIDGE_CONFIG_SPACE pciBridgeConfig = {};
   PCI_BRIDGE_STATE pciBridgeState = {};
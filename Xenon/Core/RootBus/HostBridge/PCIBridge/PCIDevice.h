@@ -2,10 +2,12 @@
 
 #pragma once
 
+#include <array>
 #include <cstring>
 #include <string>
 
 #include "Core/RootBus/HostBridge/PCIe.h"
+#include "Core/SaveState.h"
 
 struct PCIDeviceInfo {
   std::string deviceName{};
@@ -25,8 +27,24 @@ public:
   virtual void ConfigRead(u64 readAddress, u8 *data, u64 size) {}
   virtual void ConfigWrite(u64 writeAddress, const u8 *data, u64 size) {}
 
+  // Saves or restores the device state. Devices with state besides config space extend this.
+  virtual void DoState(Xe::StateStream &stream) {
+    stream.Do(pciConfigSpace);
+    stream.DoArray(pciDevSizes, 6);
+  }
+
   std::string GetDeviceName() { return deviceInfo.deviceName; }
 
+  // Size of the region mapped by each BAR
+  u64 GetDeviceSize() { return deviceInfo.size; }
+
+  // Returns the BAR's currently programmed in config space
+  std::array<u32, 6> GetBARs() {
+    return { pciConfigSpace.configSpaceHeader.BAR0, pciConfigSpace.configSpaceHeader.BAR1,
+             pciConfigSpace.configSpaceHeader.BAR2, pciConfigSpace.configSpaceHeader.BAR3,
+             pciConfigSpace.configSpaceHeader.BAR4, pciConfigSpace.configSpaceHeader.BAR5 };
+  }
+
   // Checks wether a given address is mapped in the device's BAR's
   bool IsAddressMappedInBAR(u32 address) {
     u32 bar0 = pciConfigSpace.configSpaceHeader.BAR0;
@@ -4,6 +4,7 @@
 #include "Base/Global.h"
 #include "Base/Config.h"
 #include "Base/Thread.h"
+#include "Core/Scheduler.h"
 #include "Core/XCPU/Xenon.h"
 
 #include "SFCX.h"
@@ -243,14 +244,18 @@ Xe::PCIDev::SFCX::~SFCX() {
   // Clear NAND image data
   rawImageData.clear();
   // Terminate thread
-  sfcxThreadRunning = false;
+  sfcxWorker.Stop();
+  if (schedulerId)
+    XeMain::GetScheduler()->Unregister(schedulerId);
   if (sfcxThread.joinable())
     sfcxThread.join();
 }
 
 void Xe::PCIDev::SFCX::Start() {
+  // Take turns with the PPUs, commands then complete at a deterministic point
+  if (XeMain::GetScheduler()->IsDeterministic())
+    schedulerId = XeMain::GetScheduler()->Register("SFCX");
   // Enter SFCX Thread
-  sfcxThreadRunning = true;
   sfcxThread = std::thread(&Xe::PCIDev::SFCX::sfcxMainLoop, this);
 }
 
@@ -347,6 +352,8 @@ void Xe::PCIDev::SFCX::Write(u64 writeAddress, const u8 *data, u64 size) {
 
     // Set command register
     sfcxState.commandReg = command;
+    if (command != NO_CMD)
+      sfcxWorker.Notify();
     break;
   case SFCX_ADDRESS_REG:
     memcpy(&sfcxState.addressReg, data, size);
@@ -389,6 +396,8 @@ void Xe::PCIDev::SFCX::MemSet(u64 writeAddress, s32 data, u64 size) {
     break;
   case SFCX_COMMAND_REG:
     memset(&sfcxState.commandReg, data, size);
+    if (sfcxState.commandReg != NO_CMD)
+      sfcxWorker.Notify();
     break;
   case SFCX_ADDRESS_REG:
     memset(&sfcxState.addressReg, data, size);
@@ -473,45 +482,69 @@ void Xe::PCIDev::SFCX::ConfigWrite(u64 writeAddress, const u8 *data, u64 size) {
   memcpy(&pciConfigSpace.data[offset], &tmp, size);
 }
 
+void Xe::PCIDev::SFCX::DoState(StateStream &stream) {
+  std::lock_guard lck(mutex);
+  PCIDevice::DoState(stream);
+  stream.Do(sfcxState);
+  // The image gets written to trough DMA and block erases
+  stream.DoVector(rawImageData);
+  if (stream.IsLoading())
+    sfcxWorker.Notify();
+}
+
 void Xe::PCIDev::SFCX::sfcxMainLoop() {
   Base::SetCurrentThreadName("[Xe] SFCX");
   // Config register should be initialized by now
-  while (XeRunning && sfcxThreadRunning) {
-    // Did we got a command?
-    if (sfcxState.commandReg != NO_CMD) {
-      // Check the command reg to see what command was issued
-      std::lock_guard lck(mutex);
-      switch (sfcxState.commandReg) {
-      case PHY_PAGE_TO_BUF:
-        sfcxReadPageFromNAND(true);
-        break;
-      case LOG_PAGE_TO_BUF:
-        sfcxReadPageFromNAND(false);
-        break;
-      case DMA_PHY_TO_RAM:
-        sfcxDoDMAfromNAND();
-        break;
-      case DMA_RAM_TO_PHY:
-        sfcxDoDMAtoNAND();
-        break;
-      case BLOCK_ERASE:
-        sfcxEraseBlock();
-        break;
-      default:
-        LOG_ERROR(SFCX, "Unrecognized command was issued. 0x{:X}. Issuing interrupt if enabled.", sfcxState.commandReg);
-        break;
-      }
-      if (sfcxState.configReg & CONFIG_INT_EN) {
-        parentBus->RouteInterrupt(PRIO_SFCX);
-        sfcxState.statusReg |= STATUS_INT_CP;
-      }
-
-      // Clear Command Register
-      sfcxState.commandReg = NO_CMD;
+  if (schedulerId) {
+    Xe::Scheduler *scheduler = XeMain::GetScheduler();
+    while (XeRunning && !sfcxWorker.IsStopped() && scheduler->BeginSlice(schedulerId)) {
+      sfcxProcessCommand();
+      scheduler->EndSlice(schedulerId);
+    }
+    scheduler->Unregister(schedulerId);
+    return;
+  }
+  // Sleeps until a command is written, instead of spinning on the command register
+  while (XeRunning && sfcxWorker.Wait([this] { return sfcxState.commandReg != NO_CMD; })) {
+    sfcxProcessCommand();
+  }
+}
 
-      // Set Status to Ready again
-      sfcxState.statusReg &= ~STATUS_BUSY;
+void Xe::PCIDev::SFCX::sfcxProcessCommand() {
+  // Did we got a command?
+  if (sfcxState.commandReg != NO_CMD) {
+    // Check the command reg to see what command was issued
+    std::lock_guard lck(mutex);
+    switch (sfcxState.commandReg) {
+    case PHY_PAGE_TO_BUF:
+      sfcxReadPageFromNAND(true);
+      break;
+    case LOG_PAGE_TO_BUF:
+      sfcxReadPageFromNAND(false);
+      break;
+    case DMA_PHY_TO_RAM:
+      sfcxDoDMAfromNAND();
+      break;
+    case DMA_RAM_TO_PHY:
+      sfcxDoDMAtoNAND();
+      break;
+    case BLOCK_ERASE:
+      sfcxEraseBlock();
+      break;
+    default:
+      LOG_ERROR(SFCX, "Unrecognized command was issued. 0x{:X}. Issuing interrupt if enabled.", sfcxState.commandReg);
+      break;
+    }
+    if (sfcxState.configReg & CONFIG_INT_EN) {
+      parentBus->RouteInterrupt(PRIO_SFCX);
+      sfcxState.statusReg |= STATUS_INT_CP;
     }
+
+    // Clear Command Register
+    sfcxState.commandReg = NO_CMD;
+
+    // Set Status to Ready again
+    sfcxState.statusReg &= ~STATUS_BUSY;
   }
 }
 
@@ -597,8 +630,13 @@ void Xe::PCIDev::SFCX::sfcxDoDMAfromNAND() {
   u32 dmaPagesNum = ((sfcxState.configReg & CONFIG_DMA_LEN) >> 6) + 1;
 
   // Get RAM pointers for both buffers
-  u8* dataPhysAddrPtr = mainMemory->GetPointerToAddress(sfcxState.dataPhysAddrReg);
-  u8* sparePhysAddrPtr = mainMemory->GetPointerToAddress(sfcxState.sparePhysAddrReg);
+  u8* dataPhysAddrPtr = mainMemory->GetPointerToRange(sfcxState.dataPhysAddrReg, dmaPagesNum * sfcxState.pageSize);
+  u8* sparePhysAddrPtr = mainMemory->GetPointerToRange(sfcxState.sparePhysAddrReg, dmaPagesNum * sfcxState.spareSize);
+  if (!dataPhysAddrPtr || !sparePhysAddrPtr) {
+    LOG_ERROR(SFCX, "DMA_PHY_TO_RAM: Data (0x{:X}) or spare (0x{:X}) buffer is outside of RAM",
+      sfcxState.dataPhysAddrReg, sfcxState.sparePhysAddrReg);
+    return;
+  }
 
 #ifdef SFCX_DEBUG
   LOG_DEBUG(SFCX, "DMA_PHY_TO_RAM: Reading 0x{:X} pages. Logical Address: 0x{:X}, Physical Address: 0x{:X}, Data DMA address: 0x{:X}, Spare DMA address: 0x{:X}",
@@ -621,6 +659,8 @@ void Xe::PCIDev::SFCX::sfcxDoDMAfromNAND() {
     // On DMA, physical pages are split into Page data and Spare Data, and stored at different locations in memory
     memcpy(dataPhysAddrPtr, &sfcxState.pageBuffer, sfcxState.pageSize);
     memcpy(sparePhysAddrPtr, &sfcxState.pageBuffer[sfcxState.pageSize], sfcxState.spareSize);
+    mainMemory->NotifyHostWrite(dataPhysAddrPtr, sfcxState.pageSize);
+    mainMemory->NotifyHostWrite(sparePhysAddrPtr, sfcxState.spareSize);
 
     // Increase buffer pointers
     dataPhysAddrPtr += sfcxState.pageSize;   // Logical page size
@@ -647,8 +687,13 @@ void Xe::PCIDev::SFCX::sfcxDoDMAtoNAND() {
   u32 dmaPagesNum = ((sfcxState.configReg & CONFIG_DMA_LEN) >> 6) + 1;
 
   // Get RAM pointers for both buffers
-  u8 *dataPhysAddrPtr = mainMemory->GetPointerToAddress(sfcxState.dataPhysAddrReg);
-  u8 *sparePhysAddrPtr = mainMemory->GetPointerToAddress(sfcxState.sparePhysAddrReg);
+  u8 *dataPhysAddrPtr = mainMemory->GetPointerToRange(sfcxState.dataPhysAddrReg, dmaPagesNum * sfcxState.pageSize);
+  u8 *sparePhysAddrPtr = mainMemory->GetPointerToRange(sfcxState.sparePhysAddrReg, dmaPagesNum * sfcxState.spareSize);
+  if (!dataPhysAddrPtr || !sparePhysAddrPtr) {
+    LOG_ERROR(SFCX, "DMA_RAM_TO_PHY: Data (0x{:X}) or spare (0x{:X}) buffer is outside of RAM",
+      sfcxState.dataPhysAddrReg, sfcxState.sparePhysAddrReg);
+    return;
+  }
 
 #ifdef SFCX_DEBUG
   LOG_DEBUG(SFCX, "DMA_RAM_TO_PHY: Writing 0x{:X} pages. Logical Address: 0x{:X}, Physical Address: 0x{:X}, Data DMA address: 0x{:X}, Spare DMA address: 0x{:X}",
@@ -6,6 +6,8 @@
 #include <fstream>
 #include <filesystem>
 
+#include "Base/DeviceWorker.h"
+
 #include "Core/RAM/RAM.h"
 #include "Core/RootBus/HostBridge/PCIBridge/PCIBridge.h"
 #include "Core/RootBus/HostBridge/PCIBridge/PCIDevice.h"
@@ -193,17 +195,22 @@ public:
   // Config space read/write.
   void ConfigRead(u64 readAddress, u8* data, u64 size) override;
   void ConfigWrite(u64 writeAddress, const u8* data, u64 size) override;
+  void DoState(StateStream &stream) override;
 
   u64 initSkip1 = 0, initSkip2 = 0;
 private:
   // Secure Flash Controller for Xbox main loop.
   void sfcxMainLoop();
+  // Runs the command in the command register, if any.
+  void sfcxProcessCommand();
   // Magic check
   bool checkMagic();
   // Thread object
   std::thread sfcxThread;
-  // Thread running
-  volatile bool sfcxThreadRunning = false;
+  // Parks the thread until a command is issued
+  Base::DeviceWorker sfcxWorker;
+  // Turn id in the deterministic scheduler, 0 when running free
+  u32 schedulerId = 0;
   // SFCX State
   SFCX_STATE sfcxState{};
   // I/O File stream.
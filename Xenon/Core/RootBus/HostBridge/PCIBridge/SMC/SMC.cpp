@@ -8,6 +8,8 @@
 #include "Base/Hash.h"
 #include "Base/Thread.h"
 
+#include "Core/Scheduler.h"
+
 #include "HANA_State.h"
 #include "SMC_Config.h"
 
@@ -103,6 +105,10 @@ Xe::PCIDev::SMC::SMC(const std::string &deviceName, u64 size, PCIBridge *parentP
   }
   smcCoreState.uartHandle->uartPresent = true;
 
+  // Take turns with the PPUs, the clock then runs on guest time
+  if (XeMain::GetScheduler()->IsDeterministic())
+    schedulerId = XeMain::GetScheduler()->Register("SMC");
+
   // Enter main execution thread.
   smcThread = std::thread(&SMC::smcMainThread, this);
 }
@@ -110,7 +116,9 @@ Xe::PCIDev::SMC::SMC(const std::string &deviceName, u64 size, PCIBridge *parentP
 // Class Destructor.
 Xe::PCIDev::SMC::~SMC() {
   LOG_INFO(SMC, "Shutting SMC down...");
-  smcThreadRunning = false;
+  smcWorker.Stop();
+  if (schedulerId)
+    XeMain::GetScheduler()->Unregister(schedulerId);
   if (smcThread.joinable())
     smcThread.join();
   smcCoreState.uartHandle->Shutdown();
@@ -209,9 +217,12 @@ void Xe::PCIDev::SMC::Write(u64 writeAddress, const u8 *data, u64 size) {
     break;
   case CLCK_INT_ENABLED_REG: // Clock INT Enabled Register
     memcpy(&smcPCIState.clockIntEnabledReg, data, size);
+    // Clock interrupt deadline changes
+    smcWorker.Notify();
     break;
   case CLCK_INT_STATUS_REG: // Clock INT Status Register
     memcpy(&smcPCIState.clockIntStatusReg, data, size);
+    smcWorker.Notify();
     break;
   case FIFO_IN_STATUS_REG: // FIFO In Status Register
     memcpy(&smcPCIState.fifoInStatusReg, data, size);
@@ -219,6 +230,8 @@ void Xe::PCIDev::SMC::Write(u64 writeAddress, const u8 *data, u64 size) {
       // Reset our input buffer and buffer pointer.
       memset(smcCoreState.fifoDataBuffer, 0, sizeof(smcCoreState.fifoDataBuffer));
       smcCoreState.fifoBufferPos = 0;
+    } else if (smcPCIState.fifoInStatusReg == FIFO_STATUS_BUSY) { // Message sent, process it
+      smcWorker.Notify();
     }
     break;
   case FIFO_OUT_STATUS_REG: // FIFO Out Status Register
@@ -268,9 +281,11 @@ void Xe::PCIDev::SMC::MemSet(u64 writeAddress, s32 data, u64 size) {
     break;
   case CLCK_INT_ENABLED_REG: // Clock INT Enabled Register
     memset(&smcPCIState.clockIntEnabledReg, data, size);
+    smcWorker.Notify();
     break;
   case CLCK_INT_STATUS_REG: // Clock INT Status Register
     memset(&smcPCIState.clockIntStatusReg, data, size);
+    smcWorker.Notify();
     break;
   case FIFO_IN_STATUS_REG: // FIFO In Status Register
     memset(&smcPCIState.fifoInStatusReg, data, size);
@@ -278,6 +293,8 @@ void Xe::PCIDev::SMC::MemSet(u64 writeAddress, s32 data, u64 size) {
       // Reset our input buffer and buffer pointer.
       memset(&smcCoreState.fifoDataBuffer, 0, 16);
       smcCoreState.fifoBufferPos = 0;
+    } else if (smcPCIState.fifoInStatusReg == FIFO_STATUS_BUSY) {
+      smcWorker.Notify();
     }
     break;
   case FIFO_OUT_STATUS_REG: // FIFO Out Status Register
@@ -333,6 +350,20 @@ void Xe::PCIDev::SMC::ConfigWrite(u64 writeAddress, const u8 *data, u64 size) {
   memcpy(&pciConfigSpace.data[static_cast<u8>(writeAddress)], &tmp, size);
 }
 
+void Xe::PCIDev::SMC::DoState(StateStream &stream) {
+  std::lock_guard lck(mutex);
+  PCIDevice::DoState(stream);
+  stream.Do(smcPCIState);
+  // UART settings belong to the host, they're kept
+  stream.Do(smcCoreState.currTrayState);
+  stream.Do(smcCoreState.currPowerOnReason);
+  stream.Do(smcCoreState.currAVPackType);
+  stream.DoArray(smcCoreState.fifoDataBuffer, sizeof(smcCoreState.fifoDataBuffer));
+  stream.Do(smcCoreState.fifoBufferPos);
+  if (stream.IsLoading())
+    smcWorker.Notify();
+}
+
 // Setups the UART Communication at a given configuration.
 void Xe::PCIDev::SMC::setupUART(u32 uartConfig) {
   LOG_INFO(UART, "Initializing...");
@@ -367,9 +398,16 @@ void Xe::PCIDev::SMC::smcMainThread() {
   // receive a message.
   smcPCIState.fifoInStatusReg = FIFO_STATUS_READY;
 
+  Xe::Scheduler *scheduler = XeMain::GetScheduler();
+  // Host time, or the virtual clock when scheduled deterministically
+  const auto clockNow = [this, scheduler] {
+    if (schedulerId)
+      return std::chrono::steady_clock::time_point(scheduler->GetTimeNs());
+    return std::chrono::steady_clock::now();
+  };
+
   // Timer for measuring elapsed time since last Clock Interrupt.
-  std::chrono::steady_clock::time_point timerStart =
-      std::chrono::steady_clock::now();
+  std::chrono::steady_clock::time_point timerStart = clockNow();
   
   // Fat consoles vs Slims have different initial values for the HANA/ANA
   u32 *hanaState = HANA_State;
@@ -407,8 +445,11 @@ void Xe::PCIDev::SMC::smcMainThread() {
     reinterpret_cast<u8*>(hanaState)[0xFE] = 0x23;
   } break;
   }
-  while (smcThreadRunning) {
+  while (!smcWorker.IsStopped()) {
     MICROPROFILE_SCOPEI("[Xe::PCI]", "SMC::Loop", MP_AUTO);
+    // Wait for our turn
+    if (schedulerId && !scheduler->BeginSlice(schedulerId))
+      break;
     // The System Management Controller (SMC) does the following:
     // * Communicates over a FIFO Queue with the kernel to execute commands and
     // provide system info.
@@ -675,8 +716,10 @@ void Xe::PCIDev::SMC::smcMainThread() {
     }
 
     // Measure elapsed time.
-    std::chrono::steady_clock::time_point timerNow =
-      std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point timerNow = clockNow();
+
+    // Next time the loop has to run on its own, no deadline while the clock interrupt can't fire
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
 
     // Check for SMC Clock interrupt register.
     // 
@@ -688,13 +731,26 @@ void Xe::PCIDev::SMC::smcMainThread() {
         // delay.
         if (timerNow >= timerStart + 500ms) {
           // Update internal timer.
-          timerStart = std::chrono::steady_clock::now();
+          timerStart = clockNow();
           mutex.lock();
           smcPCIState.clockIntStatusReg = CLCK_INT_TAKEN;
           pciBridge->RouteInterrupt(PRIO_CLOCK);
           mutex.unlock();
+        } else {
+          deadline = timerStart + 500ms;
         }
       }
     }
+
+    // Scheduled, the next turn comes right after the others had theirs
+    if (schedulerId) {
+      scheduler->EndSlice(schedulerId);
+      continue;
+    }
+
+    // Sleep until then, or until a register write needs handling
+    smcWorker.WaitUntil(deadline, [this] { return smcPCIState.fifoInStatusReg == FIFO_STATUS_BUSY; });
   }
+  if (schedulerId)
+    scheduler->Unregister(schedulerId);
 }
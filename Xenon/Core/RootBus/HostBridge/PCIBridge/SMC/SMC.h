@@ -8,6 +8,7 @@
 #include <condition_variable>
 #include <thread>
 
+#include "Base/DeviceWorker.h"
 #include "Base/Global.h"
 
 #include "Core/RootBus/HostBridge/PCIBridge/PCIBridge.h"
@@ -246,6 +247,7 @@ public:
   void MemSet(u64 writeAddress, s32 data, u64 size) override;
   void ConfigRead(u64 readAddress, u8* data, u64 size) override;
   void ConfigWrite(u64 writeAddress, const u8* data, u64 size) override;
+  void DoState(StateStream &stream) override;
 
   void SetPowerOnReason(const SMC_PWR_REASON &reason) {
     smcCoreState.currPowerOnReason = reason;
@@ -269,8 +271,11 @@ private:
   // SMC Thread object
   std::thread smcThread;
 
-  // SMC Thread running state
-  volatile bool smcThreadRunning = true;
+  // Parks the thread until a FIFO command arrives or the next clock interrupt is due
+  Base::DeviceWorker smcWorker;
+
+  // Turn id in the deterministic scheduler, 0 when running free
+  u32 schedulerId = 0;
 
   // UART Thread object
   std::thread uartThread;
@@ -35,6 +35,7 @@ void RootBus::AddDevice(std::shared_ptr<SystemDevice> device) {
   deviceCount++;
   LOG_INFO(RootBus, "Device attached: {}", device->GetDeviceName());
   connectedDevices.insert({ device->GetDeviceName(), device });
+  RebuildAddressDecoder();
 }
 
 void RootBus::ResetDevice(std::shared_ptr<SystemDevice> device) {
@@ -50,6 +51,7 @@ void RootBus::ResetDevice(std::shared_ptr<SystemDevice> device) {
     it->second.reset();
     connectedDevices.erase(it);
     connectedDevices.insert({ device->GetDeviceName(), device });
+    RebuildAddressDecoder();
   } else {
     LOG_CRITICAL(RootBus, "Failed to reset device! '{}' never existed.", it->first);
   }
@@ -64,13 +66,10 @@ bool RootBus::Read(u64 readAddress, u8 *data, u64 size, bool soc) {
     return true;
   }
 
-  for (auto &[name, dev] : connectedDevices) {
-    if (readAddress >= dev->GetStartAddress() &&
-        readAddress <= dev->GetEndAddress()) {
-      // Hit
-      dev->Read(readAddress, data, size);
-      return true;
-    }
+  if (SystemDevice *dev = addressDecoder.Lookup(readAddress)) {
+    // Hit
+    dev->Read(readAddress, data, size);
+    return true;
   }
 
   // Check on the other busses
@@ -93,13 +92,10 @@ bool RootBus::Read(u64 readAddress, u8 *data, u64 size, bool soc) {
 
 bool RootBus::MemSet(u64 writeAddress, s32 data, u64 size) {
   MICROPROFILE_SCOPEI("[Xe::PCI]", "RootBus::MemSet", MP_AUTO);
-  for (auto &[name, dev] : connectedDevices) {
-    if (writeAddress >= dev->GetStartAddress() &&
-        writeAddress <= dev->GetEndAddress()) {
-      // Hit
-      dev->MemSet(writeAddress, data, size);
-      return true;
-    }
+  if (SystemDevice *dev = addressDecoder.Lookup(writeAddress)) {
+    // Hit
+    dev->MemSet(writeAddress, data, size);
+    return true;
   }
 
   // Check on the other busses
@@ -126,13 +122,10 @@ bool RootBus::Write(u64 writeAddress, const u8 *data, u64 size, bool soc) {
     return true;
   }
 
-  for (auto &[name, dev] : connectedDevices) {
-    if (writeAddress >= dev->GetStartAddress() &&
-        writeAddress <= dev->GetEndAddress()) {
-      // Hit
-      dev->Write(writeAddress, data, size);
-      return true;
-    }
+  if (SystemDevice *dev = addressDecoder.Lookup(writeAddress)) {
+    // Hit
+    dev->Write(writeAddress, data, size);
+    return true;
   }
 
   // Check on the other busses
@@ -147,6 +140,17 @@ bool RootBus::Write(u64 writeAddress, const u8 *data, u64 size, bool soc) {
   return false;
 }
 
+void RootBus::RebuildAddressDecoder() {
+  addressDecoder.Begin();
+  for (auto &[name, dev] : connectedDevices) {
+    // Device end addresses are inclusive
+    if (!addressDecoder.Map(dev->GetStartAddress(), dev->GetEndAddress() - dev->GetStartAddress() + 1, dev.get())) {
+      LOG_CRITICAL(RootBus, "Address decoder is full, unable to map {}", name);
+    }
+  }
+  addressDecoder.Publish();
+}
+
 //
 // Configuration R/W
 //
@@ -4,6 +4,7 @@
 
 #include <unordered_map>
 
+#include "Base/AddressDecoder.h"
 #include "Base/SystemDevice.h"
 #include "Core/RootBus/HostBridge/HostBridge.h"
 
@@ -31,9 +32,14 @@ public:
   bool ConfigWrite(u64 writeAddress, const u8 *data, u64 size);
 
 private:
+  // Rebuilds the address decode table from the connected devices
+  void RebuildAddressDecoder();
+
   std::shared_ptr<HostBridge> hostBridge{};
   u32 deviceCount;
   std::unordered_map<std::string, std::shared_ptr<SystemDevice>> connectedDevices;
+  // Physical address to device lookup, rebuilt whenever a device is attached/reset
+  Base::AddressDecoder<SystemDevice*> addressDecoder{};
 
   std::unique_ptr<u8> biuData{ std::make_unique<STRIP_UNIQUE(biuData)>(0x10000) };
 };
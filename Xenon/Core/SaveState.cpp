@@ -0,0 +1,481 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#include <chrono>
+#include <fstream>
+#include <random>
+
+#include "Base/Logging/Log.h"
+
+#include "Core/RAM/RAM.h"
+#include "Core/RootBus/HostBridge/PCIBridge/PCIBridge.h"
+#include "Core/XCPU/Xenon.h"
+#include "Core/XGPU/XGPU.h"
+#include "Core/XeMain.h"
+
+#include "SaveState.h"
+
+namespace Xe {
+
+//
+// StateStream
+//
+
+void StateStream::DoBytes(void *data, u64 size) {
+  if (size == 0)
+    return;
+  if (IsSaving()) {
+    const u8 *bytes = reinterpret_cast<const u8*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+    return;
+  }
+  if (failed || size > buffer.size() - offset) {
+    failed = true;
+    return;
+  }
+  memcpy(data, buffer.data() + offset, size);
+  offset += size;
+}
+
+void StateStream::DoString(std::string &value) {
+  u32 length = static_cast<u32>(value.size());
+  Do(length);
+  if (IsLoading()) {
+    if (failed || length > buffer.size() - offset) {
+      failed = true;
+      return;
+    }
+    value.assign(reinterpret_cast<const char*>(buffer.data() + offset), length);
+    offset += length;
+    return;
+  }
+  DoBytes(value.data(), length);
+}
+
+void StateStream::DoMarker(const char *name) {
+  std::string marker = name;
+  std::string read = marker;
+  DoString(read);
+  if (IsLoading() && !failed && read != marker) {
+    LOG_ERROR(System, "SaveState: Expected section '{}', found '{}'", marker, read);
+    failed = true;
+  }
+}
+
+//
+// Run length encoding
+//
+
+// Control bytes below 0x80 are followed by (c + 1) literal bytes, the rest by a byte repeated
+// (c - 0x80 + 3) times. Good enough for RAM, which is mostly zeroes and fill patterns.
+static void RLEEncode(const u8 *data, u64 size, std::vector<u8> &out) {
+  u64 pos = 0;
+  u64 literalStart = 0;
+  auto flushLiterals = [&](u64 end) {
+    while (literalStart < end) {
+      const u64 count = std::min<u64>(end - literalStart, 0x80);
+      out.push_back(static_cast<u8>(count - 1));
+      out.insert(out.end(), data + literalStart, data + literalStart + count);
+      literalStart += count;
+    }
+  };
+  while (pos < size) {
+    u64 run = 1;
+    while (pos + run < size && run < 0x82 && data[pos + run] == data[pos])
+      run++;
+    if (run >= 3) {
+      flushLiterals(pos);
+      out.push_back(static_cast<u8>(0x80 + run - 3));
+      out.push_back(data[pos]);
+      pos += run;
+      literalStart = pos;
+    } else {
+      pos += run;
+    }
+  }
+  flushLiterals(size);
+}
+
+static bool RLEDecode(const u8 *data, u64 size, u8 *out, u64 outSize) {
+  u64 pos = 0;
+  u64 outPos = 0;
+  while (pos < size) {
+    const u8 control = data[pos++];
+    if (control < 0x80) {
+      const u64 count = control + 1ULL;
+      if (count > size - pos || count > outSize - outPos)
+        return false;
+      memcpy(out + outPos, data + pos, count);
+      pos += count;
+      outPos += count;
+    } else {
+      const u64 count = control - 0x80ULL + 3;
+      if (pos == size || count > outSize - outPos)
+        return false;
+      memset(out + outPos, data[pos++], count);
+      outPos += count;
+    }
+  }
+  return outPos == outSize;
+}
+
+//
+// State files
+//
+
+enum class ePageEncoding : u8 {
+  Zero,
+  RLE,
+  Raw
+};
+
+struct StateFileHeader {
+  u32 magic = XE_STATE_MAGIC;
+  u32 version = XE_STATE_VERSION;
+  // Random id, so a parent that got overwritten is noticed
+  u64 stateId = 0;
+  // Zero for full states
+  u64 parentId = 0;
+  u64 ramSize = 0;
+  // Amount of parents
+  u32 chainDepth = 0;
+  u32 pageCount = 0;
+  // Device state size, before and after encoding
+  u64 deviceSize = 0;
+  u64 deviceEncodedSize = 0;
+};
+
+// A state file read into memory
+struct StateFile {
+  StateFileHeader header = {};
+  std::string parentPath = {};
+  std::vector<u8> deviceState = {};
+  // Page records, parsed while applying
+  std::vector<u8> pageData = {};
+};
+
+// State the next incremental save is based on, the last one saved or loaded
+static u64 baselineId = 0;
+static u32 baselineDepth = 0;
+static std::filesystem::path baselinePath = {};
+
+static bool ReadStateFile(const std::filesystem::path &path, StateFile &file) {
+  std::ifstream stream{ path, std::ios::binary | std::ios::ate };
+  if (!stream.is_open()) {
+    LOG_ERROR(System, "SaveState: Unable to open {}", path.string());
+    return false;
+  }
+  const u64 fileSize = static_cast<u64>(stream.tellg());
+  stream.seekg(0);
+  std::vector<u8> data(fileSize);
+  stream.read(reinterpret_cast<char*>(data.data()), fileSize);
+  if (!stream) {
+    LOG_ERROR(System, "SaveState: Unable to read {}", path.string());
+    return false;
+  }
+
+  StateStream reader{ std::move(data) };
+  reader.Do(file.header);
+  if (reader.Failed() || file.header.magic != XE_STATE_MAGIC) {
+    LOG_ERROR(System, "SaveState: {} isn't a save state", path.string());
+    return false;
+  }
+  if (file.header.version != XE_STATE_VERSION) {
+    LOG_ERROR(System, "SaveState: {} is version {}, expected {}", path.string(), file.header.version, XE_STATE_VERSION);
+    return false;
+  }
+  reader.DoString(file.parentPath);
+  // Sizes are checked before allocating anything, a single control byte expands to 130 bytes at most
+  if (reader.Failed() || file.header.deviceEncodedSize > fileSize || file.header.deviceSize > file.header.deviceEncodedSize * 130) {
+    LOG_ERROR(System, "SaveState: {} is truncated or corrupted", path.string());
+    return false;
+  }
+  std::vector<u8> encoded(file.header.deviceEncodedSize);
+  reader.DoArray(encoded.data(), encoded.size());
+  file.deviceState.resize(file.header.deviceSize);
+  if (reader.Failed() || !RLEDecode(encoded.data(), encoded.size(), file.deviceState.data(), file.deviceState.size())) {
+    LOG_ERROR(System, "SaveState: {} is truncated or corrupted", path.string());
+    return false;
+  }
+  // Whatever is left are the pages
+  const u64 headerSize = sizeof(StateFileHeader) + sizeof(u32) + file.parentPath.size() + encoded.size();
+  std::vector<u8> &buffer = reader.GetBuffer();
+  file.pageData.assign(buffer.begin() + headerSize, buffer.end());
+  return true;
+}
+
+// Copies the pages of file that aren't in filled yet into RAM. Without ram they're only decoded,
+// to check the file before anything is touched.
+static bool ApplyStatePages(const StateFile &file, RAM *ram, std::vector<bool> &filled) {
+  std::vector<u8> scratch(ram ? 0 : RAM_STATE_PAGE_SIZE);
+  const u8 *data = file.pageData.data();
+  const u64 size = file.pageData.size();
+  u64 pos = 0;
+  for (u32 i = 0; i != file.header.pageCount; i++) {
+    u32 page = 0;
+    ePageEncoding encoding = ePageEncoding::Zero;
+    if (sizeof(page) + sizeof(encoding) > size - pos)
+      return false;
+    memcpy(&page, data + pos, sizeof(page));
+    pos += sizeof(page);
+    memcpy(&encoding, data + pos, sizeof(encoding));
+    pos += sizeof(encoding);
+    u32 encodedSize = 0;
+    if (encoding != ePageEncoding::Zero) {
+      if (sizeof(encodedSize) > size - pos)
+        return false;
+      memcpy(&encodedSize, data + pos, sizeof(encodedSize));
+      pos += sizeof(encodedSize);
+      if (encodedSize > size - pos)
+        return false;
+    }
+    if (page >= filled.size())
+      return false;
+    const u8 *pageData = data + pos;
+    pos += encodedSize;
+    // A newer state already has this page
+    if (filled[page])
+      continue;
+    filled[page] = true;
+
+    // RAM was decommitted before, zero pages are already there
+    u8 *hostPage = ram ? ram->GetPointerToRange(RAM_START_ADDR + (static_cast<u64>(page) << RAM_STATE_PAGE_SHIFT), RAM_STATE_PAGE_SIZE) :
+      scratch.data();
+    switch (encoding) {
+    case ePageEncoding::Zero:
+      break;
+    case ePageEncoding::RLE:
+      if (!RLEDecode(pageData, encodedSize, hostPage, RAM_STATE_PAGE_SIZE))
+        return false;
+      break;
+    case ePageEncoding::Raw:
+      if (encodedSize != RAM_STATE_PAGE_SIZE)
+        return false;
+      memcpy(hostPage, pageData, RAM_STATE_PAGE_SIZE);
+      break;
+    default:
+      return false;
+    }
+  }
+  return true;
+}
+
+// Runs DoState on every component
+static void DoSystemState(StateStream &stream) {
+  XeMain::GetCPU()->DoState(stream);
+  XeMain::pciBridge->DoState(stream);
+  XeMain::xenos->DoState(stream);
+  stream.DoMarker("End");
+}
+
+// Halts the PPUs until it goes out of scope, unless they were already halted
+class ScopedSystemPause {
+public:
+  ScopedSystemPause() {
+    Xenon *cpu = XeMain::GetCPU();
+    wasHalted = cpu->IsHalted();
+    if (!wasHalted)
+      cpu->Halt();
+    parked = cpu->WaitForParked(std::chrono::milliseconds(2000));
+  }
+  ~ScopedSystemPause() {
+    if (!wasHalted)
+      XeMain::GetCPU()->Continue();
+  }
+  // The system is in no state to run, leaves the PPUs halted
+  void KeepHalted() { wasHalted = true; }
+  bool parked = false;
+private:
+  bool wasHalted = false;
+};
+
+bool SaveSystemState(const std::filesystem::path &path, bool incremental) {
+  if (!XeMain::CPUStarted || !XeMain::GetCPU() || !XeMain::ram || !XeMain::xenos || !XeMain::pciBridge) {
+    LOG_ERROR(System, "SaveState: The system isn't running");
+    return false;
+  }
+  ScopedSystemPause pause{};
+  if (!pause.parked) {
+    LOG_ERROR(System, "SaveState: Timed out waiting for the PPUs to stop");
+    return false;
+  }
+  RAM *ram = XeMain::ram.get();
+
+  // Falls back to a full state when there's nothing to base it on
+  if (incremental && (baselineId == 0 || baselineDepth + 1 >= XE_STATE_MAX_CHAIN || !std::filesystem::exists(baselinePath)))
+    incremental = false;
+
+  StateFile file = {};
+  file.header.stateId = std::random_device{}() | (static_cast<u64>(std::chrono::steady_clock::now().time_since_epoch().count()) << 32);
+  file.header.ramSize = ram->GetSize();
+  if (incremental) {
+    file.header.parentId = baselineId;
+    file.header.chainDepth = baselineDepth + 1;
+    file.parentPath = std::filesystem::absolute(baselinePath).string();
+  }
+
+  // Device state
+  StateStream stream{};
+  DoSystemState(stream);
+  std::vector<u8> &deviceState = stream.GetBuffer();
+  std::vector<u8> deviceEncoded = {};
+  RLEEncode(deviceState.data(), deviceState.size(), deviceEncoded);
+  file.header.deviceSize = deviceState.size();
+  file.header.deviceEncodedSize = deviceEncoded.size();
+
+  // RAM pages
+  std::vector<u32> pages = {};
+  ram->CollectChangedStatePages(pages, !incremental);
+  file.header.pageCount = static_cast<u32>(pages.size());
+  std::vector<u8> encodedPage = {};
+  for (u32 page : pages) {
+    const u8 *hostPage = ram->GetPointerToRange(RAM_START_ADDR + (static_cast<u64>(page) << RAM_STATE_PAGE_SHIFT), RAM_STATE_PAGE_SIZE);
+    ePageEncoding encoding = ePageEncoding::Zero;
+    for (u64 i = 0; i != RAM_STATE_PAGE_SIZE; i++) {
+      if (hostPage[i]) {
+        encoding = ePageEncoding::RLE;
+        break;
+      }
+    }
+    file.pageData.insert(file.pageData.end(), reinterpret_cast<const u8*>(&page), reinterpret_cast<const u8*>(&page) + sizeof(page));
+    if (encoding == ePageEncoding::Zero) {
+      file.pageData.push_back(static_cast<u8>(encoding));
+      continue;
+    }
+    encodedPage.clear();
+    RLEEncode(hostPage, RAM_STATE_PAGE_SIZE, encodedPage);
+    if (encodedPage.size() >= RAM_STATE_PAGE_SIZE) {
+      encoding = ePageEncoding::Raw;
+      encodedPage.assign(hostPage, hostPage + RAM_STATE_PAGE_SIZE);
+    }
+    const u32 encodedSize = static_cast<u32>(encodedPage.size());
+    file.pageData.push_back(static_cast<u8>(encoding));
+    file.pageData.insert(file.pageData.end(), reinterpret_cast<const u8*>(&encodedSize), reinterpret_cast<const u8*>(&encodedSize) + sizeof(encodedSize));
+    file.pageData.insert(file.pageData.end(), encodedPage.begin(), encodedPage.end());
+  }
+
+  // Header, parent path, device state, pages
+  StateStream writer{};
+  writer.Do(file.header);
+  writer.DoString(file.parentPath);
+  writer.DoArray(deviceEncoded.data(), deviceEncoded.size());
+  writer.DoArray(file.pageData.data(), file.pageData.size());
+  try {
+    if (path.has_parent_path())
+      std::filesystem::create_directories(path.parent_path());
+    std::ofstream out{ path, std::ios::binary | std::ios::trunc };
+    out.write(reinterpret_cast<const char*>(writer.GetBuffer().data()), writer.GetBuffer().size());
+    if (!out) {
+      LOG_ERROR(System, "SaveState: Unable to write {}", path.string());
+      return false;
+    }
+  }
+  catch (const std::exception &ex) {
+    LOG_ERROR(System, "SaveState: Exception trying to write {}. {}", path.string(), ex.what());
+    return false;
+  }
+
+  baselineId = file.header.stateId;
+  baselineDepth = file.header.chainDepth;
+  baselinePath = path;
+  LOG_INFO(System, "SaveState: Saved {} ({} pages, {} bytes{})", path.string(), pages.size(), writer.GetBuffer().size(),
+    incremental ? ", incremental" : "");
+  return true;
+}
+
+bool LoadSystemState(const std::filesystem::path &path) {
+  if (!XeMain::CPUStarted || !XeMain::GetCPU() || !XeMain::ram || !XeMain::xenos || !XeMain::pciBridge) {
+    LOG_ERROR(System, "SaveState: The system isn't running");
+    return false;
+  }
+  RAM *ram = XeMain::ram.get();
+
+  // Read the whole chain first, so nothing is touched if any part of it is missing
+  std::vector<StateFile> chain = {};
+  std::filesystem::path currentPath = path;
+  while (true) {
+    StateFile &file = chain.emplace_back();
+    if (!ReadStateFile(currentPath, file))
+      return false;
+    if (file.header.ramSize != ram->GetSize()) {
+      LOG_ERROR(System, "SaveState: {} was saved with 0x{:X} bytes of RAM, current is 0x{:X}", currentPath.string(),
+        file.header.ramSize, ram->GetSize());
+      return false;
+    }
+    if (chain.size() > 1 && file.header.stateId != chain[chain.size() - 2].header.parentId) {
+      LOG_ERROR(System, "SaveState: {} changed since {} was saved on top of it", currentPath.string(), path.string());
+      return false;
+    }
+    if (file.header.parentId == 0)
+      break;
+    if (chain.size() >= XE_STATE_MAX_CHAIN) {
+      LOG_ERROR(System, "SaveState: {} has too many parents", path.string());
+      return false;
+    }
+    currentPath = file.parentPath;
+  }
+
+  // Newest first, each page comes from the latest state that has it. Every page is decoded once
+  // before RAM is cleared, so a corrupted one leaves the running system as it was.
+  const u64 pageCount = ram->GetSize() >> RAM_STATE_PAGE_SHIFT;
+  std::vector<bool> filled(pageCount);
+  for (const StateFile &file : chain) {
+    if (!ApplyStatePages(file, nullptr, filled)) {
+      LOG_ERROR(System, "SaveState: Pages in {} are corrupted", path.string());
+      return false;
+    }
+  }
+
+  ScopedSystemPause pause{};
+  if (!pause.parked) {
+    LOG_ERROR(System, "SaveState: Timed out waiting for the PPUs to stop");
+    return false;
+  }
+
+  // DoState loads straight into the devices, so the device state is tried first and the current one
+  // put back right after. It's kept aside to restore if anything fails later on.
+  StateStream current{};
+  DoSystemState(current);
+  std::vector<u8> deviceState = chain.front().deviceState;
+  StateStream trial{ std::move(deviceState) };
+  DoSystemState(trial);
+  StateStream rollback{ std::move(current.GetBuffer()) };
+  DoSystemState(rollback);
+  if (rollback.Failed()) {
+    LOG_ERROR(System, "SaveState: Unable to restore the device state, the system is left halted");
+    pause.KeepHalted();
+    return false;
+  }
+  if (trial.Failed()) {
+    LOG_ERROR(System, "SaveState: Device state in {} doesn't match this build", path.string());
+    return false;
+  }
+
+  // Everything checked out. Reset also drops anything compiled or decoded from the old contents.
+  ram->Reset();
+  filled.assign(pageCount, false);
+  for (const StateFile &file : chain) {
+    if (!ApplyStatePages(file, ram, filled)) {
+      LOG_ERROR(System, "SaveState: Pages in {} are corrupted, the system is left halted", path.string());
+      pause.KeepHalted();
+      return false;
+    }
+  }
+  StateStream stream{ std::move(chain.front().deviceState) };
+  DoSystemState(stream);
+  if (stream.Failed()) {
+    LOG_ERROR(System, "SaveState: Device state in {} doesn't match this build, the system is left halted", path.string());
+    pause.KeepHalted();
+    return false;
+  }
+
+  // Next incremental save goes on top of this one
+  std::vector<u32> pages = {};
+  ram->CollectChangedStatePages(pages, true);
+  baselineId = chain.front().header.stateId;
+  baselineDepth = chain.front().header.chainDepth;
+  baselinePath = path;
+  LOG_INFO(System, "SaveState: Loaded {} ({} files)", path.string(), chain.size());
+  return true;
+}
+
+} // namespace Xe
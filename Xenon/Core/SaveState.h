@@ -0,0 +1,123 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#pragma once
+
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "Base/Types.h"
+
+//
+// Save states.
+//
+// A save state holds the whole machine: PPU registers, the Xenon context (SRAM, SoC blocks, IIC),
+// the PCI bridge and its devices, the Xenos registers and CP ring pointers, and RAM. Components
+// serialize themselves trough a DoState(StateStream&) method, the same method is used for saving
+// and loading so both sides can't drift apart.
+//
+// Files are written in two parts: the device state, run length encoded, and the RAM pages. Only
+// the pages that changed since the previous save or load are written when saving incrementally,
+// the rest are taken from that state (the parent) on load, recursively. Pages that are all zero
+// only take a page index.
+//
+
+// 'XEST'
+#define XE_STATE_MAGIC 0x54534558
+// Bumped whenever any DoState changes its layout
+#define XE_STATE_VERSION 1
+// Maximum length of a chain of incremental states
+#define XE_STATE_MAX_CHAIN 64
+
+namespace Xe {
+
+class StateStream {
+public:
+  enum class eMode : u8 {
+    Save,
+    Load
+  };
+  // Stream to save into
+  StateStream() : mode(eMode::Save) {}
+  // Stream to load from data
+  StateStream(std::vector<u8> &&data) : mode(eMode::Load), buffer(std::move(data)) {}
+
+  bool IsSaving() const { return mode == eMode::Save; }
+  bool IsLoading() const { return mode == eMode::Load; }
+  // Set once a load ran out of data or a marker didn't match, everything after is ignored
+  bool Failed() const { return failed; }
+  std::vector<u8> &GetBuffer() { return buffer; }
+
+  void DoBytes(void *data, u64 size);
+  template <typename T>
+  void Do(T &value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only plain data can be copied as is");
+    DoBytes(&value, sizeof(T));
+  }
+  template <typename T>
+  void DoArray(T *values, u64 count) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only plain data can be copied as is");
+    DoBytes(values, sizeof(T) * count);
+  }
+  template <typename T>
+  void DoVector(std::vector<T> &values) {
+    u64 count = values.size();
+    Do(count);
+    if (IsLoading())
+      values.resize(HasRoomFor(count, sizeof(T)) ? count : 0);
+    DoArray(values.data(), values.size());
+  }
+  void DoString(std::string &value);
+  template <typename K, typename V>
+  void DoMap(std::unordered_map<K, V> &values) {
+    u64 count = values.size();
+    Do(count);
+    if (IsLoading()) {
+      values.clear();
+      if (!HasRoomFor(count, sizeof(K) + sizeof(V)))
+        return;
+      for (u64 i = 0; i != count && !Failed(); i++) {
+        K key{};
+        V value{};
+        Do(key);
+        Do(value);
+        values.emplace(key, value);
+      }
+      return;
+    }
+    // Sorted, so the same state always gives the same bytes
+    std::map<K, V> sorted{ values.begin(), values.end() };
+    for (auto &[key, value] : sorted) {
+      K keyCopy = key;
+      Do(keyCopy);
+      Do(value);
+    }
+  }
+  // Writes a tag, or checks it's the same one when loading. Catches layout mismatches early.
+  void DoMarker(const char *name);
+private:
+  // Whether count elements of elementSize bytes are left to load, fails the stream if not. Checked
+  // before allocating, so a corrupted count can't ask for more memory than the state has.
+  bool HasRoomFor(u64 count, u64 elementSize) {
+    if (failed || count > (buffer.size() - offset) / elementSize)
+      failed = true;
+    return !failed;
+  }
+
+  eMode mode = eMode::Save;
+  std::vector<u8> buffer = {};
+  u64 offset = 0;
+  bool failed = false;
+};
+
+// Snapshots the system to path. With incremental set, only RAM pages changed since the last save
+// or load are written and path depends on that state.
+bool SaveSystemState(const std::filesystem::path &path, bool incremental);
+// Restores the system from path, following its parent states if it's incremental.
+bool LoadSystemState(const std::filesystem::path &path);
+
+} // namespace Xe
@@ -0,0 +1,111 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#include <algorithm>
+
+#include "Scheduler.h"
+
+#include "Base/Logging/Log.h"
+
+void Xe::Scheduler::Configure(eSchedulerMode newMode, u32 newQuantum) {
+  std::lock_guard lock(mutex);
+  mode = newMode;
+  quantum = newQuantum ? newQuantum : 1;
+  if (IsDeterministic()) {
+    LOG_INFO(System, "Deterministic scheduling, {} instructions per quantum", quantum);
+  }
+}
+
+u32 Xe::Scheduler::Register(const std::string &name) {
+  std::lock_guard lock(mutex);
+  std::unique_ptr<Participant> &participant = participants.emplace_back(std::make_unique<Participant>());
+  participant->id = nextId++;
+  participant->name = name;
+  LOG_DEBUG(System, "Scheduler: {} registered with id {}", name, participant->id);
+  // First one in gets the turn
+  if (participants.size() == 1) {
+    turn = 0;
+  }
+  return participant->id;
+}
+
+void Xe::Scheduler::Unregister(u32 id) {
+  std::lock_guard lock(mutex);
+  const s32 index = FindParticipant(id);
+  if (index < 0)
+    return;
+  // Wake it up, BeginSlice sees it's gone
+  participants[index]->cv.notify_all();
+  participants.erase(participants.begin() + index);
+  if (participants.empty()) {
+    turn = 0;
+    return;
+  }
+  if (static_cast<u32>(index) < turn) {
+    turn--;
+  } else if (static_cast<u32>(index) == turn) {
+    // The turn moves on to whoever took its place
+    if (turn >= participants.size()) {
+      turn = 0;
+      time += roundTicks;
+      roundTicks = 0;
+    }
+    participants[turn]->cv.notify_one();
+  }
+}
+
+bool Xe::Scheduler::BeginSlice(u32 id) {
+  std::unique_lock lock(mutex);
+  s32 index = FindParticipant(id);
+  while (index >= 0 && static_cast<u32>(index) != turn) {
+    participants[index]->cv.wait(lock);
+    index = FindParticipant(id);
+  }
+  return index >= 0;
+}
+
+void Xe::Scheduler::EndSlice(u32 id) {
+  std::lock_guard lock(mutex);
+  const s32 index = FindParticipant(id);
+  // Not our turn (unregistered mid slice), nothing to pass
+  if (index < 0 || static_cast<u32>(index) != turn)
+    return;
+  PassTurn();
+}
+
+bool Xe::Scheduler::Yield(u32 id) {
+  EndSlice(id);
+  return BeginSlice(id);
+}
+
+void Xe::Scheduler::AdvanceTime(u64 ticks) {
+  std::lock_guard lock(mutex);
+  roundTicks = std::max(roundTicks, ticks);
+}
+
+u64 Xe::Scheduler::GetTime() {
+  std::lock_guard lock(mutex);
+  return time;
+}
+
+std::chrono::nanoseconds Xe::Scheduler::GetTimeNs() {
+  return std::chrono::nanoseconds(GetTime() * (1000000000ULL / XE_TIMEBASE_FREQUENCY));
+}
+
+s32 Xe::Scheduler::FindParticipant(u32 id) const {
+  for (size_t i = 0; i != participants.size(); i++) {
+    if (participants[i]->id == id)
+      return static_cast<s32>(i);
+  }
+  return -1;
+}
+
+void Xe::Scheduler::PassTurn() {
+  turn++;
+  if (turn >= participants.size()) {
+    // Everyone had a turn, the round is over
+    turn = 0;
+    time += roundTicks;
+    roundTicks = 0;
+  }
+  participants[turn]->cv.notify_one();
+}
@@ -0,0 +1,90 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Base/Types.h"
+
+//
+// Execution scheduler.
+//
+// In Relaxed mode (the default) PPUs and devices run free on their own host threads, as fast as
+// they can, and the time base advances by the CPI measured on the host.
+//
+// In Deterministic mode every participant (PPUs, CP, SFCX, SMC) still has its own host thread,
+// but only one of them runs at a time. The turn is passed around in registration order, PPUs run
+// a fixed quantum of instructions per turn and devices do whatever work is pending. Guest time
+// comes from a virtual clock instead of the host one, so two runs of the same image behave the
+// same way regardless of host load.
+//
+
+// Time base frequency, used to convert the virtual clock to host time units
+#define XE_TIMEBASE_FREQUENCY 50000000ULL
+
+namespace Xe {
+
+enum class eSchedulerMode : u8 {
+  Relaxed,
+  Deterministic
+};
+
+class Scheduler {
+public:
+  // Sets the mode and PPU quantum, must be done before anything registers.
+  void Configure(eSchedulerMode newMode, u32 newQuantum);
+
+  bool IsDeterministic() const { return mode == eSchedulerMode::Deterministic; }
+  // Instructions each hardware thread runs per turn
+  u32 GetQuantum() const { return quantum; }
+
+  // Adds a participant at the end of the turn order. Returns its id.
+  u32 Register(const std::string &name);
+  // Removes a participant, waking it up if it's waiting for its turn. Safe to call more than once.
+  void Unregister(u32 id);
+
+  // Blocks until it's the participant's turn. Returns false once it was unregistered.
+  bool BeginSlice(u32 id);
+  // Passes the turn to the next participant.
+  void EndSlice(u32 id);
+  // Gives the turn away and waits for the next one, for participants waiting on someone else.
+  bool Yield(u32 id);
+
+  // Reports guest time spent in the current turn, the clock advances by the longest one per round.
+  void AdvanceTime(u64 ticks);
+  // Virtual clock, in time base ticks
+  u64 GetTime();
+  // Virtual clock, in nanoseconds
+  std::chrono::nanoseconds GetTimeNs();
+
+private:
+  struct Participant {
+    u32 id = 0;
+    std::string name = {};
+    // Signaled when the turn reaches this participant
+    std::condition_variable cv = {};
+  };
+  // Index of a registered participant, -1 if there's none
+  s32 FindParticipant(u32 id) const;
+  // Moves the turn to the next participant, ends the round when wrapping around
+  void PassTurn();
+
+  eSchedulerMode mode = eSchedulerMode::Relaxed;
+  u32 quantum = 0x1000;
+  std::mutex mutex;
+  // Participants in turn order
+  std::vector<std::unique_ptr<Participant>> participants = {};
+  // Index of the participant whose turn it is
+  u32 turn = 0;
+  u32 nextId = 1;
+  // Virtual clock and the time spent in the current round
+  u64 time = 0;
+  u64 roundTicks = 0;
+};
+
+} // namespace Xe
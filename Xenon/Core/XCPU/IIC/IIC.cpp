@@ -5,6 +5,7 @@
 #include "Base/Logging/Log.h"
 #include "Base/Assert.h"
 #include "Base/Global.h"
+#include "Core/SaveState.h"
 
 #include "IIC.h"
 
@@ -51,6 +52,7 @@ void Xe::XCPU::IIC::XenonIIC::writeInterrupt(u64 intAddress, const u8 *data, u64
     break;
   case Xe::XCPU::IIC::CPU_CURRENT_TSK_PRI:
     iicState.ppeIntCtrlBlck[ppeIntCtrlBlckID].REG_CPU_CURRENT_TSK_PRI = bsIntData;
+    updatePendingMask(ppeIntCtrlBlckID);
     break;
   case Xe::XCPU::IIC::CPU_IPI_DISPATCH_0:
     iicState.ppeIntCtrlBlck[ppeIntCtrlBlckID].REG_CPU_IPI_DISPATCH_0 = bsIntData;
@@ -84,6 +86,7 @@ void Xe::XCPU::IIC::XenonIIC::writeInterrupt(u64 intAddress, const u8 *data, u64
       interrupts.erase(interrupts.begin() + intIdx);
 
       iicState.ppeIntCtrlBlck[ppeIntCtrlBlckID].intSignaled = false;
+      updatePendingMask(ppeIntCtrlBlckID);
     }
     break;
   case Xe::XCPU::IIC::EOI_SET_CPU_CURRENT_TSK_PRI:
@@ -110,6 +113,7 @@ void Xe::XCPU::IIC::XenonIIC::writeInterrupt(u64 intAddress, const u8 *data, u64
 
     // Set new Interrupt priority
     iicState.ppeIntCtrlBlck[ppeIntCtrlBlckID].REG_CPU_CURRENT_TSK_PRI = bsIntData;
+    updatePendingMask(ppeIntCtrlBlckID);
     break;
   case Xe::XCPU::IIC::INT_MCACK:
     iicState.ppeIntCtrlBlck[ppeIntCtrlBlckID].REG_INT_MCACK = bsIntData;
@@ -176,14 +180,20 @@ void Xe::XCPU::IIC::XenonIIC::readInterrupt(u64 intAddress, u8 *data, u64 size)
 }
 
 bool Xe::XCPU::IIC::XenonIIC::checkExtInterrupt(u8 ppuID) {
-  MICROPROFILE_SCOPEI("[Xe::IIC]", "CheckExternalInterrupt", MP_AUTO);
-  std::scoped_lock lk(mutex);
-
   if (ppuID >= 6) {
     LOG_ERROR(Xenon_IIC, "Invalid PPU ID in checkExtInterrupt: {}", ppuID);
     return false;
   }
 
+  // Called after every instruction, nothing to signal is by far the common case, so check without
+  // taking the lock. A stale zero only delays the interrupt until the next check.
+  if (iicState.ppeIntCtrlBlck[ppuID].pendingMask.load(std::memory_order_relaxed) == 0) {
+    return false;
+  }
+
+  MICROPROFILE_SCOPEI("[Xe::IIC]", "CheckExternalInterrupt", MP_AUTO);
+  std::scoped_lock lk(mutex);
+
   // Check for some interrupt that was already signaled
   if (iicState.ppeIntCtrlBlck[ppuID].intSignaled) {
     return false;
@@ -208,6 +218,7 @@ bool Xe::XCPU::IIC::XenonIIC::checkExtInterrupt(u8 ppuID) {
     LOG_DEBUG(Xenon_IIC, "Signaling interrupt for thread 0x{:X} ", ppuID);
 #endif // IIC_DEBUG
     iicState.ppeIntCtrlBlck[ppuID].intSignaled = true;
+    updatePendingMask(ppuID);
     return true;
   }
   else {
@@ -234,6 +245,7 @@ void Xe::XCPU::IIC::XenonIIC::genInterrupt(u8 interruptType, u8 cpusToInterrupt)
 
       // Store the interrupt in the interrupt queue
       iicState.ppeIntCtrlBlck[ppuID].interrupts.push_back(newInt);
+      updatePendingMask(ppuID);
     }
     cpusToInterrupt = cpusToInterrupt >> 1;
   }
@@ -261,6 +273,7 @@ void Xe::XCPU::IIC::XenonIIC::cancelInterrupt(u8 interruptType, u8 cpusInterrupt
         }
         if (found) {
           iicState.ppeIntCtrlBlck[ppuID].interrupts.erase(iicState.ppeIntCtrlBlck[ppuID].interrupts.begin() + intIdx);
+          updatePendingMask(ppuID);
         }
       }
       cpusInterrupted = cpusInterrupted >> 1;
@@ -268,6 +281,40 @@ void Xe::XCPU::IIC::XenonIIC::cancelInterrupt(u8 interruptType, u8 cpusInterrupt
   }
 }
 
+void Xe::XCPU::IIC::XenonIIC::DoState(StateStream &stream) {
+  std::lock_guard lock(mutex);
+  stream.DoMarker("IIC");
+  for (u8 ppuID = 0; ppuID < 6; ppuID++) {
+    PPE_INT_CTRL_BLCK &ctrlBlck = iicState.ppeIntCtrlBlck[ppuID];
+    stream.Do(ctrlBlck.REG_CPU_WHOAMI);
+    stream.Do(ctrlBlck.REG_CPU_CURRENT_TSK_PRI);
+    stream.Do(ctrlBlck.REG_CPU_IPI_DISPATCH_0);
+    stream.Do(ctrlBlck.REG_ACK);
+    stream.Do(ctrlBlck.REG_ACK_SET_CPU_CURRENT_TSK_PRI);
+    stream.Do(ctrlBlck.REG_EOI);
+    stream.Do(ctrlBlck.REG_EOI_SET_CPU_CURRENT_TSK_PRI);
+    stream.Do(ctrlBlck.REG_INT_MCACK);
+    stream.DoVector(ctrlBlck.interrupts);
+    stream.Do(ctrlBlck.intSignaled);
+    if (stream.IsLoading())
+      updatePendingMask(ppuID);
+  }
+}
+
+void Xe::XCPU::IIC::XenonIIC::updatePendingMask(u8 ppuID) {
+  PPE_INT_CTRL_BLCK &ctrlBlck = iicState.ppeIntCtrlBlck[ppuID];
+  u32 mask = 0;
+  // Nothing else gets signaled until the signaled interrupt is EOI'd
+  if (!ctrlBlck.intSignaled) {
+    for (const auto &interrupt : ctrlBlck.interrupts) {
+      if (interrupt.interrupt >= ctrlBlck.REG_CPU_CURRENT_TSK_PRI) {
+        mask |= XE_IIC_PRIO_BIT(interrupt.interrupt);
+      }
+    }
+  }
+  ctrlBlck.pendingMask.store(mask, std::memory_order_relaxed);
+}
+
 struct IRQ_DATA {
   u8 irq = 0;
   std::string_view name = {};
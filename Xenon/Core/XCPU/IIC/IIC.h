@@ -2,10 +2,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <queue>
 #include <mutex>
 
 namespace Xe {
+class StateStream;
 namespace XCPU {
 namespace IIC {
 
@@ -40,6 +42,9 @@ namespace IIC {
 #define PRIO_IPI_1 0x78
 #define PRIO_NONE 0x7C
 
+// Priorities are multiples of 4 in 0x00-0x7C, so each one gets a bit in a u32
+#define XE_IIC_PRIO_BIT(prio) (1U << (((prio) >> 2) & 0x1F))
+
 enum XE_IIC_CPU_REG {
   CPU_WHOAMI = 0x0,
   CPU_CURRENT_TSK_PRI = 0x8,
@@ -74,6 +79,9 @@ struct PPE_INT_CTRL_BLCK {
   std::vector<Xe_Int> interrupts;
   // Stores whether an interrupt was already signaled to the target thread or not
   bool intSignaled = false;
+  // One XE_IIC_PRIO_BIT per pending interrupt that can be signaled right now, that is, at or above
+  // the current task priority while nothing is signaled. Lets checkExtInterrupt skip the lock.
+  std::atomic<u32> pendingMask = 0;
 };
 
 struct IIC_State {
@@ -89,9 +97,13 @@ public:
   bool checkExtInterrupt(u8 ppuID);
   void genInterrupt(u8 interruptType, u8 cpusToInterrupt);
   void cancelInterrupt(u8 interruptType, u8 cpusInterrupted);
+  // Saves or restores the interrupt control blocks
+  void DoState(StateStream &stream);
 private:
   IIC_State iicState;
   std::recursive_mutex mutex;
+  // Recomputes the pending mask of a thread, must be called with the mutex held
+  void updatePendingMask(u8 ppuID);
   // Returns the name of the input interrupt ID
   std::string getIntName(u8 intID);
 };
@@ -3,6 +3,300 @@
 #include "JITEmitter_Helpers.h"
 
 #if defined(ARCH_X86) || defined(ARCH_X86_64)
+
+//
+// Utilities
+//
+
+// Carry into the low bit of an add
+enum class eJITCarryIn : u8 {
+  Zero, // x + y
+  One,  // x + y + 1
+  CA    // x + y + XER[CA]
+};
+
+// Condition register logical operations
+enum class eJITCROp : u8 {
+  And,
+  AndC,
+  Eqv,
+  Nand,
+  Nor,
+  Or,
+  OrC,
+  Xor
+};
+
+// Writes the result of an instruction to a GPR and records CR0 for record forms.
+static void J_SetResult(JITBlockBuilder *b, u32 reg, x86::Gp value, bool rc) {
+  COMP->mov(GPRRegOut(reg), value);
+  if (rc)
+    J_RecordCR0(b, value);
+}
+
+// Returns a new register holding ~value.
+static x86::Gp J_Not(JITBlockBuilder *b, x86::Gp value) {
+  x86::Gp result = newGP64();
+  COMP->mov(result, value);
+  COMP->not_(result);
+  return result;
+}
+
+// Returns a new register holding a constant.
+static x86::Gp J_Const(JITBlockBuilder *b, u64 value) {
+  x86::Gp result = newGP64();
+  COMP->mov(result, value);
+  return result;
+}
+
+// Picks the 64 bit or 32 bit mode version of a flag (byte registers) depending on MSR[SF].
+static x86::Gp J_SelectByMode(JITBlockBuilder *b, x86::Gp flag64, x86::Gp flag32) {
+  x86::Gp mode = b->regs.DataMode();
+  x86::Gp result = newGP32();
+  x86::Gp tmp = newGP32();
+  COMP->movzx(result, flag64.r8());
+  COMP->movzx(tmp, flag32.r8());
+  COMP->test(mode, 0x10);
+  COMP->cmovz(result, tmp);
+  return result;
+}
+
+// Emits x + y + carry in, used by the add and subtract from families (subtractions add ~rA).
+// XER[CA] and XER[OV] are mode dependent: out of bit 0 in 64 bit mode and out of bit 32 otherwise,
+// so when they are needed the low words get added again for the 32 bit flags.
+static x86::Gp J_AddExtended(JITBlockBuilder *b, x86::Gp x, x86::Gp y, eJITCarryIn carryIn,
+                             bool setCA, bool setOV) {
+  x86::Gp xer = carryIn == eJITCarryIn::CA ? XERReg() : x86::Gp();
+  auto emitAdd = [&](const x86::Gp &dst, const x86::Gp &src) {
+    switch (carryIn) {
+    case eJITCarryIn::Zero:
+      COMP->add(dst, src);
+      return;
+    case eJITCarryIn::One:
+      COMP->stc();
+      break;
+    case eJITCarryIn::CA:
+      COMP->bt(xer, 29);
+      break;
+    }
+    COMP->adc(dst, src);
+  };
+
+  x86::Gp result = newGP64();
+  COMP->mov(result, x);
+  emitAdd(result, y);
+  if (!setCA && !setOV)
+    return result;
+
+  x86::Gp ca64 = newGP8();
+  x86::Gp ov64 = newGP8();
+  x86::Gp ca32 = newGP8();
+  x86::Gp ov32 = newGP8();
+  COMP->setc(ca64);
+  COMP->seto(ov64);
+  x86::Gp low = newGP32();
+  COMP->mov(low, x.r32());
+  emitAdd(low, y.r32());
+  COMP->setc(ca32);
+  COMP->seto(ov32);
+
+  if (setCA)
+    J_SetCA(b, J_SelectByMode(b, ca64, ca32));
+  if (setOV)
+    J_SetOV(b, J_SelectByMode(b, ov64, ov32));
+  return result;
+}
+
+// Emits rD = rA / rB. rD is 0 when dividing by zero or on signed overflow, the interpreter does
+// the same. OE forms set XER[OV] on either for signed divides, on division by zero for unsigned ones.
+static void J_Divide(JITBlockBuilder *b, PPCOpcode instr, bool is64, bool isSigned) {
+  x86::Gp rA = GPRReg(instr.ra);
+  x86::Gp rB = GPRReg(instr.rb);
+  x86::Gp result = newGP64();
+  x86::Gp dividend = newGP64();
+  x86::Gp remainder = newGP64();
+  x86::Gp divisor = newGP64();
+  x86::Gp zero = newGP8();
+  x86::Gp invalid = newGP8();
+  Label doneLabel = COMP->newLabel();
+
+  // Sized views, word forms only use the low words
+  auto sized = [is64](const x86::Gp &reg) { return is64 ? reg.r64() : reg.r32(); };
+  COMP->mov(sized(dividend), sized(rA));
+  COMP->mov(sized(divisor), sized(rB));
+  COMP->xor_(result, result);
+
+  COMP->test(sized(divisor), sized(divisor));
+  COMP->sete(zero);
+  COMP->mov(invalid, zero);
+  if (isSigned) {
+    // Most negative value divided by -1 overflows too
+    x86::Gp minValue = newGP8();
+    x86::Gp minusOne = newGP8();
+    if (is64) {
+      x86::Gp tmp = newGP64();
+      COMP->mov(tmp, static_cast<u64>(INT64_MIN));
+      COMP->cmp(dividend, tmp);
+    } else {
+      COMP->cmp(dividend.r32(), imm(INT32_MIN));
+    }
+    COMP->sete(minValue);
+    COMP->cmp(sized(divisor), imm(-1));
+    COMP->sete(minusOne);
+    COMP->and_(minValue, minusOne);
+    COMP->or_(invalid, minValue);
+  }
+  COMP->test(invalid, invalid);
+  COMP->jnz(doneLabel);
+  if (isSigned) {
+    if (is64)
+      COMP->cqo(remainder, dividend);
+    else
+      COMP->cdq(remainder.r32(), dividend.r32());
+    COMP->idiv(sized(remainder), sized(dividend), sized(divisor));
+  } else {
+    COMP->xor_(remainder, remainder);
+    COMP->div(sized(remainder), sized(dividend), sized(divisor));
+  }
+  // Word results are zero extended
+  COMP->mov(sized(result), sized(dividend));
+  COMP->bind(doneLabel);
+
+  if (instr.oe)
+    J_SetOV(b, isSigned ? invalid : zero);
+  J_SetResult(b, instr.rd, result, instr.rc);
+}
+
+// Sets CR bit crbD to the result of a logical operation on CR bits crbA and crbB.
+static void J_CRLogical(JITBlockBuilder *b, PPCOpcode instr, eJITCROp op) {
+  x86::Gp cr = CRRegOut();
+  x86::Gp bitA = newGP32();
+  x86::Gp bitB = newGP32();
+  COMP->mov(bitA, cr);
+  COMP->shr(bitA, 31 - instr.crba);
+  COMP->mov(bitB, cr);
+  COMP->shr(bitB, 31 - instr.crbb);
+
+  switch (op) {
+  case eJITCROp::And:
+    COMP->and_(bitA, bitB);
+    break;
+  case eJITCROp::AndC:
+    COMP->not_(bitB);
+    COMP->and_(bitA, bitB);
+    break;
+  case eJITCROp::Eqv:
+    COMP->xor_(bitA, bitB);
+    COMP->not_(bitA);
+    break;
+  case eJITCROp::Nand:
+    COMP->and_(bitA, bitB);
+    COMP->not_(bitA);
+    break;
+  case eJITCROp::Nor:
+    COMP->or_(bitA, bitB);
+    COMP->not_(bitA);
+    break;
+  case eJITCROp::Or:
+    COMP->or_(bitA, bitB);
+    break;
+  case eJITCROp::OrC:
+    COMP->not_(bitB);
+    COMP->or_(bitA, bitB);
+    break;
+  case eJITCROp::Xor:
+    COMP->xor_(bitA, bitB);
+    break;
+  }
+
+  const u32 sh = 31 - instr.crbd;
+  COMP->and_(bitA, 1);
+  COMP->shl(bitA, sh);
+  COMP->and_(cr, ~(1u << sh));
+  COMP->or_(cr, bitA);
+}
+
+// Returns ROTL32(rS[32-63], n) duplicated in both words and anded with MASK(MB + 32, ME + 32).
+// count is used for the amount when valid, sh otherwise.
+static x86::Gp J_RotateWord(JITBlockBuilder *b, PPCOpcode instr, x86::Gp count, u32 sh) {
+  x86::Gp rot = newGP64();
+  COMP->mov(rot.r32(), GPRReg(instr.rs).r32());
+  if (count.isValid()) {
+    COMP->rol(rot.r32(), count.r8());
+  } else if (sh != 0) {
+    COMP->rol(rot.r32(), sh);
+  }
+  const u64 mask = PPCRotateMask(32 + instr.mb32, 32 + instr.me32);
+  // Masks inside the low word don't need the duplicated value
+  if ((mask >> 32) == 0) {
+    COMP->and_(rot.r32(), imm(static_cast<u32>(mask)));
+    return rot;
+  }
+  x86::Gp dup = Jduplicate32(b, rot);
+  J_AndMask(b, dup, mask);
+  return dup;
+}
+
+// Returns ROTL64(rS, n) anded with mask. count is used for the amount when valid, sh otherwise.
+static x86::Gp J_RotateDouble(JITBlockBuilder *b, PPCOpcode instr, x86::Gp count, u32 sh, u64 mask) {
+  x86::Gp rot = newGP64();
+  COMP->mov(rot, GPRReg(instr.rs));
+  if (count.isValid()) {
+    COMP->rol(rot, count.r8());
+  } else if (sh != 0) {
+    COMP->rol(rot, sh);
+  }
+  J_AndMask(b, rot, mask);
+  return rot;
+}
+
+// Sets XER[CA] for the algebraic right shifts: rS negative and any 1 bits shifted out. value is
+// the sign extended source, result the shifted value and count the shift amount.
+static void J_SetShiftCA(JITBlockBuilder *b, x86::Gp value, x86::Gp result, const Operand &count) {
+  x86::Gp back = newGP64();
+  x86::Gp lost = newGP8();
+  x86::Gp negative = newGP8();
+  COMP->mov(back, result);
+  COMP->emit(x86::Inst::kIdShl, back, count);
+  COMP->cmp(back, value);
+  COMP->setne(lost);
+  COMP->test(value, value);
+  COMP->sets(negative);
+  COMP->and_(lost, negative);
+  J_SetCA(b, lost);
+}
+
+//
+// Instruction definitions
+//
+
+// Add (x'7C00 0214')
+void PPCInterpreter::PPCInterpreterJIT_addx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- (rA) + (rB)
+  */
+  x86::Gp res = J_AddExtended(b, GPRReg(instr.ra), GPRReg(instr.rb), eJITCarryIn::Zero, false, instr.oe);
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// Add Carrying (x'7C00 0014')
+void PPCInterpreter::PPCInterpreterJIT_addcx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- (rA) + (rB)
+  */
+  x86::Gp res = J_AddExtended(b, GPRReg(instr.ra), GPRReg(instr.rb), eJITCarryIn::Zero, true, instr.oe);
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// Add Extended (x'7C00 0114')
+void PPCInterpreter::PPCInterpreterJIT_addex(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- (rA) + (rB) + XER[CA]
+  */
+  x86::Gp res = J_AddExtended(b, GPRReg(instr.ra), GPRReg(instr.rb), eJITCarryIn::CA, true, instr.oe);
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
 // Add Immediate (x'3800 0000')
 void PPCInterpreter::PPCInterpreterJIT_addi(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
   /*
@@ -11,33 +305,668 @@ void PPCInterpreter::PPCInterpreterJIT_addi(PPU_STATE *ppuState, JITBlockBuilder
   */
   int16_t immVal = instr.simm16;
 
-  // rDT = imm
-  x86::Gp rDTemp = newGP64();
-  COMP->mov(rDTemp, immVal);
+  if (instr.ra == 0) {
+    COMP->mov(GPRRegOut(instr.rd), immVal); // rD = imm
+  } else {
+    x86::Gp rA = GPRReg(instr.ra);
+    x86::Gp rD = GPRRegOut(instr.rd);
+    COMP->mov(rD, rA);
+    COMP->add(rD, immVal); // rD = rA + imm
+  }
+}
+
+// Add Immediate Carrying (x'3000 0000')
+void PPCInterpreter::PPCInterpreterJIT_addic(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- (rA) + EXTS(SIMM)
+  */
+  x86::Gp simm = J_Const(b, static_cast<s64>(instr.simm16));
+  x86::Gp res = J_AddExtended(b, GPRReg(instr.ra), simm, eJITCarryIn::Zero, true, false);
+  // addic. is a separate opcode
+  J_SetResult(b, instr.rd, res, instr.main & 1);
+}
+
+// Add Immediate Shifted (x'3C00 0000')
+void PPCInterpreter::PPCInterpreterJIT_addis(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    if rA = 0 then rD <- EXTS(SIMM || (16)0)
+    else rD <- (rA) + EXTS(SIMM || (16)0)
+  */
+  const s32 immVal = instr.simm16 * 65536;
 
   if (instr.ra == 0) {
-    COMP->mov(GPRPtr(instr.rd), rDTemp);
+    COMP->mov(GPRRegOut(instr.rd), static_cast<s64>(immVal));
   } else {
-    COMP->add(rDTemp, GPRPtr(instr.ra)); // rDT += rA
-    COMP->mov(GPRPtr(instr.rd), rDTemp); // rD  = rDT
+    x86::Gp rA = GPRReg(instr.ra);
+    x86::Gp rD = GPRRegOut(instr.rd);
+    COMP->mov(rD, rA);
+    COMP->add(rD, immVal);
   }
 }
 
+// Add to Minus One Extended (x'7C00 01D4')
+void PPCInterpreter::PPCInterpreterJIT_addmex(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- (rA) + XER[CA] - 1
+  */
+  x86::Gp res = J_AddExtended(b, GPRReg(instr.ra), J_Const(b, ~0ULL), eJITCarryIn::CA, true, instr.oe);
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// Add to Zero Extended (x'7C00 0194')
+void PPCInterpreter::PPCInterpreterJIT_addzex(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- (rA) + XER[CA]
+  */
+  x86::Gp res = J_AddExtended(b, GPRReg(instr.ra), J_Const(b, 0), eJITCarryIn::CA, true, instr.oe);
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
 // And (x'7C00 0038')
 void PPCInterpreter::PPCInterpreterJIT_andx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
   /*
     rA <- (rS) & (rB)
   */
 
-  // rSTemp
+  // rSTemp & rB
   x86::Gp rSTemp = newGP64();
-  COMP->mov(rSTemp, GPRPtr(instr.rs));
+  COMP->mov(rSTemp, GPRReg(instr.rs));
+  COMP->and_(rSTemp, GPRReg(instr.rb));
 
-  // rSTemp & rB
-  COMP->and_(rSTemp, GPRPtr(instr.rb));
+  // rA = rSTemp, _rc
+  J_SetResult(b, instr.ra, rSTemp, instr.rc);
+}
+
+// AND with Complement (x'7C00 0078')
+void PPCInterpreter::PPCInterpreterJIT_andcx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rA <- (rS) & ~(rB)
+  */
+  x86::Gp res = J_Not(b, GPRReg(instr.rb));
+  COMP->and_(res, GPRReg(instr.rs));
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// And Immediate (x'7000 0000')
+void PPCInterpreter::PPCInterpreterJIT_andi(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rA <- (rS) & ((48)0 || UIMM)
+  */
+  x86::Gp res = newGP64();
+  COMP->mov(res, GPRReg(instr.rs));
+  COMP->and_(res, imm<u16>(instr.uimm16));
+
+  // Always records CR0
+  J_SetResult(b, instr.ra, res, true);
+}
+
+// And Immediate Shifted (x'7400 0000')
+void PPCInterpreter::PPCInterpreterJIT_andis(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rA <- (rS) & ((32)0 || UIMM || (16)0)
+  */
+  x86::Gp res = newGP64();
+  COMP->mov(res, GPRReg(instr.rs));
+  J_AndMask(b, res, u64{ instr.uimm16 } << 16);
+
+  // Always records CR0
+  J_SetResult(b, instr.ra, res, true);
+}
 
-  // rA = rSTemp
-  COMP->mov(GPRPtr(instr.ra), rSTemp);
+// Compare
+void PPCInterpreter::PPCInterpreterJIT_cmp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  x86::Gp rA = GPRReg(instr.ra);
+  x86::Gp rB = GPRReg(instr.rb);
+  x86::Gp field = instr.l10 ? J_CompareCR(b, rA, rB, true) : J_CompareCR(b, rA.r32(), rB.r32(), true);
+  J_SetCRField(b, field, instr.crfd);
+}
+
+// Compare Immediate
+void PPCInterpreter::PPCInterpreterJIT_cmpi(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  x86::Gp rA = GPRReg(instr.ra);
+  const Imm simm = imm(static_cast<s32>(instr.simm16));
+  x86::Gp field = instr.l10 ? J_CompareCR(b, rA, simm, true) : J_CompareCR(b, rA.r32(), simm, true);
+  J_SetCRField(b, field, instr.crfd);
+}
+
+// Compare Logical
+void PPCInterpreter::PPCInterpreterJIT_cmpl(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  x86::Gp rA = GPRReg(instr.ra);
+  x86::Gp rB = GPRReg(instr.rb);
+  x86::Gp field = instr.l10 ? J_CompareCR(b, rA, rB, false) : J_CompareCR(b, rA.r32(), rB.r32(), false);
+  J_SetCRField(b, field, instr.crfd);
+}
+
+// Compare Logical Immediate
+void PPCInterpreter::PPCInterpreterJIT_cmpli(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  x86::Gp rA = GPRReg(instr.ra);
+  const Imm uimm = imm(static_cast<u32>(instr.uimm16));
+  x86::Gp field = instr.l10 ? J_CompareCR(b, rA, uimm, false) : J_CompareCR(b, rA.r32(), uimm, false);
+  J_SetCRField(b, field, instr.crfd);
+}
+
+// Count Leading Zeros Double Word (x'7C00 0074')
+void PPCInterpreter::PPCInterpreterJIT_cntlzdx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- 0
+    do while n < 64
+      if rS[n] = 1 then leave
+      n <- n + 1
+    rA <- n
+  */
+  x86::Gp res = newGP64();
+  x86::Gp zeroResult = newGP64();
+  // 63 - bsr, bsr leaves ZF set for a zero input, which must give 64 (127 ^ 63)
+  COMP->mov(zeroResult, 127);
+  COMP->bsr(res, GPRReg(instr.rs));
+  COMP->cmovz(res, zeroResult);
+  COMP->xor_(res, 63);
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Count Leading Zeros Word (x'7C00 0034')
+void PPCInterpreter::PPCInterpreterJIT_cntlzwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- 32
+    do while n < 64
+      if rS[n] = 1 then leave
+      n <- n + 1
+    rA <- n - 32
+  */
+  x86::Gp res = newGP64();
+  x86::Gp zeroResult = newGP64();
+  // 31 - bsr, a zero input must give 32 (63 ^ 31)
+  COMP->mov(zeroResult.r32(), 63);
+  COMP->bsr(res.r32(), GPRReg(instr.rs).r32());
+  COMP->cmovz(res.r32(), zeroResult.r32());
+  COMP->xor_(res.r32(), 31);
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Condition Register AND
+void PPCInterpreter::PPCInterpreterJIT_crand(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_CRLogical(b, instr, eJITCROp::And);
+}
+
+// Condition Register AND with Complement
+void PPCInterpreter::PPCInterpreterJIT_crandc(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_CRLogical(b, instr, eJITCROp::AndC);
+}
+
+// Condition Register Equivalent
+void PPCInterpreter::PPCInterpreterJIT_creqv(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_CRLogical(b, instr, eJITCROp::Eqv);
+}
+
+// Condition Register NAND
+void PPCInterpreter::PPCInterpreterJIT_crnand(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_CRLogical(b, instr, eJITCROp::Nand);
+}
+
+// Condition Register NOR
+void PPCInterpreter::PPCInterpreterJIT_crnor(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_CRLogical(b, instr, eJITCROp::Nor);
+}
+
+// Condition Register OR
+void PPCInterpreter::PPCInterpreterJIT_cror(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_CRLogical(b, instr, eJITCROp::Or);
+}
+
+// Condition Register OR with Complement
+void PPCInterpreter::PPCInterpreterJIT_crorc(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_CRLogical(b, instr, eJITCROp::OrC);
+}
+
+// Condition Register XOR
+void PPCInterpreter::PPCInterpreterJIT_crxor(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_CRLogical(b, instr, eJITCROp::Xor);
+}
+
+// Divide Double Word (x'7C00 03D2')
+void PPCInterpreter::PPCInterpreterJIT_divdx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Divide(b, instr, true, true);
+}
+
+// Divide Double Word Unsigned (x'7C00 0392')
+void PPCInterpreter::PPCInterpreterJIT_divdux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Divide(b, instr, true, false);
+}
+
+// Divide Word (x'7C00 03D6')
+void PPCInterpreter::PPCInterpreterJIT_divwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Divide(b, instr, false, true);
+}
+
+// Divide Word Unsigned (x'7C00 0396')
+void PPCInterpreter::PPCInterpreterJIT_divwux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Divide(b, instr, false, false);
+}
+
+// Equivalent (x'7C00 0238')
+void PPCInterpreter::PPCInterpreterJIT_eqvx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rA <- 1 ^ ((rS) ^ (rB))
+  */
+  x86::Gp res = newGP64();
+  COMP->mov(res, GPRReg(instr.rs));
+  COMP->xor_(res, GPRReg(instr.rb));
+  COMP->not_(res);
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Extend Sign Byte (x'7C00 0774')
+void PPCInterpreter::PPCInterpreterJIT_extsbx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  x86::Gp res = newGP64();
+  COMP->movsx(res, GPRReg(instr.rs).r8());
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Extend Sign Half Word (x'7C00 0734')
+void PPCInterpreter::PPCInterpreterJIT_extshx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  x86::Gp res = newGP64();
+  COMP->movsx(res, GPRReg(instr.rs).r16());
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Extend Sign Word (x'7C00 07B4')
+void PPCInterpreter::PPCInterpreterJIT_extswx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  x86::Gp res = newGP64();
+  COMP->movsxd(res, GPRReg(instr.rs).r32());
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Move Condition Register Field
+void PPCInterpreter::PPCInterpreterJIT_mcrf(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  x86::Gp field = newGP32();
+  COMP->mov(field, CRReg());
+  COMP->shr(field, (7 - instr.crfs) * 4);
+  COMP->and_(field, 0xF);
+  J_SetCRField(b, field, instr.crfd);
+}
+
+// Move from Time Base (x'7C00 02E6')
+void PPCInterpreter::PPCInterpreterJIT_mftb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  const u32 spr = (instr.spr >> 5) | ((instr.spr & 0x1f) << 5);
+  x86::Gp res = newGP64();
+
+  switch (spr) {
+  case 268:
+    J_ReadTimeBase(b, res);
+    break;
+  case 269:
+    J_ReadTimeBase(b, res);
+    COMP->shr(res, 32);
+    break;
+  default:
+    LOG_CRITICAL(Xenon, "MFTB -> Illegal instruction form!");
+    return;
+  }
+  COMP->mov(GPRRegOut(instr.rd), res);
+}
+
+// Move From One Condition Register Field
+void PPCInterpreter::PPCInterpreterJIT_mfocrf(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  x86::Gp res = newGP64();
+  if (instr.l11) {
+    // MFOCRF
+    u32 crMask = 0;
+    u32 count = 0;
+    for (u32 bit = 0x80; bit; bit >>= 1) {
+      crMask <<= 4;
+      if (instr.crm & bit) {
+        crMask |= 0xF;
+        count++;
+      }
+    }
+    if (count == 1) {
+      COMP->mov(res.r32(), CRReg());
+      COMP->and_(res.r32(), crMask);
+    } else { // Undefined behavior.
+      COMP->xor_(res.r32(), res.r32());
+    }
+  } else {
+    // MFCR
+    COMP->mov(res.r32(), CRReg());
+  }
+  COMP->mov(GPRRegOut(instr.rd), res);
+}
+
+// Move To One Condition Register Field
+void PPCInterpreter::PPCInterpreterJIT_mtocrf(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  u32 crMask = 0;
+  for (u32 bit = 0x80; bit; bit >>= 1) {
+    crMask <<= 4;
+    if (instr.crm & bit) {
+      crMask |= 0xF;
+    }
+  }
+  if (!crMask)
+    return;
+
+  x86::Gp value = newGP32();
+  COMP->mov(value, GPRReg(instr.rs).r32());
+  COMP->and_(value, crMask);
+  // CR0 gets overwritten
+  if (crMask & 0xF0000000)
+    b->regs.DiscardCR0();
+  x86::Gp cr = CRRegOut();
+  COMP->and_(cr, ~crMask);
+  COMP->or_(cr, value);
+}
+
+// Multiply High Double Word (x'7C00 0092')
+void PPCInterpreter::PPCInterpreterJIT_mulhdx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    prod[0-127] <- (rA) * (rB)
+    rD <- prod[0-63]
+  */
+  x86::Gp lo = newGP64();
+  x86::Gp hi = newGP64();
+  COMP->mov(lo, GPRReg(instr.ra));
+  COMP->imul(hi, lo, GPRReg(instr.rb));
+  J_SetResult(b, instr.rd, hi, instr.rc);
+}
+
+// Multiply High Double Word Unsigned (x'7C00 0012')
+void PPCInterpreter::PPCInterpreterJIT_mulhdux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    prod[0-127] <- (rA) * (rB)
+    rD <- prod[0-63]
+  */
+  x86::Gp lo = newGP64();
+  x86::Gp hi = newGP64();
+  COMP->mov(lo, GPRReg(instr.ra));
+  COMP->mul(hi, lo, GPRReg(instr.rb));
+  J_SetResult(b, instr.rd, hi, instr.rc);
+}
+
+// Multiply High Word (x'7C00 0096')
+void PPCInterpreter::PPCInterpreterJIT_mulhwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    prod[0-63] <- rA[32-63] * rB[32-63]
+    rD[32-63] <- prod[0-31]
+    rD[0-31] <- undefined
+  */
+  x86::Gp res = newGP64();
+  x86::Gp rhs = newGP64();
+  COMP->movsxd(res, GPRReg(instr.ra).r32());
+  COMP->movsxd(rhs, GPRReg(instr.rb).r32());
+  COMP->imul(res, rhs);
+  COMP->sar(res, 32);
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// Multiply High Word Unsigned (x'7C00 0016')
+void PPCInterpreter::PPCInterpreterJIT_mulhwux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    prod[0-63] <- rA[32-63] * rB[32-63]
+    rD[32-63] <- prod[0-31]
+    rD[0-31] <- undefined
+  */
+  x86::Gp res = newGP64();
+  x86::Gp rhs = newGP64();
+  COMP->mov(res.r32(), GPRReg(instr.ra).r32());
+  COMP->mov(rhs.r32(), GPRReg(instr.rb).r32());
+  COMP->imul(res, rhs);
+  COMP->shr(res, 32);
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// Multiply Low Double Word (x'7C00 01D2')
+void PPCInterpreter::PPCInterpreterJIT_mulldx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    prod[0-127] <- (rA) * (rB)
+    rD <- prod[64-127]
+  */
+  x86::Gp res = newGP64();
+  COMP->mov(res, GPRReg(instr.ra));
+  COMP->imul(res, GPRReg(instr.rb));
+  // OF is set when the high half isn't the sign extension of the result
+  if (instr.oe) {
+    x86::Gp overflow = newGP8();
+    COMP->seto(overflow);
+    J_SetOV(b, overflow);
+  }
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// Multiply Low Immediate (x'1C00 0000')
+void PPCInterpreter::PPCInterpreterJIT_mulli(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    prod[0-127] <- (rA) * EXTS(SIMM)
+    rD <- prod[64-127]
+  */
+  x86::Gp res = newGP64();
+  COMP->imul(res, GPRReg(instr.ra), imm(static_cast<s32>(instr.simm16)));
+  COMP->mov(GPRRegOut(instr.rd), res);
+}
+
+// Multiply Low Word (x'7C00 01D6')
+void PPCInterpreter::PPCInterpreterJIT_mullwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- rA[32-63] * rB[32-63]
+  */
+  x86::Gp res = newGP64();
+  x86::Gp rhs = newGP64();
+  COMP->movsxd(res, GPRReg(instr.ra).r32());
+  COMP->movsxd(rhs, GPRReg(instr.rb).r32());
+  COMP->imul(res, rhs);
+  if (instr.oe) {
+    // Overflows when the product doesn't fit in 32 bits
+    x86::Gp overflow = newGP8();
+    COMP->movsxd(rhs, res.r32());
+    COMP->cmp(rhs, res);
+    COMP->setne(overflow);
+    J_SetOV(b, overflow);
+  }
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// NAND
+void PPCInterpreter::PPCInterpreterJIT_nandx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rA <- ~((rS) & (rB))
+  */
+  x86::Gp res = newGP64();
+  COMP->mov(res, GPRReg(instr.rs));
+  COMP->and_(res, GPRReg(instr.rb));
+  COMP->not_(res);
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Negate
+void PPCInterpreter::PPCInterpreterJIT_negx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- ~(rA) + 1
+  */
+  x86::Gp rA = GPRReg(instr.ra);
+  x86::Gp res = newGP64();
+  COMP->mov(res, rA);
+  COMP->neg(res);
+  if (instr.oe) {
+    // Mode dependent, OF is set when negating the most negative value
+    x86::Gp ov64 = newGP8();
+    x86::Gp ov32 = newGP8();
+    x86::Gp low = newGP32();
+    COMP->seto(ov64);
+    COMP->mov(low, rA.r32());
+    COMP->neg(low);
+    COMP->seto(ov32);
+    J_SetOV(b, J_SelectByMode(b, ov64, ov32));
+  }
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// NOR (x'7C00 00F8')
+void PPCInterpreter::PPCInterpreterJIT_norx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rA <- ~((rS) | (rB))
+  */
+  x86::Gp res = newGP64();
+  COMP->mov(res, GPRReg(instr.rs));
+  COMP->or_(res, GPRReg(instr.rb));
+  COMP->not_(res);
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// OR with Complement (x'7C00 0338')
+void PPCInterpreter::PPCInterpreterJIT_orcx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rA <- (rS) | ~(rB)
+  */
+  x86::Gp res = J_Not(b, GPRReg(instr.rb));
+  COMP->or_(res, GPRReg(instr.rs));
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// OR Immediate (x'6000 0000')
+void PPCInterpreter::PPCInterpreterJIT_ori(PPU_STATE* ppuState, JITBlockBuilder* b, PPCOpcode t_instr) {
+  /*
+    rA <- (rS) | ((4816)0 || UIMM)
+  */
+  x86::Gp tmp = newGP64();
+  x86::Gp val1 = newGP64();
+  u64 shImm = (u64{ t_instr.uimm16 });
+  COMP->mov(tmp, GPRReg(t_instr.rs));
+  COMP->mov(val1, shImm);
+  COMP->or_(tmp, val1);
+  COMP->mov(GPRRegOut(t_instr.ra), tmp);
+}
+
+// OR Immediate Shifted (x'6400 0000')
+void PPCInterpreter::PPCInterpreterJIT_oris(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rA <- (rS) | ((32)0 || UIMM || (16)0)
+  */
+  x86::Gp tmp = newGP64();
+  x86::Gp val1 = newGP64();
+  u64 shImm = (u64{ instr.uimm16 } << 16);
+  COMP->mov(tmp, GPRReg(instr.rs));
+  COMP->mov(val1, shImm);
+  COMP->or_(tmp, val1);
+  COMP->mov(GPRRegOut(instr.ra), tmp);
+}
+
+// OR (x'7C00 0378')
+void PPCInterpreter::PPCInterpreterJIT_orx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rA <- (rS) | (rB)
+  */
+  x86::Gp res = newGP64();
+  COMP->mov(res, GPRReg(instr.rs));
+  COMP->or_(res, GPRReg(instr.rb));
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Rotate Left Double Word Immediate then Clear (x'7800 0008')
+void PPCInterpreter::PPCInterpreterJIT_rldicx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- sh[5] || sh[0-4]
+    r <- ROTL[64](rS, n)
+    b <- mb[5] || mb[0-4]
+    m <- MASK(b, ~ n)
+    rA <- r & m
+  */
+  const u32 sh = instr.sh64;
+  const u32 mb = instr.mbe64;
+  x86::Gp res = J_RotateDouble(b, instr, x86::Gp(), sh, PPCRotateMask(mb, sh ^ 63));
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Rotate Left Double Word then Clear Right (x'7800 0012')
+void PPCInterpreter::PPCInterpreterJIT_rldcrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- rB[58-63]
+    r <- ROTL[64](rS, n)
+    e <- me[5] || me[0-4]
+    m <- MASK(0, e)
+    rA <- r & m
+  */
+  const u32 me = instr.mbe64;
+  x86::Gp res = J_RotateDouble(b, instr, GPRReg(instr.rb), 0, ~0ULL << (me ^ 63));
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Rotate Left Double Word then Clear Left (x'7800 0010')
+void PPCInterpreter::PPCInterpreterJIT_rldclx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- rB[58-63]
+    r <- ROTL[64](rS, n)
+    b <- mb[5] || mb[0-4]
+    m <- MASK(b, 63)
+    rA <- r & m
+  */
+  const u32 mb = instr.mbe64;
+  x86::Gp res = J_RotateDouble(b, instr, GPRReg(instr.rb), 0, ~0ULL >> mb);
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Rotate Left Double Word Immediate then Clear Left (x'7800 0000')
+void PPCInterpreter::PPCInterpreterJIT_rldiclx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- sh[5] || sh[0-4]
+    r <- ROTL[64](rS, n)
+    b <- mb[5] || mb[0-4]
+    m <- MASK(b, 63)
+    rA <- r & m
+  */
+  const u32 sh = instr.sh64;
+  const u32 mb = instr.mbe64;
+  x86::Gp res = J_RotateDouble(b, instr, x86::Gp(), sh, ~0ULL >> mb);
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Rotate Left Double Word Immediate then Clear Right (x'7800 0004')
+void PPCInterpreter::PPCInterpreterJIT_rldicrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- sh[5] || sh[0-4]
+    r <- ROTL[64](rS, n)
+    e <- me[5] || me[0-4]
+    m <- MASK(0, e)
+    rA <- r & m
+  */
+  const u32 sh = instr.sh64;
+  const u32 me = instr.mbe64;
+  x86::Gp res = J_RotateDouble(b, instr, x86::Gp(), sh, ~0ULL << (me ^ 63));
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Rotate Left Double Word Immediate then Mask Insert (x'7800 000C')
+void PPCInterpreter::PPCInterpreterJIT_rldimix(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- sh[5] || sh[0-4]
+    r <- ROTL[64](rS, n)
+    b <- mb[5] || mb[0-4]
+    m <- MASK(b, ~n)
+    rA <- (r & m) | (rA & ~m)
+  */
+  const u32 sh = instr.sh64;
+  const u32 mb = instr.mbe64;
+  const u64 mask = PPCRotateMask(mb, sh ^ 63);
+  x86::Gp keep = newGP64();
+  COMP->mov(keep, GPRReg(instr.ra));
+  x86::Gp res = J_RotateDouble(b, instr, x86::Gp(), sh, mask);
+  J_AndMask(b, keep, ~mask);
+  COMP->or_(res, keep);
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Rotate Left Word Immediate then Mask Insert (x'5000 0000')
+void PPCInterpreter::PPCInterpreterJIT_rlwimix(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- SH
+    r <- ROTL[32](rS[32-63], n)
+    m <- MASK(MB + 32, ME + 32)
+    rA <- (r & m) | (rA & ~m)
+  */
+  const u64 mask = PPCRotateMask(32 + instr.mb32, 32 + instr.me32);
+  x86::Gp keep = newGP64();
+  COMP->mov(keep, GPRReg(instr.ra));
+  x86::Gp res = J_RotateWord(b, instr, x86::Gp(), instr.sh32);
+  J_AndMask(b, keep, ~mask);
+  COMP->or_(res, keep);
+  J_SetResult(b, instr.ra, res, instr.rc);
 }
 
 // Rotate Left Word Immediate then AND with Mask (x'5400 0000')
@@ -48,21 +977,8 @@ void PPCInterpreter::PPCInterpreterJIT_rlwinmx(PPU_STATE *ppuState, JITBlockBuil
     m <- MASK(MB + 32, ME + 32)
     rA <- (r & m)
   */
-  x86::Gp n = newGP32();
-  COMP->mov(n, imm<u16>(instr.sh32));
-
-  x86::Gp rol = newGP32();
-  COMP->mov(rol, GPRPtr(instr.rs));
-  COMP->rol(rol, n); // rol32 by variable
-
-  x86::Gp dup = Jduplicate32(b, rol);
-  u64 mask = PPCRotateMask(32 + instr.mb32, 32 + instr.me32);
-  COMP->and_(dup, mask);
-  COMP->mov(GPRPtr(instr.ra), dup);
-
-  // _rc
-  if (instr.rc)
-    J_ppuSetCR_LOGICAL(b, dup, 0);
+  x86::Gp res = J_RotateWord(b, instr, x86::Gp(), instr.sh32);
+  J_SetResult(b, instr.ra, res, instr.rc);
 }
 
 // Rotate Left Word then AND with Mask (x'5C00 0000')
@@ -73,91 +989,301 @@ void PPCInterpreter::PPCInterpreterJIT_rlwnmx(PPU_STATE *ppuState, JITBlockBuild
     m <- MASK(MB + 32, ME + 32)
     rA <- r & m
   */
-  x86::Gp n = newGP32();
-  COMP->mov(n, GPRPtr(instr.rb));
-  COMP->and_(n, 0x1F); // n = rB & 0x1F (rot amount)
+  // rol r32 only uses the low 5 bits of the count
+  x86::Gp res = J_RotateWord(b, instr, GPRReg(instr.rb), 0);
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Shift Left Double Word (x'7C00 0036')
+void PPCInterpreter::PPCInterpreterJIT_sldx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- rB[58-63]
+    r <- ROTL[64](rS, n)
+    if rB[57] = 0 then
+      m <- MASK(0, 63 - n)
+    else m <- (64)0
+    rA <- r & m
+  */
+  x86::Gp res = newGP64();
+  x86::Gp count = newGP32();
+  x86::Gp zero = newGP64();
+  COMP->xor_(zero, zero);
+  COMP->mov(count, GPRReg(instr.rb).r32());
+  COMP->mov(res, GPRReg(instr.rs));
+  COMP->shl(res, count.r8());
+  COMP->test(count, 0x40);
+  COMP->cmovnz(res, zero);
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Shift Left Word (x'7C00 0030')
+void PPCInterpreter::PPCInterpreterJIT_slwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- rB[59-63]
+    r <- ROTL[32](rS[32-63], n)
+    if rB[58] = 0 then m <- MASK(32, 63 - n)
+    else m <- (64)0
+    rA <- r & m
+  */
+  // 64 bit shift by rB & 0x3F, then only the low word is kept
+  x86::Gp res = newGP64();
+  COMP->mov(res, GPRReg(instr.rs));
+  COMP->shl(res, GPRReg(instr.rb).r8());
+  COMP->mov(res.r32(), res.r32());
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// Shift Right Algebraic Double Word (x'7C00 0634')
+void PPCInterpreter::PPCInterpreterJIT_sradx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- rB[58-63]
+    r <- ROTL[64](rS, 64 - n)
+    if rB[57] = 0 then
+      m <- MASK(n, 63)
+    else m <- (64)0
+    S <- rS[0]
+    rA <- (r & m) | (((64)S) & ~m)
+    XER[CA] <- S & ((r & ~ m) | 0)
+  */
+  x86::Gp rS = GPRReg(instr.rs);
+  x86::Gp count = newGP32();
+  x86::Gp maxCount = newGP32();
+  x86::Gp outOfRange = newGP8();
+  x86::Gp res = newGP64();
 
-  x86::Gp rol = newGP32();
-  COMP->mov(rol, GPRPtr(instr.rs));
-  COMP->rol(rol, n); // rol32 by variable
+  // Amounts over 63 fill with the sign and always carry out a negative value
+  COMP->mov(count, GPRReg(instr.rb).r32());
+  COMP->and_(count, 0x7F);
+  COMP->mov(maxCount, 63);
+  COMP->cmp(count, 63);
+  COMP->seta(outOfRange);
+  COMP->cmova(count, maxCount);
+  COMP->mov(res, rS);
+  COMP->sar(res, count.r8());
 
-  x86::Gp dup = Jduplicate32(b, rol);
-  u64 mask = PPCRotateMask(32 + instr.mb32, 32 + instr.me32);
-  COMP->and_(dup, mask);
-  COMP->mov(GPRPtr(instr.ra), dup);
+  x86::Gp back = newGP64();
+  x86::Gp lost = newGP8();
+  x86::Gp negative = newGP8();
+  COMP->mov(back, res);
+  COMP->shl(back, count.r8());
+  COMP->cmp(back, rS);
+  COMP->setne(lost);
+  COMP->or_(lost, outOfRange);
+  COMP->test(rS, rS);
+  COMP->sets(negative);
+  COMP->and_(lost, negative);
+  J_SetCA(b, lost);
 
-  // _rc
-  if (instr.rc)
-    J_ppuSetCR(b, dup, 0);
+  J_SetResult(b, instr.ra, res, instr.rc);
 }
 
+// Shift Right Algebraic Double Word Immediate (x'7C00 0674')
+void PPCInterpreter::PPCInterpreterJIT_sradix(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- sh[5] || sh[0-4]
+    r <- ROTL[64](rS, 64 - n)
+    m <- MASK(n, 63)
+    S <- rS[0]
+    rA <- (r & m) | (((64)S) & ~m)
+    XER[CA] <- S & ((r & ~m) != 0)
+  */
+  const u32 sh = instr.sh64;
+  x86::Gp rS = GPRReg(instr.rs);
+  x86::Gp res = newGP64();
+  COMP->mov(res, rS);
+  COMP->sar(res, sh);
+  J_SetShiftCA(b, rS, res, imm(sh));
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
 
-// And Immediate (x'7000 0000')
-void PPCInterpreter::PPCInterpreterJIT_andi(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+// Shift Right Algebraic Word (x'7C00 0630')
+void PPCInterpreter::PPCInterpreterJIT_srawx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
   /*
-    rA <- (rS) & ((48)0 || UIMM)
+    n <- rB[59-63]
+    r <- ROTL[32](rS[32-63], 64 - n)
+    if rB[5826] = 0 then
+    m <- MASK(n + 32, 63)
+    else m <- (64)0
+    S <- rS[32]
+    rA <- r & m | (64)S & ~m
+    XER[CA] <- S & (r & ~m[32-63] != 0
   */
+  // Shifting the sign extended word by rB & 0x3F also covers the amounts over 31
+  x86::Gp value = newGP64();
+  x86::Gp count = newGP32();
   x86::Gp res = newGP64();
-  COMP->mov(res, GPRPtr(instr.rs)); 
-  COMP->and_(res, imm<u16>(instr.uimm16));
-  COMP->mov(GPRPtr(instr.ra), res);
+  COMP->movsxd(value, GPRReg(instr.rs).r32());
+  COMP->mov(count, GPRReg(instr.rb).r32());
+  COMP->mov(res, value);
+  COMP->sar(res, count.r8());
+  J_SetShiftCA(b, value, res, count.r8());
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
 
-  J_ppuSetCR_LOGICAL(b, res, 0);
+// Shift Right Algebraic Word Immediate (x'7C00 0670')
+void PPCInterpreter::PPCInterpreterJIT_srawix(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    n <- SH
+    r <- ROTL[32](rS[32-63], 64 - n)
+    m<- MASK(n + 32, 63)
+    S <- rS[32]
+    rA <- r & m | (64)S & ~m
+    XER[CA] <- S & ((r & ~m)[32-63] != 0)
+  */
+  const u32 sh = instr.sh32;
+  x86::Gp value = newGP64();
+  x86::Gp res = newGP64();
+  COMP->movsxd(value, GPRReg(instr.rs).r32());
+  COMP->mov(res, value);
+  COMP->sar(res, sh);
+  J_SetShiftCA(b, value, res, imm(sh));
+  J_SetResult(b, instr.ra, res, instr.rc);
 }
 
-// XOR Immediate (x'6800 0000')
-void PPCInterpreter::PPCInterpreterJIT_xori(PPU_STATE* ppuState, JITBlockBuilder* b, PPCOpcode t_instr) {
+// Shift Right Double Word (x'7C00 0436')
+void PPCInterpreter::PPCInterpreterJIT_srdx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
   /*
-    rA <- (rS) ^ ((4816)0 || UIMM)
+    n <- rB[58-63]
+    r <- ROTL[64](rS, 64 - n)
+    if rB[57] = 0 then
+      m <- MASK(n, 63)
+    else m <- (64)0
+    rA <- r & m
   */
-  x86::Gp tmp = newGP64();
-  x86::Gp val1 = newGP64();
-  u64 shImm = (u64{ t_instr.uimm16 });
-  COMP->mov(tmp, GPRPtr(t_instr.rs));
-  COMP->mov(val1, shImm);
-  COMP->xor_(tmp, val1);
-  COMP->mov(GPRPtr(t_instr.ra), tmp);
+  x86::Gp res = newGP64();
+  x86::Gp count = newGP32();
+  x86::Gp zero = newGP64();
+  COMP->xor_(zero, zero);
+  COMP->mov(count, GPRReg(instr.rb).r32());
+  COMP->mov(res, GPRReg(instr.rs));
+  COMP->shr(res, count.r8());
+  COMP->test(count, 0x40);
+  COMP->cmovnz(res, zero);
+  J_SetResult(b, instr.ra, res, instr.rc);
 }
 
-// XOR Immediate Shifted (x'6C00 0000')
-void PPCInterpreter::PPCInterpreterJIT_xoris(PPU_STATE* ppuState, JITBlockBuilder* b, PPCOpcode t_instr) {
+// Shift Right Word (x'7C00 0430')
+void PPCInterpreter::PPCInterpreterJIT_srwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
   /*
-    rA <- (rS) | ((32)0 || UIMM || (16)0)
+    n <- rB[58-63]
+    r <- ROTL[32](rS[32-63], 64 - n)
+    if rB[58] = 0 then
+      m <- MASK(n + 32, 63)
+    else m <- (64)0
+    rA <- r & m
   */
-  x86::Gp tmp = newGP64();
-  x86::Gp val1 = newGP64();
-  u64 shImm = (u64{ t_instr.uimm16 } << 16);
-  COMP->mov(tmp, GPRPtr(t_instr.rs));
-  COMP->mov(val1, shImm);
-  COMP->xor_(tmp, val1);
-  COMP->mov(GPRPtr(t_instr.ra), tmp);
+  // Zero extended word shifted by rB & 0x3F
+  x86::Gp res = newGP64();
+  COMP->mov(res.r32(), GPRReg(instr.rs).r32());
+  COMP->shr(res, GPRReg(instr.rb).r8());
+  J_SetResult(b, instr.ra, res, instr.rc);
 }
 
-// OR Immediate (x'6000 0000')
-void PPCInterpreter::PPCInterpreterJIT_ori(PPU_STATE* ppuState, JITBlockBuilder* b, PPCOpcode t_instr) {
+// Subtract from Carrying (x'7C00 0010')
+void PPCInterpreter::PPCInterpreterJIT_subfcx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
   /*
-    rA <- (rS) | ((4816)0 || UIMM)
+    rD <- ~(rA) + (rB) + 1
+  */
+  x86::Gp notRA = J_Not(b, GPRReg(instr.ra));
+  x86::Gp res = J_AddExtended(b, notRA, GPRReg(instr.rb), eJITCarryIn::One, true, instr.oe);
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// Subtract From (x'7C00 0050')
+void PPCInterpreter::PPCInterpreterJIT_subfx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- ~(rA) + (rB) + 1
+  */
+  x86::Gp rA = GPRReg(instr.ra);
+  x86::Gp rB = GPRReg(instr.rb);
+  x86::Gp res;
+  if (instr.oe) {
+    res = J_AddExtended(b, J_Not(b, rA), rB, eJITCarryIn::One, false, true);
+  } else {
+    res = newGP64();
+    COMP->mov(res, rB);
+    COMP->sub(res, rA);
+  }
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// Subtract from Extended (x'7C00 0110')
+void PPCInterpreter::PPCInterpreterJIT_subfex(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- ~(rA) + (rB) + XER[CA]
+  */
+  x86::Gp notRA = J_Not(b, GPRReg(instr.ra));
+  x86::Gp res = J_AddExtended(b, notRA, GPRReg(instr.rb), eJITCarryIn::CA, true, instr.oe);
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// Subtract from Immediate Carrying (x'2000 0000')
+void PPCInterpreter::PPCInterpreterJIT_subfic(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- ~(rA) + EXTS(SIMM) + 1
+  */
+  x86::Gp notRA = J_Not(b, GPRReg(instr.ra));
+  x86::Gp simm = J_Const(b, static_cast<s64>(instr.simm16));
+  x86::Gp res = J_AddExtended(b, notRA, simm, eJITCarryIn::One, true, false);
+  COMP->mov(GPRRegOut(instr.rd), res);
+}
+
+// Subtract from Minus One Extended (x'7C00 01D0')
+void PPCInterpreter::PPCInterpreterJIT_subfmex(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- ~(rA) + XER[CA] - 1
+  */
+  x86::Gp notRA = J_Not(b, GPRReg(instr.ra));
+  x86::Gp res = J_AddExtended(b, notRA, J_Const(b, ~0ULL), eJITCarryIn::CA, true, instr.oe);
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// Subtract from Zero Extended (x'7C00 0190')
+void PPCInterpreter::PPCInterpreterJIT_subfzex(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rD <- ~(rA) + XER[CA]
+  */
+  x86::Gp notRA = J_Not(b, GPRReg(instr.ra));
+  x86::Gp res = J_AddExtended(b, notRA, J_Const(b, 0), eJITCarryIn::CA, true, instr.oe);
+  J_SetResult(b, instr.rd, res, instr.rc);
+}
+
+// XOR (x'7C00 0278')
+void PPCInterpreter::PPCInterpreterJIT_xorx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    rA <- (rS) ^ (rB)
+  */
+  x86::Gp res = newGP64();
+  COMP->mov(res, GPRReg(instr.rs));
+  COMP->xor_(res, GPRReg(instr.rb));
+  J_SetResult(b, instr.ra, res, instr.rc);
+}
+
+// XOR Immediate (x'6800 0000')
+void PPCInterpreter::PPCInterpreterJIT_xori(PPU_STATE* ppuState, JITBlockBuilder* b, PPCOpcode t_instr) {
+  /*
+    rA <- (rS) ^ ((4816)0 || UIMM)
   */
   x86::Gp tmp = newGP64();
   x86::Gp val1 = newGP64();
   u64 shImm = (u64{ t_instr.uimm16 });
-  COMP->mov(tmp, GPRPtr(t_instr.rs));
+  COMP->mov(tmp, GPRReg(t_instr.rs));
   COMP->mov(val1, shImm);
-  COMP->or_(tmp, val1);
-  COMP->mov(GPRPtr(t_instr.ra), tmp);
+  COMP->xor_(tmp, val1);
+  COMP->mov(GPRRegOut(t_instr.ra), tmp);
 }
 
-// OR Immediate Shifted (x'6400 0000')
-void PPCInterpreter::PPCInterpreterJIT_oris(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+// XOR Immediate Shifted (x'6C00 0000')
+void PPCInterpreter::PPCInterpreterJIT_xoris(PPU_STATE* ppuState, JITBlockBuilder* b, PPCOpcode t_instr) {
   /*
     rA <- (rS) | ((32)0 || UIMM || (16)0)
   */
   x86::Gp tmp = newGP64();
   x86::Gp val1 = newGP64();
-  u64 shImm = (u64{ instr.uimm16 } << 16);
-  COMP->mov(tmp, GPRPtr(instr.rs));
+  u64 shImm = (u64{ t_instr.uimm16 } << 16);
+  COMP->mov(tmp, GPRReg(t_instr.rs));
   COMP->mov(val1, shImm);
-  COMP->or_(tmp, val1);
-  COMP->mov(GPRPtr(instr.ra), tmp);
+  COMP->xor_(tmp, val1);
+  COMP->mov(GPRRegOut(t_instr.ra), tmp);
 }
-#endif
\ No newline at end of file
+#endif
@@ -3,6 +3,119 @@
 #include "JITEmitter_Helpers.h"
 
 #if defined(ARCH_X86) || defined(ARCH_X86_64)
+
+//
+// Utilities
+//
+
+// Emits the BO/BI condition of a conditional branch, decrementing the CTR first when BO asks for it.
+// Returns a byte register set when the branch is taken, or an invalid register when it always is.
+static x86::Gp J_BranchCondition(JITBlockBuilder *b, u32 bo, u32 bi, bool useCTR) {
+  x86::Gp taken{};
+  // CR bit test, done first as it reads flags from a pending CR0
+  if ((bo & 0x10) == 0) {
+    taken = J_TestCRBit(b, bi, (bo & 0x8) != 0);
+  }
+  if (useCTR && (bo & 0x4) == 0) {
+    x86::Gp ctr = newGP64();
+    x86::Gp ctrOk = newGP8();
+    COMP->mov(ctr, SPRPtr(CTR));
+    COMP->sub(ctr, 1);
+    COMP->mov(SPRPtr(CTR), ctr);
+    (bo & 0x2) ? COMP->setz(ctrOk) : COMP->setnz(ctrOk);
+    if (taken.isValid()) {
+      COMP->and_(taken, ctrOk);
+    } else {
+      taken = ctrOk;
+    }
+  }
+  return taken;
+}
+
+// Sets NIA to target when taken is set, leaves the fall through address otherwise.
+static void J_BranchTo(JITBlockBuilder *b, x86::Gp taken, x86::Gp target) {
+  if (!taken.isValid()) {
+    COMP->mov(NIAPtr(), target);
+    return;
+  }
+  x86::Gp nia = newGP64();
+  COMP->mov(nia, J_InstrAddress(b) + 4);
+  COMP->test(taken, taken);
+  COMP->cmovnz(nia, target);
+  COMP->mov(NIAPtr(), nia);
+}
+
+//
+// Instruction definitions
+//
+
+// Branch Conditional
+void PPCInterpreter::PPCInterpreterJIT_bc(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  const u64 cia = J_InstrAddress(b);
+  x86::Gp taken = J_BranchCondition(b, instr.bo, instr.bi, true);
+  x86::Gp target = newGP64();
+  COMP->mov(target, (instr.aa ? 0 : cia) + (EXTS(instr.ds, 14) << 2));
+  J_BranchTo(b, taken, target);
+
+  if (instr.lk) {
+    x86::Gp lr = newGP64();
+    COMP->mov(lr, cia + 4);
+    COMP->mov(LRPtr(), lr);
+  }
+}
+
+// Branch Conditional to Count Register
+void PPCInterpreter::PPCInterpreterJIT_bcctr(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  // The CTR is never decremented
+  x86::Gp taken = J_BranchCondition(b, instr.bo, instr.bi, false);
+  x86::Gp target = newGP64();
+  COMP->mov(target, SPRPtr(CTR));
+  COMP->and_(target, ~3);
+  J_BranchTo(b, taken, target);
+
+  if (instr.lk) {
+    x86::Gp lr = newGP64();
+    COMP->mov(lr, J_InstrAddress(b) + 4);
+    COMP->mov(LRPtr(), lr);
+  }
+}
+
+// Branch Conditional to Link Register
+void PPCInterpreter::PPCInterpreterJIT_bclr(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  const u64 cia = J_InstrAddress(b);
+  bool forceCond = false;
+  bool forcedCondOk = false;
+  // CB/SB Hardware Init step skip (hacky), the addresses are set before any code runs
+  if (XeMain::sfcx && XeMain::sfcx->initSkip1 && XeMain::sfcx->initSkip2) {
+    if (cia == XeMain::sfcx->initSkip1) {
+      forceCond = true;
+      forcedCondOk = false;
+    }
+    if (cia == XeMain::sfcx->initSkip2) {
+      forceCond = true;
+      forcedCondOk = true;
+    }
+  }
+
+  // LR is read before lk updates it
+  x86::Gp target = newGP64();
+  COMP->mov(target, LRPtr());
+  COMP->and_(target, ~3);
+  const u32 bo = forceCond ? (instr.bo | 0x10) : instr.bo;
+  x86::Gp taken = J_BranchCondition(b, bo, instr.bi, true);
+  // A forced false condition still decrements the CTR, NIA is left at the fall through
+  if (!forceCond || forcedCondOk) {
+    J_BranchTo(b, taken, target);
+  }
+
+  if (instr.lk) {
+    x86::Gp lr = newGP64();
+    COMP->mov(lr, cia + 4);
+    COMP->mov(LRPtr(), lr);
+  }
+}
+
+// Branch
 void PPCInterpreter::PPCInterpreterJIT_b(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
   x86::Gp cia = newGP32();  // current instruction address
   x86::Gp target = newGP32();
@@ -0,0 +1,334 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#include "JITEmitter_Helpers.h"
+
+#include "Base/HostCPU.h"
+
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+
+//
+// Utilities
+//
+// Only the fast FPU mode is emitted natively (see PPC_FPU.cpp), with the same checks: the precise
+// path, record forms and every result that isn't finite are left to the interpreter handler.
+// fcmpu is exact, so it's always emitted.
+//
+
+// FPSCR bits that require the precise path: the exception enables (VE, OE, UE, ZE, XE) and NI
+constexpr u32 JIT_FPSCR_PRECISE_MASK = 0xFC;
+// FPSCR[RN]
+constexpr u32 JIT_FPSCR_RN_MASK = 0x3;
+
+// Arithmetic operations of the fast path
+enum class eJITFPOp : u8 {
+  Add,       // frA + frB
+  Sub,       // frA - frB
+  Mul,       // frA * frC
+  Div,       // frA / frB
+  MulAdd,    // frA * frC + frB
+  MulSub,    // frA * frC - frB
+  NegMulAdd, // -(frA * frC + frB)
+  Round      // frB
+};
+
+// True when the instruction gets emitted natively. Fused forms need the host FMA, rounding twice
+// gives different results.
+static bool J_FPUNative(PPCOpcode instr, bool needsFMA) {
+  return Config::highlyExperimental.fastFPU && !instr.rc && (!needsFMA || Base::GetHostCPUFeatures().fma);
+}
+
+// Calls the interpreter handler of the instruction.
+static void J_FPUInterpreter(JITBlockBuilder *b, PPCInterpreter::instructionHandler handler) {
+  b->regs.Flush();
+  InvokeNode *call = nullptr;
+  J_Invoke(b, &call, (void*)handler, FuncSignature::build<void, PPU_STATE*>());
+  call->setArg(0, b->ppuState->Base());
+}
+
+// Jumps to slowLabel when the FPU is unavailable or any bit of fpscrMask is set in FPSCR, the
+// interpreter handler then raises the exception or takes the precise path.
+static void J_FPUCheckFastPath(JITBlockBuilder *b, u32 fpscrMask, Label slowLabel) {
+  x86::Gp msr = newGP64();
+  COMP->mov(msr, MSRPtr().Ptr<u64>());
+  COMP->test(msr.r32(), 0x2000); // MSR[FP]
+  COMP->jz(slowLabel);
+  if (fpscrMask != 0) {
+    COMP->test(FPSCRPtr().Ptr<u32>(), imm(fpscrMask));
+    COMP->jnz(slowLabel);
+  }
+}
+
+// Emits an arithmetic instruction. The result is stored in frD and its class left pending, same as
+// the interpreter fast path.
+static void J_FPArith(JITBlockBuilder *b, PPCOpcode instr, eJITFPOp op, bool single,
+                      PPCInterpreter::instructionHandler handler) {
+  const bool fused = op == eJITFPOp::MulAdd || op == eJITFPOp::MulSub || op == eJITFPOp::NegMulAdd;
+  if (!J_FPUNative(instr, fused)) {
+    J_FPUInterpreter(b, handler);
+    b->regs.Invalidate();
+    b->checkExceptions = true;
+    return;
+  }
+
+  x86::Xmm result = newXMM();
+  x86::Xmm factor = newXMM();
+  x86::Gp bits = newGP64();
+  x86::Gp exponent = newGP64();
+  x86::Gp limit = newGP64();
+  Label slowLabel = COMP->newLabel();
+  Label doneLabel = COMP->newLabel();
+
+  J_FPUCheckFastPath(b, JIT_FPSCR_PRECISE_MASK, slowLabel);
+
+  switch (op) {
+  case eJITFPOp::Add:
+    COMP->movsd(result, FPRPtr(instr.fra));
+    COMP->addsd(result, FPRPtr(instr.frb));
+    break;
+  case eJITFPOp::Sub:
+    COMP->movsd(result, FPRPtr(instr.fra));
+    COMP->subsd(result, FPRPtr(instr.frb));
+    break;
+  case eJITFPOp::Mul:
+    COMP->movsd(result, FPRPtr(instr.fra));
+    COMP->mulsd(result, FPRPtr(instr.frc));
+    break;
+  case eJITFPOp::Div:
+    COMP->movsd(result, FPRPtr(instr.fra));
+    COMP->divsd(result, FPRPtr(instr.frb));
+    break;
+  case eJITFPOp::MulAdd:
+  case eJITFPOp::NegMulAdd:
+    COMP->movsd(result, FPRPtr(instr.frb));
+    COMP->movsd(factor, FPRPtr(instr.fra));
+    COMP->vfmadd231sd(result, factor, FPRPtr(instr.frc));
+    break;
+  case eJITFPOp::MulSub:
+    COMP->movsd(result, FPRPtr(instr.frb));
+    COMP->movsd(factor, FPRPtr(instr.fra));
+    COMP->vfmsub231sd(result, factor, FPRPtr(instr.frc));
+    break;
+  case eJITFPOp::Round:
+    COMP->movsd(result, FPRPtr(instr.frb));
+    break;
+  }
+  if (single) {
+    COMP->cvtsd2ss(result, result);
+    COMP->cvtss2sd(result, result);
+  }
+  COMP->movq(bits, result);
+  if (op == eJITFPOp::NegMulAdd)
+    COMP->btc(bits, 63);
+
+  // Infinities and NaNs, exponent all ones
+  COMP->mov(exponent, bits);
+  COMP->shl(exponent, 1);
+  COMP->mov(limit, 0xFFE0000000000000ull);
+  COMP->cmp(exponent, limit);
+  COMP->jae(slowLabel);
+
+  COMP->mov(FPRPtr(instr.frd), bits);
+  COMP->mov(b->threadCtx->scalar(&PPU_THREAD_REGISTERS::fprfPendingValue).Ptr<u64>(), bits);
+  COMP->mov(b->threadCtx->scalar(&PPU_THREAD_REGISTERS::fprfPending).Ptr<u8>(),
+    imm(static_cast<u8>(single ? eFPRFPending::Single : eFPRFPending::Double)));
+  COMP->jmp(doneLabel);
+
+  // Non record forms only change FPRs and the FPSCR, cached registers stay valid
+  COMP->bind(slowLabel);
+  J_FPUInterpreter(b, handler);
+
+  COMP->bind(doneLabel);
+  b->checkExceptions = true;
+}
+
+// Floating Add (Double-Precision) (x'FC00 002A')
+void PPCInterpreter::PPCInterpreterJIT_faddx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    frD <- (frA) + (frB)
+  */
+  J_FPArith(b, instr, eJITFPOp::Add, false, &PPCInterpreter_faddx);
+}
+
+// Floating Add Single (x'EC00 002A')
+void PPCInterpreter::PPCInterpreterJIT_faddsx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_FPArith(b, instr, eJITFPOp::Add, true, &PPCInterpreter_faddsx);
+}
+
+// Floating Subtract (Double-Precision) (x'FC00 0028')
+void PPCInterpreter::PPCInterpreterJIT_fsubx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    frD <- (frA) - (frB)
+  */
+  J_FPArith(b, instr, eJITFPOp::Sub, false, &PPCInterpreter_fsubx);
+}
+
+// Floating Subtract Single (x'EC00 0028')
+void PPCInterpreter::PPCInterpreterJIT_fsubsx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_FPArith(b, instr, eJITFPOp::Sub, true, &PPCInterpreter_fsubsx);
+}
+
+// Floating Multiply (Double-Precision) (x'FC00 0032')
+void PPCInterpreter::PPCInterpreterJIT_fmulx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    frD <- (frA) * (frC)
+  */
+  J_FPArith(b, instr, eJITFPOp::Mul, false, &PPCInterpreter_fmulx);
+}
+
+// Floating Divide (Double-Precision) (x'FC00 0024')
+void PPCInterpreter::PPCInterpreterJIT_fdivx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    frD <- (frA) / (frB)
+  */
+  J_FPArith(b, instr, eJITFPOp::Div, false, &PPCInterpreter_fdivx);
+}
+
+// Floating Divide Single (x'EC00 0024')
+void PPCInterpreter::PPCInterpreterJIT_fdivsx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_FPArith(b, instr, eJITFPOp::Div, true, &PPCInterpreter_fdivsx);
+}
+
+// Floating Multiply-Add (Double-Precision) (x'FC00 003A')
+void PPCInterpreter::PPCInterpreterJIT_fmaddx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    frD <- (frA * frC) + frB
+  */
+  J_FPArith(b, instr, eJITFPOp::MulAdd, false, &PPCInterpreter_fmaddx);
+}
+
+// Floating Multiply-Subtract (Double-Precision) (x'FC00 0038')
+void PPCInterpreter::PPCInterpreterJIT_fmsubx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    frD <- (frA * frC) - frB
+  */
+  J_FPArith(b, instr, eJITFPOp::MulSub, false, &PPCInterpreter_fmsubx);
+}
+
+// Floating Negative Multiply-Add (Double-Precision) (x'FC00 003E')
+void PPCInterpreter::PPCInterpreterJIT_fnmaddx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    frD <- -([frA * frC] + frB)
+  */
+  J_FPArith(b, instr, eJITFPOp::NegMulAdd, false, &PPCInterpreter_fnmaddx);
+}
+
+// Floating Round to Single (x'FC00 0018')
+void PPCInterpreter::PPCInterpreterJIT_frspx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_FPArith(b, instr, eJITFPOp::Round, true, &PPCInterpreter_frspx);
+}
+
+// Floating Convert to Integer Word (x'FC00 001C')
+void PPCInterpreter::PPCInterpreterJIT_fctiwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  if (!J_FPUNative(instr, false)) {
+    J_FPUInterpreter(b, &PPCInterpreter_fctiwx);
+    b->regs.Invalidate();
+    b->checkExceptions = true;
+    return;
+  }
+
+  x86::Xmm value = newXMM();
+  x86::Gp word = newGP32();
+  x86::Gp result = newGP64();
+  x86::Gp sign = newGP64();
+  x86::Gp zero = newGP8();
+  Label slowLabel = COMP->newLabel();
+  Label doneLabel = COMP->newLabel();
+
+  // Round to nearest only, that's what the host uses
+  J_FPUCheckFastPath(b, JIT_FPSCR_PRECISE_MASK | JIT_FPSCR_RN_MASK, slowLabel);
+
+  COMP->movsd(value, FPRPtr(instr.frb));
+  COMP->cvtsd2si(word, value);
+  // Integer indefinite, NaN or out of range. -2^31 itself takes the slow path too.
+  COMP->cmp(word, imm(INT32_MIN));
+  COMP->je(slowLabel);
+
+  // Same as the interpreter, the upper word is undefined, a zero result of a negative value sets bit 32
+  COMP->mov(result, 0xFFF8000000000000ull);
+  COMP->or_(result, word.r64());
+  COMP->test(word, word);
+  COMP->setz(zero);
+  COMP->movq(sign, value);
+  COMP->shr(sign, 63);
+  COMP->and_(sign.r8(), zero);
+  COMP->shl(sign, 32);
+  COMP->or_(result, sign);
+  COMP->mov(FPRPtr(instr.frd), result);
+  COMP->jmp(doneLabel);
+
+  COMP->bind(slowLabel);
+  J_FPUInterpreter(b, &PPCInterpreter_fctiwx);
+
+  COMP->bind(doneLabel);
+  b->checkExceptions = true;
+}
+
+// Floating Compare Unordered (x'FC00 0000')
+void PPCInterpreter::PPCInterpreterJIT_fcmpu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  /*
+    if (frA) is a NaN or (frB) is a NaN then c <- 0b0001
+    else if (frA) < (frB) then c <- 0b1000
+    else if (frA) > (frB) then c <- 0b0100
+    else c <- 0b0010
+    FPCC <- c
+    CR[4 * crfD-4 * crfD + 3] <- c
+    if (frA) is an SNaN or (frB) is an SNaN then VXSNAN <- 1
+  */
+  x86::Gp cr = CRRegOut();
+  x86::Xmm lhs = newXMM();
+  x86::Gp field = newGP32();
+  x86::Gp flag = newGP32();
+  x86::Gp fpscr = newGP32();
+  x86::Gp lt = newGP8();
+  x86::Gp gt = newGP8();
+  x86::Gp eq = newGP8();
+  Label slowLabel = COMP->newLabel();
+  Label resolvedLabel = COMP->newLabel();
+  Label doneLabel = COMP->newLabel();
+
+  J_FPUCheckFastPath(b, 0, slowLabel);
+
+  // FPCC is part of FPRF, a pending class must be written first
+  COMP->cmp(b->threadCtx->scalar(&PPU_THREAD_REGISTERS::fprfPending).Ptr<u8>(), imm(0));
+  COMP->je(resolvedLabel);
+  InvokeNode *resolve = nullptr;
+  J_Invoke(b, &resolve, (void*)&PPCInterpreter::ppuResolveFPRF, FuncSignature::build<void, PPU_THREAD_REGISTERS*>());
+  resolve->setArg(0, b->threadCtx->Base());
+  COMP->bind(resolvedLabel);
+
+  // Unordered, SNaNs may raise an exception
+  COMP->movsd(lhs, FPRPtr(instr.fra));
+  COMP->ucomisd(lhs, FPRPtr(instr.frb));
+  COMP->jp(slowLabel);
+  COMP->setb(lt);
+  COMP->seta(gt);
+  COMP->sete(eq);
+  COMP->xor_(field, field);
+  const std::pair<x86::Gp, u32> bits[] = { { lt, 3 }, { gt, 2 }, { eq, 1 } };
+  for (const auto &[bit, shift] : bits) {
+    COMP->movzx(flag, bit);
+    COMP->shl(flag, shift);
+    COMP->or_(field, flag);
+  }
+
+  // FPSCR[FPCC]
+  COMP->mov(fpscr, FPSCRPtr().Ptr<u32>());
+  COMP->and_(fpscr, ~0xF000u);
+  COMP->mov(flag, field);
+  COMP->shl(flag, 12);
+  COMP->or_(fpscr, flag);
+  COMP->mov(FPSCRPtr().Ptr<u32>(), fpscr);
+
+  J_SetCRField(b, field, instr.crfd);
+  COMP->jmp(doneLabel);
+
+  // The handler writes the CR field, so the cached CR is reloaded
+  COMP->bind(slowLabel);
+  J_FPUInterpreter(b, &PPCInterpreter_fcmpu);
+  COMP->mov(cr, CRValPtr().Ptr<u32>());
+
+  COMP->bind(doneLabel);
+  b->checkExceptions = true;
+}
+
+#endif
@@ -2,10 +2,16 @@
 
 #pragma once
 
+#include <array>
+#include <cstring>
+
+#include "Base/Config.h"
 #include "Base/Logging/Log.h"
 
+#include "Core/RAM/RAM.h"
 #include "Core/XCPU/Interpreter/PPCInterpreter.h"
 #include "Core/XCPU/PPU/PPU_JIT.h"
+#include "Core/XeMain.h"
 
 #if defined(ARCH_X86) || defined(ARCH_X86_64)
 using namespace asmjit;
@@ -21,6 +27,11 @@ using namespace asmjit;
 #define newGP8()   b->compiler->newGpb()
 #define newGPptr() b->compiler->newGpz()
 
+//
+// Allocates a new SSE register
+//
+#define newXMM()   b->compiler->newXmm()
+
 //
 // Pointer Helpers
 //
@@ -34,6 +45,23 @@ using namespace asmjit;
 #define CIAPtr() b->threadCtx->scalar(&PPU_THREAD_REGISTERS::CIA)
 #define NIAPtr() b->threadCtx->scalar(&PPU_THREAD_REGISTERS::NIA)
 #define LRPtr() SPRPtr(LR)
+#define MSRPtr() SPRPtr(MSR)
+#define FPRPtr(x) x86::qword_ptr(b->threadCtx->Base(), \
+  static_cast<s32>(b->threadCtx->array(&PPU_THREAD_REGISTERS::FPR).Offset() + (x) * sizeof(FPRegister)))
+#define FPSCRPtr() b->threadCtx->scalar(&PPU_THREAD_REGISTERS::FPSCR)
+
+//
+// Cached guest registers, see JITRegisterCache. Out variants mark the value as modified.
+//
+
+#define GPRReg(x) b->regs.GPR(x)
+#define GPRRegOut(x) b->regs.GPROut(x)
+#define CRReg() b->regs.CR()
+#define CRRegOut() b->regs.CROut()
+#define XERReg() b->regs.XER()
+#define XERRegOut() b->regs.XEROut()
+#define VRReg(x) b->regs.VR(x)
+#define VRRegOut(x) b->regs.VROut(x)
 
 inline x86::Gp Jrotl32(JITBlockBuilder *b, x86::Mem x, u32 n) {
   x86::Gp tmp = newGP32();
@@ -52,114 +80,518 @@ inline x86::Gp Jduplicate32(JITBlockBuilder *b, x86::Gp origin) {
   return cast64;
 }
 
-inline x86::Gp J_BuildCR(JITBlockBuilder *b, x86::Gp lhs, x86::Gp rhs) {
-  x86::Gp crValue = newGP32();
-  x86::Gp tmp = newGP8();
+// Address of the instruction being emitted
+inline u64 J_InstrAddress(JITBlockBuilder *b) {
+  return b->ppuAddr + b->instrIndex * 4;
+}
 
-  COMP->cmp(lhs, rhs); // Compare lhs and rhs
-  COMP->xor_(crValue, crValue);
+// Ands a 64 bit mask into value. x86 only takes sign extended 32 bit immediates, other masks are
+// loaded in a register first.
+inline void J_AndMask(JITBlockBuilder *b, x86::Gp value, u64 mask) {
+  if (static_cast<u64>(static_cast<s64>(static_cast<s32>(mask))) == mask) {
+    COMP->and_(value.r64(), imm(static_cast<s32>(mask)));
+  } else if ((mask >> 32) == 0) {
+    // Writing the low dword clears the upper one
+    COMP->and_(value.r32(), imm(static_cast<u32>(mask)));
+  } else {
+    x86::Gp tmp = newGP64();
+    COMP->mov(tmp, mask);
+    COMP->and_(value.r64(), tmp);
+  }
+}
 
-  // lt (less than)
-  COMP->setl(tmp);
-  COMP->shl(tmp, imm(3 - CR_BIT_LT));
-  COMP->or_(crValue.r8(), tmp.r8());
+//
+// Host addresses
+//
+// Generated code may be written to the disk cache and loaded in another run, so every host
+// address goes trough these: the full 64 bit immediate is always emitted and recorded, which lets
+// the cache find and rebase it. Calls are made trough a register for the same reason.
+//
 
-  // gt (greater than)
-  COMP->setg(tmp);
-  COMP->shl(tmp, imm(3 - CR_BIT_GT));
-  COMP->or_(crValue.r8(), tmp.r8());
+// Loads a host address into dst.
+inline void J_MovHostPtr(JITBlockBuilder *b, x86::Gp dst, eJITReloc kind, const void *ptr) {
+  JITReloc reloc{ kind, reinterpret_cast<u64>(ptr), COMP->newLabel(), COMP->newLabel() };
+  COMP->bind(reloc.start);
+  COMP->long_().mov(dst.r64(), imm(reloc.value));
+  COMP->bind(reloc.end);
+  b->relocs.push_back(reloc);
+}
 
-  // eq (equal)
-  COMP->sete(tmp);
-  COMP->shl(tmp, imm(3 - CR_BIT_EQ));
-  COMP->or_(crValue.r8(), tmp.r8());
+// Calls a function of the emulator binary.
+inline void J_Invoke(JITBlockBuilder *b, InvokeNode **out, const void *fn, const FuncSignature &signature) {
+  x86::Gp target = newGPptr();
+  J_MovHostPtr(b, target, eJITReloc::Image, fn);
+  COMP->invoke(out, target, signature);
+}
 
-  // so (summary overflow)
-#ifdef __LITTLE_ENDIAN__
-  COMP->mov(tmp.r32(), SPRPtr(XER));
-  COMP->shr(tmp.r32(), imm(31));
-#else
-  COMP->mov(tmp.r32(), SPRPtr(XER));
-  COMP->and_(tmp.r32(), imm(1));
-#endif
-  COMP->shl(tmp, imm(3 - CR_BIT_SO));
-  COMP->or_(crValue.r8(), tmp.r8());
+// Reads the time base, it's updated lazily so it must be computed.
+inline void J_ReadTimeBase(JITBlockBuilder *b, x86::Gp dst) {
+  InvokeNode *read = nullptr;
+  J_Invoke(b, &read, (void*)&PPCInterpreter::ppcGetTimeBase, FuncSignature::build<u64, PPU_STATE*>());
+  read->setArg(0, b->ppuState->Base());
+  read->setRet(0, dst);
+}
 
-  return crValue;
+//
+// Condition Register
+//
+
+// Compares lhs with rhs, returns the resulting CR field (LT GT EQ SO) in the low nibble.
+inline x86::Gp J_CompareCR(JITBlockBuilder *b, const Operand &lhs, const Operand &rhs, bool isSigned) {
+  x86::Gp field = newGP32();
+  x86::Gp flag = newGP32();
+  x86::Gp lt = newGP8();
+  x86::Gp gt = newGP8();
+  x86::Gp eq = newGP8();
+
+  // so (summary overflow), done first as the shifts change the flags
+  COMP->mov(field, XERReg());
+  COMP->shr(field, 31);
+
+  COMP->emit(x86::Inst::kIdCmp, lhs, rhs);
+  if (isSigned) {
+    COMP->setl(lt);
+    COMP->setg(gt);
+  } else {
+    COMP->setb(lt);
+    COMP->seta(gt);
+  }
+  COMP->sete(eq);
+
+  const std::pair<x86::Gp, u32> bits[] = { { lt, 3 - CR_BIT_LT }, { gt, 3 - CR_BIT_GT }, { eq, 3 - CR_BIT_EQ } };
+  for (const auto &[bit, shift] : bits) {
+    COMP->movzx(flag, bit);
+    COMP->shl(flag, shift);
+    COMP->or_(field, flag);
+  }
+  return field;
 }
 
+// Replaces CR field index with the low nibble of field.
 inline void J_SetCRField(JITBlockBuilder *b, x86::Gp field, u32 index) {
-  x86::Gp tempCR = newGP32();
+  // The whole field is replaced, no need to build a pending CR0
+  if (index == 0)
+    b->regs.DiscardCR0();
+  x86::Gp cr = CRRegOut();
 
   u32 sh = (7 - index) * 4; // Shift formula
   uint32_t clearMask = ~(0xF << sh);
 
-  COMP->mov(tempCR, CRValPtr());
-  COMP->and_(tempCR, clearMask); // Clear field 
+  COMP->and_(cr, clearMask); // Clear field 
   COMP->shl(field, sh); // Shift field bits to position
-  COMP->or_(tempCR, field); // Apply bits
+  COMP->or_(cr, field); // Apply bits
+}
+
+// Records CR0 for the result of a record form (Rc = 1) instruction. Lazy, see JITRegisterCache.
+inline void J_RecordCR0(JITBlockBuilder *b, x86::Gp value) {
+  b->regs.RecordCR0(value);
+}
 
-  COMP->mov(CRValPtr(), tempCR); // Store updated value back
+// Returns a byte register set to 1 when CR bit 'bit' equals 'value'. A pending CR0 is tested
+// directly from its value, without building the field.
+inline x86::Gp J_TestCRBit(JITBlockBuilder *b, u32 bit, bool value) {
+  x86::Gp result = newGP8();
+  if (bit < 4 && b->regs.CR0Pending()) {
+    if (bit == CR_BIT_SO) {
+      COMP->bt(XERReg(), 31);
+      value ? COMP->setc(result) : COMP->setnc(result);
+      return result;
+    }
+    x86::Gp cr0 = b->regs.CR0Value();
+    COMP->test(cr0, cr0);
+    switch (bit) {
+    case CR_BIT_LT:
+      value ? COMP->setl(result) : COMP->setge(result);
+      break;
+    case CR_BIT_GT:
+      value ? COMP->setg(result) : COMP->setle(result);
+      break;
+    case CR_BIT_EQ:
+      value ? COMP->sete(result) : COMP->setne(result);
+      break;
+    }
+    return result;
+  }
+  COMP->bt(CRReg(), 31 - bit);
+  value ? COMP->setc(result) : COMP->setnc(result);
+  return result;
 }
 
-inline void J_ppuSetCR(JITBlockBuilder *b, x86::Gp value, u32 index) {
-  Label use64 = COMP->newLabel();
-  Label done = COMP->newLabel();
+//
+// XER
+//
 
-  x86::Gp tempMSR = newGP32();
-  x86::Gp tempCR = newGP32();
+// Sets XER[CA] to the low bit of carry.
+inline void J_SetCA(JITBlockBuilder *b, x86::Gp carry) {
+  x86::Gp xer = XERRegOut();
+  x86::Gp tmp = newGP32();
+  COMP->movzx(tmp, carry.r8());
+  COMP->shl(tmp, 29);
+  COMP->and_(xer, ~(1u << 29));
+  COMP->or_(xer, tmp);
+}
 
-  // Load MSR and check SF bit
-  COMP->mov(tempMSR, SPRPtr(MSR));
-  COMP->bt(tempMSR, 0); // Bit 0 (SF) on MSR
-  COMP->jc(use64); // If set, use 64-bit compare
+// Sets XER[OV] to the low bit of overflow and ORs it into XER[SO]. Same as ppuSetXerOv, ByteCount,
+// CA and SO are kept and every other bit is cleared.
+inline void J_SetOV(JITBlockBuilder *b, x86::Gp overflow) {
+  x86::Gp xer = XERRegOut();
+  x86::Gp tmp = newGP32();
+  COMP->movzx(tmp, overflow.r8());
+  COMP->and_(xer, 0xA000007F);
+  COMP->shl(tmp, 30);
+  COMP->or_(xer, tmp);
+  COMP->shl(tmp, 1);
+  COMP->or_(xer, tmp);
+}
+
+//
+// Exceptions
+//
 
-  // 32-bit compare
-  {
-    x86::Gp zero32 = newGP32();
-    COMP->xor_(zero32, zero32);
-    x86::Gp field = J_BuildCR(b, value.r32(), zero32);
-    J_SetCRField(b, field, index);
-    COMP->jmp(done);
+// Leaves the block when one of the exceptions in mask is pending after the current instruction and
+// gets taken. Guest registers are written back as they are at this point of the emitter, so it must
+// be emitted before the instruction updates any of them.
+inline void J_ExitOnException(JITBlockBuilder *b, u16 mask = 0xFFFF) {
+  Label skipRet = COMP->newLabel();
+  COMP->test(b->threadCtx->scalar(&PPU_THREAD_REGISTERS::exceptReg).Ptr<u16>(), imm(mask));
+  COMP->jz(skipRet);
+  b->regs.Flush();
+  InvokeNode *exceptionCheck = nullptr;
+  x86::Gp retVal = newGP8();
+  J_Invoke(b, &exceptionCheck, (void*)callExceptionExit, FuncSignature::build<bool, PPU*, PPU_STATE*, u64>());
+  exceptionCheck->setArg(0, b->ppu->Base());
+  exceptionCheck->setArg(1, b->ppuState->Base());
+  exceptionCheck->setArg(2, imm(b->instrIndex + 1));
+  exceptionCheck->setRet(0, retVal);
+  COMP->test(retVal, retVal);
+  COMP->jz(skipRet);
+  // Exception taken, account for the instructions run so far and leave the chain
+  x86::Gp budgetPtr = newGPptr();
+  J_MovHostPtr(b, budgetPtr, eJITReloc::JIT, b->budget);
+  COMP->sub(x86::qword_ptr(budgetPtr), b->instrIndex + 1);
+  COMP->jmp(b->exitLabel);
+  COMP->bind(skipRet);
+}
+
+//
+// Memory access
+//
+// Accesses to RAM pages present in the D-ERAT are done inline on the host pointer cached in the
+// entry. Everything else (misses, page crossing, MMIO, SoC and code pages on stores) goes trough
+// the MMU helpers, which also raise the data storage/segment exceptions.
+//
+
+inline u64 JITReadMemory8(PPU_STATE *ppuState, u64 EA) { return PPCInterpreter::MMURead8(ppuState, EA); }
+inline u64 JITReadMemory16(PPU_STATE *ppuState, u64 EA) { return PPCInterpreter::MMURead16(ppuState, EA); }
+inline u64 JITReadMemory32(PPU_STATE *ppuState, u64 EA) { return PPCInterpreter::MMURead32(ppuState, EA); }
+inline u64 JITReadMemory64(PPU_STATE *ppuState, u64 EA) { return PPCInterpreter::MMURead64(ppuState, EA); }
+inline void JITWriteMemory8(PPU_STATE *ppuState, u64 EA, u64 data) { PPCInterpreter::MMUWrite8(ppuState, EA, static_cast<u8>(data)); }
+inline void JITWriteMemory16(PPU_STATE *ppuState, u64 EA, u64 data) { PPCInterpreter::MMUWrite16(ppuState, EA, static_cast<u16>(data)); }
+inline void JITWriteMemory32(PPU_STATE *ppuState, u64 EA, u64 data) { PPCInterpreter::MMUWrite32(ppuState, EA, static_cast<u32>(data)); }
+inline void JITWriteMemory64(PPU_STATE *ppuState, u64 EA, u64 data) { PPCInterpreter::MMUWrite64(ppuState, EA, data); }
+// Quadwords, words in host order as vector registers keep them
+inline void JITReadVector(PPU_STATE *ppuState, u64 EA, Base::Vector128 *vector) {
+  for (u32 i = 0; i != 4; i++)
+    vector->dword[i] = PPCInterpreter::MMURead32(ppuState, EA + i * sizeof(u32));
+}
+inline void JITWriteVector(PPU_STATE *ppuState, u64 EA, const Base::Vector128 *vector) {
+  for (u32 i = 0; i != 4; i++)
+    PPCInterpreter::MMUWrite32(ppuState, EA + i * sizeof(u32), vector->dword[i]);
+}
+// Inline store done while a reservation is held, host points into RAM
+inline void JITCheckReservations(const u8 *host, u64 size) {
+  const u64 RA = RAM_START_ADDR + (host - XeMain::ram->GetPointerToAddress(RAM_START_ADDR));
+  PPCInterpreter::CPUContext->xenonRes.Check(RA, size);
+}
+
+// Probes the D-ERAT for a RAM backed translation of EA, returns the host address of the access.
+// Jumps to slowLabel on miss, page crossing or when the page isn't RAM backed.
+inline x86::Gp J_ProbeHostPointer(JITBlockBuilder *b, x86::Gp EA, u8 size, Label slowLabel) {
+  static_assert(sizeof(ERATEntry) * XE_ERAT_WAYS == 64, "ERAT set size changed, update the set index shift");
+  x86::Gp mode = b->regs.DataMode();
+  x86::Gp addr = newGP64();
+  x86::Gp page = newGP64();
+  x86::Gp set = newGPptr();
+  x86::Gp host = newGPptr();
+
+  // Outside of 64 bit mode only the lower word is used
+  COMP->mov(addr.r32(), EA.r32());
+  COMP->test(mode, 0x10);
+  COMP->cmovnz(addr, EA);
+
+  // Page crossing accesses need two translations
+  if (size > 1) {
+    COMP->mov(page.r32(), addr.r32());
+    COMP->and_(page.r32(), 0xFFF);
+    COMP->cmp(page.r32(), 0x1000 - size);
+    COMP->ja(slowLabel);
   }
 
-  // 64-bit compare
-  COMP->bind(use64);
-  {
-    x86::Gp zero64 = newGP64();
-    COMP->xor_(zero64, zero64);
-    x86::Gp field = J_BuildCR(b, value.r64(), zero64);
-    J_SetCRField(b, field, index);
+  // Congruence class of the page
+  COMP->mov(page, addr);
+  COMP->shr(page, 12);
+  COMP->mov(set.r32(), page.r32());
+  COMP->and_(set.r32(), XE_ERAT_SETS - 1);
+  COMP->shl(set, 6);
+  COMP->add(set, b->threadCtx->Base());
+
+  const u64 entries = b->threadCtx->substruct(&PPU_THREAD_REGISTERS::dERAT).array(&ERAT::entries).Offset();
+  Label hitLabel = COMP->newLabel();
+  for (u8 way = 0; way < XE_ERAT_WAYS; way++) {
+    const u64 entry = entries + way * sizeof(ERATEntry);
+    Label nextWay = way + 1 == XE_ERAT_WAYS ? slowLabel : COMP->newLabel();
+    COMP->cmp(page, x86::qword_ptr(set, entry + offsetof(ERATEntry, eaPage)));
+    COMP->jne(nextWay);
+    COMP->cmp(mode.r8(), x86::byte_ptr(set, entry + offsetof(ERATEntry, mode)));
+    COMP->jne(nextWay);
+    COMP->mov(host, x86::qword_ptr(set, entry + offsetof(ERATEntry, hostPage)));
+    if (way + 1 != XE_ERAT_WAYS) {
+      COMP->jmp(hitLabel);
+      COMP->bind(nextWay);
+    }
   }
+  COMP->bind(hitLabel);
+  // Not RAM backed
+  COMP->test(host, host);
+  COMP->jz(slowLabel);
+  COMP->and_(addr.r32(), 0xFFF);
+  COMP->add(host, addr);
+  return host;
+}
 
-  COMP->bind(done);
+// Reads size bytes from guest memory, returns the value zero extended.
+inline x86::Gp J_ReadMemory(JITBlockBuilder *b, x86::Gp EA, u8 size) {
+  x86::Gp value = newGP64();
+  Label slowLabel = COMP->newLabel();
+  Label doneLabel = COMP->newLabel();
+
+  // Same as the MMU fast path, watched addresses always go trough the MMU
+  if (!Config::debug.haltOnReadAddress) {
+    x86::Gp host = J_ProbeHostPointer(b, EA, size, slowLabel);
+    switch (size) {
+    case 1:
+      COMP->movzx(value.r32(), x86::byte_ptr(host));
+      break;
+    case 2:
+      COMP->movzx(value.r32(), x86::word_ptr(host));
+      COMP->rol(value.r16(), 8);
+      break;
+    case 4:
+      COMP->mov(value.r32(), x86::dword_ptr(host));
+      COMP->bswap(value.r32());
+      break;
+    case 8:
+      COMP->mov(value, x86::qword_ptr(host));
+      COMP->bswap(value);
+      break;
+    }
+    COMP->jmp(doneLabel);
+  }
+
+  COMP->bind(slowLabel);
+  void *helper = size == 1 ? (void*)JITReadMemory8 : size == 2 ? (void*)JITReadMemory16 :
+    size == 4 ? (void*)JITReadMemory32 : (void*)JITReadMemory64;
+  InvokeNode *read = nullptr;
+  J_Invoke(b, &read, helper, FuncSignature::build<u64, PPU_STATE*, u64>());
+  read->setArg(0, b->ppuState->Base());
+  read->setArg(1, EA);
+  read->setRet(0, value);
+  J_ExitOnException(b, PPU_EX_DATASTOR | PPU_EX_DATASEGM);
+
+  COMP->bind(doneLabel);
+  return value;
 }
 
-inline void J_ppuSetCR_LOGICAL(JITBlockBuilder *b, x86::Gp value, u32 index) {
-  x86::Gp tempCR = newGP32();
-  x86::Gp field = newGP32();
+// Same as J_ProbeHostPointer for writes, which also go the slow way when the page has compiled code.
+// Only used when there's inline write support, see J_WriteMemory.
+inline x86::Gp J_ProbeWritePointer(JITBlockBuilder *b, x86::Gp EA, u8 size, Label slowLabel) {
+  x86::Gp host = J_ProbeHostPointer(b, EA, size, slowLabel);
+  x86::Gp tmp = newGPptr();
+
+  // Writes to pages with compiled code must invalidate it
+  x86::Gp codePage = newGPptr();
+  COMP->mov(codePage, host);
+  J_MovHostPtr(b, tmp, eJITReloc::RAMBase, XeMain::ram->GetPointerToAddress(RAM_START_ADDR));
+  COMP->sub(codePage, tmp);
+  COMP->shr(codePage, RAM_CODE_PAGE_SHIFT);
+  J_MovHostPtr(b, tmp, eJITReloc::CodePageMap, XeMain::ram->GetCodePageMap());
+  COMP->cmp(x86::byte_ptr(tmp, codePage), 0);
+  COMP->jne(slowLabel);
+  return host;
+}
+
+// Invalidates reservations on the granules of an inline store, same as XenonReservations::Check.
+// The fence orders the store before the count load, or a lwarx taking its reservation in between
+// would miss both the count and the new data.
+inline void J_CheckReservations(JITBlockBuilder *b, x86::Gp host, u8 size) {
+  Label doneLabel = COMP->newLabel();
+  x86::Gp tmp = newGPptr();
+  COMP->mfence();
+  J_MovHostPtr(b, tmp, eJITReloc::ReservationCount, PPCInterpreter::CPUContext->xenonRes.GetReservationCount());
+  COMP->cmp(x86::dword_ptr(tmp), 0);
+  COMP->je(doneLabel);
+  InvokeNode *check = nullptr;
+  J_Invoke(b, &check, (void*)JITCheckReservations, FuncSignature::build<void, const u8*, u64>());
+  check->setArg(0, host);
+  check->setArg(1, imm(size));
+  COMP->bind(doneLabel);
+}
+
+// Writes the low size bytes of value to guest memory. Value is left untouched.
+inline void J_WriteMemory(JITBlockBuilder *b, x86::Gp EA, x86::Gp value, u8 size) {
+  Label slowLabel = COMP->newLabel();
+  Label doneLabel = COMP->newLabel();
+
+  if (!Config::debug.haltOnWriteAddress && XeMain::ram) {
+    x86::Gp host = J_ProbeWritePointer(b, EA, size, slowLabel);
+    x86::Gp data = newGP64();
+    switch (size) {
+    case 1:
+      COMP->mov(x86::byte_ptr(host), value.r8());
+      break;
+    case 2:
+      COMP->mov(data.r32(), value.r32());
+      COMP->rol(data.r16(), 8);
+      COMP->mov(x86::word_ptr(host), data.r16());
+      break;
+    case 4:
+      COMP->mov(data.r32(), value.r32());
+      COMP->bswap(data.r32());
+      COMP->mov(x86::dword_ptr(host), data.r32());
+      break;
+    case 8:
+      COMP->mov(data, value);
+      COMP->bswap(data);
+      COMP->mov(x86::qword_ptr(host), data);
+      break;
+    }
+    J_CheckReservations(b, host, size);
+    COMP->jmp(doneLabel);
+  }
+
+  COMP->bind(slowLabel);
+  void *helper = size == 1 ? (void*)JITWriteMemory8 : size == 2 ? (void*)JITWriteMemory16 :
+    size == 4 ? (void*)JITWriteMemory32 : (void*)JITWriteMemory64;
+  InvokeNode *write = nullptr;
+  J_Invoke(b, &write, helper, FuncSignature::build<void, PPU_STATE*, u64, u64>());
+  write->setArg(0, b->ppuState->Base());
+  write->setArg(1, EA);
+  write->setArg(2, value.r64());
+  J_ExitOnException(b, PPU_EX_DATASTOR | PPU_EX_DATASEGM);
+
+  COMP->bind(doneLabel);
+}
+
+//
+// Vector registers
+//
+// VRs keep every word in host order (see PPC_VXU.h), so guest byte i is host byte i ^ 3 and quadwords
+// are moved between them and guest memory with a byte swap of every word.
+//
+
+// VMX128 register fields, the interpreter macros only work on the instruction being executed
+inline u32 J_VD128(PPCOpcode instr) { return instr.VMX128.VD128l | (instr.VMX128.VD128h << 5); }
+inline u32 J_VA128(PPCOpcode instr) { return instr.VMX128.VA128l | (instr.VMX128.VA128h << 5) | (instr.VMX128.VA128H << 6); }
+inline u32 J_VB128(PPCOpcode instr) { return instr.VMX128.VB128l | (instr.VMX128.VB128h << 5); }
+
+// Places a 16 byte constant in the block's constant pool.
+inline x86::Mem J_VectorConst(JITBlockBuilder *b, const std::array<u8, 16> &bytes) {
+  x86::Mem mem = COMP->newConst(ConstPoolScope::kLocal, bytes.data(), bytes.size());
+  mem.setSize(16);
+  return mem;
+}
 
-  // Zero compare (logical)
-  Label is_zero = COMP->newLabel();
-  Label done = COMP->newLabel();
+// Same value in every word.
+inline x86::Mem J_VectorConst32(JITBlockBuilder *b, u32 value) {
+  std::array<u8, 16> bytes{};
+  for (u32 i = 0; i != 16; i += 4)
+    std::memcpy(&bytes[i], &value, sizeof(value));
+  return J_VectorConst(b, bytes);
+}
 
-  COMP->xor_(field, field); // Clear field
+// Same value in every byte.
+inline x86::Mem J_VectorConst8(JITBlockBuilder *b, u8 value) {
+  return J_VectorConst32(b, value * 0x01010101u);
+}
 
-  COMP->test(value, value); // Logical test
-  COMP->jz(is_zero);
+// pshufb control swapping the bytes of every word
+inline x86::Mem J_WordSwapMask(JITBlockBuilder *b) {
+  return J_VectorConst(b, { 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 });
+}
 
-  // result != 0: GT = 1
-  COMP->mov(field, imm(1 << (3 - CR_BIT_GT)));
-  COMP->jmp(done);
+// Raises the VXU unavailable exception when MSR[VXU] is clear. Like DataMode() it's only checked
+// again after the registers got invalidated, the MSR only changes trough helpers.
+inline void J_CheckVXU(JITBlockBuilder *b) {
+  if (b->regs.VXUChecked())
+    return;
+  b->regs.SetVXUChecked();
+  Label availableLabel = COMP->newLabel();
+  COMP->bt(MSRPtr().Ptr<u64>(), 25); // MSR[VXU]
+  COMP->jc(availableLabel);
+  COMP->or_(b->threadCtx->scalar(&PPU_THREAD_REGISTERS::exceptReg).Ptr<u16>(), imm(PPU_EX_VXU));
+  J_ExitOnException(b, PPU_EX_VXU);
+  COMP->bind(availableLabel);
+}
 
-  COMP->bind(is_zero);
-  // result == 0: EQ = 1
-  COMP->mov(field, imm(1 << (3 - CR_BIT_EQ)));
+// Reads the quadword at EA, which must be 16 byte aligned, into a new XMM register.
+inline x86::Xmm J_ReadVector(JITBlockBuilder *b, x86::Gp EA) {
+  x86::Xmm value = newXMM();
+  Label slowLabel = COMP->newLabel();
+  Label doneLabel = COMP->newLabel();
+
+  if (!Config::debug.haltOnReadAddress) {
+    x86::Gp host = J_ProbeHostPointer(b, EA, 16, slowLabel);
+    COMP->movdqu(value, x86::xmmword_ptr(host));
+    COMP->pshufb(value, J_WordSwapMask(b));
+    COMP->jmp(doneLabel);
+  }
+
+  COMP->bind(slowLabel);
+  x86::Mem slot = COMP->newStack(16, 16);
+  slot.setSize(16);
+  x86::Gp slotPtr = newGPptr();
+  COMP->lea(slotPtr, slot);
+  InvokeNode *read = nullptr;
+  J_Invoke(b, &read, (void*)JITReadVector, FuncSignature::build<void, PPU_STATE*, u64, Base::Vector128*>());
+  read->setArg(0, b->ppuState->Base());
+  read->setArg(1, EA);
+  read->setArg(2, slotPtr);
+  J_ExitOnException(b, PPU_EX_DATASTOR | PPU_EX_DATASEGM);
+  COMP->movdqa(value, slot);
+
+  COMP->bind(doneLabel);
+  return value;
+}
 
-  COMP->bind(done);
+// Writes value to the quadword at EA, which must be 16 byte aligned. Value is left untouched.
+inline void J_WriteVector(JITBlockBuilder *b, x86::Gp EA, x86::Xmm value) {
+  Label slowLabel = COMP->newLabel();
+  Label doneLabel = COMP->newLabel();
+
+  if (!Config::debug.haltOnWriteAddress && XeMain::ram) {
+    x86::Gp host = J_ProbeWritePointer(b, EA, 16, slowLabel);
+    x86::Xmm data = newXMM();
+    COMP->movdqa(data, value);
+    COMP->pshufb(data, J_WordSwapMask(b));
+    COMP->movdqu(x86::xmmword_ptr(host), data);
+    J_CheckReservations(b, host, 16);
+    COMP->jmp(doneLabel);
+  }
 
-  // Set field in CR
-  J_SetCRField(b, field, index);
+  COMP->bind(slowLabel);
+  x86::Mem slot = COMP->newStack(16, 16);
+  slot.setSize(16);
+  x86::Gp slotPtr = newGPptr();
+  COMP->movdqa(slot, value);
+  COMP->lea(slotPtr, slot);
+  InvokeNode *write = nullptr;
+  J_Invoke(b, &write, (void*)JITWriteVector, FuncSignature::build<void, PPU_STATE*, u64, const Base::Vector128*>());
+  write->setArg(0, b->ppuState->Base());
+  write->setArg(1, EA);
+  write->setArg(2, slotPtr);
+  J_ExitOnException(b, PPU_EX_DATASTOR | PPU_EX_DATASEGM);
+
+  COMP->bind(doneLabel);
 }
 
 #endif
\ No newline at end of file
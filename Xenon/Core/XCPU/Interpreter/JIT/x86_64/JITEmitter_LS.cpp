@@ -0,0 +1,476 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#include "JITEmitter_Helpers.h"
+
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+
+//
+// Utilities
+//
+
+// Effective address forms of the integer load/store instructions
+enum class eJITAddrForm : u8 {
+  D,  // (rA|0) + EXTS(d)
+  DS, // (rA|0) + EXTS(ds || 0b00)
+  X   // (rA|0) + (rB)
+};
+
+// Computes the EA of a load/store. Update forms always use rA.
+static x86::Gp J_EffectiveAddress(JITBlockBuilder *b, PPCOpcode instr, eJITAddrForm form, bool update) {
+  x86::Gp EA = newGP64();
+  const bool useRA = instr.ra || update;
+  if (form == eJITAddrForm::X) {
+    x86::Gp rB = GPRReg(instr.rb);
+    if (useRA) {
+      COMP->mov(EA, GPRReg(instr.ra));
+      COMP->add(EA, rB);
+    } else {
+      COMP->mov(EA, rB);
+    }
+    return EA;
+  }
+  const s32 disp = form == eJITAddrForm::DS ? (instr.simm16 & ~3) : instr.simm16;
+  if (useRA) {
+    COMP->mov(EA, GPRReg(instr.ra));
+    COMP->add(EA, disp);
+  } else {
+    COMP->mov(EA, static_cast<s64>(disp));
+  }
+  return EA;
+}
+
+// Emits a load of size bytes into rD, optionally sign extended or byte reversed.
+// rD and rA (for update forms) are left untouched if the access raised an exception.
+static void J_Load(JITBlockBuilder *b, PPCOpcode instr, u8 size, eJITAddrForm form,
+                   bool update, bool algebraic = false, bool reversed = false) {
+  x86::Gp EA = J_EffectiveAddress(b, instr, form, update);
+  x86::Gp value = J_ReadMemory(b, EA, size);
+  if (reversed) {
+    if (size == 2)
+      COMP->rol(value.r16(), 8);
+    else
+      COMP->bswap(value.r32());
+  }
+  if (algebraic) {
+    if (size == 2)
+      COMP->movsx(value, value.r16());
+    else
+      COMP->movsxd(value, value.r32());
+  }
+  COMP->mov(GPRRegOut(instr.rd), value);
+  if (update)
+    COMP->mov(GPRRegOut(instr.ra), EA);
+}
+
+// Emits lvx and its variants, vD <- MEM(EA & ~0xF, 16).
+static void J_LoadVector(JITBlockBuilder *b, PPCOpcode instr, u32 vd) {
+  J_CheckVXU(b);
+  x86::Gp EA = J_EffectiveAddress(b, instr, eJITAddrForm::X, false);
+  COMP->and_(EA, -16);
+  x86::Xmm value = J_ReadVector(b, EA);
+  COMP->movaps(VRRegOut(vd), value);
+}
+
+// Emits lvlx/lvrx and their variants. The aligned quadword containing EA gets shifted by
+// eb = EA & 0xF with a pshufb control, lvrx doesn't access memory at all when eb is 0.
+static void J_LoadVectorShifted(JITBlockBuilder *b, PPCOpcode instr, u32 vd, bool right) {
+  J_CheckVXU(b);
+  x86::Gp EA = J_EffectiveAddress(b, instr, eJITAddrForm::X, false);
+  x86::Gp eb = newGP32();
+  COMP->mov(eb, EA.r32());
+  COMP->and_(eb, 0xF);
+
+  x86::Xmm result = newXMM();
+  Label doneLabel = COMP->newLabel();
+  if (right) {
+    // The read below is skipped at runtime, the data mode it uses must be fetched before the branch
+    b->regs.DataMode();
+    COMP->pxor(result, result);
+    COMP->test(eb, eb);
+    COMP->jz(doneLabel);
+  }
+  COMP->and_(EA, -16);
+  x86::Xmm quad = J_ReadVector(b, EA);
+
+  // Guest byte i of the result is guest byte i + eb (lvlx) or i + eb - 16 (lvrx) of the quadword.
+  // The bias puts out of range indices at 0x80 and above so pshufb clears them.
+  std::array<u8, 16> base{};
+  for (u32 hostByte = 0; hostByte != 16; hostByte++)
+    base[hostByte] = static_cast<u8>((hostByte ^ 3) + (right ? -16 : 0x70));
+  x86::Xmm control = newXMM();
+  COMP->imul(eb, eb, 0x01010101);
+  COMP->movd(control, eb);
+  COMP->pshufd(control, control, 0);
+  COMP->paddb(control, J_VectorConst(b, base));
+  COMP->pxor(control, J_VectorConst8(b, 3));
+  COMP->pshufb(quad, control);
+  COMP->movaps(result, quad);
+
+  COMP->bind(doneLabel);
+  COMP->movaps(VRRegOut(vd), result);
+}
+
+// Emits stvx and its variants, MEM(EA & ~0xF, 16) <- vS.
+static void J_StoreVector(JITBlockBuilder *b, PPCOpcode instr, u32 vs) {
+  J_CheckVXU(b);
+  x86::Xmm value = VRReg(vs);
+  x86::Gp EA = J_EffectiveAddress(b, instr, eJITAddrForm::X, false);
+  COMP->and_(EA, -16);
+  J_WriteVector(b, EA, value);
+}
+
+// Emits a store of the low size bytes of rS, optionally byte reversed.
+// rA (for update forms) is left untouched if the access raised an exception.
+static void J_Store(JITBlockBuilder *b, PPCOpcode instr, u8 size, eJITAddrForm form,
+                    bool update, bool reversed = false) {
+  x86::Gp EA = J_EffectiveAddress(b, instr, form, update);
+  x86::Gp value = GPRReg(instr.rs);
+  if (reversed) {
+    x86::Gp swapped = newGP64();
+    COMP->mov(swapped.r32(), value.r32());
+    if (size == 2)
+      COMP->rol(swapped.r16(), 8);
+    else
+      COMP->bswap(swapped.r32());
+    value = swapped;
+  }
+  J_WriteMemory(b, EA, value, size);
+  if (update)
+    COMP->mov(GPRRegOut(instr.ra), EA);
+}
+
+using enum eJITAddrForm;
+
+//
+// Store Byte
+//
+
+// Store Byte (x'9800 0000')
+void PPCInterpreter::PPCInterpreterJIT_stb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 1, D, false);
+}
+
+// Store Byte with Update (x'9C00 0000')
+void PPCInterpreter::PPCInterpreterJIT_stbu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 1, D, true);
+}
+
+// Store Byte with Update Indexed (x'7C00 01EE')
+void PPCInterpreter::PPCInterpreterJIT_stbux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 1, X, true);
+}
+
+// Store Byte Indexed (x'7C00 01AE')
+void PPCInterpreter::PPCInterpreterJIT_stbx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 1, X, false);
+}
+
+//
+// Store Halfword
+//
+
+// Store Half Word (x'B000 0000')
+void PPCInterpreter::PPCInterpreterJIT_sth(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 2, D, false);
+}
+
+// Store Half Word Byte-Reverse Indexed (x'7C00 072C')
+void PPCInterpreter::PPCInterpreterJIT_sthbrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 2, X, false, true);
+}
+
+// Store Half Word with Update (x'B400 0000')
+void PPCInterpreter::PPCInterpreterJIT_sthu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 2, D, true);
+}
+
+// Store Half Word with Update Indexed (x'7C00 036E')
+void PPCInterpreter::PPCInterpreterJIT_sthux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 2, X, true);
+}
+
+// Store Half Word Indexed (x'7C00 032E')
+void PPCInterpreter::PPCInterpreterJIT_sthx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 2, X, false);
+}
+
+//
+// Store Word
+//
+
+// Store Word (x'9000 0000')
+void PPCInterpreter::PPCInterpreterJIT_stw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 4, D, false);
+}
+
+// Store Word Byte-Reverse Indexed (x'7C00 052C')
+void PPCInterpreter::PPCInterpreterJIT_stwbrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 4, X, false, true);
+}
+
+// Store Word with Update (x'9400 0000')
+void PPCInterpreter::PPCInterpreterJIT_stwu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 4, D, true);
+}
+
+// Store Word with Update Indexed (x'7C00 016E')
+void PPCInterpreter::PPCInterpreterJIT_stwux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 4, X, true);
+}
+
+// Store Word Indexed (x'7C00 012E')
+void PPCInterpreter::PPCInterpreterJIT_stwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 4, X, false);
+}
+
+//
+// Store Doubleword
+//
+
+// Store Double Word (x'F800 0000')
+void PPCInterpreter::PPCInterpreterJIT_std(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 8, DS, false);
+}
+
+// Store Double Word with Update (x'F800 0001')
+void PPCInterpreter::PPCInterpreterJIT_stdu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 8, DS, true);
+}
+
+// Store Double Word with Update Indexed (x'7C00 016A')
+void PPCInterpreter::PPCInterpreterJIT_stdux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 8, X, true);
+}
+
+// Store Double Word Indexed (x'7C00 012A')
+void PPCInterpreter::PPCInterpreterJIT_stdx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Store(b, instr, 8, X, false);
+}
+
+//
+// Load Byte
+//
+
+// Load Byte and Zero (x'8800 0000')
+void PPCInterpreter::PPCInterpreterJIT_lbz(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 1, D, false);
+}
+
+// Load Byte and Zero with Update (x'8C00 0000')
+void PPCInterpreter::PPCInterpreterJIT_lbzu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 1, D, true);
+}
+
+// Load Byte and Zero with Update Indexed (x'7C00 00EE')
+void PPCInterpreter::PPCInterpreterJIT_lbzux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 1, X, true);
+}
+
+// Load Byte and Zero Indexed (x'7C00 00AE')
+void PPCInterpreter::PPCInterpreterJIT_lbzx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 1, X, false);
+}
+
+//
+// Load Halfword
+//
+
+// Load Half Word Algebraic (x'A800 0000')
+void PPCInterpreter::PPCInterpreterJIT_lha(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 2, D, false, true);
+}
+
+// Load Half Word Algebraic with Update (x'AC00 0000')
+void PPCInterpreter::PPCInterpreterJIT_lhau(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 2, D, true, true);
+}
+
+// Load Half Word Algebraic with Update Indexed (x'7C00 02EE')
+void PPCInterpreter::PPCInterpreterJIT_lhaux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 2, X, true, true);
+}
+
+// Load Half Word Algebraic Indexed (x'7C00 02AE')
+void PPCInterpreter::PPCInterpreterJIT_lhax(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 2, X, false, true);
+}
+
+// Load Half Word Byte-Reverse Indexed (x'7C00 062C')
+void PPCInterpreter::PPCInterpreterJIT_lhbrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 2, X, false, false, true);
+}
+
+// Load Half Word and Zero (x'A000 0000')
+void PPCInterpreter::PPCInterpreterJIT_lhz(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 2, D, false);
+}
+
+// Load Half Word and Zero with Update (x'A400 0000')
+void PPCInterpreter::PPCInterpreterJIT_lhzu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 2, D, true);
+}
+
+// Load Half Word and Zero with Update Indexed (x'7C00 026E')
+void PPCInterpreter::PPCInterpreterJIT_lhzux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 2, X, true);
+}
+
+// Load Half Word and Zero Indexed (x'7C00 022E')
+void PPCInterpreter::PPCInterpreterJIT_lhzx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 2, X, false);
+}
+
+//
+// Load Word
+//
+
+// Load Word Algebraic (x'E800 0002')
+void PPCInterpreter::PPCInterpreterJIT_lwa(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 4, DS, false, true);
+}
+
+// Load Word Algebraic Indexed (x'7C00 02AA')
+void PPCInterpreter::PPCInterpreterJIT_lwax(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 4, X, false, true);
+}
+
+// Load Word Algebraic with Update Indexed (x'7C00 02EA')
+void PPCInterpreter::PPCInterpreterJIT_lwaux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 4, X, true, true);
+}
+
+// Load Word Byte-Reverse Indexed (x'7C00 042C')
+void PPCInterpreter::PPCInterpreterJIT_lwbrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 4, X, false, false, true);
+}
+
+// Load Word and Zero (x'8000 0000')
+void PPCInterpreter::PPCInterpreterJIT_lwz(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 4, D, false);
+}
+
+// Load Word and Zero with Update (x'8400 0000')
+void PPCInterpreter::PPCInterpreterJIT_lwzu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 4, D, true);
+}
+
+// Load Word and Zero with Update Indexed (x'7C00 006E')
+void PPCInterpreter::PPCInterpreterJIT_lwzux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 4, X, true);
+}
+
+// Load Word and Zero Indexed (x'7C00 002E')
+void PPCInterpreter::PPCInterpreterJIT_lwzx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 4, X, false);
+}
+
+//
+// Load Doubleword
+//
+
+// Load Double Word (x'E800 0000')
+void PPCInterpreter::PPCInterpreterJIT_ld(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 8, DS, false);
+}
+
+// Load Double Word with Update (x'E800 0001')
+void PPCInterpreter::PPCInterpreterJIT_ldu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 8, DS, true);
+}
+
+// Load Double Word with Update Indexed (x'7C00 006A')
+void PPCInterpreter::PPCInterpreterJIT_ldux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 8, X, true);
+}
+
+// Load Double Word Indexed (x'7C00 002A')
+void PPCInterpreter::PPCInterpreterJIT_ldx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_Load(b, instr, 8, X, false);
+}
+
+
+//
+// Load/Store Vector
+//
+
+// Load Vector Indexed (x'7C00 00CE')
+void PPCInterpreter::PPCInterpreterJIT_lvx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_LoadVector(b, instr, instr.vd);
+}
+
+// Load Vector Indexed LRU (x'7C00 02CE')
+void PPCInterpreter::PPCInterpreterJIT_lvxl(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_LoadVector(b, instr, instr.vd);
+}
+
+// Load Vector Indexed 128 (x'1000 00C3')
+void PPCInterpreter::PPCInterpreterJIT_lvx128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_LoadVector(b, instr, J_VD128(instr));
+}
+
+// Load Vector Indexed LRU 128 (x'1000 02C3')
+void PPCInterpreter::PPCInterpreterJIT_lvxl128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_LoadVector(b, instr, J_VD128(instr));
+}
+
+// Load Vector Left Indexed (x'7C00 040E')
+void PPCInterpreter::PPCInterpreterJIT_lvlx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_LoadVectorShifted(b, instr, instr.vd, false);
+}
+
+// Load Vector Left Indexed LRU (x'7C00 060E')
+void PPCInterpreter::PPCInterpreterJIT_lvlxl(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_LoadVectorShifted(b, instr, instr.vd, false);
+}
+
+// Load Vector Left Indexed 128 (x'1000 0403')
+void PPCInterpreter::PPCInterpreterJIT_lvlx128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_LoadVectorShifted(b, instr, J_VD128(instr), false);
+}
+
+// Load Vector Left Indexed LRU 128 (x'1000 0603')
+void PPCInterpreter::PPCInterpreterJIT_lvlxl128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_LoadVectorShifted(b, instr, J_VD128(instr), false);
+}
+
+// Load Vector Right Indexed (x'7C00 044E')
+void PPCInterpreter::PPCInterpreterJIT_lvrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_LoadVectorShifted(b, instr, instr.vd, true);
+}
+
+// Load Vector Right Indexed LRU (x'7C00 064E')
+void PPCInterpreter::PPCInterpreterJIT_lvrxl(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_LoadVectorShifted(b, instr, instr.vd, true);
+}
+
+// Load Vector Right Indexed 128 (x'1000 0443')
+void PPCInterpreter::PPCInterpreterJIT_lvrx128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_LoadVectorShifted(b, instr, J_VD128(instr), true);
+}
+
+// Load Vector Right Indexed LRU 128 (x'1000 0643')
+void PPCInterpreter::PPCInterpreterJIT_lvrxl128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_LoadVectorShifted(b, instr, J_VD128(instr), true);
+}
+
+// Store Vector Indexed (x'7C00 01CE')
+void PPCInterpreter::PPCInterpreterJIT_stvx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_StoreVector(b, instr, instr.vs);
+}
+
+// Store Vector Indexed LRU (x'7C00 03CE')
+void PPCInterpreter::PPCInterpreterJIT_stvxl(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_StoreVector(b, instr, instr.vs);
+}
+
+// Store Vector Indexed 128 (x'1000 01C3')
+void PPCInterpreter::PPCInterpreterJIT_stvx128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_StoreVector(b, instr, J_VD128(instr));
+}
+
+// Store Vector Indexed LRU 128 (x'1000 03C3')
+void PPCInterpreter::PPCInterpreterJIT_stvxl128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_StoreVector(b, instr, J_VD128(instr));
+}
+
+#endif
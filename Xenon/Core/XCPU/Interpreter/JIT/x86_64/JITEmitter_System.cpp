@@ -14,7 +14,7 @@ void PPCInterpreter::PPCInterpreterJIT_mfspr(PPU_STATE *ppuState, JITBlockBuilde
 
   switch (sprNum) {
   case SPR_XER:
-    COMP->mov(rSValue, SPRPtr(XER).Base());
+    COMP->mov(rSValue.r32(), XERReg());
     break;
   case SPR_LR:
     COMP->mov(rSValue, SPRPtr(LR));
@@ -28,9 +28,14 @@ void PPCInterpreter::PPCInterpreterJIT_mfspr(PPU_STATE *ppuState, JITBlockBuilde
   case SPR_DAR:
     COMP->mov(rSValue, SPRPtr(DAR));
     break;
-  case SPR_DEC:
-    COMP->mov(rSValue, SPRPtr(DEC));
-    break;
+  case SPR_DEC: {
+    // Updated lazily, same as the time base
+    InvokeNode *read = nullptr;
+    J_Invoke(b, &read, (void*)&ppcGetDecrementer, FuncSignature::build<s32, PPU_STATE*>());
+    read->setArg(0, b->ppuState->Base());
+    read->setRet(0, rSValue.r32());
+    COMP->movsxd(rSValue, rSValue.r32());
+  } break;
   case SPR_SDR1:
     COMP->mov(rSValue, SharedSPRPtr(SDR1));
     break;
@@ -50,12 +55,14 @@ void PPCInterpreter::PPCInterpreterJIT_mfspr(PPU_STATE *ppuState, JITBlockBuilde
     COMP->mov(rSValue, SPRPtr(VRSAVE));
     break;
   case SPR_TBL_RO:
-    COMP->mov(rSValue, SharedSPRPtr(TB));
-    break;
-  case SPR_TBU_RO:
-    COMP->mov(rSValue, 0xFFFFFFFF00000000);
-    COMP->and_(rSValue, SharedSPRPtr(TB));
-    break;
+    J_ReadTimeBase(b, rSValue);
+    break;
+  case SPR_TBU_RO: {
+    x86::Gp mask = newGP64();
+    J_ReadTimeBase(b, rSValue);
+    COMP->mov(mask, 0xFFFFFFFF00000000);
+    COMP->and_(rSValue, mask);
+  } break;
   case SPR_SPRG0:
     COMP->mov(rSValue, SPRPtr(SPRG0));
     break;
@@ -69,7 +76,7 @@ void PPCInterpreter::PPCInterpreterJIT_mfspr(PPU_STATE *ppuState, JITBlockBuilde
     COMP->mov(rSValue, SPRPtr(SPRG3));
     break;
   case SPR_TB:
-    COMP->mov(rSValue, SharedSPRPtr(TB));
+    J_ReadTimeBase(b, rSValue);
     break;
   case SPR_PVR:
     COMP->mov(rSValue, SharedSPRPtr(PVR));
@@ -121,6 +128,6 @@ void PPCInterpreter::PPCInterpreterJIT_mfspr(PPU_STATE *ppuState, JITBlockBuilde
     break;
   }
 
-  COMP->mov(GPRPtr(rS), rSValue);
+  COMP->mov(GPRRegOut(rS), rSValue);
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,1021 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#include "JITEmitter_Helpers.h"
+
+#include "Base/HostCPU.h"
+
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+
+//
+// Utilities
+//
+// Same sequences as the host kernels in PPC_VXU.h, on VRs cached in XMM registers. Cached VRs are
+// never modified in place, results go to a new register that's then moved into vD.
+//
+
+// Runs the interpreter handler of an instruction the host CPU has no native sequence for.
+static void J_VXUInterpreter(JITBlockBuilder *b, PPCInterpreter::instructionHandler handler) {
+  b->regs.Flush();
+  InvokeNode *call = nullptr;
+  J_Invoke(b, &call, (void*)handler, FuncSignature::build<void, PPU_STATE*>());
+  call->setArg(0, b->ppuState->Base());
+  b->regs.Invalidate();
+  b->checkExceptions = true;
+}
+
+// Copy of source, used as the destination of two operand instructions.
+static x86::Xmm J_CopyVector(JITBlockBuilder *b, x86::Xmm source) {
+  x86::Xmm copy = newXMM();
+  COMP->movaps(copy, source);
+  return copy;
+}
+
+// mask ? ifSet : ifClear, bitwise. Clobbers mask and ifSet, returns the register with the result.
+static x86::Xmm J_Select(JITBlockBuilder *b, x86::Xmm mask, x86::Xmm ifSet, x86::Xmm ifClear) {
+  COMP->pand(ifSet, mask);
+  COMP->pandn(mask, ifClear);
+  COMP->por(mask, ifSet);
+  return mask;
+}
+
+// vD <- vA op vB, for instructions with a direct SSE equivalent.
+static void J_VectorBinary(JITBlockBuilder *b, x86::Inst::Id op, u32 vd, u32 va, u32 vb) {
+  J_CheckVXU(b);
+  x86::Xmm x = VRReg(va);
+  x86::Xmm y = VRReg(vb);
+  x86::Xmm result = J_CopyVector(b, x);
+  COMP->emit(op, result, y);
+  COMP->movaps(VRRegOut(vd), result);
+}
+
+// Sets the sticky VSCR[SAT] when a saturating instruction clamped any element, that is when its
+// result differs from the modulo one. Clobbers modulo.
+static void J_SetSATIfDifferent(JITBlockBuilder *b, x86::Xmm saturated, x86::Xmm modulo) {
+  x86::Gp mask = newGP32();
+  x86::Gp sat = newGP32();
+  COMP->pcmpeqb(modulo, saturated);
+  COMP->pmovmskb(mask, modulo);
+  COMP->xor_(sat, sat);
+  COMP->cmp(mask, 0xFFFF);
+  COMP->setne(sat.r8());
+  COMP->or_(b->threadCtx->scalar(&PPU_THREAD_REGISTERS::VSCR).Ptr<u32>(), sat); // VSCR[SAT]
+}
+
+// vD <- vA op vB with saturation, modOp being the wrapping version of op.
+static void J_VectorBinarySat(JITBlockBuilder *b, x86::Inst::Id op, x86::Inst::Id modOp, u32 vd, u32 va, u32 vb) {
+  J_CheckVXU(b);
+  x86::Xmm x = VRReg(va);
+  x86::Xmm y = VRReg(vb);
+  x86::Xmm result = J_CopyVector(b, x);
+  x86::Xmm modulo = J_CopyVector(b, x);
+  COMP->emit(op, result, y);
+  COMP->emit(modOp, modulo, y);
+  J_SetSATIfDifferent(b, result, modulo);
+  COMP->movaps(VRRegOut(vd), result);
+}
+
+// Signed averages, done unsigned on values biased by the sign bit.
+static void J_VectorAverageSigned(JITBlockBuilder *b, x86::Inst::Id op, u32 bias, u32 vd, u32 va, u32 vb) {
+  J_CheckVXU(b);
+  x86::Mem biasConst = J_VectorConst32(b, bias);
+  x86::Xmm x = J_CopyVector(b, VRReg(va));
+  x86::Xmm y = J_CopyVector(b, VRReg(vb));
+  COMP->pxor(x, biasConst);
+  COMP->pxor(y, biasConst);
+  COMP->emit(op, x, y);
+  COMP->pxor(x, biasConst);
+  COMP->movaps(VRRegOut(vd), x);
+}
+
+// Sets CR6 from a compare result: all elements true (LT), none true (EQ). See vxuCompareCR6.
+static void J_VectorCompareCR6(JITBlockBuilder *b, x86::Xmm result) {
+  x86::Gp mask = newGP32();
+  x86::Gp field = newGP32();
+  x86::Gp flag = newGP32();
+  COMP->pmovmskb(mask, result);
+  COMP->xor_(field, field);
+  COMP->xor_(flag, flag);
+  COMP->cmp(mask, 0xFFFF);
+  COMP->sete(field.r8());
+  COMP->shl(field, 3 - CR_BIT_LT);
+  COMP->test(mask, mask);
+  COMP->sete(flag.r8());
+  COMP->shl(flag, 3 - CR_BIT_EQ);
+  COMP->or_(field, flag);
+  J_SetCRField(b, field, 6);
+}
+
+// Integer compares. Unsigned ones are done signed on values biased by the sign bit (bias != 0).
+static void J_VectorCompare(JITBlockBuilder *b, x86::Inst::Id op, u32 vd, u32 va, u32 vb, bool record, u32 bias = 0) {
+  J_CheckVXU(b);
+  x86::Xmm x = VRReg(va);
+  x86::Xmm y = VRReg(vb);
+  x86::Xmm result = J_CopyVector(b, x);
+  if (bias != 0) {
+    x86::Mem biasConst = J_VectorConst32(b, bias);
+    y = J_CopyVector(b, y);
+    COMP->pxor(result, biasConst);
+    COMP->pxor(y, biasConst);
+  }
+  COMP->emit(op, result, y);
+  COMP->movaps(VRRegOut(vd), result);
+  if (record)
+    J_VectorCompareCR6(b, result);
+}
+
+// Denormal elements of value to zero of the same sign in non-Java mode, see vxuFloat. mask is the
+// one from JITRegisterCache::VXUFlushMask().
+static x86::Xmm J_FlushDenormals(JITBlockBuilder *b, x86::Xmm value, x86::Xmm mask) {
+  x86::Xmm result = J_CopyVector(b, value);
+  COMP->pand(result, J_VectorConst32(b, 0x7F800000));
+  COMP->pcmpeqd(result, J_VectorConst32(b, 0));
+  COMP->pand(result, mask);
+  COMP->pandn(result, value);
+  return result;
+}
+
+// Float compares, predicate being a cmpps one. Swapped for the greater than forms, like SSE does.
+static void J_VectorFloatCompare(JITBlockBuilder *b, u8 predicate, bool swap, u32 vd, u32 va, u32 vb, bool record) {
+  J_CheckVXU(b);
+  x86::Xmm mask = b->regs.VXUFlushMask();
+  x86::Xmm x = J_FlushDenormals(b, VRReg(va), mask);
+  x86::Xmm y = J_FlushDenormals(b, VRReg(vb), mask);
+  if (swap)
+    std::swap(x, y);
+  COMP->cmpps(x, y, predicate);
+  COMP->movaps(VRRegOut(vd), x);
+  if (record)
+    J_VectorCompareCR6(b, x);
+}
+
+// Float arithmetic operations
+enum class eJITVecFPOp : u8 {
+  Add,
+  Sub,
+  Mul,
+  Max,
+  Min
+};
+
+// vD <- vA op vB, with the denormal flushing of vxuFloat.
+static void J_VectorFPArith(JITBlockBuilder *b, eJITVecFPOp op, u32 vd, u32 va, u32 vb) {
+  J_CheckVXU(b);
+  x86::Xmm mask = b->regs.VXUFlushMask();
+  x86::Xmm x = J_FlushDenormals(b, VRReg(va), mask);
+  x86::Xmm y = J_FlushDenormals(b, VRReg(vb), mask);
+  x86::Xmm result = x;
+  switch (op) {
+  case eJITVecFPOp::Add: COMP->addps(result, y); break;
+  case eJITVecFPOp::Sub: COMP->subps(result, y); break;
+  case eJITVecFPOp::Mul: COMP->mulps(result, y); break;
+  case eJITVecFPOp::Max:
+  case eJITVecFPOp::Min: {
+    // VMX returns the NaN operand and orders -0 below +0, SSE returns the second operand for both
+    const bool max = op == eJITVecFPOp::Max;
+    x86::Xmm equal = J_CopyVector(b, x);
+    x86::Xmm signs = J_CopyVector(b, x);
+    x86::Xmm extreme = J_CopyVector(b, x);
+    COMP->cmpps(equal, y, 0); // EQ
+    max ? COMP->andps(signs, y) : COMP->orps(signs, y);
+    max ? COMP->maxps(extreme, y) : COMP->minps(extreme, y);
+    x86::Xmm ordered = J_Select(b, equal, signs, extreme);
+    x86::Xmm unordered = J_CopyVector(b, x);
+    COMP->cmpps(unordered, y, 3); // UNORD
+    COMP->addps(x, y);
+    result = J_Select(b, unordered, x, ordered);
+  } break;
+  }
+  COMP->movaps(VRRegOut(vd), J_FlushDenormals(b, result, mask));
+}
+
+// vD <- a * b + c, or -(a * b - c) when negate is set. Fused like the FMA kernels, hosts without
+// them use the interpreter's double precision emulation.
+static void J_VectorMultiplyAdd(JITBlockBuilder *b, PPCInterpreter::instructionHandler handler, bool negate,
+                                u32 vd, u32 va, u32 vb, u32 vc) {
+  const Base::HostCPUFeatures &host = Base::GetHostCPUFeatures();
+  if (!host.avx2 || !host.fma) {
+    J_VXUInterpreter(b, handler);
+    return;
+  }
+  J_CheckVXU(b);
+  x86::Xmm mask = b->regs.VXUFlushMask();
+  x86::Xmm x = J_FlushDenormals(b, VRReg(va), mask);
+  x86::Xmm y = J_FlushDenormals(b, VRReg(vb), mask);
+  x86::Xmm z = J_FlushDenormals(b, VRReg(vc), mask);
+  if (negate) {
+    COMP->vfmsub213ps(x, y, z);
+    COMP->xorps(x, J_VectorConst32(b, 0x80000000));
+  } else {
+    COMP->vfmadd213ps(x, y, z);
+  }
+  COMP->movaps(VRRegOut(vd), J_FlushDenormals(b, x, mask));
+}
+
+// Per word shifts by the low 5 bits of vB
+enum class eJITVecShift : u8 {
+  Left,
+  Right,
+  RightAlgebraic,
+  Rotate
+};
+
+// Per word shifts, with the AVX2 variable shifts. Older hosts use the interpreter.
+static void J_VectorShiftWord(JITBlockBuilder *b, PPCInterpreter::instructionHandler handler, eJITVecShift shift,
+                              u32 vd, u32 va, u32 vb) {
+  if (!Base::GetHostCPUFeatures().avx2) {
+    J_VXUInterpreter(b, handler);
+    return;
+  }
+  J_CheckVXU(b);
+  x86::Xmm x = VRReg(va);
+  x86::Xmm sh = J_CopyVector(b, VRReg(vb));
+  x86::Xmm result = newXMM();
+  COMP->pand(sh, J_VectorConst32(b, 31));
+  switch (shift) {
+  case eJITVecShift::Left: COMP->vpsllvd(result, x, sh); break;
+  case eJITVecShift::Right: COMP->vpsrlvd(result, x, sh); break;
+  case eJITVecShift::RightAlgebraic: COMP->vpsravd(result, x, sh); break;
+  case eJITVecShift::Rotate: {
+    x86::Xmm count = newXMM();
+    COMP->movdqa(count, J_VectorConst32(b, 32));
+    COMP->psubd(count, sh);
+    COMP->vpsllvd(result, x, sh);
+    COMP->vpsrlvd(count, x, count);
+    COMP->por(result, count);
+  } break;
+  }
+  COMP->movaps(VRRegOut(vd), result);
+}
+
+// Builds the result from guest bytes of vA || vB, guest byte i being byte source[i] (0-31).
+// Used for the instructions with an immediate (or fixed) byte selection.
+static void J_VectorShuffle(JITBlockBuilder *b, u32 vd, u32 va, u32 vb, const std::array<u8, 16> &source) {
+  J_CheckVXU(b);
+  std::array<u8, 16> fromA{};
+  std::array<u8, 16> fromB{};
+  bool useA = false, useB = false;
+  for (u32 hostByte = 0; hostByte != 16; hostByte++) {
+    const u8 s = source[hostByte ^ 3];
+    fromA[hostByte] = s < 16 ? (s ^ 3) : 0x80;
+    fromB[hostByte] = s < 16 ? 0x80 : ((s - 16) ^ 3);
+    useA |= s < 16;
+    useB |= s >= 16;
+  }
+  x86::Xmm x = VRReg(va);
+  x86::Xmm y = VRReg(vb);
+  x86::Xmm result = newXMM();
+  if (useA) {
+    COMP->movaps(result, x);
+    COMP->pshufb(result, J_VectorConst(b, fromA));
+  }
+  if (useB) {
+    x86::Xmm other = J_CopyVector(b, y);
+    COMP->pshufb(other, J_VectorConst(b, fromB));
+    useA ? COMP->por(result, other) : COMP->movaps(result, other);
+  }
+  COMP->movaps(VRRegOut(vd), result);
+}
+
+// vsldoi, guest bytes sh to sh + 15 of vA || vB
+static void J_VectorShiftLeftDouble(JITBlockBuilder *b, u32 vd, u32 va, u32 vb, u32 sh) {
+  std::array<u8, 16> source{};
+  for (u32 i = 0; i != 16; i++)
+    source[i] = static_cast<u8>(sh + i);
+  J_VectorShuffle(b, vd, va, vb, source);
+}
+
+// Modulo packs, the low half of every element of vA || vB. size is the element size in bytes.
+static void J_VectorPackModulo(JITBlockBuilder *b, u32 vd, u32 va, u32 vb, u32 size) {
+  std::array<u8, 16> source{};
+  const u32 half = size / 2;
+  for (u32 i = 0; i != 16; i++)
+    source[i] = static_cast<u8>((i / half) * size + half + i % half);
+  J_VectorShuffle(b, vd, va, vb, source);
+}
+
+// vperm, see Permute_SSSE3
+static void J_VectorPermute(JITBlockBuilder *b, u32 vd, u32 va, u32 vb, u32 vc) {
+  J_CheckVXU(b);
+  x86::Xmm x = VRReg(va);
+  x86::Xmm y = VRReg(vb);
+  x86::Xmm index = J_CopyVector(b, VRReg(vc));
+  // Host index of the selected guest byte, bit 4 picks vB
+  COMP->pand(index, J_VectorConst8(b, 0x1F));
+  COMP->pxor(index, J_VectorConst8(b, 3));
+  x86::Xmm fromB = J_CopyVector(b, index);
+  COMP->pcmpgtb(fromB, J_VectorConst8(b, 15));
+  x86::Xmm bytesA = J_CopyVector(b, x);
+  x86::Xmm bytesB = J_CopyVector(b, y);
+  COMP->pshufb(bytesA, index);
+  COMP->pshufb(bytesB, index);
+  COMP->movaps(VRRegOut(vd), J_Select(b, fromB, bytesB, bytesA));
+}
+
+// Merges, unpack of the high (first) or low (last) halves. Bytes and halfwords are unpacked from vB
+// to vA and their word halves swapped back, see MergeHighU8.
+static void J_VectorMerge(JITBlockBuilder *b, x86::Inst::Id op, u32 size, u32 vd, u32 va, u32 vb) {
+  J_CheckVXU(b);
+  x86::Xmm x = VRReg(va);
+  x86::Xmm y = VRReg(vb);
+  x86::Xmm result = J_CopyVector(b, size == 4 ? x : y);
+  COMP->emit(op, result, size == 4 ? y : x);
+  if (size != 4)
+    COMP->pshufd(result, result, 0xB1);
+  COMP->movaps(VRRegOut(vd), result);
+}
+
+// Sign extending unpacks of the high (first) or low (last) half, see UnpackHighS8.
+static void J_VectorUnpackSigned(JITBlockBuilder *b, x86::Inst::Id op, u32 size, u32 vd, u32 vb) {
+  J_CheckVXU(b);
+  x86::Xmm result = J_CopyVector(b, VRReg(vb));
+  COMP->pshuflw(result, result, 0xB1);
+  COMP->pshufhw(result, result, 0xB1);
+  COMP->emit(op, result, result);
+  if (size == 1)
+    COMP->psraw(result, 8);
+  else
+    COMP->psrad(result, 16);
+  COMP->movaps(VRRegOut(vd), result);
+}
+
+// Splats an element of vB, given as a pshufb control
+static void J_VectorSplat(JITBlockBuilder *b, u32 vd, u32 vb, const std::array<u8, 16> &control) {
+  J_CheckVXU(b);
+  x86::Xmm result = J_CopyVector(b, VRReg(vb));
+  COMP->pshufb(result, J_VectorConst(b, control));
+  COMP->movaps(VRRegOut(vd), result);
+}
+
+// Splats word index of vB
+static void J_VectorSplatWord(JITBlockBuilder *b, u32 vd, u32 vb, u32 index) {
+  J_CheckVXU(b);
+  x86::Xmm result = newXMM();
+  COMP->pshufd(result, VRReg(vb), index * 0x55);
+  COMP->movaps(VRRegOut(vd), result);
+}
+
+// Splats an immediate word
+static void J_VectorSplatImmediate(JITBlockBuilder *b, u32 vd, u32 value) {
+  J_CheckVXU(b);
+  COMP->movaps(VRRegOut(vd), J_VectorConst32(b, value));
+}
+
+//
+// Logical
+//
+
+// Vector Logical AND (x'1000 0404')
+void PPCInterpreter::PPCInterpreterJIT_vand(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPand, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Logical AND with Complement (x'1000 0444')
+void PPCInterpreter::PPCInterpreterJIT_vandc(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  // pandn complements the destination
+  J_VectorBinary(b, x86::Inst::kIdPandn, instr.vd, instr.vb, instr.va);
+}
+
+// Vector Logical OR (x'1000 0484')
+void PPCInterpreter::PPCInterpreterJIT_vor(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPor, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Logical NOR (x'1000 0504')
+void PPCInterpreter::PPCInterpreterJIT_vnor(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPor, instr.vd, instr.va, instr.vb);
+  x86::Xmm result = VRRegOut(instr.vd);
+  COMP->pxor(result, J_VectorConst32(b, 0xFFFFFFFF));
+}
+
+// Vector Logical XOR (x'1000 04C4')
+void PPCInterpreter::PPCInterpreterJIT_vxor(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  if (instr.va == instr.vb) {
+    // Common way to clear a register
+    J_CheckVXU(b);
+    x86::Xmm result = VRRegOut(instr.vd);
+    COMP->pxor(result, result);
+    return;
+  }
+  J_VectorBinary(b, x86::Inst::kIdPxor, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Select (x'1000 002A')
+void PPCInterpreter::PPCInterpreterJIT_vsel(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_CheckVXU(b);
+  x86::Xmm mask = J_CopyVector(b, VRReg(instr.vc));
+  x86::Xmm ifSet = J_CopyVector(b, VRReg(instr.vb));
+  x86::Xmm ifClear = VRReg(instr.va);
+  COMP->movaps(VRRegOut(instr.vd), J_Select(b, mask, ifSet, ifClear));
+}
+
+// Vector128 Logical AND
+void PPCInterpreter::PPCInterpreterJIT_vand128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPand, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+// Vector128 Logical AND with Complement
+void PPCInterpreter::PPCInterpreterJIT_vandc128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPandn, J_VD128(instr), J_VB128(instr), J_VA128(instr));
+}
+
+// Vector128 Logical OR
+void PPCInterpreter::PPCInterpreterJIT_vor128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPor, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+// Vector128 Logical NOR
+void PPCInterpreter::PPCInterpreterJIT_vnor128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPor, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+  x86::Xmm result = VRRegOut(J_VD128(instr));
+  COMP->pxor(result, J_VectorConst32(b, 0xFFFFFFFF));
+}
+
+// Vector128 Logical XOR
+void PPCInterpreter::PPCInterpreterJIT_vxor128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  if (J_VA128(instr) == J_VB128(instr)) {
+    J_CheckVXU(b);
+    x86::Xmm result = VRRegOut(J_VD128(instr));
+    COMP->pxor(result, result);
+    return;
+  }
+  J_VectorBinary(b, x86::Inst::kIdPxor, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+// Vector128 Select
+void PPCInterpreter::PPCInterpreterJIT_vsel128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_CheckVXU(b);
+  x86::Xmm mask = J_CopyVector(b, VRReg(J_VD128(instr)));
+  x86::Xmm ifSet = J_CopyVector(b, VRReg(J_VB128(instr)));
+  x86::Xmm ifClear = VRReg(J_VA128(instr));
+  COMP->movaps(VRRegOut(J_VD128(instr)), J_Select(b, mask, ifSet, ifClear));
+}
+
+//
+// Integer Arithmetic
+//
+
+// Vector Add Unsigned Byte Modulo (x'1000 0000')
+void PPCInterpreter::PPCInterpreterJIT_vaddubm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPaddb, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Add Unsigned Halfword Modulo (x'1000 0040')
+void PPCInterpreter::PPCInterpreterJIT_vadduhm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPaddw, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Add Unsigned Word Modulo (x'1000 0080')
+void PPCInterpreter::PPCInterpreterJIT_vadduwm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPaddd, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Subtract Unsigned Byte Modulo (x'1000 0400')
+void PPCInterpreter::PPCInterpreterJIT_vsububm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPsubb, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Subtract Unsigned Halfword Modulo (x'1000 0440')
+void PPCInterpreter::PPCInterpreterJIT_vsubuhm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPsubw, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Subtract Unsigned Word Modulo (x'1000 0480')
+void PPCInterpreter::PPCInterpreterJIT_vsubuwm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPsubd, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Add Unsigned Byte Saturate (x'1000 0200')
+void PPCInterpreter::PPCInterpreterJIT_vaddubs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinarySat(b, x86::Inst::kIdPaddusb, x86::Inst::kIdPaddb, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Add Unsigned Halfword Saturate (x'1000 0240')
+void PPCInterpreter::PPCInterpreterJIT_vadduhs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinarySat(b, x86::Inst::kIdPaddusw, x86::Inst::kIdPaddw, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Add Signed Byte Saturate (x'1000 0300')
+void PPCInterpreter::PPCInterpreterJIT_vaddsbs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinarySat(b, x86::Inst::kIdPaddsb, x86::Inst::kIdPaddb, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Add Signed Halfword Saturate (x'1000 0340')
+void PPCInterpreter::PPCInterpreterJIT_vaddshs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinarySat(b, x86::Inst::kIdPaddsw, x86::Inst::kIdPaddw, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Subtract Unsigned Byte Saturate (x'1000 0600')
+void PPCInterpreter::PPCInterpreterJIT_vsububs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinarySat(b, x86::Inst::kIdPsubusb, x86::Inst::kIdPsubb, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Subtract Unsigned Halfword Saturate (x'1000 0640')
+void PPCInterpreter::PPCInterpreterJIT_vsubuhs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinarySat(b, x86::Inst::kIdPsubusw, x86::Inst::kIdPsubw, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Subtract Signed Byte Saturate (x'1000 0700')
+void PPCInterpreter::PPCInterpreterJIT_vsubsbs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinarySat(b, x86::Inst::kIdPsubsb, x86::Inst::kIdPsubb, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Subtract Signed Halfword Saturate (x'1000 0740')
+void PPCInterpreter::PPCInterpreterJIT_vsubshs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinarySat(b, x86::Inst::kIdPsubsw, x86::Inst::kIdPsubw, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Average Unsigned Byte (x'1000 0402')
+void PPCInterpreter::PPCInterpreterJIT_vavgub(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPavgb, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Average Unsigned Halfword (x'1000 0442')
+void PPCInterpreter::PPCInterpreterJIT_vavguh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPavgw, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Average Signed Byte (x'1000 0502')
+void PPCInterpreter::PPCInterpreterJIT_vavgsb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorAverageSigned(b, x86::Inst::kIdPavgb, 0x80808080, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Average Signed Halfword (x'1000 0542')
+void PPCInterpreter::PPCInterpreterJIT_vavgsh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorAverageSigned(b, x86::Inst::kIdPavgw, 0x80008000, instr.vd, instr.va, instr.vb);
+}
+
+//
+// Minimum/Maximum
+//
+// Only bytes unsigned and halfwords signed have SSE2 instructions, the rest need SSE4.1.
+//
+
+// Emits a min/max that needs SSE4.1, or its interpreter handler.
+static void J_VectorMinMaxSSE41(JITBlockBuilder *b, PPCInterpreter::instructionHandler handler, x86::Inst::Id op,
+                                PPCOpcode instr) {
+  if (!Base::GetHostCPUFeatures().sse41) {
+    J_VXUInterpreter(b, handler);
+    return;
+  }
+  J_VectorBinary(b, op, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Maximum Unsigned Byte (x'1000 0002')
+void PPCInterpreter::PPCInterpreterJIT_vmaxub(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPmaxub, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Minimum Unsigned Byte (x'1000 0202')
+void PPCInterpreter::PPCInterpreterJIT_vminub(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPminub, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Maximum Signed Halfword (x'1000 0142')
+void PPCInterpreter::PPCInterpreterJIT_vmaxsh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPmaxsw, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Minimum Signed Halfword (x'1000 0342')
+void PPCInterpreter::PPCInterpreterJIT_vminsh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorBinary(b, x86::Inst::kIdPminsw, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Maximum Signed Byte (x'1000 0102')
+void PPCInterpreter::PPCInterpreterJIT_vmaxsb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMinMaxSSE41(b, &PPCInterpreter_vmaxsb, x86::Inst::kIdPmaxsb, instr);
+}
+
+// Vector Minimum Signed Byte (x'1000 0302')
+void PPCInterpreter::PPCInterpreterJIT_vminsb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMinMaxSSE41(b, &PPCInterpreter_vminsb, x86::Inst::kIdPminsb, instr);
+}
+
+// Vector Maximum Unsigned Halfword (x'1000 0042')
+void PPCInterpreter::PPCInterpreterJIT_vmaxuh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMinMaxSSE41(b, &PPCInterpreter_vmaxuh, x86::Inst::kIdPmaxuw, instr);
+}
+
+// Vector Minimum Unsigned Halfword (x'1000 0242')
+void PPCInterpreter::PPCInterpreterJIT_vminuh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMinMaxSSE41(b, &PPCInterpreter_vminuh, x86::Inst::kIdPminuw, instr);
+}
+
+// Vector Maximum Signed Word (x'1000 0182')
+void PPCInterpreter::PPCInterpreterJIT_vmaxsw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMinMaxSSE41(b, &PPCInterpreter_vmaxsw, x86::Inst::kIdPmaxsd, instr);
+}
+
+// Vector Minimum Signed Word (x'1000 0382')
+void PPCInterpreter::PPCInterpreterJIT_vminsw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMinMaxSSE41(b, &PPCInterpreter_vminsw, x86::Inst::kIdPminsd, instr);
+}
+
+// Vector Maximum Unsigned Word (x'1000 0082')
+void PPCInterpreter::PPCInterpreterJIT_vmaxuw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMinMaxSSE41(b, &PPCInterpreter_vmaxuw, x86::Inst::kIdPmaxud, instr);
+}
+
+// Vector Minimum Unsigned Word (x'1000 0282')
+void PPCInterpreter::PPCInterpreterJIT_vminuw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMinMaxSSE41(b, &PPCInterpreter_vminuw, x86::Inst::kIdPminud, instr);
+}
+
+//
+// Integer Compare
+//
+
+// Vector Compare Equal-to Unsigned Byte (x'1000 0006')
+void PPCInterpreter::PPCInterpreterJIT_vcmpequb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorCompare(b, x86::Inst::kIdPcmpeqb, instr.vd, instr.va, instr.vb, instr.vrc);
+}
+
+// Vector Compare Equal-to Unsigned Halfword (x'1000 0046')
+void PPCInterpreter::PPCInterpreterJIT_vcmpequh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorCompare(b, x86::Inst::kIdPcmpeqw, instr.vd, instr.va, instr.vb, instr.vrc);
+}
+
+// Vector Compare Equal-to Unsigned Word (x'1000 0086')
+void PPCInterpreter::PPCInterpreterJIT_vcmpequw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorCompare(b, x86::Inst::kIdPcmpeqd, instr.vd, instr.va, instr.vb, instr.vrc);
+}
+
+// Vector Compare Greater-Than Signed Byte (x'1000 0306')
+void PPCInterpreter::PPCInterpreterJIT_vcmpgtsb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorCompare(b, x86::Inst::kIdPcmpgtb, instr.vd, instr.va, instr.vb, instr.vrc);
+}
+
+// Vector Compare Greater-Than Signed Halfword (x'1000 0346')
+void PPCInterpreter::PPCInterpreterJIT_vcmpgtsh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorCompare(b, x86::Inst::kIdPcmpgtw, instr.vd, instr.va, instr.vb, instr.vrc);
+}
+
+// Vector Compare Greater-Than Signed Word (x'1000 0386')
+void PPCInterpreter::PPCInterpreterJIT_vcmpgtsw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorCompare(b, x86::Inst::kIdPcmpgtd, instr.vd, instr.va, instr.vb, instr.vrc);
+}
+
+// Vector Compare Greater-Than Unsigned Byte (x'1000 0206')
+void PPCInterpreter::PPCInterpreterJIT_vcmpgtub(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorCompare(b, x86::Inst::kIdPcmpgtb, instr.vd, instr.va, instr.vb, instr.vrc, 0x80808080);
+}
+
+// Vector Compare Greater-Than Unsigned Halfword (x'1000 0246')
+void PPCInterpreter::PPCInterpreterJIT_vcmpgtuh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorCompare(b, x86::Inst::kIdPcmpgtw, instr.vd, instr.va, instr.vb, instr.vrc, 0x80008000);
+}
+
+// Vector Compare Greater-Than Unsigned Word (x'1000 0286')
+void PPCInterpreter::PPCInterpreterJIT_vcmpgtuw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorCompare(b, x86::Inst::kIdPcmpgtd, instr.vd, instr.va, instr.vb, instr.vrc, 0x80000000);
+}
+
+// Vector128 Compare Equal-to Unsigned Word
+void PPCInterpreter::PPCInterpreterJIT_vcmpequw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorCompare(b, x86::Inst::kIdPcmpeqd, J_VD128(instr), J_VA128(instr), J_VB128(instr), instr.VMX128_R.Rc);
+}
+
+//
+// Floating Point Compare
+//
+// cmpps predicates: 0 EQ, 1 LT, 2 LE. Greater than forms compare with swapped operands.
+//
+
+// Vector Compare Equal-to Floating Point (x'1000 00C6')
+void PPCInterpreter::PPCInterpreterJIT_vcmpeqfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFloatCompare(b, 0, false, instr.vd, instr.va, instr.vb, instr.vrc);
+}
+
+// Vector Compare Greater-Than-or-Equal-to Floating Point (x'1000 01C6')
+void PPCInterpreter::PPCInterpreterJIT_vcmpgefp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFloatCompare(b, 2, true, instr.vd, instr.va, instr.vb, instr.vrc);
+}
+
+// Vector Compare Greater-Than Floating Point (x'1000 02C6')
+void PPCInterpreter::PPCInterpreterJIT_vcmpgtfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFloatCompare(b, 1, true, instr.vd, instr.va, instr.vb, instr.vrc);
+}
+
+// Vector128 Compare Equal-to Floating Point
+void PPCInterpreter::PPCInterpreterJIT_vcmpeqfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFloatCompare(b, 0, false, J_VD128(instr), J_VA128(instr), J_VB128(instr), instr.VMX128_R.Rc);
+}
+
+// Vector128 Compare Greater-Than-or-Equal-to Floating Point
+void PPCInterpreter::PPCInterpreterJIT_vcmpgefp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFloatCompare(b, 2, true, J_VD128(instr), J_VA128(instr), J_VB128(instr), instr.VMX128_R.Rc);
+}
+
+// Vector128 Compare Greater-Than Floating Point
+void PPCInterpreter::PPCInterpreterJIT_vcmpgtfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFloatCompare(b, 1, true, J_VD128(instr), J_VA128(instr), J_VB128(instr), instr.VMX128_R.Rc);
+}
+
+//
+// Floating Point Arithmetic
+//
+
+// Vector Add Floating Point (x'1000 000A')
+void PPCInterpreter::PPCInterpreterJIT_vaddfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFPArith(b, eJITVecFPOp::Add, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Subtract Floating Point (x'1000 004A')
+void PPCInterpreter::PPCInterpreterJIT_vsubfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFPArith(b, eJITVecFPOp::Sub, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Maximum Floating Point (x'1000 040A')
+void PPCInterpreter::PPCInterpreterJIT_vmaxfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFPArith(b, eJITVecFPOp::Max, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Minimum Floating Point (x'1000 044A')
+void PPCInterpreter::PPCInterpreterJIT_vminfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFPArith(b, eJITVecFPOp::Min, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Multiply Add Floating Point (x'1000 002E')
+void PPCInterpreter::PPCInterpreterJIT_vmaddfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMultiplyAdd(b, &PPCInterpreter_vmaddfp, false, instr.vd, instr.va, instr.vc, instr.vb);
+}
+
+// Vector Negative Multiply-Subtract Floating Point (x'1000 002F')
+void PPCInterpreter::PPCInterpreterJIT_vnmsubfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMultiplyAdd(b, &PPCInterpreter_vnmsubfp, true, instr.vd, instr.va, instr.vc, instr.vb);
+}
+
+// Vector128 Add Floating Point
+void PPCInterpreter::PPCInterpreterJIT_vaddfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFPArith(b, eJITVecFPOp::Add, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+// Vector128 Subtract Floating Point
+void PPCInterpreter::PPCInterpreterJIT_vsubfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFPArith(b, eJITVecFPOp::Sub, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+// Vector128 Multiply Floating Point
+void PPCInterpreter::PPCInterpreterJIT_vmulfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFPArith(b, eJITVecFPOp::Mul, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+// Vector128 Multiply Add Floating Point
+void PPCInterpreter::PPCInterpreterJIT_vmaddfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  const u32 vd = J_VD128(instr);
+  J_VectorMultiplyAdd(b, &PPCInterpreter_vmaddfp128, false, vd, J_VA128(instr), J_VB128(instr), vd);
+}
+
+// Vector128 Multiply Add Carry Floating Point
+void PPCInterpreter::PPCInterpreterJIT_vmaddcfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  const u32 vd = J_VD128(instr);
+  J_VectorMultiplyAdd(b, &PPCInterpreter_vmaddcfp128, false, vd, J_VA128(instr), vd, J_VB128(instr));
+}
+
+// Vector128 Negative Multiply-Subtract Floating Point
+void PPCInterpreter::PPCInterpreterJIT_vnmsubfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  const u32 vd = J_VD128(instr);
+  J_VectorMultiplyAdd(b, &PPCInterpreter_vnmsubfp128, true, vd, J_VA128(instr), J_VB128(instr), vd);
+}
+
+// Vector128 Maximum Floating Point
+void PPCInterpreter::PPCInterpreterJIT_vmaxfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFPArith(b, eJITVecFPOp::Max, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+// Vector128 Minimum Floating Point
+void PPCInterpreter::PPCInterpreterJIT_vminfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorFPArith(b, eJITVecFPOp::Min, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+//
+// Shift/Rotate
+//
+
+// Vector Shift Left Integer Word (x'1000 0184')
+void PPCInterpreter::PPCInterpreterJIT_vslw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorShiftWord(b, &PPCInterpreter_vslw, eJITVecShift::Left, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Shift Right Integer Word (x'1000 0284')
+void PPCInterpreter::PPCInterpreterJIT_vsrw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorShiftWord(b, &PPCInterpreter_vsrw, eJITVecShift::Right, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Shift Right Algebraic Integer Word (x'1000 0384')
+void PPCInterpreter::PPCInterpreterJIT_vsraw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorShiftWord(b, &PPCInterpreter_vsraw, eJITVecShift::RightAlgebraic, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Rotate Left Integer Word (x'1000 0084')
+void PPCInterpreter::PPCInterpreterJIT_vrlw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorShiftWord(b, &PPCInterpreter_vrlw, eJITVecShift::Rotate, instr.vd, instr.va, instr.vb);
+}
+
+// Vector128 Shift Left Word
+void PPCInterpreter::PPCInterpreterJIT_vslw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorShiftWord(b, &PPCInterpreter_vslw128, eJITVecShift::Left, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+// Vector128 Shift Right Word
+void PPCInterpreter::PPCInterpreterJIT_vsrw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorShiftWord(b, &PPCInterpreter_vsrw128, eJITVecShift::Right, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+// Vector128 Shift Right Arithmetic Word
+void PPCInterpreter::PPCInterpreterJIT_vsraw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorShiftWord(b, &PPCInterpreter_vsraw128, eJITVecShift::RightAlgebraic, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+// Vector128 Rotate Left Word
+void PPCInterpreter::PPCInterpreterJIT_vrlw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorShiftWord(b, &PPCInterpreter_vrlw128, eJITVecShift::Rotate, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+//
+// Splat
+//
+
+// Vector Splat Byte (x'1000 020C')
+void PPCInterpreter::PPCInterpreterJIT_vspltb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  std::array<u8, 16> control{};
+  control.fill(static_cast<u8>((instr.vuimm & 0xF) ^ 3));
+  J_VectorSplat(b, instr.vd, instr.vb, control);
+}
+
+// Vector Splat Halfword (x'1000 024C')
+void PPCInterpreter::PPCInterpreterJIT_vsplth(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  const u8 hostHalf = static_cast<u8>((instr.vuimm & 7) ^ 1);
+  std::array<u8, 16> control{};
+  for (u32 i = 0; i != 16; i += 2) {
+    control[i] = hostHalf * 2;
+    control[i + 1] = hostHalf * 2 + 1;
+  }
+  J_VectorSplat(b, instr.vd, instr.vb, control);
+}
+
+// Vector Splat Word (x'1000 028C')
+void PPCInterpreter::PPCInterpreterJIT_vspltw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorSplatWord(b, instr.vd, instr.vb, instr.vuimm & 3);
+}
+
+// Vector128 Splat Word
+void PPCInterpreter::PPCInterpreterJIT_vspltw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorSplatWord(b, J_VD128(instr), J_VB128(instr), instr.VMX128_3.IMM & 3);
+}
+
+// Vector Splat Immediate Signed Byte (x'1000 030C')
+void PPCInterpreter::PPCInterpreterJIT_vspltisb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorSplatImmediate(b, instr.vd, static_cast<u8>(instr.vsimm) * 0x01010101u);
+}
+
+// Vector Splat Immediate Signed Halfword (x'1000 034C')
+void PPCInterpreter::PPCInterpreterJIT_vspltish(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorSplatImmediate(b, instr.vd, static_cast<u16>(instr.vsimm) * 0x00010001u);
+}
+
+// Vector Splat Immediate Signed Word (x'1000 038C')
+void PPCInterpreter::PPCInterpreterJIT_vspltisw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorSplatImmediate(b, instr.vd, static_cast<u32>(instr.vsimm));
+}
+
+// Vector128 Splat Immediate Signed Word
+void PPCInterpreter::PPCInterpreterJIT_vspltisw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorSplatImmediate(b, J_VD128(instr), static_cast<u32>(static_cast<s32>(instr.VMX128_3.IMM << 27) >> 27));
+}
+
+//
+// Merge
+//
+
+// Vector Merge High Byte (x'1000 000C')
+void PPCInterpreter::PPCInterpreterJIT_vmrghb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMerge(b, x86::Inst::kIdPunpcklbw, 1, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Merge Low Byte (x'1000 010C')
+void PPCInterpreter::PPCInterpreterJIT_vmrglb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMerge(b, x86::Inst::kIdPunpckhbw, 1, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Merge High Halfword (x'1000 004C')
+void PPCInterpreter::PPCInterpreterJIT_vmrghh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMerge(b, x86::Inst::kIdPunpcklwd, 2, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Merge Low Halfword (x'1000 014C')
+void PPCInterpreter::PPCInterpreterJIT_vmrglh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMerge(b, x86::Inst::kIdPunpckhwd, 2, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Merge High Word (x'1000 008C')
+void PPCInterpreter::PPCInterpreterJIT_vmrghw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMerge(b, x86::Inst::kIdPunpckldq, 4, instr.vd, instr.va, instr.vb);
+}
+
+// Vector Merge Low Word (x'1000 018C')
+void PPCInterpreter::PPCInterpreterJIT_vmrglw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMerge(b, x86::Inst::kIdPunpckhdq, 4, instr.vd, instr.va, instr.vb);
+}
+
+// Vector128 Merge High Word
+void PPCInterpreter::PPCInterpreterJIT_vmrghw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMerge(b, x86::Inst::kIdPunpckldq, 4, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+// Vector128 Merge Low Word
+void PPCInterpreter::PPCInterpreterJIT_vmrglw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorMerge(b, x86::Inst::kIdPunpckhdq, 4, J_VD128(instr), J_VA128(instr), J_VB128(instr));
+}
+
+//
+// Permute
+//
+
+// Vector Shift Left Double by Octet Immediate (x'1000 002C')
+void PPCInterpreter::PPCInterpreterJIT_vsldoi(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorShiftLeftDouble(b, instr.vd, instr.va, instr.vb, instr.vsh);
+}
+
+// Vector128 Shift Left Double by Octet Immediate
+void PPCInterpreter::PPCInterpreterJIT_vsldoi128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorShiftLeftDouble(b, J_VD128(instr), J_VA128(instr), J_VB128(instr), instr.VMX128_5.SH);
+}
+
+// Vector Permute (x'1000 002B')
+void PPCInterpreter::PPCInterpreterJIT_vperm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorPermute(b, instr.vd, instr.va, instr.vb, instr.vc);
+}
+
+// Vector128 Permute
+void PPCInterpreter::PPCInterpreterJIT_vperm128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorPermute(b, J_VD128(instr), J_VA128(instr), J_VB128(instr), instr.VMX128_2.VC);
+}
+
+// Vector128 Permutate Word Immediate
+void PPCInterpreter::PPCInterpreterJIT_vpermwi128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_CheckVXU(b);
+  // Word i comes from word (PERM >> (6 - i * 2)) & 3, pshufd takes them from the low bits up
+  const u32 perm = instr.VMX128_P.PERMl | (instr.VMX128_P.PERMh << 5);
+  u32 order = 0;
+  for (u32 i = 0; i != 4; i++)
+    order |= ((perm >> (6 - i * 2)) & 3) << (i * 2);
+  x86::Xmm result = newXMM();
+  COMP->pshufd(result, VRReg(J_VB128(instr)), order);
+  COMP->movaps(VRRegOut(J_VD128(instr)), result);
+}
+
+//
+// Pack/Unpack
+//
+
+// Vector Pack Unsigned Halfword Unsigned Modulo (x'1000 000E')
+void PPCInterpreter::PPCInterpreterJIT_vpkuhum(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorPackModulo(b, instr.vd, instr.va, instr.vb, 2);
+}
+
+// Vector Pack Unsigned Word Unsigned Modulo (x'1000 004E')
+void PPCInterpreter::PPCInterpreterJIT_vpkuwum(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorPackModulo(b, instr.vd, instr.va, instr.vb, 4);
+}
+
+// Vector128 Pack Unsigned Halfword Unsigned Modulo
+void PPCInterpreter::PPCInterpreterJIT_vpkuhum128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorPackModulo(b, J_VD128(instr), J_VA128(instr), J_VB128(instr), 2);
+}
+
+// Vector128 Pack Unsigned Word Unsigned Modulo
+void PPCInterpreter::PPCInterpreterJIT_vpkuwum128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorPackModulo(b, J_VD128(instr), J_VA128(instr), J_VB128(instr), 4);
+}
+
+// Vector Unpack High Signed Byte (x'1000 020E')
+void PPCInterpreter::PPCInterpreterJIT_vupkhsb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorUnpackSigned(b, x86::Inst::kIdPunpcklbw, 1, instr.vd, instr.vb);
+}
+
+// Vector Unpack Low Signed Byte (x'1000 028E')
+void PPCInterpreter::PPCInterpreterJIT_vupklsb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorUnpackSigned(b, x86::Inst::kIdPunpckhbw, 1, instr.vd, instr.vb);
+}
+
+// Vector Unpack High Signed Halfword (x'1000 024E')
+void PPCInterpreter::PPCInterpreterJIT_vupkhsh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorUnpackSigned(b, x86::Inst::kIdPunpcklwd, 2, instr.vd, instr.vb);
+}
+
+// Vector Unpack Low Signed Halfword (x'1000 02CE')
+void PPCInterpreter::PPCInterpreterJIT_vupklsh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorUnpackSigned(b, x86::Inst::kIdPunpckhwd, 2, instr.vd, instr.vb);
+}
+
+// Vector128 Unpack High Signed Byte
+void PPCInterpreter::PPCInterpreterJIT_vupkhsb128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorUnpackSigned(b, x86::Inst::kIdPunpcklbw, 1, J_VD128(instr), J_VB128(instr));
+}
+
+// Vector128 Unpack Low Signed Byte
+void PPCInterpreter::PPCInterpreterJIT_vupklsb128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
+  J_VectorUnpackSigned(b, x86::Inst::kIdPunpckhbw, 1, J_VD128(instr), J_VB128(instr));
+}
+
+#endif
@@ -0,0 +1,247 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#include <algorithm>
+#include <fstream>
+
+#include <toml.hpp>
+
+#include "Base/Config.h"
+#include "Base/Hash.h"
+#include "Base/Logging/Log.h"
+#include "Core/XeMain.h"
+
+#include "PPCHooks.h"
+#include "PPCInterpreter.h"
+
+using namespace PPCInterpreter;
+
+// Used when there's no hooks file yet, mostly for the 2.0.17489.0 kernel
+static const PPCHook defaultHooks[] = {
+  { "RGH 2 for CB_A 9188 in a JRunner XDKBuild", 0x0200C870, ePPCHookAction::SetGPR, 5, 0 },
+  { "RGH 2 17489 in a JRunner Corona XDKBuild", 0x0200C7F0, ePPCHookAction::SetGPR, 3, 0 },
+  // TODO: Investigate why FSB_CONFIG_RX_STATE needs these values to work
+  { "FSB_CONFIG_RX_STATE", 0x01003598, ePPCHookAction::SetGPR, 11, 0x0E },
+  { "FSB_CONFIG_RX_STATE", 0x01003644, ePPCHookAction::SetGPR, 11, 0x02 },
+  { "INIT_POWER_MODE bypass 2.0.17489.0", 0x80081764, ePPCHookAction::Skip },
+  { "XAudioRenderDriverInitialize bypass 2.0.17489.0", 0x8018B0EC, ePPCHookAction::Skip },
+  { "XamAppsIntilized check bypass", 0x81751168, ePPCHookAction::SetGPR, 3, 1 },
+  // Related to XAudio Microphone stuff
+  { "XHVpCreateEngine XAM call skip", 0x81B17D88, ePPCHookAction::SetGPR, 3, ~0ULL },
+  { "XHVpCreateEngine XAM call skip", 0x81B17D88, ePPCHookAction::Skip },
+  { "XamSetPowerMode call to KeSetPowerMode bypass", 0x817AC968, ePPCHookAction::Skip },
+  // Not needed for older console revisions
+  { "XDK 17.489.0 AudioChipCorder device detect bypass", 0x801AF580, ePPCHookAction::Skip },
+  { "VdpWriteXDVOUllong, skips the XDVO write loop", 0x800EF7C0, ePPCHookAction::SetGPR, 10, 1, {}, nullptr, true },
+  { "VdpSetDisplayTimingParameter, skips the ANA check", 0x800F6264, ePPCHookAction::SetGPR, 11, 0x15E, {}, nullptr, true },
+  { "VdSwap 2.0.17489.0", 0x800F8E20, ePPCHookAction::None, 0, 0, {}, nullptr, true },
+  // Pretend ARGON hardware is present, to avoid the calls
+  { "HalNoteArgonErrors skip, fakes XboxHardwareInfo bit 3", 0x800819E0, ePPCHookAction::OrGPR, 11, 0x08, {}, nullptr, true },
+  { "HalRecordArgonErrors skip, fakes XboxHardwareInfo bit 3", 0x80081A60, ePPCHookAction::OrGPR, 11, 0x08, {}, nullptr, true }
+};
+
+static const char *hookActionNames[] = { "None", "SetGPR", "OrGPR", "Skip", "Call" };
+
+// Halts the CPU and opens the debugger, same as the halt on address options
+static void HookHalt(PPU_STATE *ppuState) {
+  if (XeMain::GetCPU()) {
+    XeMain::GetCPU()->Halt();
+    Config::imgui.debugWindow = true;
+  }
+}
+
+// Logs the argument registers and the return address, for tracing calls to a guest function
+static void HookLogArgs(PPU_STATE *ppuState) {
+  LOG_INFO(Xenon, "PPU{} thread {}: r3 0x{:X} r4 0x{:X} r5 0x{:X} r6 0x{:X} r7 0x{:X} r8 0x{:X} r9 0x{:X} r10 0x{:X} LR 0x{:X}",
+    ppuState->ppuID, static_cast<u8>(curThreadId), GPR(3), GPR(4), GPR(5), GPR(6), GPR(7), GPR(8), GPR(9), GPR(10), curThread.SPR.LR);
+}
+
+PPCHookRegistry::PPCHookRegistry() {
+  hookPages.resize(PPC_HOOK_PAGE_COUNT / 64);
+  // Built-in host functions for Call hooks
+  RegisterHostFunction("Halt", HookHalt);
+  RegisterHostFunction("LogArgs", HookLogArgs);
+}
+
+void PPCHookRegistry::RegisterHostFunction(const std::string &name, PPCHostFunction function) {
+  hostFunctions.insert_or_assign(name, function);
+}
+
+void PPCHookRegistry::Load(const std::filesystem::path &path) {
+  Clear();
+  std::error_code error;
+  if (!std::filesystem::exists(path, error)) {
+    for (const PPCHook &hook : defaultHooks)
+      Add(hook);
+    LOG_INFO(Xenon, "Hooks file not found! Saving the built-in hooks to {}", path.string());
+    SaveFile(path);
+  } else if (!LoadFile(path)) {
+    Clear();
+    for (const PPCHook &hook : defaultHooks)
+      Add(hook);
+    LOG_WARNING(Xenon, "Falling back to the built-in hooks");
+  }
+  LOG_INFO(Xenon, "Loaded {} guest hooks", hooks.size());
+}
+
+bool PPCHookRegistry::HasHooks(u64 start, u64 size) const {
+  for (const PPCHook &hook : hooks) {
+    // Wraps around, same as the 32 bit compare done when running
+    if (static_cast<u32>(hook.address - static_cast<u32>(start)) < size)
+      return true;
+  }
+  return false;
+}
+
+const std::vector<u32> *PPCHookRegistry::Find(u64 address) const {
+  if (!PageHasHooks(address))
+    return nullptr;
+  auto it = hooksByAddress.find(static_cast<u32>(address));
+  return it != hooksByAddress.end() ? &it->second : nullptr;
+}
+
+bool PPCHookRegistry::Run(PPU_STATE *ppuState, u64 address) const {
+  const std::vector<u32> *indices = Find(address);
+  if (!indices)
+    return false;
+  bool skip = false;
+  for (u32 index : *indices) {
+    const PPCHook &hook = hooks[index];
+    switch (hook.action) {
+    case ePPCHookAction::SetGPR:
+      GPR(hook.gpr) = hook.value;
+      break;
+    case ePPCHookAction::OrGPR:
+      GPR(hook.gpr) |= hook.value;
+      break;
+    case ePPCHookAction::Skip:
+      skip = true;
+      break;
+    default:
+      break;
+    }
+    RunHost(ppuState, index);
+  }
+  return skip;
+}
+
+void PPCHookRegistry::RunHost(PPU_STATE *ppuState, u64 index) {
+  const PPCHook &hook = ppcHooks.hooks[index];
+  if (hook.log)
+    LOG_INFO(Xenon, "Hook '{}' hit at 0x{:X}", hook.name, hook.address);
+  if (hook.action == ePPCHookAction::Call && hook.function)
+    hook.function(ppuState);
+}
+
+void PPCHookRegistry::Add(PPCHook hook) {
+  const u32 index = static_cast<u32>(hooks.size());
+  const u32 page = hook.address >> PPC_HOOK_PAGE_SHIFT;
+  hookPages[page >> 6] |= 1ULL << (page & 63);
+  hooksByAddress[hook.address].push_back(index);
+  hooks.push_back(std::move(hook));
+}
+
+void PPCHookRegistry::Clear() {
+  hooks.clear();
+  hooksByAddress.clear();
+  std::fill(hookPages.begin(), hookPages.end(), 0);
+}
+
+bool PPCHookRegistry::LoadFile(const std::filesystem::path &path) {
+  try {
+    toml::value data = toml::parse(path);
+    if (!data.contains("Hook"))
+      return true;
+    for (const toml::value &entry : data.at("Hook").as_array()) {
+      PPCHook hook{};
+      hook.name = toml::find_or<std::string>(entry, "Name", "");
+      hook.address = static_cast<u32>(toml::find<s64>(entry, "Address"));
+      const std::string action = toml::find_or<std::string>(entry, "Action", "None");
+      switch (Base::JoaatStringHash(action)) {
+      case "None"_jLower:
+        hook.action = ePPCHookAction::None;
+        break;
+      case "SetGPR"_jLower:
+        hook.action = ePPCHookAction::SetGPR;
+        break;
+      case "OrGPR"_jLower:
+        hook.action = ePPCHookAction::OrGPR;
+        break;
+      case "Skip"_jLower:
+        hook.action = ePPCHookAction::Skip;
+        break;
+      case "Call"_jLower:
+        hook.action = ePPCHookAction::Call;
+        break;
+      default:
+        LOG_WARNING(Xenon, "Hooks: '{}' has an invalid action '{}', ignoring it", hook.name, action);
+        continue;
+      }
+      const s64 gpr = toml::find_or<s64>(entry, "GPR", 0);
+      if (gpr < 0 || gpr > 31) {
+        LOG_WARNING(Xenon, "Hooks: '{}' uses an invalid GPR {}, ignoring it", hook.name, gpr);
+        continue;
+      }
+      hook.gpr = static_cast<u8>(gpr);
+      hook.value = static_cast<u64>(toml::find_or<s64>(entry, "Value", 0));
+      hook.log = toml::find_or<bool>(entry, "Log", false);
+      if (hook.action == ePPCHookAction::Call) {
+        hook.functionName = toml::find_or<std::string>(entry, "Function", "");
+        auto it = hostFunctions.find(hook.functionName);
+        if (it == hostFunctions.end()) {
+          LOG_WARNING(Xenon, "Hooks: '{}' calls unknown host function '{}', ignoring it", hook.name, hook.functionName);
+          continue;
+        }
+        hook.function = it->second;
+      }
+      Add(std::move(hook));
+    }
+  }
+  catch (const std::exception &ex) {
+    LOG_ERROR(Xenon, "Failed to load hooks from {}. {}", path.string(), ex.what());
+    return false;
+  }
+  return true;
+}
+
+void PPCHookRegistry::SaveFile(const std::filesystem::path &path) {
+  toml::value data{ toml::table{} };
+  data.comments().push_back("# Guest hooks, run right before the instruction at Address");
+  data.comments().push_back("# Action: None | SetGPR (GPR = Value) | OrGPR (GPR |= Value) | Skip | Call (host Function)");
+  std::vector<std::string> functionNames{};
+  for (const auto &[name, function] : hostFunctions)
+    functionNames.push_back(name);
+  std::sort(functionNames.begin(), functionNames.end());
+  std::string functions = "# Function:";
+  for (const std::string &name : functionNames)
+    functions += (name == functionNames.front() ? " " : " | ") + name;
+  data.comments().push_back(functions);
+  data.comments().push_back("# Several hooks on the same address run in the order they're listed");
+  data["Hook"] = toml::array{};
+  for (const PPCHook &hook : hooks) {
+    toml::value entry{ toml::table{} };
+    entry["Name"] = hook.name;
+    entry["Address"] = static_cast<s64>(hook.address);
+    entry["Address"].as_integer_fmt().fmt = toml::integer_format::hex;
+    entry["Action"] = hookActionNames[static_cast<u8>(hook.action)];
+    if (hook.action == ePPCHookAction::SetGPR || hook.action == ePPCHookAction::OrGPR) {
+      entry["GPR"] = static_cast<s64>(hook.gpr);
+      entry["Value"] = static_cast<s64>(hook.value);
+    }
+    if (hook.action == ePPCHookAction::Call)
+      entry["Function"] = hook.functionName;
+    if (hook.log)
+      entry["Log"] = true;
+    data["Hook"].as_array().push_back(std::move(entry));
+  }
+
+  try {
+    if (path.has_parent_path())
+      std::filesystem::create_directories(path.parent_path());
+    std::ofstream file{ path };
+    file << data;
+    file.close();
+  }
+  catch (const std::exception &ex) {
+    LOG_ERROR(Xenon, "Exception trying to write hooks. {}", ex.what());
+  }
+}
@@ -0,0 +1,92 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/XCPU/PPU/PowerPC.h"
+
+// Hooks are flagged per 4KiB page of the 32 bit effective address space
+#define PPC_HOOK_PAGE_SHIFT 12
+#define PPC_HOOK_PAGE_COUNT (1ULL << (32 - PPC_HOOK_PAGE_SHIFT))
+
+namespace PPCInterpreter {
+
+// Host function a hook can call, runs before the hooked instruction
+using PPCHostFunction = void(*)(PPU_STATE *ppuState);
+
+enum class ePPCHookAction : u8 {
+  None,   // Nothing, for hooks that only log
+  SetGPR, // GPR[gpr] = value
+  OrGPR,  // GPR[gpr] |= value
+  Skip,   // Don't execute the instruction
+  Call    // Call a host function
+};
+
+struct PPCHook {
+  // Shown in the log and the hooks file
+  std::string name = {};
+  // Effective address, only the low 32 bits are compared
+  u32 address = 0;
+  ePPCHookAction action = ePPCHookAction::None;
+  u8 gpr = 0;
+  u64 value = 0;
+  // Name of the host function for Call
+  std::string functionName = {};
+  PPCHostFunction function = nullptr;
+  // Logs every time it's hit
+  bool log = false;
+};
+
+//
+// Guest patch/hook registry.
+//
+// Maps guest addresses to actions done right before the instruction there runs. The interpreter
+// only looks hooks up when the page of the instruction is flagged as having any, the JIT bakes them
+// into the generated code. Hooks are loaded from a TOML file, one per kernel version, which gets
+// created with the built-in hooks if it doesn't exist. Loading must be done before any PPU runs.
+//
+class PPCHookRegistry {
+public:
+  PPCHookRegistry();
+
+  // Makes a host function available to Call hooks, must be done before Load.
+  void RegisterHostFunction(const std::string &name, PPCHostFunction function);
+  // Replaces the current hooks with the ones in path, writing the built-in ones to it if missing.
+  void Load(const std::filesystem::path &path);
+
+  // Whether any hook lives in the page of address
+  bool PageHasHooks(u64 address) const {
+    const u32 page = static_cast<u32>(address) >> PPC_HOOK_PAGE_SHIFT;
+    return (hookPages[page >> 6] >> (page & 63)) & 1;
+  }
+  // Whether any hook lives in [start, start + size)
+  bool HasHooks(u64 start, u64 size) const;
+  // Indices of the hooks at address, in the order they run. nullptr if there's none
+  const std::vector<u32> *Find(u64 address) const;
+  const std::vector<PPCHook> &GetHooks() const { return hooks; }
+
+  // Runs the hooks at the current instruction. Returns true if it must be skipped.
+  bool Run(PPU_STATE *ppuState, u64 address) const;
+  // Runs the host side of a hook (logging and Call), for the JIT
+  static void RunHost(PPU_STATE *ppuState, u64 index);
+
+private:
+  void Add(PPCHook hook);
+  void Clear();
+  // Reads hooks from a file, returns false if it couldn't be parsed
+  bool LoadFile(const std::filesystem::path &path);
+  // Writes the current hooks to a file
+  void SaveFile(const std::filesystem::path &path);
+
+  std::vector<PPCHook> hooks = {};
+  std::unordered_map<u32, std::vector<u32>> hooksByAddress = {};
+  // One bit per page
+  std::vector<u64> hookPages = {};
+  std::unordered_map<std::string, PPCHostFunction> hostFunctions = {};
+};
+
+} // namespace PPCInterpreter
@@ -443,11 +443,21 @@ static constexpr u64 ExtractBits64(u32 input, u32 begin, u32 end) {
 #define VMX128_3_VB128 (_instr.VMX128_3.VB128l | (_instr.VMX128_3.VB128h << 5))
 #define VMX128_3_IMM   (_instr.VMX128_3.IMM)
 
+#define VMX128_4_VD128 (_instr.VMX128_4.VD128l | (_instr.VMX128_4.VD128h << 5))
+#define VMX128_4_VB128 (_instr.VMX128_4.VB128l | (_instr.VMX128_4.VB128h << 5))
+#define VMX128_4_IMM   (_instr.VMX128_4.IMM)
+#define VMX128_4_Z     (_instr.VMX128_4.z)
+
 #define VMX128_5_VD128 (_instr.VMX128_5.VD128l | (_instr.VMX128_5.VD128h << 5))
-#define VMX128_5_VA128 (_instr.VMX128_5.VA128l | (_instr.VMX128_5.VA128h << 5)) | (_instr.VMX128_5.VA128H << 6)
+#define VMX128_5_VA128 (_instr.VMX128_5.VA128l | (_instr.VMX128_5.VA128h << 5) | (_instr.VMX128_5.VA128H << 6))
 #define VMX128_5_VB128 (_instr.VMX128_5.VB128l | (_instr.VMX128_5.VB128h << 5))
 #define VMX128_5_SH    (_instr.VMX128_5.SH)
 
 #define VMX128_R_VD128 (_instr.VMX128_R.VD128l | (_instr.VMX128_R.VD128h << 5))
 #define VMX128_R_VA128 (_instr.VMX128_R.VA128l | (_instr.VMX128_R.VA128h << 5) | (_instr.VMX128_R.VA128H << 6))
 #define VMX128_R_VB128 (_instr.VMX128_R.VB128l | (_instr.VMX128_R.VB128h << 5))
+#define VMX128_R_RC    (_instr.VMX128_R.Rc)
+
+#define VMX128_P_VD128 (_instr.VMX128_P.VD128l | (_instr.VMX128_P.VD128h << 5))
+#define VMX128_P_VB128 (_instr.VMX128_P.VB128l | (_instr.VMX128_P.VB128h << 5))
+#define VMX128_P_PERM  (_instr.VMX128_P.PERMl | (_instr.VMX128_P.PERMh << 5))
@@ -13,102 +13,17 @@ using namespace PPCInterpreter;
 XENON_CONTEXT* PPCInterpreter::CPUContext = nullptr;
 RootBus* PPCInterpreter::sysBus = nullptr;
 PPCInterpreter::PPCDecoder PPCInterpreter::ppcDecoder{};
+PPCInterpreter::PPCHookRegistry PPCInterpreter::ppcHooks{};
 
 // Interpreter Single Instruction Processing.
 void PPCInterpreter::ppcExecuteSingleInstruction(PPU_STATE *ppuState) {
   PPU_THREAD_REGISTERS &thread = curThread;
 
-  // RGH 2 for CB_A 9188 in a JRunner XDKBuild.
-  if (thread.CIA == 0x0200C870) {
-    GPR(5) = 0;
-  }
-
-  // RGH 2 for CB_A 9188 in a JRunner Normal Build.
-  if (thread.CIA == 0x0200C820) {
-    //GPR(3) = 0;
-  }
-
-  // RGH 2 17489 in a JRunner Corona XDKBuild.
-  if (thread.CIA == 0x0200C7F0) {
-    GPR(3) = 0;
-  }
-
-  // 3BL Check Bypass Devkit 2.0.1838.1
-  if (thread.CIA == 0x03004994) {
-    //GPR(3) = 1;
-  }
-
-  // 4BL Check Bypass Devkit 2.0.1838.1
-  if (thread.CIA == 0x03004BF0) {
-    //GPR(3) = 1;
-  }
-
-  // 3BL Signature Check Bypass Devkit 2.0.2853.0
-  if (thread.CIA == 0x03006488) {
-    //GPR(3) = 0;
-  }
-
-  // INIT_POWER_MODE bypass 2.0.17489.0.
-  if (static_cast<u32>(thread.CIA) == 0x80081764) {
-    return;
-  }
-
-  // XAudioRenderDriverInitialize bypass 2.0.17489.0.
-  if (static_cast<u32>(thread.CIA) == 0x8018B0EC) {
-    return;
-  }
-
-  // XamAppsIntilized Check bypass.
-  if (static_cast<u32>(thread.CIA) == 0x81751168) {
-    thread.GPR[3] = 1;
-  }
-
-  // XHVpCreateEngine XAM Call skip. Related to XAudio Microphone stuff.
-  if (static_cast<u32>(thread.CIA) == 0x81B17D88) {
-    thread.GPR[3] = -1;
-    return;
-  }
-
-  // XamSetPowerMode call to KeSetPowerMode bypass.
-  if (static_cast<u32>(thread.CIA) == 0x817AC968) {
+  // Guest hooks, only looked up on pages that have any
+  if (ppcHooks.PageHasHooks(thread.CIA) && ppcHooks.Run(ppuState, thread.CIA)) {
     return;
   }
 
-  // XDK 17.489.0 AudioChipCorder Device Detect bypass. This is not needed for
-  // older console revisions.
-  if (static_cast<u32>(thread.CIA) == 0x801AF580) {
-    return;
-  }
-
-  // VdpWriteXDVOUllong. Set r10 to 1. Skips XDVO write loop.
-  if (static_cast<u32>(thread.CIA) == 0x800ef7c0) {
-    LOG_INFO(Xenon, "VdpWriteXDVOUllong");
-    thread.GPR[10] = 1;
-  }
-
-  // VdpSetDisplayTimingParameter. Set r11 to 0x10. Skips ANA Check.
-  if (static_cast<u32>(thread.CIA) == 0x800f6264) {
-    LOG_INFO(Xenon, "VdpSetDisplayTimingParameter");
-    thread.GPR[11] = 0x15E;
-  }
-
-  // VdSwap Call. 2.0.17489.0
-  if (static_cast<u32>(thread.CIA) == 0x800F8E20) {
-    LOG_INFO(Xenon, "*** VdSwap ***");
-  }
-
-  // Pretend ARGON hardware is present, to avoid the call
-  if (static_cast<u32>(thread.CIA) == 0x800819E0) {
-    thread.GPR[11] |= 0x08; // Set bit 3 (ARGON present)
-    LOG_INFO(SMC, "Faked XboxHardwareInfo bit 3 to skip HalNoteArgonErrors");
-  }
-
-  // Pretend ARGON hardware is present, to avoid the call
-  if (static_cast<u32>(thread.CIA) == 0x80081A60) {
-    thread.GPR[11] |= 0x08; // Set bit 3 (ARGON present)
-    LOG_INFO(SMC, "Faked XboxHardwareInfo bit 3 to skip HalRecordArgonErrors");
-  }
-
   // This is just to set a PC breakpoint in any PPU/Thread.
   if (static_cast<u32>(thread.CIA) == 0x8009CE40) {
     u8 a = 0;
@@ -5,6 +5,7 @@
 #include "PPCInternal.h"
 
 #include "PPC_Instruction.h"
+#include "PPCHooks.h"
 #include "PPCOpcodes.h"
 
 #include "Core/RootBus/RootBus.h"
@@ -13,6 +14,7 @@
 namespace PPCInterpreter {
 
 extern PPCInterpreter::PPCDecoder ppcDecoder;
+extern PPCInterpreter::PPCHookRegistry ppcHooks;
 extern RootBus *sysBus;
 extern XENON_CONTEXT *CPUContext;
 
@@ -129,6 +131,10 @@ void ppuSetCR1(PPU_STATE* ppuState);
 // Update FPSCR FPCC bits and CR if requested. Default CR to be updated is 1.
 void ppuUpdateFPSCR(PPU_STATE *ppuState, f64 op0, f64 op1, bool updateCR, u8 CR = 1);
 
+// Writes the class of the result left pending by the fast FPU mode to FPSCR[FPRF]. Must be done
+// before FPSCR is read or FPRF gets updated by anything else.
+void ppuResolveFPRF(PPU_THREAD_REGISTERS *thread);
+
 // Compare Unsigned
 u32 CRCompU(PPU_STATE *ppuState, u64 num1, u64 num2);
 // Compare Signed 32 bits
@@ -141,6 +147,17 @@ u32 CRCompS(PPU_STATE *ppuState, u64 num1, u64 num2);
 // Single instruction execution
 void ppcExecuteSingleInstruction(PPU_STATE *ppuState);
 
+//
+// Time Base
+//
+
+// Advances TB and DEC by the instructions counted so far and schedules the next update
+void ppcUpdateTimeBase(PPU_STATE *ppuState);
+// Current TB value
+u64 ppcGetTimeBase(PPU_STATE *ppuState);
+// Current thread's DEC value
+s32 ppcGetDecrementer(PPU_STATE *ppuState);
+
 //
 // Exceptions
 //
@@ -165,6 +182,7 @@ void ppcVXUnavailableException(PPU_STATE *ppuState);
 bool MMUTranslateAddress(u64 *EA, PPU_STATE *ppuState, bool memWrite, ePPUThread thr = ePPUThread_None);
 u8 mmuGetPageSize(PPU_STATE *ppuState, bool L, u8 LP);
 void mmuAddTlbEntry(PPU_STATE *ppuState);
+void mmuInvalidateCoreERATs(PPU_STATE *ppuState);
 bool mmuSearchTlbEntry(PPU_STATE *ppuState, u64 *RPN, u64 VA, u8 p, bool L, bool LP);
 void mmuReadString(PPU_STATE *ppuState, u64 stringAddress, char *string, u32 maxLength);
 
@@ -22,176 +22,14 @@ D_STUBRC(mtfsfi)
 D_STUBRC(fres)
 D_STUB(mfsrin)
 D_STUB(mfsr)
-D_STUB(lvsr)
-D_STUB(stvx128)
-D_STUB(lvsl128)
-D_STUB(lvewx128)
-D_STUB(stvewx128)
-D_STUB(lvxl128)
-D_STUB(stvxl128)
-D_STUB(lvlx128)
-D_STUB(lvrx128)
-D_STUB(lvlxl128)
-D_STUB(lvrxl128)
-D_STUB(stvrxl128)
-D_STUB(vor128)
-D_STUB(lvsr128)
-D_STUB(vsldoi128)
-D_STUB(vmrglw128)
-D_STUB(lvrxl)
-D_STUB(lvlxl)
 D_STUB(lswx)
-D_STUB(lveb)
-D_STUB(lvebx)
-D_STUB(lvehx)
 D_STUB(stdbrx)
 D_STUB(stswx)
-D_STUB(stvebx)
-D_STUB(stvrxl)
-D_STUB(stvlxl)
-D_STUB(stvehx)
 D_STUB(eciwx)
 D_STUB(ecowx)
 D_STUB(slbmfev)
 D_STUB(slbmfee)
 
-// Vector-instructions
-D_STUB(vaddubm)
-D_STUB(vmaxub)
-D_STUB(vrlb)
-D_STUB(vcmpequb)
-D_STUB(vcmpequb_)
-D_STUB(vmuloub)
-D_STUB(vmrghb)
-D_STUB(vpkuhum)
-D_STUB(vrlimi128)
-D_STUB(vmhaddshs)
-D_STUB(vmhraddshs)
-D_STUB(vmladduhm)
-D_STUB(vmsumubm)
-D_STUB(vmsummbm)
-D_STUB(vmsumuhm)
-D_STUB(vmsumuhs)
-D_STUB(vmsumshm)
-D_STUB(vmsumshs)
-D_STUB(vsel)
-D_STUB(vnmsubfp)
-D_STUB(vpermwi128)
-D_STUB(vadduhm)
-D_STUB(vmaxuh)
-D_STUB(vrlh)
-D_STUB(vcmpequh)
-D_STUB(vcmpequh_)
-D_STUB(vmulouh)
-D_STUB(vsubfp)
-D_STUB(vmrghh)
-D_STUB(vpkuwum)
-D_STUB(vadduwm)
-D_STUB(vrlw)
-D_STUB(vcmpequw)
-D_STUB(vcmpequw_)
-D_STUB(vpkuhus)
-D_STUB(vcmpeqfp)
-D_STUB(vcmpeqfp_)
-D_STUB(vpkuwus)
-
-D_STUB(vmaxsb)
-D_STUB(vmulosb)
-D_STUB(vrefp)
-D_STUB(vmrglb)
-D_STUB(vpkshus)
-D_STUB(vmaxsh)
-D_STUB(vslh)
-D_STUB(vmulosh)
-D_STUB(vrsqrtefp)
-D_STUB(vmrglh)
-D_STUB(vpkswus)
-D_STUB(vaddcuw)
-D_STUB(vmaxsw)
-D_STUB(vexptefp)
-D_STUB(vpkshss)
-D_STUB(vsl)
-D_STUB(vcmpgefp)
-D_STUB(vcmpgefp_)
-D_STUB(vlogefp)
-D_STUB(vpkswss)
-D_STUB(vaddubs)
-D_STUB(vminub)
-D_STUB(vsrb)
-D_STUB(vcmpgtub)
-D_STUB(vcmpgtub_)
-D_STUB(vmuleub)
-D_STUB(vrfin)
-D_STUB(vupkhsb)
-D_STUB(vadduhs)
-D_STUB(vminuh)
-D_STUB(vsrh)
-D_STUB(vcmpgtuh)
-D_STUB(vcmpgtuh_)
-D_STUB(vmuleuh)
-D_STUB(vrfiz)
-D_STUB(vsplth)
-D_STUB(vupkhsh)
-D_STUB(vadduws)
-D_STUB(vcmpgtuw)
-D_STUB(vcmpgtuw_)
-D_STUB(vrfip)
-D_STUB(vupklsb)
-D_STUB(vcmpgtfp)
-D_STUB(vcmpgtfp_)
-D_STUB(vrfim)
-D_STUB(vupklsh)
-D_STUB(vaddsbs)
-D_STUB(vminsb)
-D_STUB(vsrab)
-D_STUB(vcmpgtsb)
-D_STUB(vcmpgtsb_)
-D_STUB(vmulesb)
-D_STUB(vpkpx)
-D_STUB(vaddshs)
-D_STUB(vminsh)
-D_STUB(vsrah)
-D_STUB(vcmpgtsh)
-D_STUB(vcmpgtsh_)
-D_STUB(vmulesh)
-D_STUB(vcfsx)
-D_STUB(vupkhpx)
-D_STUB(vaddsws)
-D_STUB(vminsw)
-D_STUB(vsraw)
-D_STUB(vcmpgtsw)
-D_STUB(vcmpgtsw_)
-D_STUB(vctuxs)
-D_STUB(vcmpbfp)
-D_STUB(vcmpbfp_)
-D_STUB(vctsxs)
-D_STUB(vupklpx)
-D_STUB(vsububm)
-D_STUB(vavgub)
-D_STUB(vmaxfp)
-D_STUB(vslo)
-D_STUB(vsubuhm)
-D_STUB(vavguh)
-D_STUB(vminfp)
-D_STUB(vsro)
-D_STUB(vsubuwm)
-D_STUB(vavguw)
-D_STUB(vavgsb)
-D_STUB(vavgsh)
-D_STUB(vsubcuw)
-D_STUB(vavgsw)
-D_STUB(vsububs)
-D_STUB(vsum4ubs)
-D_STUB(vsubuhs)
-D_STUB(vsum4shs)
-D_STUB(vsubuws)
-D_STUB(vsum2sws)
-D_STUB(vsubsbs)
-D_STUB(vsum4sbs)
-D_STUB(vsubshs)
-D_STUB(vsubsws)
-D_STUB(vsumsws)
-
 //
 // ALU
 //
@@ -375,35 +213,209 @@ extern void PPCInterpreter_mtfsb1x(PPU_STATE *ppuState);
 extern void PPCInterpreter_dss(PPU_STATE *ppuState);
 extern void PPCInterpreter_dst(PPU_STATE *ppuState);
 extern void PPCInterpreter_dstst(PPU_STATE *ppuState);
-extern void PPCInterpreter_mfvscr(PPU_STATE *ppuState);
-extern void PPCInterpreter_mtvscr(PPU_STATE *ppuState);
+extern void PPCInterpreter_vaddubm(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmaxub(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrlb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmuloub(PPU_STATE *ppuState);
 extern void PPCInterpreter_vaddfp(PPU_STATE *ppuState);
-extern void PPCInterpreter_vand(PPU_STATE *ppuState);
-extern void PPCInterpreter_vandc(PPU_STATE *ppuState);
-extern void PPCInterpreter_vcfux(PPU_STATE *ppuState);
-extern void PPCInterpreter_vnor(PPU_STATE *ppuState);
-extern void PPCInterpreter_vor(PPU_STATE *ppuState);
-extern void PPCInterpreter_vspltw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmrghb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkuhum(PPU_STATE *ppuState);
+extern void PPCInterpreter_vadduhm(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmaxuh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrlh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmulouh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsubfp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmrghh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkuwum(PPU_STATE *ppuState);
+extern void PPCInterpreter_vadduwm(PPU_STATE *ppuState);
 extern void PPCInterpreter_vmaxuw(PPU_STATE *ppuState);
-extern void PPCInterpreter_vminuw(PPU_STATE *ppuState);
-extern void PPCInterpreter_vmaddfp(PPU_STATE *ppuState);
-extern void PPCInterpreter_vmulfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrlw(PPU_STATE *ppuState);
 extern void PPCInterpreter_vmrghw(PPU_STATE *ppuState);
-extern void PPCInterpreter_vmrglw(PPU_STATE *ppuState);
-extern void PPCInterpreter_vmrghw128(PPU_STATE *ppuState);
-extern void PPCInterpreter_vperm(PPU_STATE *ppuState);
-extern void PPCInterpreter_vperm128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkuhus(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkuwus(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmaxsb(PPU_STATE *ppuState);
 extern void PPCInterpreter_vslb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmulosb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrefp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmrglb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkshus(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmaxsh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vslh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmulosh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrsqrtefp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmrglh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkswus(PPU_STATE *ppuState);
+extern void PPCInterpreter_vaddcuw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmaxsw(PPU_STATE *ppuState);
 extern void PPCInterpreter_vslw(PPU_STATE *ppuState);
-extern void PPCInterpreter_vsr(PPU_STATE *ppuState);
-extern void PPCInterpreter_vsrw(PPU_STATE *ppuState);
-extern void PPCInterpreter_vsldoi(PPU_STATE *ppuState);
+extern void PPCInterpreter_vexptefp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmrglw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkshss(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsl(PPU_STATE *ppuState);
+extern void PPCInterpreter_vlogefp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkswss(PPU_STATE *ppuState);
+extern void PPCInterpreter_vaddubs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vminub(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsrb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmuleub(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrfin(PPU_STATE *ppuState);
 extern void PPCInterpreter_vspltb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vupkhsb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vadduhs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vminuh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsrh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmuleuh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrfiz(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsplth(PPU_STATE *ppuState);
+extern void PPCInterpreter_vupkhsh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vadduws(PPU_STATE *ppuState);
+extern void PPCInterpreter_vminuw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsrw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrfip(PPU_STATE *ppuState);
+extern void PPCInterpreter_vspltw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vupklsb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsr(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrfim(PPU_STATE *ppuState);
+extern void PPCInterpreter_vupklsh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vaddsbs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vminsb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsrab(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmulesb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcfux(PPU_STATE *ppuState);
 extern void PPCInterpreter_vspltisb(PPU_STATE *ppuState);
-extern void PPCInterpreter_vspltish(PPU_STATE* ppuState);
-extern void PPCInterpreter_vspltisw(PPU_STATE* ppuState);
-extern void PPCInterpreter_vspltisw128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkpx(PPU_STATE *ppuState);
+extern void PPCInterpreter_vaddshs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vminsh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsrah(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmulesh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcfsx(PPU_STATE *ppuState);
+extern void PPCInterpreter_vspltish(PPU_STATE *ppuState);
+extern void PPCInterpreter_vupkhpx(PPU_STATE *ppuState);
+extern void PPCInterpreter_vaddsws(PPU_STATE *ppuState);
+extern void PPCInterpreter_vminsw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsraw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vctuxs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vspltisw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vctsxs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vupklpx(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsububm(PPU_STATE *ppuState);
+extern void PPCInterpreter_vavgub(PPU_STATE *ppuState);
+extern void PPCInterpreter_vand(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmaxfp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vslo(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsubuhm(PPU_STATE *ppuState);
+extern void PPCInterpreter_vavguh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vandc(PPU_STATE *ppuState);
+extern void PPCInterpreter_vminfp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsro(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsubuwm(PPU_STATE *ppuState);
+extern void PPCInterpreter_vavguw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vor(PPU_STATE *ppuState);
 extern void PPCInterpreter_vxor(PPU_STATE *ppuState);
+extern void PPCInterpreter_vavgsb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vnor(PPU_STATE *ppuState);
+extern void PPCInterpreter_vavgsh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsubcuw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vavgsw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsububs(PPU_STATE *ppuState);
+extern void PPCInterpreter_mfvscr(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsum4ubs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsubuhs(PPU_STATE *ppuState);
+extern void PPCInterpreter_mtvscr(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsum4shs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsubuws(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsum2sws(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsubsbs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsum4sbs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsubshs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsubsws(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsumsws(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpequb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpequh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpequw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpeqfp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpgefp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpgtub(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpgtuh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpgtuw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpgtfp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpgtsb(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpgtsh(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpgtsw(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpbfp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmhaddshs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmhraddshs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmladduhm(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmsumubm(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmsummbm(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmsumuhm(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmsumuhs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmsumshm(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmsumshs(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsel(PPU_STATE *ppuState);
+extern void PPCInterpreter_vperm(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsldoi(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmaddfp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vnmsubfp(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsldoi128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vaddfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsubfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmulfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmaddfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmaddcfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vnmsubfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmsum3fp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmsum4fp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkshss128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vand128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkshus128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vandc128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkswss128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vnor128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkswus128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vor128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkuhum128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vxor128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkuhus128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsel128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkuwum128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vslo128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkuwus128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsro128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vperm128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpeqfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpgefp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpgtfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpbfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcmpequw128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrlw128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vslw128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsraw128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vsrw128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmaxfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vminfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmrghw128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vmrglw128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vupkhsb128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vupklsb128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpermwi128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcfpsxws128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcfpuxws128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcsxwfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vcuxwfp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrfim128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrfin128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrfip128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrfiz128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrefp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrsqrtefp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vexptefp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vlogefp128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vspltw128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vspltisw128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vupkd3d128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vpkd3d128(PPU_STATE *ppuState);
+extern void PPCInterpreter_vrlimi128(PPU_STATE *ppuState);
 
 //
 // Load/Store
@@ -463,6 +475,14 @@ extern void PPCInterpreter_stvlx(PPU_STATE *ppuState);
 extern void PPCInterpreter_stvxl(PPU_STATE *ppuState);
 extern void PPCInterpreter_stvlx128(PPU_STATE *ppuState);
 extern void PPCInterpreter_stvlxl128(PPU_STATE *ppuState);
+extern void PPCInterpreter_stvebx(PPU_STATE *ppuState);
+extern void PPCInterpreter_stvehx(PPU_STATE *ppuState);
+extern void PPCInterpreter_stvlxl(PPU_STATE *ppuState);
+extern void PPCInterpreter_stvrxl(PPU_STATE *ppuState);
+extern void PPCInterpreter_stvx128(PPU_STATE *ppuState);
+extern void PPCInterpreter_stvxl128(PPU_STATE *ppuState);
+extern void PPCInterpreter_stvewx128(PPU_STATE *ppuState);
+extern void PPCInterpreter_stvrxl128(PPU_STATE *ppuState);
 
 // Load Byte
 extern void PPCInterpreter_lbz(PPU_STATE *ppuState);
@@ -524,6 +544,19 @@ extern void PPCInterpreter_lvxl(PPU_STATE *ppuState);
 extern void PPCInterpreter_lvlx(PPU_STATE *ppuState);
 extern void PPCInterpreter_lvrx(PPU_STATE *ppuState);
 extern void PPCInterpreter_lvsl(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvsr(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvebx(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvehx(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvlxl(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvrxl(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvsl128(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvsr128(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvewx128(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvxl128(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvlx128(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvrx128(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvlxl128(PPU_STATE *ppuState);
+extern void PPCInterpreter_lvrxl128(PPU_STATE *ppuState);
 
 
 // @Aleblbl probably better to move it into a separate file for the JIT emitters
@@ -531,16 +564,277 @@ extern void PPCInterpreter_lvsl(PPU_STATE *ppuState);
 //	JIT emitters
 //
 extern void PPCInterpreterJIT_mfspr(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+// ALU
+extern void PPCInterpreterJIT_addx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_addcx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_addex(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
 extern void PPCInterpreterJIT_addi(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_addic(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_addis(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_addmex(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_addzex(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
 extern void PPCInterpreterJIT_andx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
-extern void PPCInterpreterJIT_b(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
-extern void PPCInterpreterJIT_rlwnmx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
-extern void PPCInterpreterJIT_rlwinmx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_andcx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
 extern void PPCInterpreterJIT_andi(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_andis(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_cmp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_cmpi(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_cmpl(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_cmpli(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_cntlzdx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_cntlzwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_crand(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_crandc(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_creqv(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_crnand(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_crnor(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_cror(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_crorc(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_crxor(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_divdx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_divdux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_divwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_divwux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_eqvx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_extsbx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_extshx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_extswx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_mcrf(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_mftb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_mfocrf(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_mtocrf(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_mulhdx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_mulhdux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_mulhwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_mulhwux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_mulldx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_mulli(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_mullwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_nandx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_negx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_norx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_orcx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
 extern void PPCInterpreterJIT_ori(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
 extern void PPCInterpreterJIT_oris(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_orx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_rldicx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_rldcrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_rldclx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_rldiclx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_rldicrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_rldimix(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_rlwimix(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_rlwinmx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_rlwnmx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_sldx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_slwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_sradx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_sradix(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_srawx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_srawix(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_srdx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_srwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_subfcx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_subfx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_subfex(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_subfic(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_subfmex(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_subfzex(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_xorx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
 extern void PPCInterpreterJIT_xori(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
 extern void PPCInterpreterJIT_xoris(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+// Branch
+extern void PPCInterpreterJIT_b(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_bc(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_bcctr(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_bclr(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+// Load/Store
+extern void PPCInterpreterJIT_stb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stbu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stbux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stbx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_sth(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_sthbrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_sthu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_sthux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_sthx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stwbrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stwu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stwux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_std(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stdu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stdux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stdx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lbz(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lbzu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lbzux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lbzx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lha(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lhau(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lhaux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lhax(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lhbrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lhz(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lhzu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lhzux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lhzx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lwa(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lwax(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lwaux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lwbrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lwz(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lwzu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lwzux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lwzx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_ld(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_ldu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_ldux(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_ldx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+// FPU
+extern void PPCInterpreterJIT_faddx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_faddsx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_fsubx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_fsubsx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_fmulx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_fdivx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_fdivsx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_fmaddx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_fmsubx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_fnmaddx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_frspx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_fctiwx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_fcmpu(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+// Load/Store Vector
+extern void PPCInterpreterJIT_lvx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lvxl(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lvx128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lvxl128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lvlx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lvlxl(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lvlx128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lvlxl128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lvrx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lvrxl(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lvrx128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_lvrxl128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stvx(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stvxl(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stvx128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_stvxl128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+// VXU
+extern void PPCInterpreterJIT_vand(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vandc(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vor(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vnor(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vxor(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsel(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vand128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vandc128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vor128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vnor128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vxor128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsel128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vaddubm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vadduhm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vadduwm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsububm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsubuhm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsubuwm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vaddubs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vadduhs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vaddsbs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vaddshs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsububs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsubuhs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsubsbs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsubshs(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vavgub(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vavguh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vavgsb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vavgsh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmaxub(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vminub(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmaxsh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vminsh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmaxsb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vminsb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmaxuh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vminuh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmaxsw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vminsw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmaxuw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vminuw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpequb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpequh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpequw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpgtsb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpgtsh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpgtsw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpgtub(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpgtuh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpgtuw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpequw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpeqfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpgefp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpgtfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpeqfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpgefp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vcmpgtfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vaddfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsubfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmaxfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vminfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmaddfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vnmsubfp(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vaddfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsubfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmulfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmaddfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmaddcfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vnmsubfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmaxfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vminfp128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vslw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsrw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsraw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vrlw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vslw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsrw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsraw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vrlw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vspltb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsplth(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vspltw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vspltw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vspltisb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vspltish(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vspltisw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vspltisw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmrghb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmrglb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmrghh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmrglh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmrghw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmrglw(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmrghw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vmrglw128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsldoi(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vsldoi128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vperm(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vperm128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vpermwi128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vpkuhum(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vpkuwum(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vpkuhum128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vpkuwum128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vupkhsb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vupklsb(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vupkhsh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vupklsh(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vupkhsb128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+extern void PPCInterpreterJIT_vupklsb128(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
 extern void PPCInterpreterJIT_invalid(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
 
 }
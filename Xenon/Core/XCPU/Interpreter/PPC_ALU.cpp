@@ -635,6 +635,11 @@ void PPCInterpreter::PPCInterpreter_divdx(PPU_STATE *ppuState) {
   const bool o = RB == 0 || (RA == INT64_MIN && RB == -1);
   GPRi(rd) = o ? 0 : RA / RB;
 
+  // If OE = 1 and RB = 0 or the quotient overflows, then OV is set.
+  if (_instr.oe) {
+    ppuSetXerOv(ppuState, o);
+  }
+
   // _rc
   if (_instr.rc) {
     RECORD_CR0(GPRi(rd));
@@ -653,26 +658,6 @@ void PPCInterpreter::PPCInterpreter_divdux(PPU_STATE *ppuState) {
   const u64 RB = GPRi(rb);
   GPRi(rd) = RB == 0 ? 0 : RA / RB;
 
-  // _rc
-  if (_instr.rc) {
-    RECORD_CR0(GPRi(rd));
-  }
-}
-
-// Divide Double Word (Overflow-Enabled) (x'7C00 03D2')
-void PPCInterpreter::PPCInterpreter_divdox(PPU_STATE *ppuState) {
-  /*
-    dividend[0-63] <- (rA)
-    divisor[0-63] <- (rB)
-    rD <- dividend + divisor
-  */
-
-  const s64 RA = GPRi(ra);
-  const s64 RB = GPRi(rb);
-  const bool o = RB == 0 || (RA == INT64_MIN && RB == -1);
-  GPRi(rd) = o ? 0 : RA / RB;
-
-  // _oe
   if (_instr.oe) {
     ppuSetXerOv(ppuState, RB == 0);
   }
@@ -683,27 +668,14 @@ void PPCInterpreter::PPCInterpreter_divdox(PPU_STATE *ppuState) {
   }
 }
 
-// Divide Double Word Unsigned (Overflow-Enabled) (x'7C00 0392')
-void PPCInterpreter::PPCInterpreter_divduox(PPU_STATE *ppuState) {
-  /*
-    dividend[0-63] <- (rA)
-    divisor[0-63] <- (rB)
-    rD <- dividend / divisor
-  */
-
-  const u64 RA = GPRi(ra);
-  const u64 RB = GPRi(rb);
-  GPRi(rd) = RB == 0 ? 0 : RA / RB;
-
-  // _oe
-  if (_instr.oe) {
-    ppuSetXerOv(ppuState, RB == 0);
-  }
+// Divide Double Word + OE
+void PPCInterpreter::PPCInterpreter_divdox(PPU_STATE *ppuState) {
+  PPCInterpreter_divdx(ppuState);
+}
 
-  // _rc
-  if (_instr.rc) {
-    RECORD_CR0(GPRi(rd));
-  }
+// Divide Double Word Unsigned + OE
+void PPCInterpreter::PPCInterpreter_divduox(PPU_STATE *ppuState) {
+  PPCInterpreter_divdux(ppuState);
 }
 
 // Divide Word (x'7C00 03D6')
@@ -861,10 +833,10 @@ void PPCInterpreter::PPCInterpreter_mftb(PPU_STATE *ppuState) {
 
   switch (spr) {
   case 268:
-    GPRi(rd) = ppuState->SPR.TB;
+    GPRi(rd) = ppcGetTimeBase(ppuState);
     break;
   case 269:
-    GPRi(rd) = HIDW(ppuState->SPR.TB);
+    GPRi(rd) = HIDW(ppcGetTimeBase(ppuState));
     break;
 
   default:
@@ -2,6 +2,7 @@
 
 #include "Base/Arch.h"
 
+#include "Base/Config.h"
 #include "Base/Types.h"
 #include "Base/Logging/Log.h"
 #include "PPCInterpreter.h"
@@ -33,6 +34,7 @@ enum eFPSCRExceptionBits : u32 {
   FPSCR_BIT_UE = 1U << (31 - 26), // IEEE floating-point underflow exception enable.
   FPSCR_BIT_ZE = 1U << (31 - 27), // IEEE floating-point zero divide exception enable.
   FPSCR_BIT_XE = 1U << (31 - 28), // Floating-point inexact exception enable.
+  FPSCR_BIT_NI = 1U << (31 - 29), // Floating-point non-IEEE mode enable.
 
   // VX Enabled Exceptions.
   FPSCR_VX_ANY = FPSCR_BIT_VXSNAN | FPSCR_BIT_VXISI | FPSCR_BIT_VXIDI | FPSCR_BIT_VXZDZ | FPSCR_BIT_VXIMZ | FPSCR_BIT_VXVC |
@@ -204,6 +206,54 @@ void SetFI(PPU_STATE *ppuState, u32 FI){
   curThread.FPSCR.FI = FI;
 }
 
+//
+// Fast FPU mode
+//
+// With HighlyExperimental.FastFPU set the arithmetic instructions compute their result on the host
+// and skip the FPSCR bookkeeping, as long as no FP exception is enabled, the FPU is in IEEE mode and
+// the instruction isn't a record form. FPRF isn't classified either: the result is kept and only
+// classified once FPSCR gets read or FPRF partially updated, see ppuResolveFPRF.
+// Results that aren't finite go trough the precise path, which covers every invalid operation, zero
+// divide and overflow. FI, FR and XX aren't updated by the fast path.
+//
+
+void PPCInterpreter::ppuResolveFPRF(PPU_THREAD_REGISTERS *thread) {
+  switch (thread->fprfPending) {
+  case eFPRFPending::None:
+    return;
+  case eFPRFPending::Double:
+    thread->FPSCR.FPRF = ClassifyDouble(std::bit_cast<f64>(thread->fprfPendingValue));
+    break;
+  case eFPRFPending::Single:
+    thread->FPSCR.FPRF = ClassifyFloat(static_cast<f32>(std::bit_cast<f64>(thread->fprfPendingValue)));
+    break;
+  }
+  thread->fprfPending = eFPRFPending::None;
+}
+
+// Returns true if the current instruction can take the fast path. Otherwise FPRF is resolved, as the
+// precise path updates it.
+inline bool FPFastPath(PPU_STATE *ppuState) {
+  constexpr u32 preciseMask = FPSCR_ANY_E | FPSCR_BIT_NI;
+  if (Config::highlyExperimental.fastFPU && !_instr.rc && (curThread.FPSCR.FPSCR_Hex & preciseMask) == 0)
+    return true;
+  PPCInterpreter::ppuResolveFPRF(&curThread);
+  return false;
+}
+
+// Writes a fast path result to frD and leaves its class pending. Returns false without touching frD
+// when the result must go trough the precise path.
+inline bool FPFastResult(PPU_STATE *ppuState, f64 result, bool single) {
+  if (!std::isfinite(result)) {
+    PPCInterpreter::ppuResolveFPRF(&curThread);
+    return false;
+  }
+  FPRi(frd).setValue(result);
+  curThread.fprfPendingValue = std::bit_cast<u64>(result);
+  curThread.fprfPending = single ? eFPRFPending::Single : eFPRFPending::Double;
+  return true;
+}
+
 inline f32 FPForceSingle(PPU_STATE *ppuState, f64 value) {
   if (curThread.FPSCR.NI) {
     // Emulate a rounding quirk. If the conversion result before rounding is a subnormal single,
@@ -266,6 +316,8 @@ inline f64 Force25Bit(f64 d) {
 }
 
 void PPCInterpreter::FPCompareOrdered(PPU_STATE *ppuState, f64 fra, f64 frb) {
+  ppuResolveFPRF(&curThread);
+
   eFPCCBits compareResult;
 
   if (std::isnan(fra) || std::isnan(frb)) {
@@ -288,12 +340,14 @@ void PPCInterpreter::FPCompareOrdered(PPU_STATE *ppuState, f64 fra, f64 frb) {
   const u32 compareValue = static_cast<u32>(compareResult);
 
   // Clear and set the FPCC bits accordingly.
-  curThread.FPSCR.FPRF = (curThread.FPSCR.FPRF & ~(0xF << 12)) | compareValue;
+  curThread.FPSCR.FPRF = (curThread.FPSCR.FPRF & 0x10) | compareValue;
 
   ppcUpdateCR(ppuState, _instr.crfd, compareValue);
 }
 
 void PPCInterpreter::FPCompareUnordered(PPU_STATE *ppuState, f64 fra, f64 frb) {
+  ppuResolveFPRF(&curThread);
+
   eFPCCBits compareResult;
 
   if (std::isnan(fra) || std::isnan(frb)) {
@@ -312,7 +366,7 @@ void PPCInterpreter::FPCompareUnordered(PPU_STATE *ppuState, f64 fra, f64 frb) {
   const u32 compareValue = static_cast<u32>(compareResult);
 
   // Clear and set the FPCC bits accordingly.
-  curThread.FPSCR.FPRF = (curThread.FPSCR.FPRF & ~(0xF << 12)) | compareValue;
+  curThread.FPSCR.FPRF = (curThread.FPSCR.FPRF & 0x10) | compareValue;
 
   ppcUpdateCR(ppuState, _instr.crfd, compareValue);
 }
@@ -361,6 +415,16 @@ void PPCInterpreter::ConvertToInteger(PPU_STATE *ppuState, eFPRoundMode rounding
     std::unreachable();
   }
 
+  // Fast FPU mode, in range operands only. NaNs fail both compares.
+  if (rounded > -2147483649.0 && rounded < 2147483648.0 && FPFastPath(ppuState)) {
+    value = static_cast<u32>(static_cast<s32>(rounded));
+    u64 result = 0xFFF8000000000000ull | value;
+    if (value == 0 && std::signbit(b))
+      result |= 0x100000000ull;
+    FPRi(frd).setValue(result);
+    return;
+  }
+
   if (std::isnan(b)) {
     if (IsSignalingNAN(b))
       FPSetException(ppuState, FPSCR_BIT_VXSNAN);
@@ -610,6 +674,8 @@ void PPCInterpreter::ppuUpdateFPSCR(PPU_STATE *ppuState, f64 op0, f64 op1, bool
 
   static_assert(std::endian::native == std::endian::little, "ppcUpdateFPSCR not implemented for Big-Endian arch.");
 
+  ppuResolveFPRF(&curThread);
+
   const auto cmpResult = op0 <=> op1;
   u32 crValue = 0;
   if (cmpResult == std::partial_ordering::less) {
@@ -654,6 +720,8 @@ void PPCInterpreter::PPCInterpreter_mcrfs(PPU_STATE *ppuState) {
 
   CHECK_FPU;
 
+  ppuResolveFPRF(&curThread);
+
   const u32 shift = 4 * (7 - _instr.crfs);
   const u32 fpFlags = (curThread.FPSCR.FPSCR_Hex >> shift) & 0xF;
   // If any exception bits were read, we clear them as per docs.
@@ -673,6 +741,9 @@ void PPCInterpreter::PPCInterpreter_faddx(PPU_STATE *ppuState) {
   const f64 fra = FPRi(fra).asDouble();
   const f64 frb = FPRi(frb).asDouble();
 
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, fra + frb, false))
+    return;
+
   const FPResult sum = FPAdd(ppuState, fra, frb);
 
   if (curThread.FPSCR.VE == 0 || sum.HasNoInvalidExceptions()) {
@@ -712,6 +783,9 @@ void PPCInterpreter::PPCInterpreter_faddsx(PPU_STATE *ppuState) {
   const f64 fra = FPRi(fra).asDouble();
   const f64 frb = FPRi(frb).asDouble();
 
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, static_cast<f32>(fra + frb), true))
+    return;
+
   const FPResult sum = FPAdd(ppuState, fra, frb);
 
   if (curThread.FPSCR.VE == 0 || sum.HasNoInvalidExceptions()) {
@@ -946,6 +1020,9 @@ void PPCInterpreter::PPCInterpreter_fdivx(PPU_STATE *ppuState) {
   const f64 fra = FPRi(fra).asDouble();
   const f64 frb = FPRi(frb).asDouble();
 
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, fra / frb, false))
+    return;
+
   const FPResult quotient = FPDiv(ppuState, fra, frb);
   const bool notDivideByZero = curThread.FPSCR.ZE == 0 || quotient.exception != FPSCR_BIT_ZX;
   const bool notInvalid = curThread.FPSCR.VE == 0 || quotient.HasNoInvalidExceptions();
@@ -971,6 +1048,9 @@ void PPCInterpreter::PPCInterpreter_fdivsx(PPU_STATE *ppuState) {
   const f64 fra = FPRi(fra).asDouble();
   const f64 frb = FPRi(frb).asDouble();
 
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, static_cast<f32>(fra / frb), true))
+    return;
+
   const FPResult quotient = FPDiv(ppuState, fra, frb);
   const bool notDivideByZero = curThread.FPSCR.ZE == 0 || quotient.exception != FPSCR_BIT_ZX;
   const bool notInvalid = curThread.FPSCR.VE == 0 || quotient.HasNoInvalidExceptions();
@@ -997,6 +1077,9 @@ void PPCInterpreter::PPCInterpreter_fmaddx(PPU_STATE *ppuState) {
   const f64 frb = FPRi(frb).asDouble();
   const f64 frc = FPRi(frc).asDouble();
 
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, std::fma(fra, frc, frb), false))
+    return;
+
   const FPResult product = FPMadd(ppuState, fra, frc, frb);
 
   if (curThread.FPSCR.VE == 0 || product.HasNoInvalidExceptions()) {
@@ -1022,6 +1105,9 @@ void PPCInterpreter::PPCInterpreter_fmaddsx(PPU_STATE *ppuState) {
   const f64 frc = FPRi(frc).asDouble();
 
   const f64 cValue = Force25Bit(frc);
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, static_cast<f32>(std::fma(fra, cValue, frb)), true))
+    return;
+
   const FPResult dValue = FPMadd(ppuState, fra, cValue, frb);
 
   if (curThread.FPSCR.VE == 0 || dValue.HasNoInvalidExceptions()) {
@@ -1047,6 +1133,9 @@ void PPCInterpreter::PPCInterpreter_fmulx(PPU_STATE *ppuState) {
   const f64 fra = FPRi(fra).asDouble();
   const f64 frc = FPRi(frc).asDouble();
 
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, fra * frc, false))
+    return;
+
   const FPResult product = FPMul(ppuState, fra, frc);
 
   if (curThread.FPSCR.VE == 0 || product.HasNoInvalidExceptions()) {
@@ -1074,6 +1163,9 @@ void PPCInterpreter::PPCInterpreter_fmulsx(PPU_STATE *ppuState) {
   const f64 frc = FPRi(frc).asDouble();
 
   const f64 cValue = Force25Bit(frc);
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, static_cast<f32>(fra * cValue), true))
+    return;
+
   const FPResult dValue = FPMul(ppuState, fra, cValue);
 
   if (curThread.FPSCR.VE == 0 || dValue.HasNoInvalidExceptions()) {
@@ -1114,6 +1206,9 @@ void PPCInterpreter::PPCInterpreter_fmsubx(PPU_STATE *ppuState) {
   const f64 frb = FPRi(frb).asDouble();
   const f64 frc = FPRi(frc).asDouble();
 
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, std::fma(fra, frc, -frb), false))
+    return;
+
   const FPResult product = FPMsub(ppuState, fra, frc, frb);
 
   if (curThread.FPSCR.VE == 0 || product.HasNoInvalidExceptions()) {
@@ -1139,6 +1234,9 @@ void PPCInterpreter::PPCInterpreter_fmsubsx(PPU_STATE *ppuState) {
   const f64 frc = FPRi(frc).asDouble();
 
   const f64 cValue = Force25Bit(frc);
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, static_cast<f32>(std::fma(fra, cValue, -frb)), true))
+    return;
+
   const FPResult product = FPMsub(ppuState, fra, cValue, frb);
 
   if (curThread.FPSCR.VE == 0 || product.HasNoInvalidExceptions()) {
@@ -1178,10 +1276,13 @@ void PPCInterpreter::PPCInterpreter_fnmaddx(PPU_STATE *ppuState) {
   const f64 frb = FPRi(frb).asDouble();
   const f64 frc = FPRi(frc).asDouble();
 
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, -std::fma(fra, frc, frb), false))
+    return;
+
   const FPResult product = FPMadd(ppuState, fra, frc, frb);
 
   if (curThread.FPSCR.VE == 0 || product.HasNoInvalidExceptions()) {
-    const f32 tmp = FPForceDouble(ppuState, product.value);
+    const f64 tmp = FPForceDouble(ppuState, product.value);
     const f64 result = std::isnan(tmp) ? tmp : -tmp;
     FPRi(frd).setValue(result);
     curThread.FPSCR.FPRF = ClassifyDouble(result);
@@ -1204,6 +1305,9 @@ void PPCInterpreter::PPCInterpreter_fnmaddsx(PPU_STATE *ppuState) {
   const f64 frc = FPRi(frc).asDouble();
 
   const f64 cValue = Force25Bit(frc);
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, -static_cast<f32>(std::fma(fra, cValue, frb)), true))
+    return;
+
   const FPResult product = FPMadd(ppuState, fra, cValue, frb);
 
   if (curThread.FPSCR.VE == 0 || product.HasNoInvalidExceptions()) {
@@ -1243,10 +1347,13 @@ void PPCInterpreter::PPCInterpreter_fnmsubx(PPU_STATE *ppuState) {
   const f64 frb = FPRi(frb).asDouble();
   const f64 frc = FPRi(frc).asDouble();
 
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, -std::fma(fra, frc, -frb), false))
+    return;
+
   const FPResult product = FPMsub(ppuState, fra, frc, frb);
 
   if (curThread.FPSCR.VE == 0 || product.HasNoInvalidExceptions()) {
-    const f32 tmp = FPForceDouble(ppuState, product.value);
+    const f64 tmp = FPForceDouble(ppuState, product.value);
     const f64 result = std::isnan(tmp) ? tmp : -tmp;
     FPRi(frd).setValue(result);
     curThread.FPSCR.FPRF = ClassifyDouble(result);
@@ -1269,6 +1376,9 @@ void PPCInterpreter::PPCInterpreter_fnmsubsx(PPU_STATE *ppuState) {
   const f64 frc = FPRi(frc).asDouble();
 
   const f64 cValue = Force25Bit(frc);
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, -static_cast<f32>(std::fma(fra, cValue, -frb)), true))
+    return;
+
   const FPResult product = FPMsub(ppuState, fra, cValue, frb);
 
   if (curThread.FPSCR.VE == 0 || product.HasNoInvalidExceptions()) {
@@ -1293,6 +1403,9 @@ void PPCInterpreter::PPCInterpreter_frspx(PPU_STATE *ppuState) {
   const f64 b = FPRi(frb).asDouble();
   const f32 rounded = FPForceSingle(ppuState, b);
 
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, static_cast<f32>(b), true))
+    return;
+
   if (std::isnan(b)) {
     const bool is_snan = IsSignalingNAN(b);
 
@@ -1327,6 +1440,9 @@ void PPCInterpreter::PPCInterpreter_fsubx(PPU_STATE *ppuState) {
   const f64 fra = FPRi(fra).asDouble();
   const f64 frb = FPRi(frb).asDouble();
 
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, fra - frb, false))
+    return;
+
   const FPResult difference = FPSub(ppuState, fra, frb);
 
   if (curThread.FPSCR.VE == 0 || difference.HasNoInvalidExceptions()) {
@@ -1367,6 +1483,9 @@ void PPCInterpreter::PPCInterpreter_fsubsx(PPU_STATE *ppuState) {
   const f64 fra = FPRi(fra).asDouble();
   const f64 frb = FPRi(frb).asDouble();
 
+  if (FPFastPath(ppuState) && FPFastResult(ppuState, static_cast<f32>(fra - frb), true))
+    return;
+
   const FPResult difference = FPSub(ppuState, fra, frb);
 
   if (curThread.FPSCR.VE == 0 || difference.HasNoInvalidExceptions()) {
@@ -1436,6 +1555,8 @@ void PPCInterpreter::PPCInterpreter_frsqrtex(PPU_STATE *ppuState) {
 void PPCInterpreter::PPCInterpreter_mffsx(PPU_STATE *ppuState) {
   CHECK_FPU;
 
+  ppuResolveFPRF(&curThread);
+
   FPRi(frd).setValue(static_cast<u64>(GET_FPSCR));
 
   if (_instr.rc)
@@ -1446,6 +1567,8 @@ void PPCInterpreter::PPCInterpreter_mffsx(PPU_STATE *ppuState) {
 void PPCInterpreter::PPCInterpreter_mtfsfx(PPU_STATE *ppuState) {
   CHECK_FPU;
 
+  ppuResolveFPRF(&curThread);
+
   const u32 fm = _instr.flm;
   u32 m = 0;
 
@@ -1468,6 +1591,8 @@ void PPCInterpreter::PPCInterpreter_mtfsb0x(PPU_STATE *ppuState) {
 
   CHECK_FPU;
 
+  ppuResolveFPRF(&curThread);
+
   u32 b = 0x80000000 >> _instr.crbd;
 
   curThread.FPSCR.FPSCR_Hex &= ~b;
@@ -1484,6 +1609,8 @@ void PPCInterpreter::PPCInterpreter_mtfsb1x(PPU_STATE *ppuState) {
 
   CHECK_FPU;
 
+  ppuResolveFPRF(&curThread);
+
   const u32 bit = _instr.crbd;
   const u32 b = 0x80000000 >> bit;
 
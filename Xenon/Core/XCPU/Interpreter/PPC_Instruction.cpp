@@ -37,15 +37,16 @@ namespace PPCInterpreter {
   }
 
   void PPCInterpreterJIT_invalid(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr) {
-    u32 opcodeEntry = PPCDecode(instr.opcode);
-    std::string opName = ppcDecoder.getNameTable()[opcodeEntry];
-    LOG_DEBUG(Xenon, "JIT: No emitter found for opcode '{}' (0x{:08X}) at addr 0x{:X}", opName, instr.opcode, curThread.CIA);
+    LOG_DEBUG(Xenon, "JIT: No emitter found for opcode '{}' (0x{:08X}) at addr 0x{:X}", ppcDecoder.decodeName(instr.opcode), instr.opcode, curThread.CIA);
   }
 
   PPCDecoder::PPCDecoder() {
     fillTables();
     fillNameTables();
     fillJITTables();
+    for (auto &x : infoTable) {
+      x.flags = instrFlags[x.nameId];
+    }
   }
 
   void PPCDecoder::fillJITTables() {
@@ -56,15 +57,24 @@ namespace PPCInterpreter {
 #define GET(name) GET_(name), GET_(name)
 #define GETRC(name) GET_(name##x), GET_(name##x)
 
-    for (auto &x : jitTable) {
-      x = GET(invalid);
+    for (auto &x : infoTable) {
+      x.jitHandler = GET_(invalid);
     }
 
     // Main opcodes (field 0..5)
 #if defined(ARCH_X86) || defined(ARCH_X86_64)
-    fillTable<instructionHandlerJIT>(jitTable, 0x00, 6, -1, {
+    fillTable<instructionHandlerJIT>(&PPCInstrInfo::jitHandler, 0x00, 6, -1, {
+      { 0x07, GET(mulli) },
+      { 0x08, GET(subfic) },
+      { 0x0A, GET(cmpli) },
+      { 0x0B, GET(cmpi) },
+      { 0x0C, GET(addic) },
+      { 0x0D, GET(addic) },
       { 0x0E, GET(addi) },
+      { 0x0F, GET(addis) },
+      { 0x10, GET(bc) },
       { 0x12, GET(b) },
+      { 0x14, GETRC(rlwimi) },
       { 0x15, GETRC(rlwinm) },
       { 0x17, GETRC(rlwnm) },
       { 0x18, GET(ori) },
@@ -72,12 +82,231 @@ namespace PPCInterpreter {
       { 0x1A, GET(xori) },
       { 0x1B, GET(xoris) },
       { 0x1C, GET(andi) },
+      { 0x1D, GET(andis) },
+      { 0x20, GET(lwz) },
+      { 0x21, GET(lwzu) },
+      { 0x22, GET(lbz) },
+      { 0x23, GET(lbzu) },
+      { 0x24, GET(stw) },
+      { 0x25, GET(stwu) },
+      { 0x26, GET(stb) },
+      { 0x27, GET(stbu) },
+      { 0x28, GET(lhz) },
+      { 0x29, GET(lhzu) },
+      { 0x2A, GET(lha) },
+      { 0x2B, GET(lhau) },
+      { 0x2C, GET(sth) },
+      { 0x2D, GET(sthu) },
+    });
+
+    // Group 0x13 opcodes (field 21..30)
+    fillTable<instructionHandlerJIT>(&PPCInstrInfo::jitHandler, 0x13, 10, 1, {
+      { 0x000, GET(mcrf) },
+      { 0x010, GET(bclr) },
+      { 0x021, GET(crnor) },
+      { 0x081, GET(crandc) },
+      { 0x0C1, GET(crxor) },
+      { 0x0E1, GET(crnand) },
+      { 0x101, GET(crand) },
+      { 0x121, GET(creqv) },
+      { 0x1A1, GET(crorc) },
+      { 0x1C1, GET(cror) },
+      { 0x210, GET(bcctr) },
+    });
+
+    // Group 0x1E opcodes (field 27..30)
+    fillTable<instructionHandlerJIT>(&PPCInstrInfo::jitHandler, 0x1E, 4, 1, {
+      { 0x0, GETRC(rldicl) },
+      { 0x1, GETRC(rldicl) },
+      { 0x2, GETRC(rldicr) },
+      { 0x3, GETRC(rldicr) },
+      { 0x4, GETRC(rldic) },
+      { 0x5, GETRC(rldic) },
+      { 0x6, GETRC(rldimi) },
+      { 0x7, GETRC(rldimi) },
+      { 0x8, GETRC(rldcl) },
+      { 0x9, GETRC(rldcr) },
     });
 
     // Group 0x1F opcodes (field 21..30)
-    fillTable<instructionHandlerJIT>(jitTable, 0x1F, 10, 1, {
+    // OE forms share the emitter of the base instruction
+    fillTable<instructionHandlerJIT>(&PPCInstrInfo::jitHandler, 0x1F, 10, 1, {
+      { 0x000, GET(cmp) },
+      { 0x008, GETRC(subfc) },
+      { 0x208, GETRC(subfc) },
+      { 0x009, GETRC(mulhdu) },
+      { 0x00A, GETRC(addc) },
+      { 0x20A, GETRC(addc) },
+      { 0x00B, GETRC(mulhwu) },
+      { 0x013, GET(mfocrf) },
+      { 0x015, GET(ldx) },
+      { 0x017, GET(lwzx) },
+      { 0x018, GETRC(slw) },
+      { 0x01A, GETRC(cntlzw) },
+      { 0x01B, GETRC(sld) },
+      { 0x01C, GETRC(and) },
+      { 0x020, GET(cmpl) },
+      { 0x028, GETRC(subf) },
+      { 0x228, GETRC(subf) },
+      { 0x035, GET(ldux) },
+      { 0x037, GET(lwzux) },
+      { 0x03A, GETRC(cntlzd) },
+      { 0x03C, GETRC(andc) },
+      { 0x049, GETRC(mulhd) },
+      { 0x04B, GETRC(mulhw) },
+      { 0x057, GET(lbzx) },
+      { 0x068, GETRC(neg) },
+      { 0x268, GETRC(neg) },
+      { 0x077, GET(lbzux) },
+      { 0x07C, GETRC(nor) },
+      { 0x088, GETRC(subfe) },
+      { 0x288, GETRC(subfe) },
+      { 0x08A, GETRC(adde) },
+      { 0x28A, GETRC(adde) },
+      { 0x090, GET(mtocrf) },
+      { 0x095, GET(stdx) },
+      { 0x097, GET(stwx) },
+      { 0x0B5, GET(stdux) },
+      { 0x0B7, GET(stwux) },
+      { 0x0C8, GETRC(subfze) },
+      { 0x2C8, GETRC(subfze) },
+      { 0x0CA, GETRC(addze) },
+      { 0x2CA, GETRC(addze) },
+      { 0x0D7, GET(stbx) },
+      { 0x0E8, GETRC(subfme) },
+      { 0x2E8, GETRC(subfme) },
+      { 0x0E9, GETRC(mulld) },
+      { 0x2E9, GETRC(mulld) },
+      { 0x0EA, GETRC(addme) },
+      { 0x2EA, GETRC(addme) },
+      { 0x0EB, GETRC(mullw) },
+      { 0x2EB, GETRC(mullw) },
+      { 0x0F7, GET(stbux) },
+      { 0x10A, GETRC(add) },
+      { 0x30A, GETRC(add) },
+      { 0x117, GET(lhzx) },
+      { 0x11C, GETRC(eqv) },
+      { 0x137, GET(lhzux) },
+      { 0x13C, GETRC(xor) },
       { 0x153, GET(mfspr) },
+      { 0x155, GET(lwax) },
+      { 0x157, GET(lhax) },
+      { 0x173, GET(mftb) },
+      { 0x175, GET(lwaux) },
+      { 0x177, GET(lhaux) },
+      { 0x197, GET(sthx) },
+      { 0x19C, GET(orcx) },
+      { 0x1B7, GET(sthux) },
+      { 0x1BC, GETRC(or) },
+      { 0x1C9, GETRC(divdu) },
+      { 0x3C9, GETRC(divdu) },
+      { 0x1CB, GETRC(divwu) },
+      { 0x3CB, GETRC(divwu) },
+      { 0x1DC, GETRC(nand) },
+      { 0x1E9, GETRC(divd) },
+      { 0x3E9, GETRC(divd) },
+      { 0x1EB, GETRC(divw) },
+      { 0x3EB, GETRC(divw) },
+      { 0x216, GET(lwbrx) },
+      { 0x218, GETRC(srw) },
+      { 0x21B, GETRC(srd) },
+      { 0x296, GET(stwbrx) },
+      { 0x316, GET(lhbrx) },
+      { 0x318, GETRC(sraw) },
+      { 0x31A, GETRC(srad) },
+      { 0x338, GETRC(srawi) },
+      { 0x33A, GETRC(sradi) },
+      { 0x33B, GETRC(sradi) },
+      { 0x396, GET(sthbrx) },
+      { 0x39A, GETRC(extsh) },
+      { 0x3BA, GETRC(extsb) },
+      { 0x3DA, GETRC(extsw) },
+      { 0x067, GET(lvx) },
+      { 0x0E7, GET(stvx) },
+      { 0x167, GET(lvxl) },
+      { 0x1E7, GET(stvxl) },
+      { 0x207, GET(lvlx) },
+      { 0x227, GET(lvrx) },
+      { 0x307, GET(lvlxl) },
+      { 0x327, GET(lvrxl) },
+    });
+
+    // Group 0x3A opcodes (field 30..31)
+    fillTable<instructionHandlerJIT>(&PPCInstrInfo::jitHandler, 0x3A, 2, 0, {
+      { 0x0, GET(ld) },
+      { 0x1, GET(ldu) },
+      { 0x2, GET(lwa) },
+    });
+
+    // Group 0x3E opcodes (field 30..31)
+    fillTable<instructionHandlerJIT>(&PPCInstrInfo::jitHandler, 0x3E, 2, 0, {
+      { 0x0, GET(std) },
+      { 0x1, GET(stdu) },
+    });
+
+    // Group 0x3B opcodes (field 21..30)
+    fillTable<instructionHandlerJIT>(&PPCInstrInfo::jitHandler, 0x3B, 10, 1, {
+      { 0x12, GETRC(fdivs), 5 },
+      { 0x14, GETRC(fsubs), 5 },
+      { 0x15, GETRC(fadds), 5 },
+    });
+
+    // Group 0x3F opcodes (field 21..30)
+    fillTable<instructionHandlerJIT>(&PPCInstrInfo::jitHandler, 0x3F, 10, 1, {
+      { 0x000, GET(fcmpu) },
+      { 0x00C, GETRC(frsp) },
+      { 0x00E, GETRC(fctiw) },
+
+      { 0x012, GETRC(fdiv), 5 },
+      { 0x014, GETRC(fsub), 5 },
+      { 0x015, GETRC(fadd), 5 },
+      { 0x019, GETRC(fmul), 5 },
+      { 0x01C, GETRC(fmsub), 5 },
+      { 0x01D, GETRC(fmadd), 5 },
+      { 0x01F, GETRC(fnmadd), 5 },
     });
+
+    // VMX and VMX128 opcodes (groups 0x04..0x06). Their masked encodings overlap, so the emitters are
+    // placed on the entries already decoded to the matching interpreter handler.
+    const std::pair<instructionHandler, instructionHandlerJIT> vectorEmitters[] = {
+#define VXU_JIT(name) { &PPCInterpreter_##name, GET_(name) }
+      VXU_JIT(lvx128), VXU_JIT(lvxl128), VXU_JIT(stvx128), VXU_JIT(stvxl128),
+      VXU_JIT(lvlx128), VXU_JIT(lvlxl128), VXU_JIT(lvrx128), VXU_JIT(lvrxl128),
+      VXU_JIT(vand), VXU_JIT(vandc), VXU_JIT(vor), VXU_JIT(vnor), VXU_JIT(vxor), VXU_JIT(vsel),
+      VXU_JIT(vand128), VXU_JIT(vandc128), VXU_JIT(vor128), VXU_JIT(vnor128), VXU_JIT(vxor128), VXU_JIT(vsel128),
+      VXU_JIT(vaddubm), VXU_JIT(vadduhm), VXU_JIT(vadduwm), VXU_JIT(vsububm), VXU_JIT(vsubuhm), VXU_JIT(vsubuwm),
+      VXU_JIT(vaddubs), VXU_JIT(vadduhs), VXU_JIT(vaddsbs), VXU_JIT(vaddshs),
+      VXU_JIT(vsububs), VXU_JIT(vsubuhs), VXU_JIT(vsubsbs), VXU_JIT(vsubshs),
+      VXU_JIT(vavgub), VXU_JIT(vavguh), VXU_JIT(vavgsb), VXU_JIT(vavgsh),
+      VXU_JIT(vmaxub), VXU_JIT(vminub), VXU_JIT(vmaxsh), VXU_JIT(vminsh), VXU_JIT(vmaxsb), VXU_JIT(vminsb),
+      VXU_JIT(vmaxuh), VXU_JIT(vminuh), VXU_JIT(vmaxsw), VXU_JIT(vminsw), VXU_JIT(vmaxuw), VXU_JIT(vminuw),
+      VXU_JIT(vcmpequb), VXU_JIT(vcmpequh), VXU_JIT(vcmpequw), VXU_JIT(vcmpgtsb), VXU_JIT(vcmpgtsh),
+      VXU_JIT(vcmpgtsw), VXU_JIT(vcmpgtub), VXU_JIT(vcmpgtuh), VXU_JIT(vcmpgtuw), VXU_JIT(vcmpequw128),
+      VXU_JIT(vcmpeqfp), VXU_JIT(vcmpgefp), VXU_JIT(vcmpgtfp),
+      VXU_JIT(vcmpeqfp128), VXU_JIT(vcmpgefp128), VXU_JIT(vcmpgtfp128),
+      VXU_JIT(vaddfp), VXU_JIT(vsubfp), VXU_JIT(vmaxfp), VXU_JIT(vminfp), VXU_JIT(vmaddfp), VXU_JIT(vnmsubfp),
+      VXU_JIT(vaddfp128), VXU_JIT(vsubfp128), VXU_JIT(vmulfp128), VXU_JIT(vmaddfp128), VXU_JIT(vmaddcfp128),
+      VXU_JIT(vnmsubfp128), VXU_JIT(vmaxfp128), VXU_JIT(vminfp128),
+      VXU_JIT(vslw), VXU_JIT(vsrw), VXU_JIT(vsraw), VXU_JIT(vrlw),
+      VXU_JIT(vslw128), VXU_JIT(vsrw128), VXU_JIT(vsraw128), VXU_JIT(vrlw128),
+      VXU_JIT(vspltb), VXU_JIT(vsplth), VXU_JIT(vspltw), VXU_JIT(vspltw128),
+      VXU_JIT(vspltisb), VXU_JIT(vspltish), VXU_JIT(vspltisw), VXU_JIT(vspltisw128),
+      VXU_JIT(vmrghb), VXU_JIT(vmrglb), VXU_JIT(vmrghh), VXU_JIT(vmrglh), VXU_JIT(vmrghw), VXU_JIT(vmrglw),
+      VXU_JIT(vmrghw128), VXU_JIT(vmrglw128),
+      VXU_JIT(vsldoi), VXU_JIT(vsldoi128), VXU_JIT(vperm), VXU_JIT(vperm128), VXU_JIT(vpermwi128),
+      VXU_JIT(vpkuhum), VXU_JIT(vpkuwum), VXU_JIT(vpkuhum128), VXU_JIT(vpkuwum128),
+      VXU_JIT(vupkhsb), VXU_JIT(vupklsb), VXU_JIT(vupkhsh), VXU_JIT(vupklsh),
+      VXU_JIT(vupkhsb128), VXU_JIT(vupklsb128),
+#undef VXU_JIT
+    };
+    for (auto &x : infoTable) {
+      for (const auto &[handler, emitter] : vectorEmitters) {
+        if (x.handler == handler) {
+          x.jitHandler = emitter;
+          break;
+        }
+      }
+    }
 #endif // defined ARCH_X86 || ARCH_X86_64
 
     #undef GET_
@@ -88,11 +317,11 @@ namespace PPCInterpreter {
     #define GET_(name) &PPCInterpreter_##name
     #define GET(name) GET_(name), GET_(name)
     #define GETRC(name) GET_(name##x), GET_(name##x)
-    for (auto& x : table) {
-      x = GET(invalid);
+    for (auto &x : infoTable) {
+      x.handler = GET_(invalid);
     }
     // Main opcodes (field 0..5)
-    fillTable<instructionHandler>(table, 0x00, 6, -1, {
+    fillTable<instructionHandler>(&PPCInstrInfo::handler, 0x00, 6, -1, {
       { 0x02, GET(tdi) },
       { 0x03, GET(twi) },
       { 0x07, GET(mulli) },
@@ -140,195 +369,263 @@ namespace PPCInterpreter {
       { 0x36, GET(stfd) },
       { 0x37, GET(stfdu) },
     });
-    // Special case opcodes
-    fillTable<instructionHandler>(table, 0x04, 11, 12, {
-      //{ 0x083, GET(lvewx128) },
-      //{ 0x403, GET(lvlx128) },
-      //{ 0x603, GET(lvlxl128) },
-      //{ 0x443, GET(lvrx128) },
-      //{ 0x643, GET(lvrxl128) },
-      //{ 0x003, GET(lvsl128) },
-      //{ 0x043, GET(lvsr128) },
-      //{ 0x2C3, GET(lvxl128) },
-      { 0x945, GET(vperm128) },
-      { 0x7193, GET(stvewx128) },
-      { 0x7393, GET(stvrx128) },
-      { 0x73C4, GET(stvx128) },
-      { 0xB705, GET(vor128) },
-      { 0x30C4, GET(lvx128) },
-      { 0x2405, GET(vmulfp128) },
-      { 0x1D8C6, GET(vmrglw128) },
-      { 0x1C8C6, GET(vmrghw128) },
-      { 0x1C1C4, GET(stvlxl128) },
-      { 0x1C2C4, GET(stvlxl128) },
-      { 0x1C406, GET(vrlimi128) },
-      { 0x1DD06, GET(vspltisw128) },
-      { 0xDB84, GET(vmaddfp) },
-      { 0xBB84, GET(vmaddfp) },
-      { 0x7B84, GET(vmaddfp) },
-      { 0xCB84, GET(vmaddfp) },
-      { 0xCB04, GET(vsldoi) },
-      { 0x4B04, GET(vsldoi) },
-      { 0xF406, GET(vpermwi128) },
-      { 0x6AC4, GET(vperm) },
-      { 0x5AC4, GET(vperm) },
-      { 0x141C4, GET(stvlx128) },
-      { 0x151C4, GET(stvrx128) },
-      //{ 0x503, GET(stvlx128) },
-      //{ 0x743, GET(stvrxl128) },
-      //{ 0x3C3, GET(stvxl128) },
-    });
-    // Group 0x4 opcodes (field 21..31)
-    fillTable<instructionHandler>(table, 0x04, 11, 0, {
-      { 0x604, GET(mfvscr) },
-      { 0x644, GET(mtvscr) },
-      { 0x180, GET(vaddcuw) },
-      { 0x00A, GET(vaddfp) },
-      { 0x300, GET(vaddsbs) },
-      { 0x340, GET(vaddshs) },
-      { 0x380, GET(vaddsws) },
+    // Group 0x04 VX form opcodes (field 21..31)
+    fillMasked<instructionHandler>(&PPCInstrInfo::handler, 0x04, 0x7FF, {
       { 0x000, GET(vaddubm) },
-      { 0x200, GET(vaddubs) },
-      { 0x040, GET(vadduhm) },
-      { 0x240, GET(vadduhs) },
-      { 0x080, GET(vadduwm) },
-      { 0x280, GET(vadduws) },
-      { 0x404, GET(vand) },
-      { 0x444, GET(vandc) },
-      { 0x502, GET(vavgsb) },
-      { 0x542, GET(vavgsh) },
-      { 0x582, GET(vavgsw) },
-      { 0x402, GET(vavgub) },
-      { 0x442, GET(vavguh) },
-      { 0x482, GET(vavguw) },
-      { 0x34A, GET(vcfsx) },
-      { 0x30A, GET(vcfux) },
-      { 0x3C6, GET(vcmpbfp) },
-      { 0x0C6, GET(vcmpeqfp) },
-      { 0x006, GET(vcmpequb) },
-      { 0x046, GET(vcmpequh) },
-      { 0x086, GET(vcmpequw) },
-      { 0x1C6, GET(vcmpgefp) },
-      { 0x2C6, GET(vcmpgtfp) },
-      { 0x3C6, GET(vcmpgtsb) },
-      { 0x346, GET(vcmpgtsh) },
-      { 0x386, GET(vcmpgtsw) },
-      { 0x206, GET(vcmpgtub) },
-      { 0x246, GET(vcmpgtuh) },
-      { 0x286, GET(vcmpgtuw) },
-      { 0x3CA, GET(vctsxs) },
-      { 0x38A, GET(vctuxs) },
-      { 0x18A, GET(vexptefp) },
-      { 0x1CA, GET(vlogefp) },
-      { 0x02E, GET(vmaddfp) },
-      { 0x40A, GET(vmaxfp) },
-      { 0x102, GET(vmaxsb) },
-      { 0x142, GET(vmaxsh) },
-      { 0x182, GET(vmaxsw) },
       { 0x002, GET(vmaxub) },
-      { 0x042, GET(vmaxuh) },
-      { 0x082, GET(vmaxuw) },
-      { 0x020, GET(vmhaddshs) },
-      { 0x021, GET(vmhraddshs) },
-      { 0x44A, GET(vminfp) },
-      { 0x302, GET(vminsb) },
-      { 0x342, GET(vminsh) },
-      { 0x382, GET(vminsw) },
-      { 0x202, GET(vminub) },
-      { 0x242, GET(vminuh) },
-      { 0x282, GET(vminuw) },
-      { 0x222, GET(vmladduhm) },
+      { 0x004, GET(vrlb) },
+      { 0x008, GET(vmuloub) },
+      { 0x00A, GET(vaddfp) },
       { 0x00C, GET(vmrghb) },
+      { 0x00E, GET(vpkuhum) },
+      { 0x040, GET(vadduhm) },
+      { 0x042, GET(vmaxuh) },
+      { 0x044, GET(vrlh) },
+      { 0x048, GET(vmulouh) },
+      { 0x04A, GET(vsubfp) },
       { 0x04C, GET(vmrghh) },
+      { 0x04E, GET(vpkuwum) },
+      { 0x080, GET(vadduwm) },
+      { 0x082, GET(vmaxuw) },
+      { 0x084, GET(vrlw) },
       { 0x08C, GET(vmrghw) },
+      { 0x08E, GET(vpkuhus) },
+      { 0x0CE, GET(vpkuwus) },
+      { 0x102, GET(vmaxsb) },
+      { 0x104, GET(vslb) },
+      { 0x108, GET(vmulosb) },
+      { 0x10A, GET(vrefp) },
       { 0x10C, GET(vmrglb) },
+      { 0x10E, GET(vpkshus) },
+      { 0x142, GET(vmaxsh) },
+      { 0x144, GET(vslh) },
+      { 0x148, GET(vmulosh) },
+      { 0x14A, GET(vrsqrtefp) },
       { 0x14C, GET(vmrglh) },
+      { 0x14E, GET(vpkswus) },
+      { 0x180, GET(vaddcuw) },
+      { 0x182, GET(vmaxsw) },
+      { 0x184, GET(vslw) },
+      { 0x18A, GET(vexptefp) },
       { 0x18C, GET(vmrglw) },
-      { 0x025, GET(vmsummbm) },
-      { 0x028, GET(vmsumshm) },
-      { 0x029, GET(vmsumshs) },
-      { 0x024, GET(vmsumubm) },
-      { 0x026, GET(vmsumuhm) },
-      { 0x027, GET(vmsumuhs) },
-      { 0x308, GET(vmulesb) },
-      { 0x348, GET(vmulesh) },
-      { 0x208, GET(vmuleub) },
-      { 0x248, GET(vmuleuh) },
-      { 0x108, GET(vmulosb) },
-      { 0x148, GET(vmulosh) },
-      { 0x008, GET(vmuloub) },
-      { 0x048, GET(vmulouh) },
-      { 0x02F, GET(vnmsubfp) },
-      { 0x504, GET(vnor) },
-      { 0x484, GET(vor) },
-      { 0x02B, GET(vperm) },
-      { 0x30E, GET(vpkpx) },
       { 0x18E, GET(vpkshss) },
-      { 0x10E, GET(vpkshus) },
+      { 0x1C4, GET(vsl) },
+      { 0x1CA, GET(vlogefp) },
       { 0x1CE, GET(vpkswss) },
-      { 0x14E, GET(vpkswus) },
-      { 0x00E, GET(vpkuhum) },
-      { 0x08E, GET(vpkuhus) },
-      { 0x04E, GET(vpkuwum) },
-      { 0x0CE, GET(vpkuwus) },
-      { 0x10A, GET(vrefp) },
-      { 0x2CA, GET(vrfim) },
+      { 0x200, GET(vaddubs) },
+      { 0x202, GET(vminub) },
+      { 0x204, GET(vsrb) },
+      { 0x208, GET(vmuleub) },
       { 0x20A, GET(vrfin) },
-      { 0x28A, GET(vrfip) },
-      { 0x24A, GET(vrfiz) },
-      { 0x004, GET(vrlb) },
-      { 0x044, GET(vrlh) },
-      { 0x084, GET(vrlw) },
-      { 0x14A, GET(vrsqrtefp) },
-      { 0x02A, GET(vsel) },
-      { 0x1C4, GET(vsl) },
-      { 0x104, GET(vslb) },
-      { 0x02C, GET(vsldoi) },
-      { 0x010, GET(vsldoi128) },
-      { 0x144, GET(vslh) },
-      { 0x40C, GET(vslo) },
-      { 0x184, GET(vslw) },
       { 0x20C, GET(vspltb) },
+      { 0x20E, GET(vupkhsb) },
+      { 0x240, GET(vadduhs) },
+      { 0x242, GET(vminuh) },
+      { 0x244, GET(vsrh) },
+      { 0x248, GET(vmuleuh) },
+      { 0x24A, GET(vrfiz) },
       { 0x24C, GET(vsplth) },
-      { 0x30C, GET(vspltisb) },
-      { 0x34C, GET(vspltish) },
-      { 0x38C, GET(vspltisw) },
+      { 0x24E, GET(vupkhsh) },
+      { 0x280, GET(vadduws) },
+      { 0x282, GET(vminuw) },
+      { 0x284, GET(vsrw) },
+      { 0x28A, GET(vrfip) },
       { 0x28C, GET(vspltw) },
-      { 0x24C, GET(vsr) },
+      { 0x28E, GET(vupklsb) },
+      { 0x2C4, GET(vsr) },
+      { 0x2CA, GET(vrfim) },
+      { 0x2CE, GET(vupklsh) },
+      { 0x300, GET(vaddsbs) },
+      { 0x302, GET(vminsb) },
       { 0x304, GET(vsrab) },
+      { 0x308, GET(vmulesb) },
+      { 0x30A, GET(vcfux) },
+      { 0x30C, GET(vspltisb) },
+      { 0x30E, GET(vpkpx) },
+      { 0x340, GET(vaddshs) },
+      { 0x342, GET(vminsh) },
       { 0x344, GET(vsrah) },
+      { 0x348, GET(vmulesh) },
+      { 0x34A, GET(vcfsx) },
+      { 0x34C, GET(vspltish) },
+      { 0x34E, GET(vupkhpx) },
+      { 0x380, GET(vaddsws) },
+      { 0x382, GET(vminsw) },
       { 0x384, GET(vsraw) },
-      { 0x204, GET(vsrb) },
-      { 0x244, GET(vsrh) },
+      { 0x38A, GET(vctuxs) },
+      { 0x38C, GET(vspltisw) },
+      { 0x3CA, GET(vctsxs) },
+      { 0x3CE, GET(vupklpx) },
+      { 0x400, GET(vsububm) },
+      { 0x402, GET(vavgub) },
+      { 0x404, GET(vand) },
+      { 0x40A, GET(vmaxfp) },
+      { 0x40C, GET(vslo) },
+      { 0x440, GET(vsubuhm) },
+      { 0x442, GET(vavguh) },
+      { 0x444, GET(vandc) },
+      { 0x44A, GET(vminfp) },
       { 0x44C, GET(vsro) },
-      { 0x284, GET(vsrw) },
+      { 0x480, GET(vsubuwm) },
+      { 0x482, GET(vavguw) },
+      { 0x484, GET(vor) },
+      { 0x4C4, GET(vxor) },
+      { 0x502, GET(vavgsb) },
+      { 0x504, GET(vnor) },
+      { 0x542, GET(vavgsh) },
       { 0x580, GET(vsubcuw) },
-      { 0x04A, GET(vsubfp) },
-      { 0x700, GET(vsubsbs) },
-      { 0x740, GET(vsubshs) },
-      { 0x780, GET(vsubsws) },
-      { 0x400, GET(vsububm) },
+      { 0x582, GET(vavgsw) },
       { 0x600, GET(vsububs) },
-      { 0x440, GET(vsubuhm) },
+      { 0x604, GET(mfvscr) },
+      { 0x608, GET(vsum4ubs) },
       { 0x640, GET(vsubuhs) },
-      { 0x480, GET(vsubuwm) },
+      { 0x644, GET(mtvscr) },
+      { 0x648, GET(vsum4shs) },
       { 0x680, GET(vsubuws) },
       { 0x688, GET(vsum2sws) },
+      { 0x700, GET(vsubsbs) },
       { 0x708, GET(vsum4sbs) },
-      { 0x648, GET(vsum4shs) },
-      { 0x608, GET(vsum4ubs) },
+      { 0x740, GET(vsubshs) },
+      { 0x780, GET(vsubsws) },
       { 0x788, GET(vsumsws) },
-      { 0x34E, GET(vupkhpx) },
-      { 0x20E, GET(vupkhsb) },
-      { 0x24E, GET(vupkhsh) },
-      { 0x3CE, GET(vupklpx) },
-      { 0x28E, GET(vupklsb) },
-      { 0x28E, GET(vupklsb) },
-      { 0x2CE, GET(vupklsh) },
-      { 0x4C4, GET(vxor) },
+    });
+    // Group 0x04 VC form compares (field 22..31), field 21 is Rc
+    fillMasked<instructionHandler>(&PPCInstrInfo::handler, 0x04, 0x3FF, {
+      { 0x006, GET(vcmpequb) },
+      { 0x046, GET(vcmpequh) },
+      { 0x086, GET(vcmpequw) },
+      { 0x0C6, GET(vcmpeqfp) },
+      { 0x1C6, GET(vcmpgefp) },
+      { 0x206, GET(vcmpgtub) },
+      { 0x246, GET(vcmpgtuh) },
+      { 0x286, GET(vcmpgtuw) },
+      { 0x2C6, GET(vcmpgtfp) },
+      { 0x306, GET(vcmpgtsb) },
+      { 0x346, GET(vcmpgtsh) },
+      { 0x386, GET(vcmpgtsw) },
+      { 0x3C6, GET(vcmpbfp) },
+    });
+    // Group 0x04 VA form opcodes (field 26..31), field 21..25 is vC
+    fillMasked<instructionHandler>(&PPCInstrInfo::handler, 0x04, 0x03F, {
+      { 0x20, GET(vmhaddshs) },
+      { 0x21, GET(vmhraddshs) },
+      { 0x22, GET(vmladduhm) },
+      { 0x24, GET(vmsumubm) },
+      { 0x25, GET(vmsummbm) },
+      { 0x26, GET(vmsumuhm) },
+      { 0x27, GET(vmsumuhs) },
+      { 0x28, GET(vmsumshm) },
+      { 0x29, GET(vmsumshs) },
+      { 0x2A, GET(vsel) },
+      { 0x2B, GET(vperm) },
+      { 0x2C, GET(vsldoi) },
+      { 0x2E, GET(vmaddfp) },
+      { 0x2F, GET(vnmsubfp) },
+    });
+    // Group 0x04 VMX128 loads and stores (field 21..27, 30..31)
+    fillMasked<instructionHandler>(&PPCInstrInfo::handler, 0x04, 0x7F3, {
+      { 0x003, GET(lvsl128) },
+      { 0x043, GET(lvsr128) },
+      { 0x083, GET(lvewx128) },
+      { 0x0C3, GET(lvx128) },
+      { 0x183, GET(stvewx128) },
+      { 0x1C3, GET(stvx128) },
+      { 0x2C3, GET(lvxl128) },
+      { 0x3C3, GET(stvxl128) },
+      { 0x403, GET(lvlx128) },
+      { 0x443, GET(lvrx128) },
+      { 0x503, GET(stvlx128) },
+      { 0x543, GET(stvrx128) },
+      { 0x603, GET(lvlxl128) },
+      { 0x643, GET(lvrxl128) },
+      { 0x703, GET(stvlxl128) },
+      { 0x743, GET(stvrxl128) },
+    });
+    // Group 0x04 VMX128 shift (field 27)
+    fillMasked<instructionHandler>(&PPCInstrInfo::handler, 0x04, 0x010, {
+      { 0x10, GET(vsldoi128) },
+    });
+    // Group 0x05 VMX128 opcodes (field 22..25, 27)
+    fillMasked<instructionHandler>(&PPCInstrInfo::handler, 0x05, 0x3D0, {
+      { 0x010, GET(vaddfp128) },
+      { 0x050, GET(vsubfp128) },
+      { 0x090, GET(vmulfp128) },
+      { 0x0D0, GET(vmaddfp128) },
+      { 0x110, GET(vmaddcfp128) },
+      { 0x150, GET(vnmsubfp128) },
+      { 0x190, GET(vmsum3fp128) },
+      { 0x1D0, GET(vmsum4fp128) },
+      { 0x200, GET(vpkshss128) },
+      { 0x210, GET(vand128) },
+      { 0x240, GET(vpkshus128) },
+      { 0x250, GET(vandc128) },
+      { 0x280, GET(vpkswss128) },
+      { 0x290, GET(vnor128) },
+      { 0x2C0, GET(vpkswus128) },
+      { 0x2D0, GET(vor128) },
+      { 0x300, GET(vpkuhum128) },
+      { 0x310, GET(vxor128) },
+      { 0x340, GET(vpkuhus128) },
+      { 0x350, GET(vsel128) },
+      { 0x380, GET(vpkuwum128) },
+      { 0x390, GET(vslo128) },
+      { 0x3C0, GET(vpkuwus128) },
+      { 0x3D0, GET(vsro128) },
+    });
+    // Group 0x05 VMX128 permute (field 22, 27)
+    fillMasked<instructionHandler>(&PPCInstrInfo::handler, 0x05, 0x210, {
+      { 0x000, GET(vperm128) },
+    });
+    // Group 0x06 VMX128 compares (field 22..24, 27), field 25 is Rc
+    fillMasked<instructionHandler>(&PPCInstrInfo::handler, 0x06, 0x390, {
+      { 0x000, GET(vcmpeqfp128) },
+      { 0x080, GET(vcmpgefp128) },
+      { 0x100, GET(vcmpgtfp128) },
+      { 0x180, GET(vcmpbfp128) },
+      { 0x200, GET(vcmpequw128) },
+    });
+    // Group 0x06 VMX128 opcodes (field 22..25, 27)
+    fillMasked<instructionHandler>(&PPCInstrInfo::handler, 0x06, 0x3D0, {
+      { 0x050, GET(vrlw128) },
+      { 0x0D0, GET(vslw128) },
+      { 0x150, GET(vsraw128) },
+      { 0x1D0, GET(vsrw128) },
+      { 0x280, GET(vmaxfp128) },
+      { 0x2C0, GET(vminfp128) },
+      { 0x300, GET(vmrghw128) },
+      { 0x340, GET(vmrglw128) },
+      { 0x380, GET(vupkhsb128) },
+      { 0x3C0, GET(vupklsb128) },
+    });
+    // Group 0x06 VMX128 word permute (field 21..22, 26..27)
+    fillMasked<instructionHandler>(&PPCInstrInfo::handler, 0x06, 0x630, {
+      { 0x210, GET(vpermwi128) },
+    });
+    // Group 0x06 VMX128 unary opcodes (field 21..27)
+    fillMasked<instructionHandler>(&PPCInstrInfo::handler, 0x06, 0x7F0, {
+      { 0x230, GET(vcfpsxws128) },
+      { 0x270, GET(vcfpuxws128) },
+      { 0x2B0, GET(vcsxwfp128) },
+      { 0x2F0, GET(vcuxwfp128) },
+      { 0x330, GET(vrfim128) },
+      { 0x370, GET(vrfin128) },
+      { 0x3B0, GET(vrfip128) },
+      { 0x3F0, GET(vrfiz128) },
+      { 0x630, GET(vrefp128) },
+      { 0x670, GET(vrsqrtefp128) },
+      { 0x6B0, GET(vexptefp128) },
+      { 0x6F0, GET(vlogefp128) },
+      { 0x730, GET(vspltw128) },
+      { 0x770, GET(vspltisw128) },
+      { 0x7F0, GET(vupkd3d128) },
+    });
+    // Group 0x06 VMX128 insert opcodes (field 21..23, 26..27)
+    fillMasked<instructionHandler>(&PPCInstrInfo::handler, 0x06, 0x730, {
+      { 0x610, GET(vpkd3d128) },
+      { 0x710, GET(vrlimi128) },
     });
     // Group 0x13 opcodes (field 21..30)
-    fillTable<instructionHandler>(table, 0x13, 10, 1, {
+    fillTable<instructionHandler>(&PPCInstrInfo::handler, 0x13, 10, 1, {
       { 0x000, GET(mcrf) },
       { 0x010, GET(bclr) },
       { 0x012, GET(rfid) },
@@ -344,7 +641,7 @@ namespace PPCInterpreter {
       { 0x210, GET(bcctr) },
     });
     // Group 0x1E opcodes (field 27..30)
-    fillTable<instructionHandler>(table, 0x1E, 4, 1, {
+    fillTable<instructionHandler>(&PPCInstrInfo::handler, 0x1E, 4, 1, {
       { 0x0, GETRC(rldicl) },
       { 0x1, GETRC(rldicl) },
       { 0x2, GETRC(rldicr) },
@@ -357,7 +654,7 @@ namespace PPCInterpreter {
       { 0x9, GETRC(rldcr) },
     });
     // Group 0x1F opcodes (field 21..30)
-    fillTable<instructionHandler>(table, 0x1F, 10, 1, {
+    fillTable<instructionHandler>(&PPCInstrInfo::handler, 0x1F, 10, 1, {
       { 0x000, GET(cmp) },
       { 0x004, GET(tw) },
       { 0x006, GET(lvsl) },
@@ -519,13 +816,13 @@ namespace PPCInterpreter {
       { 0x3F6, GET(dcbz) },
     });
     // Group 0x3A opcodes (field 30..31)
-    fillTable<instructionHandler>(table, 0x3A, 2, 0, {
+    fillTable<instructionHandler>(&PPCInstrInfo::handler, 0x3A, 2, 0, {
       { 0x0, GET(ld) },
       { 0x1, GET(ldu) },
       { 0x2, GET(lwa) },
     });
     // Group 0x3B opcodes (field 21..30)
-    fillTable<instructionHandler>(table, 0x3B, 10, 1, {
+    fillTable<instructionHandler>(&PPCInstrInfo::handler, 0x3B, 10, 1, {
       { 0x12, GETRC(fdivs), 5 },
       { 0x14, GETRC(fsubs), 5 },
       { 0x15, GETRC(fadds), 5 },
@@ -538,12 +835,12 @@ namespace PPCInterpreter {
       { 0x1F, GETRC(fnmadds), 5 },
     });
     // Group 0x3E opcodes (field 30..31)
-    fillTable<instructionHandler>(table, 0x3E, 2, 0, {
+    fillTable<instructionHandler>(&PPCInstrInfo::handler, 0x3E, 2, 0, {
       { 0x0, GET(std) },
       { 0x1, GET(stdu) },
     });
     // Group 0x3F opcodes (field 21..30)
-    fillTable<instructionHandler>(table, 0x3F, 10, 1, {
+    fillTable<instructionHandler>(&PPCInstrInfo::handler, 0x3F, 10, 1, {
       { 0x026, GETRC(mtfsb1) },
       { 0x040, GET(mcrfs) },
       { 0x046, GETRC(mtfsb0) },
@@ -644,23 +941,22 @@ namespace PPCInterpreter {
 
     PPCOpcode op;
     op.opcode = instr;
-    u32 decodedInstr = PPCDecode(instr);
-    std::string baseName = ppcDecoder.getNameTable()[decodedInstr];
+    const u16 nameId = ppcDecoder.getInfo(PPCDecode(instr)).nameId;
 
-    switch (Base::JoaatStringHash(baseName)) {
-    case "cmpi"_j: {
+    switch (nameId) {
+    case PPCInstrNameId("cmpi"): {
       return op.l10 ? "cmpdi" : "cmpwi";
     } break;
-    case "addic"_j: {
+    case PPCInstrNameId("addic"): {
       return op.main & 1 ? "addic." : "addic";
     } break;
-    case "addi"_j: {
+    case PPCInstrNameId("addi"): {
       return op.ra == 0 ? "li" : "addi";
     } break;
-    case "addis"_j: {
+    case PPCInstrNameId("addis"): {
       return op.ra == 0 ? "lis" : "addis";
     } break;
-    case "bc"_j: {
+    case PPCInstrNameId("bc"): {
       const u32 bo = op.bo;
       const u32 bi = op.bi;
       const s32 bd = op.ds * 4;
@@ -681,7 +977,7 @@ namespace PPCInterpreter {
         finalInstr += sign;
       return finalInstr;
     } break;
-    case "b"_j: {
+    case PPCInstrNameId("b"): {
       const u32 li = op.bt24;
       const u32 aa = op.aa;
       const u32 lk = op.lk;
@@ -701,7 +997,7 @@ namespace PPCInterpreter {
       } break;
       }
     } break;
-    case "bclr"_j: {
+    case PPCInstrNameId("bclr"): {
       const u32 bo = op.bo;
       const u32 bi = op.bi;
       const u32 bh = op.bh;
@@ -721,7 +1017,7 @@ namespace PPCInterpreter {
         finalInstr += sign;
       return finalInstr;
     } break;
-    case "bcctr"_j: {
+    case PPCInstrNameId("bcctr"): {
       const u32 bo = op.bo;
       const u32 bi = op.bi;
       const u32 bh = op.bh;
@@ -744,6 +1040,6 @@ namespace PPCInterpreter {
     } break;
     }
 
-    return baseName;
+    return std::string(instrNames[nameId]);
   }
 }
@@ -11,6 +11,7 @@
 
 #include <array>
 #include <string>
+#include <string_view>
 
 #include "Base/Hash.h"
 #include "Base/Logging/Log.h"
@@ -27,6 +28,21 @@ constexpr u32 PPCDecode(u32 instr) {
   return ((instr >> 26) | (instr << 6)) & 0x1FFFF; // Rotate + mask
 }
 
+//
+// Instruction flags
+//
+
+// Changes the flow of execution (b, bc, bclr, bcctr, rfid)
+#define PPC_INSTR_BRANCH 0x1
+// A JIT block must end after it
+#define PPC_INSTR_ENDS_BLOCK 0x2
+// Reads guest memory
+#define PPC_INSTR_LOAD 0x4
+// Writes guest memory
+#define PPC_INSTR_STORE 0x8
+// Raises a trap or system call exception
+#define PPC_INSTR_TRAP 0x10
+
 namespace PPCInterpreter {
   // Define a type alias for function pointers
   using instructionHandler = fptr<void(PPU_STATE *ppuState)>;
@@ -36,6 +52,104 @@ namespace PPCInterpreter {
   extern void PPCInterpreter_known_unimplemented(const char *name, PPU_STATE *ppuState);
   extern const std::string PPCInterpreter_getFullName(u32 instr);
   extern void PPCInterpreterJIT_invalid(PPU_STATE *ppuState, JITBlockBuilder *b, PPCOpcode instr);
+
+  // Interned instruction names, the decoder stores an index into this instead of a string
+  inline constexpr std::string_view instrNames[] = {
+    "invalid", "tdi", "twi", "mulli", "subfic", "cmpli", "cmpi", "addic", "addi", "addis", "bc", "sc", "b",
+    "rlwimix", "rlwinmx", "rlwnmx", "ori", "oris", "xori", "xoris", "andi", "andis", "lwz", "lwzu", "lbz",
+    "lbzu", "stw", "stwu", "stb", "stbu", "lhz", "lhzu", "lha", "lhau", "sth", "sthu", "lmw", "stmw", "lfs",
+    "lfsu", "lfd", "lfdu", "stfs", "stfsu", "stfd", "stfdu", "vperm128", "stvewx128", "stvrx128", "stvx128",
+    "vor128", "lvx128", "vmulfp128", "stvlx128", "vmrglw128", "vmrghw128", "stvlxl128", "vspltisw128",
+    "lvewx128", "lvlx128", "lvlxl128", "lvrx128", "lvrxl128", "lvsl128", "lvsr128", "lvxl128", "stvxl128",
+    "stvrxl128", "vaddfp128", "vsubfp128", "vmaddfp128", "vmaddcfp128", "vnmsubfp128", "vmsum3fp128",
+    "vmsum4fp128", "vpkshss128", "vand128", "vpkshus128", "vandc128", "vpkswss128", "vnor128", "vpkswus128",
+    "vpkuhum128", "vxor128", "vpkuhus128", "vsel128", "vpkuwum128", "vslo128", "vpkuwus128", "vsro128",
+    "vcmpeqfp128", "vcmpgefp128", "vcmpgtfp128", "vcmpbfp128", "vcmpequw128", "vrlw128", "vslw128",
+    "vsraw128", "vsrw128", "vmaxfp128", "vminfp128", "vupkhsb128", "vupklsb128", "vpermwi128", "vcfpsxws128",
+    "vcfpuxws128", "vcsxwfp128", "vcuxwfp128", "vrfim128", "vrfin128", "vrfip128", "vrfiz128", "vrefp128",
+    "vrsqrtefp128", "vexptefp128", "vlogefp128", "vspltw128", "vupkd3d128", "vpkd3d128", "vrlimi128", "mfvscr",
+    "mtvscr", "vaddcuw", "vaddfp", "vaddsbs", "vaddshs", "vaddsws", "vaddubm", "vaddubs", "vadduhm",
+    "vadduhs", "vadduwm", "vadduws", "vand", "vandc", "vavgsb", "vavgsh", "vavgsw", "vavgub", "vavguh",
+    "vavguw", "vcfsx", "vcfux", "vcmpbfp", "vcmpeqfp", "vcmpequb", "vcmpequh", "vcmpequw", "vcmpgefp",
+    "vcmpgtfp", "vcmpgtsb", "vcmpgtsh", "vcmpgtsw", "vcmpgtub", "vcmpgtuh", "vcmpgtuw", "vctsxs", "vctuxs",
+    "vexptefp", "vlogefp", "vmaddfp", "vmaxfp", "vmaxsb", "vmaxsh", "vmaxsw", "vmaxub", "vmaxuh", "vmaxuw",
+    "vmhaddshs", "vmhraddshs", "vminfp", "vminsb", "vminsh", "vminsw", "vminub", "vminuh", "vminuw",
+    "vmladduhm", "vmrghb", "vmrghh", "vmrghw", "vmrglb", "vmrglh", "vmrglw", "vmsummbm", "vmsumshm",
+    "vmsumshs", "vmsumubm", "vmsumuhm", "vmsumuhs", "vmulesb", "vmulesh", "vmuleub", "vmuleuh", "vmulosb",
+    "vmulosh", "vmuloub", "vmulouh", "vnmsubfp", "vnor", "vor", "vperm", "vpkpx", "vpkshss", "vpkshus",
+    "vpkswss", "vpkswus", "vpkuhum", "vpkuhus", "vpkuwum", "vpkuwus", "vrefp", "vrfim", "vrfin", "vrfip",
+    "vrfiz", "vrlb", "vrlh", "vrlw", "vrsqrtefp", "vsel", "vsl", "vslb", "vsldoi", "vsldoi128", "vslh",
+    "vslo", "vslw", "vspltb", "vsplth", "vspltisb", "vspltish", "vspltisw", "vspltw", "vsr", "vsrab", "vsrah",
+    "vsraw", "vsrb", "vsrh", "vsro", "vsrw", "vsubcuw", "vsubfp", "vsubsbs", "vsubshs", "vsubsws", "vsububm",
+    "vsububs", "vsubuhm", "vsubuhs", "vsubuwm", "vsubuws", "vsum2sws", "vsum4sbs", "vsum4shs", "vsum4ubs",
+    "vsumsws", "vupkhpx", "vupkhsb", "vupkhsh", "vupklpx", "vupklsb", "vupklsh", "vxor", "mcrf", "bclr",
+    "rfid", "crnor", "crandc", "isync", "crxor", "crnand", "crand", "creqv", "crorc", "cror", "bcctr",
+    "rldiclx", "rldicrx", "rldicx", "rldimix", "rldclx", "rldcrx", "cmp", "tw", "lvsl", "lvebx", "subfcx",
+    "subfcox", "mulhdux", "addcx", "addcox", "mulhwux", "mfocrf", "lwarx", "ldx", "lwzx", "slwx", "cntlzwx",
+    "sldx", "andx", "cmpl", "lvsr", "lvehx", "subfx", "subfox", "ldux", "dcbst", "lwzux", "cntlzdx", "andcx",
+    "td", "lvewx", "mulhdx", "mulhwx", "mfmsr", "ldarx", "dcbf", "lbzx", "lvx", "negx", "negox", "lbzux",
+    "norx", "stvebx", "subfex", "subfeox", "addex", "addeox", "mtocrf", "mtmsr", "stdx", "stwcx", "stwx",
+    "stvehx", "mtmsrd", "stdux", "stwux", "stvewx", "subfzex", "subfzeox", "addzex", "addzeox", "stdcx",
+    "stbx", "stvx", "subfmex", "subfmeox", "mulldx", "mulldox", "addmex", "addmeox", "mullwx", "mullwox",
+    "dcbtst", "stbux", "addx", "addox", "dcbt", "lhzx", "eqvx", "tlbiel", "tlbie", "eciwx", "lhzux", "xorx",
+    "mfspr", "lwax", "dst", "lhax", "lvxl", "mftb", "lwaux", "dstst", "lhaux", "slbmte", "sthx", "orcx",
+    "slbie", "ecowx", "sthux", "orx", "divdux", "divduox", "divwux", "divwuox", "mtspr", "dcbi", "nandx",
+    "slbia", "stvxl", "divdx", "divdox", "divwx", "divwox", "lvlx", "ldbrx", "lswx", "lwbrx", "lfsx", "srwx",
+    "srdx", "lvrx", "tlbsync", "lfsux", "mfsrin", "mfsr", "lswi", "sync", "lfdx", "lfdux", "stvlx", "stdbrx",
+    "stswx", "stwbrx", "stfsx", "stvrx", "stfsux", "stswi", "stfdx", "stfdux", "lvlxl", "lhbrx", "srawx",
+    "sradx", "lvrxl", "dss", "srawix", "sradix", "slbmfev", "eieio", "stvlxl", "slbmfee", "sthbrx", "extshx",
+    "stvrxl", "extsbx", "stfiwx", "extswx", "icbi", "dcbz", "ld", "ldu", "lwa", "fdivsx", "fsubsx", "faddsx",
+    "fsqrtsx", "fresx", "fmulsx", "fmsubsx", "fmaddsx", "fnmsubsx", "fnmaddsx", "std", "stdu", "mtfsb1x",
+    "mcrfs", "mtfsb0x", "mtfsfix", "mffsx", "mtfsfx", "fcmpu", "frspx", "fctiwx", "fctiwzx", "fdivx", "fsubx",
+    "faddx", "fsqrtx", "fselx", "fmulx", "frsqrtex", "fmsubx", "fmaddx", "fnmsubx", "fnmaddx", "fcmpo",
+    "fnegx", "fmrx", "fnabsx", "fabsx", "fctidx", "fctidzx", "fcfidx"
+  };
+
+  // Name id of an instruction, resolved at compile time so unknown names fail to build
+  consteval u16 PPCInstrNameId(std::string_view name) {
+    for (u16 id = 0; id != std::size(instrNames); id++) {
+      if (instrNames[id] == name)
+        return id;
+    }
+    throw_fail_debug_msg("Unknown PPC instruction name");
+    return 0;
+  }
+
+  // PPC_INSTR_* flags of an instruction, by name
+  constexpr u16 PPCInstrFlags(std::string_view name) {
+    u16 flags = 0;
+    if (name == "b" || name == "bc" || name == "bclr" || name == "bcctr" || name == "rfid")
+      flags |= PPC_INSTR_BRANCH | PPC_INSTR_ENDS_BLOCK;
+    if (name == "invalid")
+      flags |= PPC_INSTR_ENDS_BLOCK;
+    if (name == "tw" || name == "twi" || name == "td" || name == "tdi" || name == "sc")
+      flags |= PPC_INSTR_TRAP;
+    // lvsl/lvsr only build a permute control vector from the address
+    if (name.starts_with('l') && !name.starts_with("lvsl") && !name.starts_with("lvsr"))
+      flags |= PPC_INSTR_LOAD;
+    if (name.starts_with("st") || name == "dcbz")
+      flags |= PPC_INSTR_STORE;
+    return flags;
+  }
+
+  inline constexpr auto instrFlags = [] {
+    std::array<u16, std::size(instrNames)> flags{};
+    for (size_t id = 0; id != flags.size(); id++) {
+      flags[id] = PPCInstrFlags(instrNames[id]);
+    }
+    return flags;
+  }();
+
+  // Decoder table entry, everything known about an instruction
+  struct PPCInstrInfo {
+    instructionHandler handler;
+    instructionHandlerJIT jitHandler;
+    // Index into instrNames
+    u16 nameId;
+    // PPC_INSTR_* flags
+    u16 flags;
+  };
+
   class PPCDecoder {
     template <typename T>
     class InstrInfo {
@@ -57,14 +171,14 @@ namespace PPCInterpreter {
     void fillTables();
     void fillJITTables();
     void fillNameTables() {
-      #define GET_(name) std::string(#name)
+      #define GET_(name) PPCInstrNameId(#name)
       #define GET(name) GET_(name), GET_(name)
       #define GETRC(name) GET_(name##x), GET_(name##x)
-      for (auto& x : nameTable) {
-        x = GET(invalid);
+      for (auto &x : infoTable) {
+        x.nameId = GET_(invalid);
       }
       // Main opcodes (field 0..5)
-      fillTable<std::string>(nameTable, 0x00, 6, -1, {
+      fillTable<u16>(&PPCInstrInfo::nameId, 0x00, 6, -1, {
         { 0x02, GET(tdi) },
         { 0x03, GET(twi) },
         { 0x07, GET(mulli) },
@@ -112,181 +226,263 @@ namespace PPCInterpreter {
         { 0x36, GET(stfd) },
         { 0x37, GET(stfdu) },
       });
-      // Special case opcodes
-      fillTable<std::string>(nameTable, 0x04, 11, 11, {
-        { 0x945, GET(vperm128) },
-        { 0x7193, GET(stvewx128) },
-        { 0x7393, GET(stvrx128) },
-        { 0x73C4, GET(stvx128) },
-        { 0xB705, GET(vor128) },
-        { 0x30C4, GET(lvx128) },
-        { 0x2405, GET(vmulfp128) },
-        { 0x141C4, GET(stvlx128) },
-        { 0x151C4, GET(stvrx128) },
-        { 0x1D8C6, GET(vmrglw128) },
-        { 0x1C8C6, GET(vmrghw128) },        
-        { 0x1C1C4, GET(stvlxl128) },
-        { 0x1DD06, GET(vspltisw128) },
-      });
-      // Group 0x04 opcodes (field 21..31)
-      fillTable<std::string>(nameTable, 0x04, 11, 0, {
-        { 0x83, GET(lvewx128) },
-        { 0x403, GET(lvlx128) },
-        { 0x603, GET(lvlxl128) },
-        { 0x443, GET(lvrx128) },
-        { 0x643, GET(lvrxl128) },
-        { 0x3, GET(lvsl128) },
-        { 0x43, GET(lvsr128) },
-        { 0x2C3, GET(lvxl128) },
-        { 0x604, GET(mfvscr) },
-        { 0x644, GET(mtvscr) },
-        { 0x180, GET(vaddcuw) },
-        { 0xA, GET(vaddfp) },
-        { 0x300, GET(vaddsbs) },
-        { 0x340, GET(vaddshs) },
-        { 0x380, GET(vaddsws) },
-        { 0x0, GET(vaddubm) },
-        { 0x200, GET(vaddubs) },
-        { 0x40, GET(vadduhm) },
-        { 0x240, GET(vadduhs) },
-        { 0x80, GET(vadduwm) },
-        { 0x280, GET(vadduws) },
-        { 0x404, GET(vand) },
-        { 0x444, GET(vandc) },
-        { 0x502, GET(vavgsb) },
-        { 0x542, GET(vavgsh) },
-        { 0x582, GET(vavgsw) },
-        { 0x402, GET(vavgub) },
-        { 0x442, GET(vavguh) },
-        { 0x482, GET(vavguw) },
-        { 0x34A, GET(vcfsx) },
-        { 0x30A, GET(vcfux) },
-        { 0x3C6, GET(vcmpbfp) },
-        { 0xC6, GET(vcmpeqfp) },
-        { 0x6, GET(vcmpequb) },
-        { 0x46, GET(vcmpequh) },
-        { 0x86, GET(vcmpequw) },
-        { 0x1C6, GET(vcmpgefp) },
-        { 0x2C6, GET(vcmpgtfp) },
-        { 0x3C6, GET(vcmpgtsb) },
-        { 0x346, GET(vcmpgtsh) },
-        { 0x386, GET(vcmpgtsw) },
-        { 0x206, GET(vcmpgtub) },
-        { 0x246, GET(vcmpgtuh) },
-        { 0x286, GET(vcmpgtuw) },
-        { 0x3CA, GET(vctsxs) },
-        { 0x38A, GET(vctuxs) },
-        { 0x18A, GET(vexptefp) },
-        { 0x1CA, GET(vlogefp) },
-        { 0x2E, GET(vmaddfp) },
-        { 0x40A, GET(vmaxfp) },
+      // Group 0x04 VX form opcodes (field 21..31)
+      fillMasked<u16>(&PPCInstrInfo::nameId, 0x04, 0x7FF, {
+        { 0x000, GET(vaddubm) },
+        { 0x002, GET(vmaxub) },
+        { 0x004, GET(vrlb) },
+        { 0x008, GET(vmuloub) },
+        { 0x00A, GET(vaddfp) },
+        { 0x00C, GET(vmrghb) },
+        { 0x00E, GET(vpkuhum) },
+        { 0x040, GET(vadduhm) },
+        { 0x042, GET(vmaxuh) },
+        { 0x044, GET(vrlh) },
+        { 0x048, GET(vmulouh) },
+        { 0x04A, GET(vsubfp) },
+        { 0x04C, GET(vmrghh) },
+        { 0x04E, GET(vpkuwum) },
+        { 0x080, GET(vadduwm) },
+        { 0x082, GET(vmaxuw) },
+        { 0x084, GET(vrlw) },
+        { 0x08C, GET(vmrghw) },
+        { 0x08E, GET(vpkuhus) },
+        { 0x0CE, GET(vpkuwus) },
         { 0x102, GET(vmaxsb) },
-        { 0x142, GET(vmaxsh) },
-        { 0x182, GET(vmaxsw) },
-        { 0x2, GET(vmaxub) },
-        { 0x42, GET(vmaxuh) },
-        { 0x82, GET(vmaxuw) },
-        { 0x20, GET(vmhaddshs) },
-        { 0x21, GET(vmhraddshs) },
-        { 0x44A, GET(vminfp) },
-        { 0x302, GET(vminsb) },
-        { 0x342, GET(vminsh) },
-        { 0x382, GET(vminsw) },
-        { 0x202, GET(vminub) },
-        { 0x242, GET(vminuh) },
-        { 0x282, GET(vminuw) },
-        { 0x222, GET(vmladduhm) },
-        { 0xC, GET(vmrghb) },
-        { 0x4C, GET(vmrghh) },
-        { 0x8C, GET(vmrghw) },
+        { 0x104, GET(vslb) },
+        { 0x108, GET(vmulosb) },
+        { 0x10A, GET(vrefp) },
         { 0x10C, GET(vmrglb) },
+        { 0x10E, GET(vpkshus) },
+        { 0x142, GET(vmaxsh) },
+        { 0x144, GET(vslh) },
+        { 0x148, GET(vmulosh) },
+        { 0x14A, GET(vrsqrtefp) },
         { 0x14C, GET(vmrglh) },
+        { 0x14E, GET(vpkswus) },
+        { 0x180, GET(vaddcuw) },
+        { 0x182, GET(vmaxsw) },
+        { 0x184, GET(vslw) },
+        { 0x18A, GET(vexptefp) },
         { 0x18C, GET(vmrglw) },
-        { 0x25, GET(vmsummbm) },
-        { 0x28, GET(vmsumshm) },
-        { 0x29, GET(vmsumshs) },
-        { 0x24, GET(vmsumubm) },
-        { 0x26, GET(vmsumuhm) },
-        { 0x27, GET(vmsumuhs) },
-        { 0x308, GET(vmulesb) },
-        { 0x348, GET(vmulesh) },
-        { 0x208, GET(vmuleub) },
-        { 0x248, GET(vmuleuh) },
-        { 0x108, GET(vmulosb) },
-        { 0x148, GET(vmulosh) },
-        { 0x8, GET(vmuloub) },
-        { 0x48, GET(vmulouh) },
-        { 0x2F, GET(vnmsubfp) },
-        { 0x504, GET(vnor) },
-        { 0x484, GET(vor) },
-        { 0x2B, GET(vperm) },
-        { 0x30E, GET(vpkpx) },
         { 0x18E, GET(vpkshss) },
-        { 0x10E, GET(vpkshus) },
+        { 0x1C4, GET(vsl) },
+        { 0x1CA, GET(vlogefp) },
         { 0x1CE, GET(vpkswss) },
-        { 0x14E, GET(vpkswus) },
-        { 0xE, GET(vpkuhum) },
-        { 0x8E, GET(vpkuhus) },
-        { 0x4E, GET(vpkuwum) },
-        { 0xCE, GET(vpkuwus) },
-        { 0x10A, GET(vrefp) },
-        { 0x2CA, GET(vrfim) },
+        { 0x200, GET(vaddubs) },
+        { 0x202, GET(vminub) },
+        { 0x204, GET(vsrb) },
+        { 0x208, GET(vmuleub) },
         { 0x20A, GET(vrfin) },
-        { 0x28A, GET(vrfip) },
-        { 0x24A, GET(vrfiz) },
-        { 0x4, GET(vrlb) },
-        { 0x44, GET(vrlh) },
-        { 0x84, GET(vrlw) },
-        { 0x14A, GET(vrsqrtefp) },
-        { 0x2A, GET(vsel) },
-        { 0x1C4, GET(vsl) },
-        { 0x104, GET(vslb) },
-        { 0x2C, GET(vsldoi) },
-        { 0x10, GET(vsldoi128) },
-        { 0x144, GET(vslh) },
-        { 0x40C, GET(vslo) },
-        { 0x184, GET(vslw) },
         { 0x20C, GET(vspltb) },
+        { 0x20E, GET(vupkhsb) },
+        { 0x240, GET(vadduhs) },
+        { 0x242, GET(vminuh) },
+        { 0x244, GET(vsrh) },
+        { 0x248, GET(vmuleuh) },
+        { 0x24A, GET(vrfiz) },
         { 0x24C, GET(vsplth) },
-        { 0x30C, GET(vspltisb) },
-        { 0x34C, GET(vspltish) },
-        { 0x38C, GET(vspltisw) },
+        { 0x24E, GET(vupkhsh) },
+        { 0x280, GET(vadduws) },
+        { 0x282, GET(vminuw) },
+        { 0x284, GET(vsrw) },
+        { 0x28A, GET(vrfip) },
         { 0x28C, GET(vspltw) },
-        { 0x24C, GET(vsr) },
+        { 0x28E, GET(vupklsb) },
+        { 0x2C4, GET(vsr) },
+        { 0x2CA, GET(vrfim) },
+        { 0x2CE, GET(vupklsh) },
+        { 0x300, GET(vaddsbs) },
+        { 0x302, GET(vminsb) },
         { 0x304, GET(vsrab) },
+        { 0x308, GET(vmulesb) },
+        { 0x30A, GET(vcfux) },
+        { 0x30C, GET(vspltisb) },
+        { 0x30E, GET(vpkpx) },
+        { 0x340, GET(vaddshs) },
+        { 0x342, GET(vminsh) },
         { 0x344, GET(vsrah) },
+        { 0x348, GET(vmulesh) },
+        { 0x34A, GET(vcfsx) },
+        { 0x34C, GET(vspltish) },
+        { 0x34E, GET(vupkhpx) },
+        { 0x380, GET(vaddsws) },
+        { 0x382, GET(vminsw) },
         { 0x384, GET(vsraw) },
-        { 0x204, GET(vsrb) },
-        { 0x244, GET(vsrh) },
+        { 0x38A, GET(vctuxs) },
+        { 0x38C, GET(vspltisw) },
+        { 0x3CA, GET(vctsxs) },
+        { 0x3CE, GET(vupklpx) },
+        { 0x400, GET(vsububm) },
+        { 0x402, GET(vavgub) },
+        { 0x404, GET(vand) },
+        { 0x40A, GET(vmaxfp) },
+        { 0x40C, GET(vslo) },
+        { 0x440, GET(vsubuhm) },
+        { 0x442, GET(vavguh) },
+        { 0x444, GET(vandc) },
+        { 0x44A, GET(vminfp) },
         { 0x44C, GET(vsro) },
-        { 0x284, GET(vsrw) },
+        { 0x480, GET(vsubuwm) },
+        { 0x482, GET(vavguw) },
+        { 0x484, GET(vor) },
+        { 0x4C4, GET(vxor) },
+        { 0x502, GET(vavgsb) },
+        { 0x504, GET(vnor) },
+        { 0x542, GET(vavgsh) },
         { 0x580, GET(vsubcuw) },
-        { 0x4A, GET(vsubfp) },
-        { 0x700, GET(vsubsbs) },
-        { 0x740, GET(vsubshs) },
-        { 0x780, GET(vsubsws) },
-        { 0x400, GET(vsububm) },
+        { 0x582, GET(vavgsw) },
         { 0x600, GET(vsububs) },
-        { 0x440, GET(vsubuhm) },
+        { 0x604, GET(mfvscr) },
+        { 0x608, GET(vsum4ubs) },
         { 0x640, GET(vsubuhs) },
-        { 0x480, GET(vsubuwm) },
+        { 0x644, GET(mtvscr) },
+        { 0x648, GET(vsum4shs) },
         { 0x680, GET(vsubuws) },
         { 0x688, GET(vsum2sws) },
+        { 0x700, GET(vsubsbs) },
         { 0x708, GET(vsum4sbs) },
-        { 0x648, GET(vsum4shs) },
-        { 0x608, GET(vsum4ubs) },
+        { 0x740, GET(vsubshs) },
+        { 0x780, GET(vsubsws) },
         { 0x788, GET(vsumsws) },
-        { 0x34E, GET(vupkhpx) },
-        { 0x20E, GET(vupkhsb) },
-        { 0x24E, GET(vupkhsh) },
-        { 0x3CE, GET(vupklpx) },
-        { 0x28E, GET(vupklsb) },
-        { 0x28E, GET(vupklsb) },
-        { 0x2CE, GET(vupklsh) },
-        { 0x4C4, GET(vxor) },
+      });
+      // Group 0x04 VC form compares (field 22..31), field 21 is Rc
+      fillMasked<u16>(&PPCInstrInfo::nameId, 0x04, 0x3FF, {
+        { 0x006, GET(vcmpequb) },
+        { 0x046, GET(vcmpequh) },
+        { 0x086, GET(vcmpequw) },
+        { 0x0C6, GET(vcmpeqfp) },
+        { 0x1C6, GET(vcmpgefp) },
+        { 0x206, GET(vcmpgtub) },
+        { 0x246, GET(vcmpgtuh) },
+        { 0x286, GET(vcmpgtuw) },
+        { 0x2C6, GET(vcmpgtfp) },
+        { 0x306, GET(vcmpgtsb) },
+        { 0x346, GET(vcmpgtsh) },
+        { 0x386, GET(vcmpgtsw) },
+        { 0x3C6, GET(vcmpbfp) },
+      });
+      // Group 0x04 VA form opcodes (field 26..31), field 21..25 is vC
+      fillMasked<u16>(&PPCInstrInfo::nameId, 0x04, 0x03F, {
+        { 0x20, GET(vmhaddshs) },
+        { 0x21, GET(vmhraddshs) },
+        { 0x22, GET(vmladduhm) },
+        { 0x24, GET(vmsumubm) },
+        { 0x25, GET(vmsummbm) },
+        { 0x26, GET(vmsumuhm) },
+        { 0x27, GET(vmsumuhs) },
+        { 0x28, GET(vmsumshm) },
+        { 0x29, GET(vmsumshs) },
+        { 0x2A, GET(vsel) },
+        { 0x2B, GET(vperm) },
+        { 0x2C, GET(vsldoi) },
+        { 0x2E, GET(vmaddfp) },
+        { 0x2F, GET(vnmsubfp) },
+      });
+      // Group 0x04 VMX128 loads and stores (field 21..27, 30..31)
+      fillMasked<u16>(&PPCInstrInfo::nameId, 0x04, 0x7F3, {
+        { 0x003, GET(lvsl128) },
+        { 0x043, GET(lvsr128) },
+        { 0x083, GET(lvewx128) },
+        { 0x0C3, GET(lvx128) },
+        { 0x183, GET(stvewx128) },
+        { 0x1C3, GET(stvx128) },
+        { 0x2C3, GET(lvxl128) },
+        { 0x3C3, GET(stvxl128) },
+        { 0x403, GET(lvlx128) },
+        { 0x443, GET(lvrx128) },
+        { 0x503, GET(stvlx128) },
+        { 0x543, GET(stvrx128) },
+        { 0x603, GET(lvlxl128) },
+        { 0x643, GET(lvrxl128) },
+        { 0x703, GET(stvlxl128) },
+        { 0x743, GET(stvrxl128) },
+      });
+      // Group 0x04 VMX128 shift (field 27)
+      fillMasked<u16>(&PPCInstrInfo::nameId, 0x04, 0x010, {
+        { 0x10, GET(vsldoi128) },
+      });
+      // Group 0x05 VMX128 opcodes (field 22..25, 27)
+      fillMasked<u16>(&PPCInstrInfo::nameId, 0x05, 0x3D0, {
+        { 0x010, GET(vaddfp128) },
+        { 0x050, GET(vsubfp128) },
+        { 0x090, GET(vmulfp128) },
+        { 0x0D0, GET(vmaddfp128) },
+        { 0x110, GET(vmaddcfp128) },
+        { 0x150, GET(vnmsubfp128) },
+        { 0x190, GET(vmsum3fp128) },
+        { 0x1D0, GET(vmsum4fp128) },
+        { 0x200, GET(vpkshss128) },
+        { 0x210, GET(vand128) },
+        { 0x240, GET(vpkshus128) },
+        { 0x250, GET(vandc128) },
+        { 0x280, GET(vpkswss128) },
+        { 0x290, GET(vnor128) },
+        { 0x2C0, GET(vpkswus128) },
+        { 0x2D0, GET(vor128) },
+        { 0x300, GET(vpkuhum128) },
+        { 0x310, GET(vxor128) },
+        { 0x340, GET(vpkuhus128) },
+        { 0x350, GET(vsel128) },
+        { 0x380, GET(vpkuwum128) },
+        { 0x390, GET(vslo128) },
+        { 0x3C0, GET(vpkuwus128) },
+        { 0x3D0, GET(vsro128) },
+      });
+      // Group 0x05 VMX128 permute (field 22, 27)
+      fillMasked<u16>(&PPCInstrInfo::nameId, 0x05, 0x210, {
+        { 0x000, GET(vperm128) },
+      });
+      // Group 0x06 VMX128 compares (field 22..24, 27), field 25 is Rc
+      fillMasked<u16>(&PPCInstrInfo::nameId, 0x06, 0x390, {
+        { 0x000, GET(vcmpeqfp128) },
+        { 0x080, GET(vcmpgefp128) },
+        { 0x100, GET(vcmpgtfp128) },
+        { 0x180, GET(vcmpbfp128) },
+        { 0x200, GET(vcmpequw128) },
+      });
+      // Group 0x06 VMX128 opcodes (field 22..25, 27)
+      fillMasked<u16>(&PPCInstrInfo::nameId, 0x06, 0x3D0, {
+        { 0x050, GET(vrlw128) },
+        { 0x0D0, GET(vslw128) },
+        { 0x150, GET(vsraw128) },
+        { 0x1D0, GET(vsrw128) },
+        { 0x280, GET(vmaxfp128) },
+        { 0x2C0, GET(vminfp128) },
+        { 0x300, GET(vmrghw128) },
+        { 0x340, GET(vmrglw128) },
+        { 0x380, GET(vupkhsb128) },
+        { 0x3C0, GET(vupklsb128) },
+      });
+      // Group 0x06 VMX128 word permute (field 21..22, 26..27)
+      fillMasked<u16>(&PPCInstrInfo::nameId, 0x06, 0x630, {
+        { 0x210, GET(vpermwi128) },
+      });
+      // Group 0x06 VMX128 unary opcodes (field 21..27)
+      fillMasked<u16>(&PPCInstrInfo::nameId, 0x06, 0x7F0, {
+        { 0x230, GET(vcfpsxws128) },
+        { 0x270, GET(vcfpuxws128) },
+        { 0x2B0, GET(vcsxwfp128) },
+        { 0x2F0, GET(vcuxwfp128) },
+        { 0x330, GET(vrfim128) },
+        { 0x370, GET(vrfin128) },
+        { 0x3B0, GET(vrfip128) },
+        { 0x3F0, GET(vrfiz128) },
+        { 0x630, GET(vrefp128) },
+        { 0x670, GET(vrsqrtefp128) },
+        { 0x6B0, GET(vexptefp128) },
+        { 0x6F0, GET(vlogefp128) },
+        { 0x730, GET(vspltw128) },
+        { 0x770, GET(vspltisw128) },
+        { 0x7F0, GET(vupkd3d128) },
+      });
+      // Group 0x06 VMX128 insert opcodes (field 21..23, 26..27)
+      fillMasked<u16>(&PPCInstrInfo::nameId, 0x06, 0x730, {
+        { 0x610, GET(vpkd3d128) },
+        { 0x710, GET(vrlimi128) },
       });
       // Group 0x13 opcodes (field 21..30)
-      fillTable<std::string>(nameTable, 0x13, 10, 1, {
+      fillTable<u16>(&PPCInstrInfo::nameId, 0x13, 10, 1, {
         { 0x000, GET(mcrf) },
         { 0x010, GET(bclr) },
         { 0x012, GET(rfid) },
@@ -302,7 +498,7 @@ namespace PPCInterpreter {
         { 0x210, GET(bcctr) },
       });
       // Group 0x1E opcodes (field 27..30)
-      fillTable<std::string>(nameTable, 0x1E, 4, 1, {
+      fillTable<u16>(&PPCInstrInfo::nameId, 0x1E, 4, 1, {
         { 0x0, GETRC(rldicl) },
         { 0x1, GETRC(rldicl) },
         { 0x2, GETRC(rldicr) },
@@ -315,7 +511,7 @@ namespace PPCInterpreter {
         { 0x9, GETRC(rldcr) },
       });
       // Group 0x1F opcodes (field 21..30)
-      fillTable<std::string>(nameTable, 0x1F, 10, 1, {
+      fillTable<u16>(&PPCInstrInfo::nameId, 0x1F, 10, 1, {
         { 0x000, GET(cmp) },
         { 0x004, GET(tw) },
         { 0x006, GET(lvsl) },
@@ -477,13 +673,13 @@ namespace PPCInterpreter {
         { 0x3F6, GET(dcbz) },
       });
       // Group 0x3A opcodes (field 30..31)
-      fillTable<std::string>(nameTable, 0x3A, 2, 0, {
+      fillTable<u16>(&PPCInstrInfo::nameId, 0x3A, 2, 0, {
         { 0x0, GET(ld) },
         { 0x1, GET(ldu) },
         { 0x2, GET(lwa) },
       });
       // Group 0x3B opcodes (field 21..30)
-      fillTable<std::string>(nameTable, 0x3B, 10, 1, {
+      fillTable<u16>(&PPCInstrInfo::nameId, 0x3B, 10, 1, {
         { 0x12, GETRC(fdivs), 5 },
         { 0x14, GETRC(fsubs), 5 },
         { 0x15, GETRC(fadds), 5 },
@@ -496,12 +692,12 @@ namespace PPCInterpreter {
         { 0x1F, GETRC(fnmadds), 5 },
       });
       // Group 0x3E opcodes (field 30..31)
-      fillTable<std::string>(nameTable, 0x3E, 2, 0, {
+      fillTable<u16>(&PPCInstrInfo::nameId, 0x3E, 2, 0, {
         { 0x0, GET(std) },
         { 0x1, GET(stdu) },
       });
       // Group 0x3F opcodes (field 21..30)
-      fillTable<std::string>(nameTable, 0x3F, 10, 1, {
+      fillTable<u16>(&PPCInstrInfo::nameId, 0x3F, 10, 1, {
         { 0x026, GETRC(mtfsb1) },
         { 0x040, GET(mcrfs) },
         { 0x046, GETRC(mtfsb0) },
@@ -538,48 +734,40 @@ namespace PPCInterpreter {
     }
     PPCDecoder();
     ~PPCDecoder() = default;
-    const std::array<instructionHandler, 0x20000> &getTable() const noexcept {
-      return table;
-    }
-    const std::array<instructionHandlerJIT, 0x20000>& getJITTable() const noexcept {
-      return jitTable;
+    // Takes an already decoded (PPCDecode) instruction
+    const PPCInstrInfo &getInfo(u32 decoded) const noexcept {
+      return infoTable[decoded];
     }
     instructionHandler decode(u32 instr) const noexcept {
       if (instr == 0x60000000) {
         return &PPCInterpreter_nop;
       }
-      return getTable()[PPCDecode(instr)];
+      return infoTable[PPCDecode(instr)].handler;
     }
     instructionHandlerJIT decodeJIT(u32 instr) const noexcept {
-      return getJITTable()[PPCDecode(instr)];
+      return infoTable[PPCDecode(instr)].jitHandler;
     }
-    const std::array<std::string, 0x20000> &getNameTable() const noexcept {
-      return nameTable;
+    std::string_view getName(u32 decoded) const noexcept {
+      return instrNames[infoTable[decoded].nameId];
     }
-    std::string decodeName(u32 instr) const noexcept {
-      return getNameTable()[PPCDecode(instr)];
+    std::string_view decodeName(u32 instr) const noexcept {
+      return getName(PPCDecode(instr));
     }
     bool isBranch(u32 decoded) const noexcept {
-      return decoded == 0x0012 // b
-          || decoded == 0x0010 // bc
-          || decoded == 0x6490 // bclr (0x13 << 11 | 0x010)
-          || decoded == 0x7290 // bcctr (0x13 << 11 | 0x210)
-          || decoded == 0x6590;// rfid  (0x13 << 11 | 0x012)
+      return infoTable[decoded].flags & PPC_INSTR_BRANCH;
     }
   private:
-    // Fast lookup table
-    std::array<instructionHandler, 0x20000> table;
-    std::array<instructionHandlerJIT, 0x20000> jitTable;
-    std::array<std::string, 0x20000> nameTable;
+    // Fast lookup table, indexed by the decoded instruction
+    std::array<PPCInstrInfo, 0x20000> infoTable;
 
     template <typename T>
-    void fillTable(std::array<T, 0x20000> &t, u32 mainOp, u32 count, u32 sh, std::initializer_list<InstrInfo<T>> entries) noexcept {
+    void fillTable(T PPCInstrInfo::*field, u32 mainOp, u32 count, u32 sh, std::initializer_list<InstrInfo<T>> entries) noexcept {
       if (sh < 11) {
         for (const auto& v : entries) {
           for (u32 i = 0; i < 1u << (v.magn + (11 - sh - count)); i++) {
             for (u32 j = 0; j < 1u << sh; j++) {
               const u32 k = (((i << (count - v.magn)) | v.value) << sh) | j;
-              c_at(t, (k << 6) | mainOp) = k & 1 ? v.ptrRc : v.ptr0;
+              c_at(infoTable, (k << 6) | mainOp).*field = k & 1 ? v.ptrRc : v.ptr0;
             }
           }
         }
@@ -588,10 +776,22 @@ namespace PPCInterpreter {
         // Special case opcodes
         for (const auto& v : entries) {
           for (u32 i = 0; i < 1u << 11; i++) {
-            c_at(t, i << 6 | v.value) = i & 1 ? v.ptrRc : v.ptr0;
+            c_at(infoTable, i << 6 | v.value).*field = i & 1 ? v.ptrRc : v.ptr0;
           }
         }
       }
     }
+
+    // Fills every opcode of mainOp whose field 21..31 matches value under mask. The VMX and VMX128
+    // groups scatter their extended opcode around register fields, so they don't fit fillTable.
+    template <typename T>
+    void fillMasked(T PPCInstrInfo::*field, u32 mainOp, u32 mask, std::initializer_list<InstrInfo<T>> entries) noexcept {
+      for (const auto &v : entries) {
+        for (u32 k = 0; k < 1u << 11; k++) {
+          if ((k & mask) == v.value)
+            c_at(infoTable, (k << 6) | mainOp).*field = v.ptr0;
+        }
+      }
+    }
   };
 } // namespace PPCInterpreter
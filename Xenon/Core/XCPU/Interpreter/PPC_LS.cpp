@@ -3,6 +3,7 @@
 #include <bit>
 
 #include "Base/Assert.h"
+#include "Core/XeMain.h"
 #include "PPCInterpreter.h"
 
 using namespace Base;
@@ -117,6 +118,86 @@ inline u32 ConvertToSingle(u64 inValue) {
   }
 }
 
+//
+// Vector Utilities
+//
+
+// Guest byte i of a vector register is host byte i ^ 3, as every word is kept in host order. Loads and
+// stores work on host words, so only partial accesses need to care about it.
+
+// Reads the quadword containing EA, returns false if the access faulted
+static bool vectorReadQuad(PPU_STATE *ppuState, u64 EA, Vector128 &vector) {
+  EA &= ~0xF;
+  vector.dword[0] = PPCInterpreter::MMURead32(ppuState, EA);
+  vector.dword[1] = PPCInterpreter::MMURead32(ppuState, EA + (sizeof(u32) * 1));
+  vector.dword[2] = PPCInterpreter::MMURead32(ppuState, EA + (sizeof(u32) * 2));
+  vector.dword[3] = PPCInterpreter::MMURead32(ppuState, EA + (sizeof(u32) * 3));
+  return !(_ex & PPU_EX_DATASEGM || _ex & PPU_EX_DATASTOR);
+}
+
+// Writes the quadword containing EA
+static void vectorWriteQuad(PPU_STATE *ppuState, u64 EA, const Vector128 &vector) {
+  EA &= ~0xF;
+  PPCInterpreter::MMUWrite32(ppuState, EA, vector.dword[0]);
+  PPCInterpreter::MMUWrite32(ppuState, EA + (sizeof(u32) * 1), vector.dword[1]);
+  PPCInterpreter::MMUWrite32(ppuState, EA + (sizeof(u32) * 2), vector.dword[2]);
+  PPCInterpreter::MMUWrite32(ppuState, EA + (sizeof(u32) * 3), vector.dword[3]);
+}
+
+// (vD) <- MEM(EA, 16 - eb) || (eb * 8)(0)
+static void vectorLoadLeft(PPU_STATE *ppuState, u64 EA, Vector128 &vd) {
+  const u8 eb = EA & 0xF;
+  Vector128 quad{};
+  if (!vectorReadQuad(ppuState, EA, quad))
+    return;
+  Vector128 result{};
+  for (u8 i = 0; i < 16 - eb; i++) {
+    result.bytes[i ^ 3] = quad.bytes[(i + eb) ^ 3];
+  }
+  vd = result;
+}
+
+// (vD) <- ((16 - eb) * 8)(0) || MEM(EA - eb, eb)
+static void vectorLoadRight(PPU_STATE *ppuState, u64 EA, Vector128 &vd) {
+  const u8 eb = EA & 0xF;
+  Vector128 result{};
+  // With eb = 0 memory isn't accessed and vD is cleared
+  if (eb != 0) {
+    Vector128 quad{};
+    if (!vectorReadQuad(ppuState, EA, quad))
+      return;
+    for (u8 i = 16 - eb; i < 16; i++) {
+      result.bytes[i ^ 3] = quad.bytes[(i - (16 - eb)) ^ 3];
+    }
+  }
+  vd = result;
+}
+
+// MEM(EA, 16 - eb) <- (vS)0:(16 - eb) * 8 - 1
+static void vectorStoreLeft(PPU_STATE *ppuState, u64 EA, const Vector128 &vs) {
+  const u8 eb = EA & 0xF;
+  for (u8 i = 0; i < 16 - eb; i++) {
+    PPCInterpreter::MMUWrite8(ppuState, EA + i, vs.bytes[i ^ 3]);
+  }
+}
+
+// MEM(EA - eb, eb) <- (vS)(16 - eb) * 8:127
+static void vectorStoreRight(PPU_STATE *ppuState, u64 EA, const Vector128 &vs) {
+  const u8 eb = EA & 0xF;
+  EA &= ~0xF;
+  // If eb = 0, then memory is not modified by the instruction
+  for (u8 i = 0; i < eb; i++) {
+    PPCInterpreter::MMUWrite8(ppuState, EA + i, vs.bytes[(16 - eb + i) ^ 3]);
+  }
+}
+
+// Permute control vector for lvsl/lvsr, bytes first, first + 1, ...
+static void vectorShiftControl(u8 first, Vector128 &vd) {
+  for (u8 i = 0; i < 16; i++) {
+    vd.bytes[i ^ 3] = first + i;
+  }
+}
+
 //
 // Store Byte
 //
@@ -144,7 +225,17 @@ void PPCInterpreter::PPCInterpreter_dcbz(PPU_STATE *ppuState) {
 
 // Instruction Cache Block Invalidate
 void PPCInterpreter::PPCInterpreter_icbi(PPU_STATE *ppuState) {
-  // Do nothing
+  // We have no instruction cache, but the JIT may hold code compiled from this block.
+  // Translated as a load, as per the PowerPC spec.
+  u64 RA = (_instr.ra ? GPRi(ra) : 0) + GPRi(rb);
+  if (!MMUTranslateAddress(&RA, ppuState, false))
+    return;
+
+  bool socAccess = false;
+  RA = mmuContructEndAddressFromSecEngAddr(RA, &socAccess);
+  if (!socAccess && XeMain::ram && RA < XeMain::ram->GetSize()) {
+    XeMain::ram->NotifyWrite(RA & ~127ULL, 128);
+  }
 }
 
 // Store Byte (x'9800 0000')
@@ -396,18 +487,10 @@ void PPCInterpreter::PPCInterpreter_stwcx(PPU_STATE *ppuState) {
   if (_ex & PPU_EX_DATASEGM || _ex & PPU_EX_DATASTOR)
     return;
 
-  if (curThread.ppuRes->valid) {
-    CPUContext->xenonRes.LockGuard([&] {
-      if (curThread.ppuRes->valid) {
-        if (curThread.ppuRes->reservedAddr == RA) {
-          MMUWrite32(ppuState, EA, static_cast<u32>(GPRi(rs)));
-          BSET(CR, 4, CR_BIT_EQ);
-        } else {
-          CPUContext->xenonRes.Decrement();
-          curThread.ppuRes->valid = false;
-        }
-      }
-    });
+  if (CPUContext->xenonRes.StoreConditional(curThread.ppuRes.get(), RA, [&] {
+        MMUWrite32(ppuState, EA, static_cast<u32>(GPRi(rs)));
+      })) {
+    BSET(CR, 4, CR_BIT_EQ);
   }
 
   ppcUpdateCR(ppuState, 0, CR);
@@ -505,18 +588,10 @@ void PPCInterpreter::PPCInterpreter_stdcx(PPU_STATE *ppuState) {
   if (_ex & PPU_EX_DATASEGM || _ex & PPU_EX_DATASTOR)
     return;
 
-  if (curThread.ppuRes->valid) {
-    CPUContext->xenonRes.LockGuard([&] {
-      if (curThread.ppuRes->valid) {
-        if (curThread.ppuRes->reservedAddr == RA) {
-          MMUWrite64(ppuState, EA, GPRi(rd));
-          BSET(CR, 4, CR_BIT_EQ);
-        } else {
-          CPUContext->xenonRes.Decrement();
-          curThread.ppuRes->valid = false;
-        }
-      }
-    });
+  if (CPUContext->xenonRes.StoreConditional(curThread.ppuRes.get(), RA, [&] {
+        MMUWrite64(ppuState, EA, GPRi(rd));
+      })) {
+    BSET(CR, 4, CR_BIT_EQ);
   }
 
   ppcUpdateCR(ppuState, 0, CR);
@@ -746,6 +821,42 @@ void PPCInterpreter::PPCInterpreter_stvx(PPU_STATE *ppuState) {
   MMUWrite32(ppuState, EA + (sizeof(u32) * 3), VRi(vs).dword[3]);
 }
 
+// Store Vector Element Byte Indexed (x'7C00 010E')
+void PPCInterpreter::PPCInterpreter_stvebx(PPU_STATE *ppuState) {
+  /*
+  if rA=0 then b <- 0
+  else b <- (rA)
+  EA <- b + (rB)
+  eb <- EA60:63
+  MEM(EA,1) <- (vS)eb*8:(eb*8)+7
+  */
+
+  CHECK_VXU;
+
+  const u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
+  const u8 eb = EA & 0xF;
+
+  MMUWrite8(ppuState, EA, VRi(vs).bytes[eb ^ 3]);
+}
+
+// Store Vector Element Halfword Indexed (x'7C00 014E')
+void PPCInterpreter::PPCInterpreter_stvehx(PPU_STATE *ppuState) {
+  /*
+  if rA=0 then b <- 0
+  else b <- (rA)
+  EA <- (b + (rB)) & 0xFFFF_FFFF_FFFF_FFFE
+  eb <- EA60:63
+  MEM(EA,2) <- (vS)eb*8:(eb*8)+15
+  */
+
+  CHECK_VXU;
+
+  const u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)) & ~1;
+  const u8 eb = EA & 0xF;
+
+  MMUWrite16(ppuState, EA, VRi(vs).word[(eb >> 1) ^ 1]);
+}
+
 // Store Vector Element Word Indexed (x'7C00 018E')
 void PPCInterpreter::PPCInterpreter_stvewx(PPU_STATE* ppuState) {
   /*
@@ -763,122 +874,85 @@ void PPCInterpreter::PPCInterpreter_stvewx(PPU_STATE* ppuState) {
   u64 EA = ((_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)) & ~3);
   const u8 eb = EA & 0xF;
 
-  MMUWrite32(ppuState, EA, VRi(vd).dword[eb / 4]);
+  MMUWrite32(ppuState, EA, VRi(vs).dword[eb / 4]);
 }
 
-// Store Vector Right Indexed
-void PPCInterpreter::PPCInterpreter_stvrx(PPU_STATE* ppuState) {
+// Store Vector Element Word Indexed 128
+void PPCInterpreter::PPCInterpreter_stvewx128(PPU_STATE *ppuState) {
   CHECK_VXU;
 
-  u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
+  const u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)) & ~3;
   const u8 eb = EA & 0xF;
-  EA &= ~0xF;
 
-  // If EB = 0, then memory is not modified by the instruction.
-  if (eb == 0) {
-    return;
-  }
+  MMUWrite32(ppuState, EA, VR(VMX128_1_VD128).dword[eb / 4]);
+}
+// Store Vector Right Indexed (x'7C00 054E')
+void PPCInterpreter::PPCInterpreter_stvrx(PPU_STATE* ppuState) {
+  /*
+  if rA=0 then b <- 0
+  else b <- (rA)
+  EA <- b + (rB)
+  eb <- EA60:63
+  MEM(EA-eb,eb) <- (vS)(16-eb)*8:127
+  */
 
-  // Need to byteswap the bytes prior to the operation because of endianness.
-  Vector128 vec = VRi(vs);
-  vec.dword[0] = byteswap_be<u32>(vec.dword[0]);
-  vec.dword[1] = byteswap_be<u32>(vec.dword[1]);
-  vec.dword[2] = byteswap_be<u32>(vec.dword[2]);
-  vec.dword[3] = byteswap_be<u32>(vec.dword[3]);
+  CHECK_VXU;
 
-  auto bytes = vec.bytes;
-  for (u32 i = 0; i < eb; ++i) {
-    MMUWrite8(ppuState, EA + i, bytes[(16 - eb) + i]);
-  }
+  vectorStoreRight(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VRi(vs));
 }
-
 // Store Vector Right Indexed 128
 void PPCInterpreter::PPCInterpreter_stvrx128(PPU_STATE* ppuState) {
   CHECK_VXU;
 
-  u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
-  const u8 eb = EA & 0xF;
-  EA &= ~0xF;
-
-  // If EB = 0, then memory is not modified by the instruction.
-  if (eb == 0) {
-    return;
-  }
+  vectorStoreRight(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VR(VMX128_1_VD128));
+}
 
-  // Need to byteswap the bytes prior to the operation because of endianness.
-  Vector128 vec = VR(VMX128_1_VD128);
-  vec.dword[0] = byteswap_be<u32>(vec.dword[0]);
-  vec.dword[1] = byteswap_be<u32>(vec.dword[1]);
-  vec.dword[2] = byteswap_be<u32>(vec.dword[2]);
-  vec.dword[3] = byteswap_be<u32>(vec.dword[3]);
+// Store Vector Right Indexed LRU (x'7C00 074E')
+void PPCInterpreter::PPCInterpreter_stvrxl(PPU_STATE *ppuState) {
+  CHECK_VXU;
 
-  auto bytes = vec.bytes;
-  for (u32 i = 0; i < eb; ++i) {
-    MMUWrite8(ppuState, EA + i, bytes[(16 - eb) + i]);
-  }
+  vectorStoreRight(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VRi(vs));
 }
 
-// Store Vector Left Indexed
-void PPCInterpreter::PPCInterpreter_stvlx(PPU_STATE* ppuState) {
+// Store Vector Right Indexed LRU 128
+void PPCInterpreter::PPCInterpreter_stvrxl128(PPU_STATE *ppuState) {
   CHECK_VXU;
 
-  u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
-  const u8 eb = EA & 0xF;
-  EA &= ~0xF;
+  vectorStoreRight(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VR(VMX128_1_VD128));
+}
+// Store Vector Left Indexed (x'7C00 050E')
+void PPCInterpreter::PPCInterpreter_stvlx(PPU_STATE* ppuState) {
+  /*
+  if rA=0 then b <- 0
+  else b <- (rA)
+  EA <- b + (rB)
+  eb <- EA60:63
+  MEM(EA,16-eb) <- (vS)0:(16-eb)*8-1
+  */
 
-  // Need to byteswap the bytes prior to the operation because of endianness.
-  Vector128 vec = VRi(vs);
-  vec.dword[0] = byteswap_be<u32>(vec.dword[0]);
-  vec.dword[1] = byteswap_be<u32>(vec.dword[1]);
-  vec.dword[2] = byteswap_be<u32>(vec.dword[2]);
-  vec.dword[3] = byteswap_be<u32>(vec.dword[3]);
+  CHECK_VXU;
 
-  auto bytes = vec.bytes;
-  for (int i = 0; i < 16 - eb; ++i) {
-    MMUWrite8(ppuState, EA + i, bytes[i]);
-  }
+  vectorStoreLeft(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VRi(vs));
 }
-
 // Store Vector Left Indexed 128
 void PPCInterpreter::PPCInterpreter_stvlx128(PPU_STATE* ppuState) {
   CHECK_VXU;
 
-  u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
-  const u8 eb = EA & 0xF;
-  EA &= ~0xF;
+  vectorStoreLeft(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VR(VMX128_1_VD128));
+}
 
-  Vector128 vec = VR(VMX128_1_VD128);
-  vec.dword[0] = byteswap_be<u32>(vec.dword[0]);
-  vec.dword[1] = byteswap_be<u32>(vec.dword[1]);
-  vec.dword[2] = byteswap_be<u32>(vec.dword[2]);
-  vec.dword[3] = byteswap_be<u32>(vec.dword[3]);
+// Store Vector Left Indexed LRU (x'7C00 070E')
+void PPCInterpreter::PPCInterpreter_stvlxl(PPU_STATE *ppuState) {
+  CHECK_VXU;
 
-  auto bytes = vec.bytes;
-  for (int i = 0; i < 16 - eb; ++i) {
-    MMUWrite8(ppuState, EA + i, bytes[i]);
-  }
+  vectorStoreLeft(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VRi(vs));
 }
-
 // Store Vector Left Indexed LRU 128
 void PPCInterpreter::PPCInterpreter_stvlxl128(PPU_STATE* ppuState) {
   CHECK_VXU;
 
-  u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
-  const u8 eb = EA & 0xF;
-  EA &= ~0xF;
-
-  Vector128 vec = VR(VMX128_1_VD128);
-  vec.dword[0] = byteswap_be<u32>(vec.dword[0]);
-  vec.dword[1] = byteswap_be<u32>(vec.dword[1]);
-  vec.dword[2] = byteswap_be<u32>(vec.dword[2]);
-  vec.dword[3] = byteswap_be<u32>(vec.dword[3]);
-
-  auto bytes = vec.bytes;
-  for (int i = 0; i < 16 - eb; ++i) {
-    MMUWrite8(ppuState, EA + i, bytes[i]);
-  }
+  vectorStoreLeft(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VR(VMX128_1_VD128));
 }
-
 // Store Vector Indexed LRU (x'7C00 03CE')
 void PPCInterpreter::PPCInterpreter_stvxl(PPU_STATE *ppuState) {
   /*
@@ -892,14 +966,22 @@ void PPCInterpreter::PPCInterpreter_stvxl(PPU_STATE *ppuState) {
 
   CHECK_VXU;
 
-  const u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)) & ~0xF;
+  vectorWriteQuad(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VRi(vs));
+}
 
-  MMUWrite32(ppuState, EA, VRi(vs).dword[0]);
-  MMUWrite32(ppuState, EA + (sizeof(u32) * 1), VRi(vs).dword[1]);
-  MMUWrite32(ppuState, EA + (sizeof(u32) * 2), VRi(vs).dword[2]);
-  MMUWrite32(ppuState, EA + (sizeof(u32) * 3), VRi(vs).dword[3]);
+// Store Vector Indexed 128
+void PPCInterpreter::PPCInterpreter_stvx128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  vectorWriteQuad(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VR(VMX128_1_VD128));
 }
 
+// Store Vector Indexed LRU 128
+void PPCInterpreter::PPCInterpreter_stvxl128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  vectorWriteQuad(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VR(VMX128_1_VD128));
+}
 //
 // Load Byte
 //
@@ -1235,9 +1317,7 @@ void PPCInterpreter::PPCInterpreter_lwarx(PPU_STATE *ppuState) {
   if (_ex & PPU_EX_DATASEGM || _ex & PPU_EX_DATASTOR)
     return;
 
-  curThread.ppuRes->valid = true;
-  curThread.ppuRes->reservedAddr = RA;
-  CPUContext->xenonRes.Increment();
+  CPUContext->xenonRes.Reserve(curThread.ppuRes.get(), RA);
 
   u32 data = MMURead32(ppuState, EA);
 
@@ -1420,9 +1500,7 @@ void PPCInterpreter::PPCInterpreter_ldarx(PPU_STATE *ppuState) {
   if (_ex & PPU_EX_DATASEGM || _ex & PPU_EX_DATASTOR)
     return;
 
-  curThread.ppuRes->reservedAddr = RA;
-  curThread.ppuRes->valid = true;
-  CPUContext->xenonRes.Increment();
+  CPUContext->xenonRes.Reserve(curThread.ppuRes.get(), RA);
 
   const u64 data = MMURead64(ppuState, EA);
 
@@ -1655,6 +1733,54 @@ void PPCInterpreter::PPCInterpreter_lfsu(PPU_STATE *ppuState) {
 // Load Vector
 //
 
+// Load Vector Element Byte Indexed (x'7C00 000E')
+void PPCInterpreter::PPCInterpreter_lvebx(PPU_STATE *ppuState) {
+  /*
+  if rA=0 then b <- 0
+  else b <- (rA)
+  EA <- b + (rB)
+  eb <- EA60:63
+  vD <- undefined
+  vDeb*8:(eb*8)+7 <- MEM(EA,1)
+  */
+
+  CHECK_VXU;
+
+  const u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
+  const u8 eb = EA & 0xF;
+
+  u8 data = MMURead8(ppuState, EA);
+
+  if (_ex & PPU_EX_DATASEGM || _ex & PPU_EX_DATASTOR)
+    return;
+
+  VRi(vd).bytes[eb ^ 3] = data;
+}
+
+// Load Vector Element Halfword Indexed (x'7C00 004E')
+void PPCInterpreter::PPCInterpreter_lvehx(PPU_STATE *ppuState) {
+  /*
+  if rA=0 then b <- 0
+  else b <- (rA)
+  EA <- (b + (rB)) & 0xFFFF_FFFF_FFFF_FFFE
+  eb <- EA60:63
+  vD <- undefined
+  vDeb*8:(eb*8)+15 <- MEM(EA,2)
+  */
+
+  CHECK_VXU;
+
+  const u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)) & ~1;
+  const u8 eb = EA & 0xF;
+
+  u16 data = MMURead16(ppuState, EA);
+
+  if (_ex & PPU_EX_DATASEGM || _ex & PPU_EX_DATASTOR)
+    return;
+
+  VRi(vd).word[(eb >> 1) ^ 1] = data;
+}
+
 // Load Vector Element Word Indexed (x'7C00 008E')
 void PPCInterpreter::PPCInterpreter_lvewx(PPU_STATE* ppuState) {
   /*
@@ -1670,19 +1796,31 @@ void PPCInterpreter::PPCInterpreter_lvewx(PPU_STATE* ppuState) {
 
   CHECK_VXU;
 
-  u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
-
-  u8 eb = EA & 0x3;
-  EA &= ~0x3;
+  const u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)) & ~3;
+  const u8 eb = EA & 0xF;
 
   u32 data = MMURead32(ppuState, EA);
 
   if (_ex & PPU_EX_DATASEGM || _ex & PPU_EX_DATASTOR)
     return;
 
-  VRi(vd).dword[eb] = data;
+  VRi(vd).dword[eb / 4] = data;
 }
 
+// Load Vector Element Word Indexed 128
+void PPCInterpreter::PPCInterpreter_lvewx128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  const u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)) & ~3;
+  const u8 eb = EA & 0xF;
+
+  u32 data = MMURead32(ppuState, EA);
+
+  if (_ex & PPU_EX_DATASEGM || _ex & PPU_EX_DATASTOR)
+    return;
+
+  VR(VMX128_1_VD128).dword[eb / 4] = data;
+}
 // Load Vector Indexed (x'7C00 00CE')
 void PPCInterpreter::PPCInterpreter_lvx(PPU_STATE* ppuState) {
   /*
@@ -1742,6 +1880,17 @@ void PPCInterpreter::PPCInterpreter_lvx128(PPU_STATE *ppuState) {
   VR(VMX128_1_VD128) = vector;
 }
 
+// Load Vector Indexed LRU 128
+void PPCInterpreter::PPCInterpreter_lvxl128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  Vector128 vector{};
+  if (!vectorReadQuad(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), vector))
+    return;
+
+  VR(VMX128_1_VD128) = vector;
+}
+
 // Load Vector Indexed LRU (x'7C00 02CE')
 void PPCInterpreter::PPCInterpreter_lvxl(PPU_STATE *ppuState) {
   /*
@@ -1787,49 +1936,29 @@ void PPCInterpreter::PPCInterpreter_lvlx(PPU_STATE *ppuState) {
 
   CHECK_VXU;
 
-  Vector128 vector{};
-
-  u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
-  const u8 eb = EA & 0xF;
-  EA &= ~0xF;
-
-  vector.dword[0] = MMURead32(ppuState, EA);
-  vector.dword[1] = MMURead32(ppuState, EA + (sizeof(u32) * 1));
-  vector.dword[2] = MMURead32(ppuState, EA + (sizeof(u32) * 2));
-  vector.dword[3] = MMURead32(ppuState, EA + (sizeof(u32) * 3));
+  vectorLoadLeft(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VRi(vd));
+}
 
-#ifdef VXU_LOAD_DEBUG
-  LOG_DEBUG(Xenon, "lvlx [EA {:#x}] Temp VR = [{:#x}, {:#x}, {:#x}, {:#x}]",
-    (u32)EA, vector.dword[0], vector.dword[1], vector.dword[2], vector.dword[3]);
-#endif // VXU_LOAD_DEBUG
+// Load Vector Left Indexed LRU (x'7C00 060E')
+void PPCInterpreter::PPCInterpreter_lvlxl(PPU_STATE *ppuState) {
+  CHECK_VXU;
 
-  if (_ex & PPU_EX_DATASEGM || _ex & PPU_EX_DATASTOR)
-    return;
+  vectorLoadLeft(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VRi(vd));
+}
 
-  vector.dword[0] = byteswap_be<u32>(vector.dword[0]);
-  vector.dword[1] = byteswap_be<u32>(vector.dword[1]);
-  vector.dword[2] = byteswap_be<u32>(vector.dword[2]);
-  vector.dword[3] = byteswap_be<u32>(vector.dword[3]);
+// Load Vector Left Indexed 128
+void PPCInterpreter::PPCInterpreter_lvlx128(PPU_STATE *ppuState) {
+  CHECK_VXU;
 
-  u8 i = 0;
-  for (i = 0; i < 16 - eb; ++i)
-    VRi(vd).bytes[i] = vector.bytes[i + eb];
+  vectorLoadLeft(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VR(VMX128_1_VD128));
+}
 
-  while (i < 16)
-    VRi(vd).bytes[i++] = 0;
- 
-  VRi(vd).dword[0] = byteswap_be<u32>(VRi(vd).dword[0]);
-  VRi(vd).dword[1] = byteswap_be<u32>(VRi(vd).dword[1]);
-  VRi(vd).dword[2] = byteswap_be<u32>(VRi(vd).dword[2]);
-  VRi(vd).dword[3] = byteswap_be<u32>(VRi(vd).dword[3]);
+// Load Vector Left Indexed LRU 128
+void PPCInterpreter::PPCInterpreter_lvlxl128(PPU_STATE *ppuState) {
+  CHECK_VXU;
 
-#ifdef VXU_LOAD_DEBUG
-  u8 vrd = _instr.vd;
-  LOG_DEBUG(Xenon, "lvlx [EB {:#d}] vR{:#d} = [{:#x}, {:#x}, {:#x}, {:#x}]",
-    eb, vrd, VRi(vd).dword[0], VRi(vd).dword[1], VRi(vd).dword[2], VRi(vd).dword[3]);
-#endif // VXU_LOAD_DEBUG
+  vectorLoadLeft(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VR(VMX128_1_VD128));
 }
-
 // Load Vector Right Indexed (x'7C00 044E')
 void PPCInterpreter::PPCInterpreter_lvrx(PPU_STATE *ppuState) {
   /*
@@ -1842,54 +1971,29 @@ void PPCInterpreter::PPCInterpreter_lvrx(PPU_STATE *ppuState) {
 
   CHECK_VXU;
 
-  Vector128 vector{};
-
-  u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
-  const u8 eb = EA & 0xF;
-  EA &= ~0xF;
-
-  vector.dword[0] = MMURead32(ppuState, EA);
-  vector.dword[1] = MMURead32(ppuState, EA + (sizeof(u32) * 1));
-  vector.dword[2] = MMURead32(ppuState, EA + (sizeof(u32) * 2));
-  vector.dword[3] = MMURead32(ppuState, EA + (sizeof(u32) * 3));
-
-#ifdef VXU_LOAD_DEBUG
-  LOG_DEBUG(Xenon, "lvrx [EA {:#x}] Temp VR = [{:#x}, {:#x}, {:#x}, {:#x}]",
-    (u32)EA, vector.dword[0], vector.dword[1], vector.dword[2], vector.dword[3]);
-#endif // VXU_LOAD_DEBUG
-
-  if (_ex & PPU_EX_DATASEGM || _ex & PPU_EX_DATASTOR)
-    return;
+  vectorLoadRight(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VRi(vd));
+}
 
-  vector.dword[0] = byteswap_be<u32>(vector.dword[0]);
-  vector.dword[1] = byteswap_be<u32>(vector.dword[1]);
-  vector.dword[2] = byteswap_be<u32>(vector.dword[2]);
-  vector.dword[3] = byteswap_be<u32>(vector.dword[3]);
+// Load Vector Right Indexed LRU (x'7C00 064E')
+void PPCInterpreter::PPCInterpreter_lvrxl(PPU_STATE *ppuState) {
+  CHECK_VXU;
 
-  u8 i = 0;
+  vectorLoadRight(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VRi(vd));
+}
 
-  while (i < (16 - eb)) {
-    VRi(vd).bytes[i] = 0;
-    ++i;
-  }
+// Load Vector Right Indexed 128
+void PPCInterpreter::PPCInterpreter_lvrx128(PPU_STATE *ppuState) {
+  CHECK_VXU;
 
-  while (i < 16) {
-    VRi(vd).bytes[i] = vector.bytes[i - (16 - eb)];
-    ++i;
-  }
+  vectorLoadRight(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VR(VMX128_1_VD128));
+}
 
-  VRi(vd).dword[0] = byteswap_be<u32>(VRi(vd).dword[0]);
-  VRi(vd).dword[1] = byteswap_be<u32>(VRi(vd).dword[1]);
-  VRi(vd).dword[2] = byteswap_be<u32>(VRi(vd).dword[2]);
-  VRi(vd).dword[3] = byteswap_be<u32>(VRi(vd).dword[3]);
+// Load Vector Right Indexed LRU 128
+void PPCInterpreter::PPCInterpreter_lvrxl128(PPU_STATE *ppuState) {
+  CHECK_VXU;
 
-#ifdef VXU_LOAD_DEBUG
-  u8 vrd = _instr.vd;
-  LOG_DEBUG(Xenon, "lvrx [EB {:#d}] vR{:#d} = [{:#x}, {:#x}, {:#x}, {:#x}]",
-    eb, vrd, VRi(vd).dword[0], VRi(vd).dword[1], VRi(vd).dword[2], VRi(vd).dword[3]);
-#endif // VXU_LOAD_DEBUG
+  vectorLoadRight(ppuState, (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb)), VR(VMX128_1_VD128));
 }
-
 // Load Vector for Shift Left (x'7C00 000C')
 void PPCInterpreter::PPCInterpreter_lvsl(PPU_STATE* ppuState) {
   /*
@@ -1923,8 +2027,44 @@ void PPCInterpreter::PPCInterpreter_lvsl(PPU_STATE* ppuState) {
   const u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
   const u8 sh = EA & 0xF;
 
-  for (s32 idx = 0; idx < 16; idx++) {
-    const u8 regIdx = (idx & ~3) | (3 - (idx & 3));
-    VRi(vd).bytes[regIdx] = idx + sh;
-  }
+  vectorShiftControl(sh, VRi(vd));
+}
+
+// Load Vector for Shift Right (x'7C00 004C')
+void PPCInterpreter::PPCInterpreter_lvsr(PPU_STATE *ppuState) {
+  /*
+  if rA = 0 then b <- 0
+  else b <- (rA)
+  addr[0:63] <- b + (rB)
+  sh <- addr[60:63]
+  if sh = 0x0 then vD[0-127] <- 0x101112131415161718191A1B1C1D1E1F
+  if sh = 0x1 then vD[0-127] <- 0x0F101112131415161718191A1B1C1D1E
+  ...
+  if sh = 0xF then vD[0-127] <- 0x0102030405060708090A0B0C0D0E0F10
+  */
+
+  CHECK_VXU;
+
+  const u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
+  const u8 sh = EA & 0xF;
+
+  vectorShiftControl(16 - sh, VRi(vd));
+}
+
+// Load Vector for Shift Left 128
+void PPCInterpreter::PPCInterpreter_lvsl128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  const u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
+
+  vectorShiftControl(EA & 0xF, VR(VMX128_1_VD128));
+}
+
+// Load Vector for Shift Right 128
+void PPCInterpreter::PPCInterpreter_lvsr128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  const u64 EA = (_instr.ra ? GPRi(ra) + GPRi(rb) : GPRi(rb));
+
+  vectorShiftControl(16 - (EA & 0xF), VR(VMX128_1_VD128));
 }
@@ -2,8 +2,10 @@
 
 #include "Base/Global.h"
 #include "Core/NAND/NAND.h"
+#include "Core/RAM/RAM.h"
 #include "Core/XCPU/PostBus/PostBus.h"
 #include "Core/XCPU/Xenon.h"
+#include "Core/XeMain.h"
 
 #include "PPCInterpreter.h"
 
@@ -160,14 +162,22 @@ inline bool mmuComparePTE(u64 VA, u64 VPN, u64 pte0, u64 pte1, u8 p, bool L, boo
   return match;
 }
 
+// Invalidates the ERAT's of both threads in the given core.
+void PPCInterpreter::mmuInvalidateCoreERATs(PPU_STATE *ppuState) {
+  for (auto &thread : ppuState->ppuThread) {
+    thread.iERAT.InvalidateAll();
+    thread.dERAT.InvalidateAll();
+  }
+}
+
 // SLB Invalidate All
 void PPCInterpreter::PPCInterpreter_slbia(PPU_STATE *ppuState) {
   for (auto &slbEntry : curThread.SLB) {
     slbEntry.V = 0;
   }
   // Invalidate both ERAT's
-  curThread.iERAT.invalidateAll();
-  curThread.dERAT.invalidateAll();
+  curThread.iERAT.InvalidateAll();
+  curThread.dERAT.InvalidateAll();
 }
 
 // TLB Invalidate Entry Local
@@ -200,10 +210,9 @@ void PPCInterpreter::PPCInterpreter_tlbiel(PPU_STATE *ppuState) {
     ppuState->TLB.tlbSet3[rb_44_51].pte0 = 0;
     ppuState->TLB.tlbSet3[rb_44_51].pte1 = 0;
 
-    // Should only invalidate entries for a specific set of addresses.
-    // Invalidate both ERAT's *** BUG *** !!!
-    curThread.iERAT.invalidateAll();
-    curThread.dERAT.invalidateAll();
+    // The TLB is shared by both threads of the core, and we have no EA to work with,
+    // so drop every ERAT entry of the core.
+    mmuInvalidateCoreERATs(ppuState);
   } else {
     // The TLB is as selective as possible when invalidating TLB entries.The
     // invalidation match criteria is VPN[38:79 - p], L, LP, and LPID.
@@ -269,10 +278,9 @@ void PPCInterpreter::PPCInterpreter_tlbiel(PPU_STATE *ppuState) {
         tlbEntry.pte1 = 0;
       }
     }
-    // Should only invalidate entries for a specific set of addresses.
-    // Invalidate both ERAT's *** BUG *** !!!
-    curThread.iERAT.invalidateAll();
-    curThread.dERAT.invalidateAll();
+    // The TLB is shared by both threads of the core, and we have no EA to work with,
+    // so drop every ERAT entry of the core.
+    mmuInvalidateCoreERATs(ppuState);
   }
 }
 
@@ -297,9 +305,11 @@ void PPCInterpreter::PPCInterpreter_tlbie(PPU_STATE *ppuState) {
   if (Config::log.advanced)
     LOG_TRACE(Xenon, "tlbie, EA:0x{:X} | PageSize:{} | Full:0x{:X},{} | LP:{}", EA, p, fullPageSize, fullPageSize, LP ? "true" : "false");
 #endif
-  for (u64 i{}; i != fullPageSize; ++i) {
-    curThread.iERAT.invalidateElement(EA+i);
-    curThread.dERAT.invalidateElement(EA+i);
+  // Drop every ERAT entry that covers the page, on both threads of the core.
+  const u64 pageEA = EA & ~(fullPageSize - 1);
+  for (auto &thread : ppuState->ppuThread) {
+    thread.iERAT.InvalidateRange(pageEA, fullPageSize);
+    thread.dERAT.InvalidateRange(pageEA, fullPageSize);
   }
 }
 
@@ -630,6 +640,45 @@ u64 PPCInterpreter::mmuContructEndAddressFromSecEngAddr(u64 inputAddress,
   return outputAddress;
 }
 
+// Returns the ERAT mode tag for the current access of the given thread.
+static inline u8 mmuGetERATMode(const PPU_THREAD_REGISTERS &thread) {
+  const MSRegister _msr = thread.SPR.MSR;
+  // The I-ERAT only cares about IR and the D-ERAT only about DR.
+  return thread.instrFetch ? ERAT::BuildMode(_msr.SF, _msr.HV, _msr.PR, _msr.IR, false)
+                           : ERAT::BuildMode(_msr.SF, _msr.HV, _msr.PR, false, _msr.DR);
+}
+
+// Returns the host address of a translated page when it is backed by main RAM. SoC, SROM/SRAM,
+// IIC and MMIO pages return nullptr, as those always need to go trough the bus.
+static u8 *mmuGetHostPage(u64 EA, u64 RA) {
+  // Accesses to 0x7FFFxxxx are redirected to the IIC.
+  if (((EA & 0x000000007FFF0000ULL) >> 16) == 0x7FFF)
+    return nullptr;
+
+  bool socAccess = false;
+  const u64 physAddr = PPCInterpreter::mmuContructEndAddressFromSecEngAddr(RA & ~0xFFFULL, &socAccess);
+  if (socAccess || !XeMain::ram.get())
+    return nullptr;
+
+  return XeMain::ram->GetPointerToRange(physAddr, 0x1000);
+}
+
+// Fast path for accesses that are fully contained in a RAM backed page already present in the
+// ERAT's. Returns the host address of the access, or nullptr if the full MMU path must be taken.
+static inline u8 *mmuGetHostPointer(PPU_STATE *ppuState, u64 EA, u64 size, ePPUThread thr, u64 *RA) {
+  PPU_THREAD_REGISTERS &thread = ppuState->ppuThread[thr != ePPUThread_None ? thr : curThreadId];
+
+  if (!thread.SPR.MSR.SF)
+    EA = static_cast<u32>(EA);
+
+  // Page crossing accesses need two translations.
+  if ((EA & 0xFFF) + size > 0x1000)
+    return nullptr;
+
+  ERAT &erat = thread.instrFetch ? thread.iERAT : thread.dERAT;
+  return erat.LookupHost(EA, mmuGetERATMode(thread), RA);
+}
+
 // Main address translation mechanism used on the XCPU.
 bool PPCInterpreter::MMUTranslateAddress(u64 *EA, PPU_STATE *ppuState,
                                          bool memWrite, ePPUThread thr) {
@@ -685,30 +734,19 @@ bool PPCInterpreter::MMUTranslateAddress(u64 *EA, PPU_STATE *ppuState,
   // pages can occupy several ERAT entries.All EA - to - RA mappings are kept in the ERAT including
   // both real - mode and virtual - mode addresses(that is, addresses accessed with MSR[IR] equal to
   // 0 or 1).
-  // TODO:
   // The ERATs identify each translation entry with some combination of the MSR[SF, IR, DR,
   // PR, and HV] bits, depending on whether the entry is in the I - ERAT or D - ERAT.This allows the
   // ERATs to distinguish between translations that are valid for the various modes of operation.
   // See IBM_CBE_Handbook_v1.1 Page 82.
 
+  ERAT &erat = thread.instrFetch ? thread.iERAT : thread.dERAT;
+  const u8 eratMode = mmuGetERATMode(thread);
+
   // Search ERAT's
-  if (thread.instrFetch) {
-    // iERAT
-    RA = thread.iERAT.getElement((*EA & ~0xFFF));
-    if (RA != -1) {
-      RA |= (*EA & 0xFFF);
-      *EA = RA;
-      return true;
-    }
-  }
-  else {
-    // dERAT
-    RA = thread.dERAT.getElement((*EA & ~0xFFF));
-    if (RA != -1) {
-      RA |= (*EA & 0xFFF);
-      *EA = RA;
-      return true;
-    }
+  if (erat.Lookup(*EA, eratMode, &RA)) {
+    RA |= (*EA & 0xFFF);
+    *EA = RA;
+    return true;
   }
 
   // Holds whether the cpu thread issuing the fetch is running in Real or
@@ -1055,15 +1093,8 @@ bool PPCInterpreter::MMUTranslateAddress(u64 *EA, PPU_STATE *ppuState,
     QSET(RA, 0, 21, 0);
   }
 
-  // Save in ERAT's
-  if (thread.instrFetch) {
-    // iERAT
-    thread.iERAT.putElement((*EA & ~0xFFF), (RA & ~0xFFF));
-  }
-  else {
-    // dERAT
-    thread.dERAT.putElement((*EA & ~0xFFF), (RA & ~0xFFF));
-  }
+  // Save in ERAT's, along with the host page for RAM backed pages
+  erat.Insert(*EA, RA, eratMode, mmuGetHostPage(*EA, RA));
 
   *EA = RA;
   return true;
@@ -1073,7 +1104,6 @@ bool PPCInterpreter::MMUTranslateAddress(u64 *EA, PPU_STATE *ppuState,
 void PPCInterpreter::MMURead(XENON_CONTEXT* cpuContext, PPU_STATE *ppuState,
                              u64 EA, u64 byteCount, u8 *outData, ePPUThread thr) {
   MICROPROFILE_SCOPEI("[Xe::PPCInterpreter]", "MMURead", MP_AUTO);
-  PPU_THREAD_REGISTERS &thread = ppuState->ppuThread[thr != ePPUThread_None ? thr : curThreadId];
   const u64 oldEA = EA;
   if (!MMUTranslateAddress(&EA, ppuState, false, thr)) {
     memset(outData, 0, byteCount);
@@ -1094,16 +1124,6 @@ void PPCInterpreter::MMURead(XENON_CONTEXT* cpuContext, PPU_STATE *ppuState,
     Config::imgui.debugWindow = true; // Open the debugger after halting
   }
 
-  // TODO: Investigate why FSB_CONFIG_RX_STATE needs these values to work
-  switch (thread.CIA) {
-  case 0x1003598ULL: {
-    GPR(11) = 0x0E;
-  } break;
-  case 0x1003644ULL: {
-    GPR(11) = 0x02;
-  } break;
-  }
-
   // Handle SoC reads
   if (socRead) {
     // Check if the read is from the SROM
@@ -1148,8 +1168,8 @@ void PPCInterpreter::MMUWrite(XENON_CONTEXT *cpuContext, PPU_STATE *ppuState,
   if (!MMUTranslateAddress(&EA, ppuState, true, thr))
     return;
 
-  // Check if it's reserved
-  cpuContext->xenonRes.Check(EA);
+  // Physical address, for the reservation check once written
+  const u64 RA = EA;
 
   bool socWrite = false;
 
@@ -1176,6 +1196,7 @@ void PPCInterpreter::MMUWrite(XENON_CONTEXT *cpuContext, PPU_STATE *ppuState,
     else if (EA >= XE_SRAM_ADDR && EA < XE_SRAM_ADDR + XE_SRAM_SIZE) {
       u32 sramAddr = static_cast<u32>(EA - XE_SRAM_ADDR);
       memcpy(&cpuContext->SRAM[sramAddr], data, byteCount);
+      cpuContext->xenonRes.Check(RA, byteCount);
       return;
     }
     // Integrated Interrupt Controller in real mode, used when the HV wants to
@@ -1199,6 +1220,9 @@ void PPCInterpreter::MMUWrite(XENON_CONTEXT *cpuContext, PPU_STATE *ppuState,
     if (Config::log.advanced)
       LOG_WARNING(Xenon_MMU, "Invalid SoC Write to 0x{:X}", EA);
   }
+
+  // Invalidate reservations on what was written
+  cpuContext->xenonRes.Check(RA, byteCount);
 }
 
 void PPCInterpreter::MMUMemCpyFromHost(PPU_STATE *ppuState,
@@ -1224,8 +1248,8 @@ void PPCInterpreter::MMUMemSet(PPU_STATE *ppuState,
   if (!CPUContext)
     return;
 
-  // Check if it's reserved
-  CPUContext->xenonRes.Check(EA);
+  // Physical address, for the reservation check once written
+  const u64 RA = EA;
 
   bool socWrite = false;
 
@@ -1246,6 +1270,7 @@ void PPCInterpreter::MMUMemSet(PPU_STATE *ppuState,
       else if (EA >= XE_SRAM_ADDR && EA < XE_SRAM_ADDR + XE_SRAM_SIZE) {
         const u32 sramAddr = static_cast<u32>(EA - XE_SRAM_ADDR);
         memset(&CPUContext->SRAM[sramAddr], data, size);
+        CPUContext->xenonRes.Check(RA, size);
         return;
       }
       // Check if writing to Security Engine Config Block
@@ -1260,10 +1285,16 @@ void PPCInterpreter::MMUMemSet(PPU_STATE *ppuState,
 
   // External MemSet
   sysBus->MemSet(EA, data, size);
+
+  // Invalidate reservations on what was written
+  CPUContext->xenonRes.Check(RA, size);
 }
 
 // Reads 1 byte of memory
 u8 PPCInterpreter::MMURead8(PPU_STATE *ppuState, u64 EA, ePPUThread thr) {
+  u64 RA = 0;
+  if (const u8 *hostPtr = mmuGetHostPointer(ppuState, EA, sizeof(u8), thr, &RA); hostPtr && !Config::debug.haltOnReadAddress)
+    return *hostPtr;
   u8 data = 0;
   MMURead(CPUContext, ppuState, EA, sizeof(data), reinterpret_cast<u8*>(&data), thr);
   return data;
@@ -1271,37 +1302,80 @@ u8 PPCInterpreter::MMURead8(PPU_STATE *ppuState, u64 EA, ePPUThread thr) {
 // Reads 2 bytes of memory
 u16 PPCInterpreter::MMURead16(PPU_STATE *ppuState, u64 EA, ePPUThread thr) {
   u16 data = 0;
+  u64 RA = 0;
+  if (const u8 *hostPtr = mmuGetHostPointer(ppuState, EA, sizeof(data), thr, &RA); hostPtr && !Config::debug.haltOnReadAddress) {
+    memcpy(&data, hostPtr, sizeof(data));
+    return byteswap_be<u16>(data);
+  }
   MMURead(CPUContext, ppuState, EA, sizeof(data), reinterpret_cast<u8*>(&data), thr);
   return byteswap_be<u16>(data);
 }
 // Reads 4 bytes of memory
 u32 PPCInterpreter::MMURead32(PPU_STATE *ppuState, u64 EA, ePPUThread thr) {
   u32 data = 0;
+  u64 RA = 0;
+  if (const u8 *hostPtr = mmuGetHostPointer(ppuState, EA, sizeof(data), thr, &RA); hostPtr && !Config::debug.haltOnReadAddress) {
+    memcpy(&data, hostPtr, sizeof(data));
+    return byteswap_be<u32>(data);
+  }
   MMURead(CPUContext, ppuState, EA, sizeof(data), reinterpret_cast<u8*>(&data), thr);
   return byteswap_be<u32>(data);
 }
 // Reads 8 bytes of memory
 u64 PPCInterpreter::MMURead64(PPU_STATE *ppuState, u64 EA, ePPUThread thr) {
   u64 data = 0;
+  u64 RA = 0;
+  if (const u8 *hostPtr = mmuGetHostPointer(ppuState, EA, sizeof(data), thr, &RA); hostPtr && !Config::debug.haltOnReadAddress) {
+    memcpy(&data, hostPtr, sizeof(data));
+    return byteswap_be<u64>(data);
+  }
   MMURead(CPUContext, ppuState, EA, sizeof(data), reinterpret_cast<u8*>(&data), thr);
   return byteswap_be<u64>(data);
 }
 // Writes 1 byte to memory
 void PPCInterpreter::MMUWrite8(PPU_STATE *ppuState, u64 EA, u8 data, ePPUThread thr) {
+  u64 RA = 0;
+  if (u8 *hostPtr = mmuGetHostPointer(ppuState, EA, sizeof(data), thr, &RA); hostPtr && !Config::debug.haltOnWriteAddress) {
+    *hostPtr = data;
+    CPUContext->xenonRes.Check(RA);
+    XeMain::ram->NotifyHostWrite(hostPtr, sizeof(data));
+    return;
+  }
   MMUWrite(CPUContext, ppuState, reinterpret_cast<const u8*>(&data), EA, sizeof(data), thr);
 }
 // Writes 2 bytes to memory
 void PPCInterpreter::MMUWrite16(PPU_STATE *ppuState, u64 EA, u16 data, ePPUThread thr) {
   const u16 dataBS = byteswap_be<u16>(data);
+  u64 RA = 0;
+  if (u8 *hostPtr = mmuGetHostPointer(ppuState, EA, sizeof(data), thr, &RA); hostPtr && !Config::debug.haltOnWriteAddress) {
+    memcpy(hostPtr, &dataBS, sizeof(dataBS));
+    CPUContext->xenonRes.Check(RA);
+    XeMain::ram->NotifyHostWrite(hostPtr, sizeof(dataBS));
+    return;
+  }
   MMUWrite(CPUContext, ppuState, reinterpret_cast<const u8*>(&dataBS), EA, sizeof(data), thr);
 }
 // Writes 4 bytes to memory
 void PPCInterpreter::MMUWrite32(PPU_STATE *ppuState, u64 EA, u32 data, ePPUThread thr) {
   const u32 dataBS = byteswap_be<u32>(data);
+  u64 RA = 0;
+  if (u8 *hostPtr = mmuGetHostPointer(ppuState, EA, sizeof(data), thr, &RA); hostPtr && !Config::debug.haltOnWriteAddress) {
+    memcpy(hostPtr, &dataBS, sizeof(dataBS));
+    CPUContext->xenonRes.Check(RA);
+    XeMain::ram->NotifyHostWrite(hostPtr, sizeof(dataBS));
+    return;
+  }
   MMUWrite(CPUContext, ppuState, reinterpret_cast<const u8*>(&dataBS), EA, sizeof(data), thr);
 }
 // Writes 8 bytes to memory
 void PPCInterpreter::MMUWrite64(PPU_STATE *ppuState, u64 EA, u64 data, ePPUThread thr) {
   const u64 dataBS = byteswap_be<u64>(data);
+  u64 RA = 0;
+  if (u8 *hostPtr = mmuGetHostPointer(ppuState, EA, sizeof(data), thr, &RA); hostPtr && !Config::debug.haltOnWriteAddress) {
+    memcpy(hostPtr, &dataBS, sizeof(dataBS));
+    CPUContext->xenonRes.Check(RA);
+    XeMain::ram->NotifyHostWrite(hostPtr, sizeof(dataBS));
+    return;
+  }
   MMUWrite(CPUContext, ppuState, reinterpret_cast<const u8*>(&dataBS), EA, sizeof(data), thr);
 }
@@ -1,9 +1,59 @@
 // Copyright 2025 Xenon Emulator Project. All rights reserved.
 
+#include <algorithm>
+
 #include "Base/Logging/Log.h"
 
 #include "PPCInterpreter.h"
 
+// HID6[15]: Time-base and decrementer facility enable.
+// 0 -> TBU, TBL, DEC, HDEC, and the hang-detection logic do not
+// update. 1 -> TBU, TBL, DEC, HDEC, and the hang-detection logic
+// are enabled to update
+static inline bool ppcTimeBaseEnabled(PPU_STATE *ppuState) {
+  return PPCInterpreter::CPUContext && PPCInterpreter::CPUContext->timeBaseActive &&
+    (ppuState->SPR.HID6 & 0x1000000000000);
+}
+
+void PPCInterpreter::ppcUpdateTimeBase(PPU_STATE *ppuState) {
+  PPU_TIME_BASE &timeBase = ppuState->timeBase;
+  const bool enabled = ppcTimeBaseEnabled(ppuState);
+  if (timeBase.instrs && enabled) {
+    // The Decrementer and the Time Base are driven by the same time frequency.
+    const u64 ticks = timeBase.instrs * timeBase.ticksPerInstr;
+    ppuState->SPR.TB += ticks;
+    PPU_THREAD_REGISTERS &thread = ppuState->ppuThread[timeBase.thread];
+    const u32 dec = thread.SPR.DEC;
+    thread.SPR.DEC = dec - static_cast<u32>(ticks);
+    // The decrementer must issue an interrupt if it went past 0 and one isn't pending already.
+    if (ticks > dec && !(thread.exceptReg & PPU_EX_DEC)) {
+      thread.exceptReg |= PPU_EX_DEC;
+    }
+  }
+  timeBase.instrs = 0;
+
+  // Next update, when the running thread's decrementer underflows
+  timeBase.thread = curThreadId;
+  timeBase.eventInstrs = PPU_TIME_BASE_MAX_BATCH;
+  if (enabled && timeBase.ticksPerInstr) {
+    const u64 dec = static_cast<u32>(curThread.SPR.DEC);
+    timeBase.eventInstrs = std::min<u64>(timeBase.eventInstrs, dec / timeBase.ticksPerInstr + 1);
+  }
+}
+
+u64 PPCInterpreter::ppcGetTimeBase(PPU_STATE *ppuState) {
+  if (!ppcTimeBaseEnabled(ppuState))
+    return ppuState->SPR.TB;
+  return ppuState->SPR.TB + ppuState->timeBase.instrs * ppuState->timeBase.ticksPerInstr;
+}
+
+s32 PPCInterpreter::ppcGetDecrementer(PPU_STATE *ppuState) {
+  const PPU_TIME_BASE &timeBase = ppuState->timeBase;
+  if (!ppcTimeBaseEnabled(ppuState) || timeBase.thread != curThreadId)
+    return curThread.SPR.DEC;
+  return static_cast<s32>(static_cast<u32>(curThread.SPR.DEC) - static_cast<u32>(timeBase.instrs * timeBase.ticksPerInstr));
+}
+
 // Instruction Synchronize
 void PPCInterpreter::PPCInterpreter_isync(PPU_STATE *ppuState) {
   // Do nothing
@@ -69,10 +119,9 @@ void PPCInterpreter::PPCInterpreter_slbie(PPU_STATE *ppuState) {
     }
   }
 
-  // Should only invalidate entries for a specific set of addresses.
-  // Invalidate both ERAT's *** BUG *** !!!
-  curThread.iERAT.invalidateAll();
-  curThread.dERAT.invalidateAll();
+  // Drop every ERAT entry inside the 256MB segment.
+  curThread.iERAT.InvalidateRange(ESID << 28, 0x10000000);
+  curThread.dERAT.InvalidateRange(ESID << 28, 0x10000000);
 }
 
 // Return From Interrupt Doubleword
@@ -224,7 +273,7 @@ void PPCInterpreter::PPCInterpreter_mfspr(PPU_STATE *ppuState) {
     GPRi(rs) = curThread.SPR.DAR;
     break;
   case SPR_DEC:
-    GPRi(rs) = curThread.SPR.DEC;
+    GPRi(rs) = ppcGetDecrementer(ppuState);
     break;
   case SPR_SDR1:
     GPRi(rs) = ppuState->SPR.SDR1;
@@ -245,10 +294,10 @@ void PPCInterpreter::PPCInterpreter_mfspr(PPU_STATE *ppuState) {
     GPRi(rs) = curThread.SPR.VRSAVE;
     break;
   case SPR_TBL_RO:
-    GPRi(rs) = ppuState->SPR.TB;
+    GPRi(rs) = ppcGetTimeBase(ppuState);
     break;
   case SPR_TBU_RO:
-    GPRi(rs) = (ppuState->SPR.TB & 0xFFFFFFFF00000000);
+    GPRi(rs) = (ppcGetTimeBase(ppuState) & 0xFFFFFFFF00000000);
     break;
   case SPR_SPRG0:
     GPRi(rs) = curThread.SPR.SPRG0;
@@ -263,7 +312,7 @@ void PPCInterpreter::PPCInterpreter_mfspr(PPU_STATE *ppuState) {
     GPRi(rs) = curThread.SPR.SPRG3;
     break;
   case SPR_TB:
-    GPRi(rs) = ppuState->SPR.TB;
+    GPRi(rs) = ppcGetTimeBase(ppuState);
     break;
   case SPR_PVR:
     GPRi(rs) = ppuState->SPR.PVR.PVR_Hex;
@@ -340,7 +389,10 @@ void PPCInterpreter::PPCInterpreter_mtspr(PPU_STATE *ppuState) {
     curThread.SPR.DAR = GPRi(rd);
     break;
   case SPR_DEC:
+    ppcUpdateTimeBase(ppuState);
     curThread.SPR.DEC = static_cast<u32>(GPRi(rd));
+    // Reschedule the underflow
+    ppcUpdateTimeBase(ppuState);
     break;
   case SPR_SDR1:
     ppuState->SPR.SDR1 = GPRi(rd);
@@ -374,9 +426,11 @@ void PPCInterpreter::PPCInterpreter_mtspr(PPU_STATE *ppuState) {
     curThread.SPR.SPRG3 = GPRi(rd);
     break;
   case SPR_TBL_WO:
+    ppcUpdateTimeBase(ppuState);
     ppuState->SPR.TB = GPRi(rd);
     break;
   case SPR_TBU_WO:
+    ppcUpdateTimeBase(ppuState);
     ppuState->SPR.TB = ppuState->SPR.TB |= (GPRi(rd) << 32);
     break;
   case SPR_HSPRG0:
@@ -390,12 +444,18 @@ void PPCInterpreter::PPCInterpreter_mtspr(PPU_STATE *ppuState) {
     break;
   case SPR_RMOR:
     ppuState->SPR.RMOR = GPRi(rd);
+    // Real mode translations depend on this register.
+    mmuInvalidateCoreERATs(ppuState);
     break;
   case SPR_HRMOR:
     ppuState->SPR.HRMOR = GPRi(rd);
+    // Real mode translations depend on this register.
+    mmuInvalidateCoreERATs(ppuState);
     break;
   case SPR_LPCR:
     ppuState->SPR.LPCR = GPRi(rd);
+    // Real mode translations depend on this register.
+    mmuInvalidateCoreERATs(ppuState);
     break;
   case SPR_LPIDR:
     ppuState->SPR.LPIDR = static_cast<u32>(GPRi(rd));
@@ -429,7 +489,10 @@ void PPCInterpreter::PPCInterpreter_mtspr(PPU_STATE *ppuState) {
     ppuState->SPR.HID4 = GPRi(rd);
     break;
   case SPR_HID6:
+    // May enable or disable the time base
+    ppcUpdateTimeBase(ppuState);
     ppuState->SPR.HID6 = GPRi(rd);
+    ppcUpdateTimeBase(ppuState);
     break;
   case SPR_DABR:
     curThread.SPR.DABR = GPRi(rd);
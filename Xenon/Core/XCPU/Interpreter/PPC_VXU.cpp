@@ -1,26 +1,58 @@
 // Copyright 2025 Xenon Emulator Project. All rights reserved.
 
 #include "PPCInterpreter.h"
+#include "PPC_VXU.h"
 
-// Data Stream Touch for Store
+//
+// Utilities
+//
+
+// Sets VSCR[SAT] if a saturating kernel clamped any element. The bit is sticky.
+static inline void vxuSetSat(PPU_STATE *ppuState, bool sat) {
+  if (sat)
+    curThread.VSCR.SAT = 1;
+}
+
+// Runs a floating point kernel. In non-Java mode (VSCR[NJ]) denormal inputs and results are
+// flushed to zero, keeping their sign.
+template <typename F, typename... Args>
+static inline Base::Vector128 vxuFloat(PPU_STATE *ppuState, F &&op, const Args &...args) {
+  if (!curThread.VSCR.NJ)
+    return op(args...);
+  return VXU::FlushDenormals(op(VXU::FlushDenormals(args)...));
+}
+
+// CR6 of the record forms of the compares: all elements true (LT), none true (EQ)
+static inline void vxuCompareCR6(PPU_STATE *ppuState, const Base::Vector128 &result) {
+  const bool allTrue = (result.qword[0] & result.qword[1]) == ~0ULL;
+  const bool allFalse = (result.qword[0] | result.qword[1]) == 0;
+  PPCInterpreter::ppuSetCR(ppuState, 6, allTrue, false, allFalse, false);
+}
+
+// CR6 of vcmpbfp., all elements within bounds (EQ)
+static inline void vxuBoundsCR6(PPU_STATE *ppuState, const Base::Vector128 &result) {
+  PPCInterpreter::ppuSetCR(ppuState, 6, false, false, (result.qword[0] | result.qword[1]) == 0, false);
+}
+
+// Data Stream Stop
 void PPCInterpreter::PPCInterpreter_dss(PPU_STATE *ppuState) {
   CHECK_VXU;
 
-  // We don't really need to do anything here, as it's handling cache. We mostly ignore it
+  // Data stream prefetching only affects the cache, there's nothing to do
 }
 
-// Data Stream Touch for Store
+// Data Stream Touch
 void PPCInterpreter::PPCInterpreter_dst(PPU_STATE *ppuState) {
   CHECK_VXU;
 
-  // We don't really need to do anything here, as it's handling cache. We mostly ignore it
+  // Data stream prefetching only affects the cache, there's nothing to do
 }
 
 // Data Stream Touch for Store
 void PPCInterpreter::PPCInterpreter_dstst(PPU_STATE *ppuState) {
   CHECK_VXU;
 
-  // We don't really need to do anything here, as it's handling cache. We mostly ignore it
+  // Data stream prefetching only affects the cache, there's nothing to do
 }
 
 // Move from Vector Status and Control Register (x'1000 0604')
@@ -31,7 +63,7 @@ void PPCInterpreter::PPCInterpreter_mfvscr(PPU_STATE *ppuState) {
 
   CHECK_VXU;
 
-  VRi(vd).dword[3] = curThread.VSCR.hexValue;
+  VRi(vd) = Base::Vector128i(0, 0, 0, curThread.VSCR.hexValue);
 }
 
 // Move to Vector Status and Control Register (x'1000 0C44')
@@ -45,575 +77,2591 @@ void PPCInterpreter::PPCInterpreter_mtvscr(PPU_STATE *ppuState) {
   curThread.VSCR.hexValue = VRi(vb).dword[3];
 }
 
-// Vector Add Floating Point (x'1000 000A')
-void PPCInterpreter::PPCInterpreter_vaddfp(PPU_STATE *ppuState) {
-/*
-  do i = 0,127,32
-    (vD)i:i+31 <- RndToNearFP32((vA)i:i+31 + fp (vB)i:i+31)
-  end 
-*/
-
-  // TODO: Rounding and NJ mode check.
+// Vector Add Unsigned Byte Modulo (x'1000 0000')
+void PPCInterpreter::PPCInterpreter_vaddubm(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 8
+    vDi:i+7 <- (vA)i:i+7 +int (vB)i:i+7
+  end
+  */
 
   CHECK_VXU;
 
-  VRi(vd).flt[0] = VRi(va).flt[0] + VRi(vb).flt[0];
-  VRi(vd).flt[1] = VRi(va).flt[1] + VRi(vb).flt[1];
-  VRi(vd).flt[2] = VRi(va).flt[2] + VRi(vb).flt[2];
-  VRi(vd).flt[3] = VRi(va).flt[3] + VRi(vb).flt[3];
+  VRi(vd) = VXU::AddU8(VRi(va), VRi(vb));
 }
 
-// Vector Logical AND (x'1000 0404')
-void PPCInterpreter::PPCInterpreter_vand(PPU_STATE *ppuState) {
+// Vector Add Unsigned Halfword Modulo (x'1000 0040')
+void PPCInterpreter::PPCInterpreter_vadduhm(PPU_STATE *ppuState) {
   /*
-  vD <- (vA) & (vB)
+  do i=0 to 127 by 16
+    vDi:i+15 <- (vA)i:i+15 +int (vB)i:i+15
+  end
   */
 
   CHECK_VXU;
 
-  VRi(vd).dword[0] = VRi(va).dword[0] & VRi(vb).dword[0];
-  VRi(vd).dword[1] = VRi(va).dword[1] & VRi(vb).dword[1];
-  VRi(vd).dword[2] = VRi(va).dword[2] & VRi(vb).dword[2];
-  VRi(vd).dword[3] = VRi(va).dword[3] & VRi(vb).dword[3];
+  VRi(vd) = VXU::AddU16(VRi(va), VRi(vb));
 }
 
-// Vector Logical AND with Complement (x'1000 0444')
-void PPCInterpreter::PPCInterpreter_vandc(PPU_STATE *ppuState) {
+// Vector Add Unsigned Word Modulo (x'1000 0080')
+void PPCInterpreter::PPCInterpreter_vadduwm(PPU_STATE *ppuState) {
   /*
-  vD <- (vA) & ~(vB)
+  do i=0 to 127 by 32
+    vDi:i+31 <- (vA)i:i+31 +int (vB)i:i+31
+  end
   */
 
   CHECK_VXU;
 
-  VRi(vd).dword[0] = VRi(va).dword[0] & ~VRi(vb).dword[0];
-  VRi(vd).dword[1] = VRi(va).dword[1] & ~VRi(vb).dword[1];
-  VRi(vd).dword[2] = VRi(va).dword[2] & ~VRi(vb).dword[2];
-  VRi(vd).dword[3] = VRi(va).dword[3] & ~VRi(vb).dword[3];
+  VRi(vd) = VXU::AddU32(VRi(va), VRi(vb));
 }
 
-// Vector Convert from Unsigned Fixed-Point Word (x'1000 030A')
-void PPCInterpreter::PPCInterpreter_vcfux(PPU_STATE *ppuState) {
+// Vector Add Unsigned Byte Saturate (x'1000 0200')
+void PPCInterpreter::PPCInterpreter_vaddubs(PPU_STATE *ppuState) {
   /*
-  do i=0 to 127 by 32
-    vDi:i+31 <- CnvtUI32ToFP32((vB)i:i+31) / fp 2UIMM
+  do i=0 to 127 by 8
+    vDi:i+7 <- UClamp((vA)i:i+7 +int (vB)i:i+7)
   end
   */
 
-  // TODO: Rounding
-
   CHECK_VXU;
 
-  const f32 divisor = 1 << _instr.vuimm;
-
-  VRi(vd).flt[0] = VRi(va).dword[0] / divisor;
-  VRi(vd).flt[1] = VRi(va).dword[1] / divisor;
-  VRi(vd).flt[2] = VRi(va).dword[2] / divisor;
-  VRi(vd).flt[3] = VRi(va).dword[3] / divisor;
+  bool sat = false;
+  VRi(vd) = VXU::AddSatU8(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
 }
 
-// Vector Logical NOR (x'1000 0504')
-void PPCInterpreter::PPCInterpreter_vnor(PPU_STATE *ppuState) {
+// Vector Add Unsigned Halfword Saturate (x'1000 0240')
+void PPCInterpreter::PPCInterpreter_vadduhs(PPU_STATE *ppuState) {
   /*
-  vD <- ~((vA) | (vB))
+  do i=0 to 127 by 16
+    vDi:i+15 <- UClamp((vA)i:i+15 +int (vB)i:i+15)
+  end
   */
 
   CHECK_VXU;
 
-  VRi(vd).dword[0] = ~(VRi(va).dword[0] | VRi(vb).dword[0]);
-  VRi(vd).dword[1] = ~(VRi(va).dword[1] | VRi(vb).dword[1]);
-  VRi(vd).dword[2] = ~(VRi(va).dword[2] | VRi(vb).dword[2]);
-  VRi(vd).dword[3] = ~(VRi(va).dword[3] | VRi(vb).dword[3]);
+  bool sat = false;
+  VRi(vd) = VXU::AddSatU16(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
 }
 
-// Vector Logical OR (x'1000 0484')
-void PPCInterpreter::PPCInterpreter_vor(PPU_STATE *ppuState) {
+// Vector Add Unsigned Word Saturate (x'1000 0280')
+void PPCInterpreter::PPCInterpreter_vadduws(PPU_STATE *ppuState) {
   /*
-  vD <- (vA) | (vB)
+  do i=0 to 127 by 32
+    vDi:i+31 <- UClamp((vA)i:i+31 +int (vB)i:i+31)
+  end
   */
 
   CHECK_VXU;
 
-  VRi(vd).dword[0] = VRi(va).dword[0] | VRi(vb).dword[0];
-  VRi(vd).dword[1] = VRi(va).dword[1] | VRi(vb).dword[1];
-  VRi(vd).dword[2] = VRi(va).dword[2] | VRi(vb).dword[2];
-  VRi(vd).dword[3] = VRi(va).dword[3] | VRi(vb).dword[3];
+  bool sat = false;
+  VRi(vd) = VXU::AddSatU32(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
 }
 
-// Vector Splat Word (x'1000 028C')
-void PPCInterpreter::PPCInterpreter_vspltw(PPU_STATE *ppuState) {
+// Vector Add Signed Byte Saturate (x'1000 0300')
+void PPCInterpreter::PPCInterpreter_vaddsbs(PPU_STATE *ppuState) {
   /*
-   b <- UIMM*32
-    do i=0 to 127 by 32
-    vDi:i+31 <- (vB)b:b+31
-    end
+  do i=0 to 127 by 8
+    vDi:i+7 <- SClamp((vA)i:i+7 +int (vB)i:i+7)
+  end
   */
 
   CHECK_VXU;
 
-  const u8 b = (_instr.va & 0x3);
+  bool sat = false;
+  VRi(vd) = VXU::AddSatS8(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Add Signed Halfword Saturate (x'1000 0340')
+void PPCInterpreter::PPCInterpreter_vaddshs(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    vDi:i+15 <- SClamp((vA)i:i+15 +int (vB)i:i+15)
+  end
+  */
+
+  CHECK_VXU;
 
-  VRi(vd).dword[0] = VRi(vb).dword[b];
-  VRi(vd).dword[1] = VRi(vb).dword[b];
-  VRi(vd).dword[2] = VRi(vb).dword[b];
-  VRi(vd).dword[3] = VRi(vb).dword[b];
+  bool sat = false;
+  VRi(vd) = VXU::AddSatS16(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
 }
 
-// Vector Maximum Unsigned Word (x'1000 0082')
-void PPCInterpreter::PPCInterpreter_vmaxuw(PPU_STATE *ppuState) {
+// Vector Add Signed Word Saturate (x'1000 0380')
+void PPCInterpreter::PPCInterpreter_vaddsws(PPU_STATE *ppuState) {
   /*
   do i=0 to 127 by 32
-  if (vA)i:i+31 >=ui (vB)i:i+31
-   then vDi:i+31 <- (vA)i:i+31
-   else vDi:i+31 <- (vB)i:i+31
+    vDi:i+31 <- SClamp((vA)i:i+31 +int (vB)i:i+31)
   end
   */
 
   CHECK_VXU;
 
-  VRi(vd).dword[0] = (VRi(va).dword[0] > VRi(vb).dword[0]) ? VRi(va).dword[0] : VRi(vb).dword[0];
-  VRi(vd).dword[1] = (VRi(va).dword[1] > VRi(vb).dword[1]) ? VRi(va).dword[1] : VRi(vb).dword[1];
-  VRi(vd).dword[2] = (VRi(va).dword[2] > VRi(vb).dword[2]) ? VRi(va).dword[2] : VRi(vb).dword[2];
-  VRi(vd).dword[3] = (VRi(va).dword[3] > VRi(vb).dword[3]) ? VRi(va).dword[3] : VRi(vb).dword[3];
+  bool sat = false;
+  VRi(vd) = VXU::AddSatS32(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
 }
 
-// Vector Minimum Unsigned Word (x'1000 0282')
-void PPCInterpreter::PPCInterpreter_vminuw(PPU_STATE *ppuState) {
+// Vector Subtract Unsigned Byte Modulo (x'1000 0400')
+void PPCInterpreter::PPCInterpreter_vsububm(PPU_STATE *ppuState) {
   /*
-  do i=0 to 127 by 32
-  if (vA)i:i+31 < ui (vB)i:i+31
-   then vDi:i+31 <- (vA)i:i+31
-   else vDi:i+31 <- (vB)i:i+31
+  do i=0 to 127 by 8
+    vDi:i+7 <- (vA)i:i+7 -int (vB)i:i+7
   end
   */
 
   CHECK_VXU;
 
-  VRi(vd).dword[0] = (VRi(va).dword[0] < VRi(vb).dword[0]) ? VRi(va).dword[0] : VRi(vb).dword[0];
-  VRi(vd).dword[1] = (VRi(va).dword[1] < VRi(vb).dword[1]) ? VRi(va).dword[1] : VRi(vb).dword[1];
-  VRi(vd).dword[2] = (VRi(va).dword[2] < VRi(vb).dword[2]) ? VRi(va).dword[2] : VRi(vb).dword[2];
-  VRi(vd).dword[3] = (VRi(va).dword[3] < VRi(vb).dword[3]) ? VRi(va).dword[3] : VRi(vb).dword[3];
+  VRi(vd) = VXU::SubU8(VRi(va), VRi(vb));
 }
 
-// Vector 128 Multiply Floating Point
-void PPCInterpreter::PPCInterpreter_vmulfp128(PPU_STATE *ppuState) {
+// Vector Subtract Unsigned Halfword Modulo (x'1000 0440')
+void PPCInterpreter::PPCInterpreter_vsubuhm(PPU_STATE *ppuState) {
   /*
-  vD <- vA * vB (4 x FP)
+  do i=0 to 127 by 16
+    vDi:i+15 <- (vA)i:i+15 -int (vB)i:i+15
+  end
   */
 
   CHECK_VXU;
 
-  VR(VMX128_VD128).flt[0] = VR(VMX128_VA128).flt[0] * VR(VMX128_VB128).flt[0];
-  VR(VMX128_VD128).flt[1] = VR(VMX128_VA128).flt[1] * VR(VMX128_VB128).flt[1];
-  VR(VMX128_VD128).flt[2] = VR(VMX128_VA128).flt[2] * VR(VMX128_VB128).flt[2];
-  VR(VMX128_VD128).flt[3] = VR(VMX128_VA128).flt[3] * VR(VMX128_VB128).flt[3];
+  VRi(vd) = VXU::SubU16(VRi(va), VRi(vb));
 }
 
-// Vector Merge High Word (x'1000 008C')
-void PPCInterpreter::PPCInterpreter_vmrghw(PPU_STATE *ppuState) {
+// Vector Subtract Unsigned Word Modulo (x'1000 0480')
+void PPCInterpreter::PPCInterpreter_vsubuwm(PPU_STATE *ppuState) {
   /*
-  do i=0 to 63 by 32
-    vDi*2:(i*2)+63 <- (vA)i:i+31 || (vB)i:i+31
+  do i=0 to 127 by 32
+    vDi:i+31 <- (vA)i:i+31 -int (vB)i:i+31
   end
   */
 
   CHECK_VXU;
 
-  VRi(vd).dword[0] = VRi(va).dword[0];
-  VRi(vd).dword[1] = VRi(vb).dword[0];
-  VRi(vd).dword[2] = VRi(va).dword[1];
-  VRi(vd).dword[3] = VRi(vb).dword[1];
+  VRi(vd) = VXU::SubU32(VRi(va), VRi(vb));
 }
 
-// Vector Merge Low Word (x'1000 018C')
-void PPCInterpreter::PPCInterpreter_vmrglw(PPU_STATE *ppuState) {
+// Vector Subtract Unsigned Byte Saturate (x'1000 0600')
+void PPCInterpreter::PPCInterpreter_vsububs(PPU_STATE *ppuState) {
   /*
-  do i=0 to 63 by 32
-    vDi*2:(i*2)+63 <- (vA)i+64:i+95 || (vB)i+64:i+95
+  do i=0 to 127 by 8
+    vDi:i+7 <- UClamp((vA)i:i+7 -int (vB)i:i+7)
   end
   */
 
   CHECK_VXU;
 
-  VRi(vd).dword[0] = VRi(va).dword[2];
-  VRi(vd).dword[1] = VRi(vb).dword[2];
-  VRi(vd).dword[2] = VRi(va).dword[3];
-  VRi(vd).dword[3] = VRi(vb).dword[3];
+  bool sat = false;
+  VRi(vd) = VXU::SubSatU8(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
 }
 
-// Vector Merge High Word 128
-void PPCInterpreter::PPCInterpreter_vmrghw128(PPU_STATE *ppuState) {
+// Vector Subtract Unsigned Halfword Saturate (x'1000 0640')
+void PPCInterpreter::PPCInterpreter_vsubuhs(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    vDi:i+15 <- UClamp((vA)i:i+15 -int (vB)i:i+15)
+  end
+  */
 
   CHECK_VXU;
 
-  VR(VMX128_VD128).dword[0] = VR(VMX128_VA128).dword[0];
-  VR(VMX128_VD128).dword[1] = VR(VMX128_VB128).dword[0];
-  VR(VMX128_VD128).dword[2] = VR(VMX128_VA128).dword[1];
-  VR(VMX128_VD128).dword[3] = VR(VMX128_VB128).dword[1];
+  bool sat = false;
+  VRi(vd) = VXU::SubSatU16(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
 }
 
-static const u8 reIndex[32] = { 3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12, 19,18,17,16, 23,22,21,20, 27,26,25,24, 31,30,29,28 };
+// Vector Subtract Unsigned Word Saturate (x'1000 0680')
+void PPCInterpreter::PPCInterpreter_vsubuws(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- UClamp((vA)i:i+31 -int (vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
 
-static inline u8 vpermHelper(u8 idx, Base::Vector128 vra, Base::Vector128 vrb) {
-  return (idx & 16) ? vrb.bytes[idx & 15] : vra.bytes[idx & 15];
+  bool sat = false;
+  VRi(vd) = VXU::SubSatU32(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
 }
 
-// Vector Permute (x'1000 002B')
-void PPCInterpreter::PPCInterpreter_vperm(PPU_STATE* ppuState) {
+// Vector Subtract Signed Byte Saturate (x'1000 0700')
+void PPCInterpreter::PPCInterpreter_vsubsbs(PPU_STATE *ppuState) {
   /*
-  temp0:255 <- (vA) || (vB)
   do i=0 to 127 by 8
-    b <- (vC)i+3:i+7 || 0b000
-    vDi:i+7 <- tempb:b+7
+    vDi:i+7 <- SClamp((vA)i:i+7 -int (vB)i:i+7)
   end
   */
 
   CHECK_VXU;
 
-  for (u8 idx = 0; idx < 16; idx++) {
-    VRi(vd).bytes[idx] = vpermHelper(reIndex[VRi(vc).bytes[reIndex[idx]]], VRi(va), VRi(rb));
-  }
-
-  VRi(vd).dword[0] = byteswap_be<u32>(VRi(vd).dword[0]);
-  VRi(vd).dword[1] = byteswap_be<u32>(VRi(vd).dword[1]);
-  VRi(vd).dword[2] = byteswap_be<u32>(VRi(vd).dword[2]);
-  VRi(vd).dword[3] = byteswap_be<u32>(VRi(vd).dword[3]);
+  bool sat = false;
+  VRi(vd) = VXU::SubSatS8(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
 }
 
-// Vector Permute 128
-void PPCInterpreter::PPCInterpreter_vperm128(PPU_STATE* ppuState) {
+// Vector Subtract Signed Halfword Saturate (x'1000 0740')
+void PPCInterpreter::PPCInterpreter_vsubshs(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    vDi:i+15 <- SClamp((vA)i:i+15 -int (vB)i:i+15)
+  end
+  */
 
   CHECK_VXU;
 
-  for (u8 idx = 0; idx < 16; idx++) {
-    VR(VMX128_2_VD128).bytes[idx] = vpermHelper(reIndex[VR(VMX128_2_VC).bytes[reIndex[idx]]], VR(VMX128_2_VA128), VR(VMX128_2_VB128));
-  }
+  bool sat = false;
+  VRi(vd) = VXU::SubSatS16(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Subtract Signed Word Saturate (x'1000 0780')
+void PPCInterpreter::PPCInterpreter_vsubsws(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- SClamp((vA)i:i+31 -int (vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
 
-  VR(VMX128_2_VD128).dword[0] = byteswap_be<u32>(VR(VMX128_2_VD128).dword[0]);
-  VR(VMX128_2_VD128).dword[1] = byteswap_be<u32>(VR(VMX128_2_VD128).dword[1]);
-  VR(VMX128_2_VD128).dword[2] = byteswap_be<u32>(VR(VMX128_2_VD128).dword[2]);
-  VR(VMX128_2_VD128).dword[3] = byteswap_be<u32>(VR(VMX128_2_VD128).dword[3]);
+  bool sat = false;
+  VRi(vd) = VXU::SubSatS32(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
 }
 
-// Vector Multiply Add Floating Point (x'1000 002E')
-void PPCInterpreter::PPCInterpreter_vmaddfp(PPU_STATE *ppuState) {
+// Vector Add Carryout Unsigned Word (x'1000 0180')
+void PPCInterpreter::PPCInterpreter_vaddcuw(PPU_STATE *ppuState) {
   /*
   do i=0 to 127 by 32
-    vDi:i+31 <- RndToNearFP32(((vA)i:i+31 *fp (vC)i:i+31) +fp (vB)i:i+31)
+    vDi:i+31 <- CarryOut((vA)i:i+31 +int (vB)i:i+31)
   end
   */
 
-  // TODO: Rounding.
+  CHECK_VXU;
+
+  VRi(vd) = VXU::AddCarryU32(VRi(va), VRi(vb));
+}
+
+// Vector Subtract Carryout Unsigned Word (x'1000 0580')
+void PPCInterpreter::PPCInterpreter_vsubcuw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- CarryOut((vA)i:i+31 -int (vB)i:i+31)
+  end
+  */
 
   CHECK_VXU;
 
-  VRi(vd).flt[0] = (VRi(va).flt[0] * VRi(vc).flt[0]) + VRi(vb).flt[0];
-  VRi(vd).flt[1] = (VRi(va).flt[1] * VRi(vc).flt[1]) + VRi(vb).flt[1];
-  VRi(vd).flt[2] = (VRi(va).flt[2] * VRi(vc).flt[2]) + VRi(vb).flt[2];
-  VRi(vd).flt[3] = (VRi(va).flt[3] * VRi(vc).flt[3]) + VRi(vb).flt[3];
+  VRi(vd) = VXU::SubCarryU32(VRi(va), VRi(vb));
 }
 
-// Vector Shift Left Integer Byte (x'1000 0104')
-void PPCInterpreter::PPCInterpreter_vslb(PPU_STATE *ppuState) {
+// Vector Average Unsigned Byte (x'1000 0402')
+void PPCInterpreter::PPCInterpreter_vavgub(PPU_STATE *ppuState) {
   /*
   do i=0 to 127 by 8
-   sh <- (vB)i+5):i+7
-   (vD)i:i+7 <- (vA)i:i+7 << ui sh
+    vDi:i+7 <- ((vA)i:i+7 +int (vB)i:i+7 +int 1) >> 1
   end
   */
 
   CHECK_VXU;
 
-  for (u8 idx = 0; idx < 16; idx++) {
-    VRi(vd).bytes[idx] = VRi(va).bytes[idx] << (VRi(vb).bytes[idx] & 0x7);
-  }
+  VRi(vd) = VXU::AvgU8(VRi(va), VRi(vb));
 }
 
-// Vector Shift Left Integer Word (x'1000 0184')
-void PPCInterpreter::PPCInterpreter_vslw(PPU_STATE* ppuState) {
+// Vector Average Unsigned Halfword (x'1000 0442')
+void PPCInterpreter::PPCInterpreter_vavguh(PPU_STATE *ppuState) {
   /*
-  do i=0 to 127 by 32
-    sh <- (vB)i+27:i+31
-    vD[i:i+31] <- (vA)[i:i+31] << ui sh
+  do i=0 to 127 by 16
+    vDi:i+15 <- ((vA)i:i+15 +int (vB)i:i+15 +int 1) >> 1
   end
   */
 
   CHECK_VXU;
 
-  VRi(rd).dword[0] = VRi(ra).dword[0] << (VRi(rb).dword[0] & 31);
-  VRi(rd).dword[1] = VRi(ra).dword[1] << (VRi(rb).dword[1] & 31);
-  VRi(rd).dword[2] = VRi(ra).dword[2] << (VRi(rb).dword[2] & 31);
-  VRi(rd).dword[3] = VRi(ra).dword[3] << (VRi(rb).dword[3] & 31);
+  VRi(vd) = VXU::AvgU16(VRi(va), VRi(vb));
 }
 
-// Vector Shift Right (x'1000 02C4')
-void PPCInterpreter::PPCInterpreter_vsr(PPU_STATE* ppuState) {
+// Vector Average Unsigned Word (x'1000 0482')
+void PPCInterpreter::PPCInterpreter_vavguw(PPU_STATE *ppuState) {
   /*
-  sh <- (vB)125:127
-  t <- 1
-  do i = 0 to 127 by 8
-    t <- t & ((vB)i+5:i+7 = sh)
-    if t = 1 then vD <- (vA) >>ui sh
-  else vD <- undefined
+  do i=0 to 127 by 32
+    vDi:i+31 <- ((vA)i:i+31 +int (vB)i:i+31 +int 1) >> 1
   end
   */
 
-  // Let sh = vB[125-127]; sh is the shift count in bits (0<=sh<=7). The contents of vA are shifted right by sh bits. Bits
-  // shifted out of bit 127 are lost. Zeros are supplied to the vacated bits on the left. The result is placed into vD.
+  CHECK_VXU;
+
+  VRi(vd) = VXU::AvgU32(VRi(va), VRi(vb));
+}
+
+// Vector Average Signed Byte (x'1000 0502')
+void PPCInterpreter::PPCInterpreter_vavgsb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 8
+    vDi:i+7 <- ((vA)i:i+7 +int (vB)i:i+7 +int 1) >> 1
+  end
+  */
 
   CHECK_VXU;
 
-  const auto sh = VRi(rb).bytes[15] & 0x7;
-  const auto rsh = 8 - sh;
+  VRi(vd) = VXU::AvgS8(VRi(va), VRi(vb));
+}
+
+// Vector Average Signed Halfword (x'1000 0542')
+void PPCInterpreter::PPCInterpreter_vavgsh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    vDi:i+15 <- ((vA)i:i+15 +int (vB)i:i+15 +int 1) >> 1
+  end
+  */
+
+  CHECK_VXU;
 
-  VRi(rd).bytes[15] = VRi(ra).bytes[15] >> sh | (VRi(rd).bytes[14] << rsh);
-  VRi(rd).bytes[14] = VRi(ra).bytes[14] >> sh | (VRi(rd).bytes[13] << rsh);
-  VRi(rd).bytes[13] = VRi(ra).bytes[13] >> sh | (VRi(rd).bytes[12] << rsh);
-  VRi(rd).bytes[12] = VRi(ra).bytes[12] >> sh | (VRi(rd).bytes[11] << rsh);
-  VRi(rd).bytes[11] = VRi(ra).bytes[11] >> sh | (VRi(rd).bytes[10] << rsh);
-  VRi(rd).bytes[10] = VRi(ra).bytes[10] >> sh | (VRi(rd).bytes[9] << rsh);
-  VRi(rd).bytes[9] = VRi(ra).bytes[9] >> sh | (VRi(rd).bytes[8] << rsh);
-  VRi(rd).bytes[8] = VRi(ra).bytes[8] >> sh | (VRi(rd).bytes[7] << rsh);
-  VRi(rd).bytes[7] = VRi(ra).bytes[7] >> sh | (VRi(rd).bytes[6] << rsh);
-  VRi(rd).bytes[6] = VRi(ra).bytes[6] >> sh | (VRi(rd).bytes[5] << rsh);
-  VRi(rd).bytes[5] = VRi(ra).bytes[5] >> sh | (VRi(rd).bytes[4] << rsh);
-  VRi(rd).bytes[4] = VRi(ra).bytes[4] >> sh | (VRi(rd).bytes[3] << rsh);
-  VRi(rd).bytes[3] = VRi(ra).bytes[3] >> sh | (VRi(rd).bytes[2] << rsh);
-  VRi(rd).bytes[2] = VRi(ra).bytes[2] >> sh | (VRi(rd).bytes[1] << rsh);
-  VRi(rd).bytes[1] = VRi(ra).bytes[1] >> sh | (VRi(rd).bytes[0] << rsh);
-  VRi(rd).bytes[0] = VRi(ra).bytes[0] >> sh;
+  VRi(vd) = VXU::AvgS16(VRi(va), VRi(vb));
 }
 
-// Vector Shift Right Word (x'1000 0284')
-void PPCInterpreter::PPCInterpreter_vsrw(PPU_STATE* ppuState) {
+// Vector Average Signed Word (x'1000 0582')
+void PPCInterpreter::PPCInterpreter_vavgsw(PPU_STATE *ppuState) {
   /*
   do i=0 to 127 by 32
-    sh <- (vB)i+(27):i+31
-    vD[i:i+31] <- (vA)[i:i+31] >> ui sh
+    vDi:i+31 <- ((vA)i:i+31 +int (vB)i:i+31 +int 1) >> 1
   end
   */
 
   CHECK_VXU;
 
-  VRi(rd).dword[0] = VRi(ra).dword[0] >> (VRi(rb).dword[0] & 31);
-  VRi(rd).dword[1] = VRi(ra).dword[1] >> (VRi(rb).dword[1] & 31);
-  VRi(rd).dword[2] = VRi(ra).dword[2] >> (VRi(rb).dword[2] & 31);
-  VRi(rd).dword[3] = VRi(ra).dword[3] >> (VRi(rb).dword[3] & 31);
+  VRi(vd) = VXU::AvgS32(VRi(va), VRi(vb));
 }
 
-static inline u8 vsldoiHelper(u8 sh, Base::Vector128 vra, Base::Vector128 vrb) {
-  return (sh < 16) ? vra.bytes[sh] : vrb.bytes[sh & 0xF];
+// Vector Maximum Unsigned Byte (x'1000 0002')
+void PPCInterpreter::PPCInterpreter_vmaxub(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 8
+    if (vA)i:i+7 >ui (vB)i:i+7 then vDi:i+7 <- (vA)i:i+7
+    else vDi:i+7 <- (vB)i:i+7
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MaxU8(VRi(va), VRi(vb));
 }
 
-#if defined(ARCH_X86_64)
-#ifdef __GNUC__
-__attribute__((target("ssse3")))
-#endif
-__m128i vsldoi_sse(__m128i va, __m128i vb, u8 shb) {
-  __m128i result = _mm_setzero_si128();
-  switch (shb) {
-#undef CASE
-#define CASE(i) case i: result = _mm_or_si128(_mm_srli_si128(va, i), _mm_slli_si128(vb, 16 - i)); break
-    CASE(0);
-    CASE(1);
-    CASE(2);
-    CASE(3);
-    CASE(4);
-    CASE(5);
-    CASE(6);
-    CASE(7);
-    CASE(8);
-    CASE(9);
-    CASE(10);
-    CASE(11);
-    CASE(12);
-    CASE(13);
-    CASE(14);
-    CASE(15);
-#undef CASE
-  }
-  return result;
+// Vector Maximum Unsigned Halfword (x'1000 0042')
+void PPCInterpreter::PPCInterpreter_vmaxuh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    if (vA)i:i+15 >ui (vB)i:i+15 then vDi:i+15 <- (vA)i:i+15
+    else vDi:i+15 <- (vB)i:i+15
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::kernels.maxU16(VRi(va), VRi(vb));
 }
 
-#ifdef __GNUC__
-__attribute__((target("ssse3")))
-#endif
-inline __m128i byteswap_be_u32x4_ssse3(__m128i x) {
-  // Reverses bytes in each 32-bit word using SSSE3 shuffle_epi8
-  const __m128i shuffle = _mm_set_epi8(
-    12, 13, 14, 15,
-    8, 9, 10, 11,
-    4, 5, 6, 7,
-    0, 1, 2, 3
-  );
-  return _mm_shuffle_epi8(x, shuffle);
+// Vector Maximum Unsigned Word (x'1000 0082')
+void PPCInterpreter::PPCInterpreter_vmaxuw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    if (vA)i:i+31 >ui (vB)i:i+31 then vDi:i+31 <- (vA)i:i+31
+    else vDi:i+31 <- (vB)i:i+31
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::kernels.maxU32(VRi(va), VRi(vb));
 }
-#endif
 
-// Vector Shift Left Double by Octet Immediate (x'1000 002C')
-void PPCInterpreter::PPCInterpreter_vsldoi(PPU_STATE *ppuState) {
+// Vector Maximum Signed Byte (x'1000 0102')
+void PPCInterpreter::PPCInterpreter_vmaxsb(PPU_STATE *ppuState) {
   /*
-  vD <- ((vA) || (vB)) << ui (SHB || 0b000)
+  do i=0 to 127 by 8
+    if (vA)i:i+7 >si (vB)i:i+7 then vDi:i+7 <- (vA)i:i+7
+    else vDi:i+7 <- (vB)i:i+7
+  end
   */
 
   CHECK_VXU;
 
-  const u8 sh = _instr.vsh;
-  // No shift
-  if (sh == 0) {
-    VRi(vd) = VRi(va);
-    return;
-  } else if (sh == 16) {
-    // Don't touch VA
-    VRi(vd) = VRi(vb);
-    return;
-  }
+  VRi(vd) = VXU::kernels.maxS8(VRi(va), VRi(vb));
+}
 
-#if defined(ARCH_X86_64)
-  __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(VRi(va).bytes.data()));
-  __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(VRi(vb).bytes.data()));
-  __m128i vd_sse = vsldoi_sse(va, vb, sh);
-
-  // Store raw result before byte swap
-  _mm_storeu_si128(reinterpret_cast<__m128i*>(VRi(vd).bytes.data()), vd_sse);
-  // Swap
-  __m128i result = _mm_loadu_si128(reinterpret_cast<__m128i*>(VRi(vd).bytes.data()));
-  result = byteswap_be_u32x4_ssse3(vd_sse);
-  _mm_storeu_si128(reinterpret_cast<__m128i*>(VRi(vd).bytes.data()), result);
-#else
-  // TODO: Ugly, super slow, fix.
-
-  VRi(va).dword[0] = byteswap_be<u32>(VRi(va).dword[0]);
-  VRi(va).dword[1] = byteswap_be<u32>(VRi(va).dword[1]);
-  VRi(va).dword[2] = byteswap_be<u32>(VRi(va).dword[2]);
-  VRi(va).dword[3] = byteswap_be<u32>(VRi(va).dword[3]);
-
-  VRi(vb).dword[0] = byteswap_be<u32>(VRi(vb).dword[0]);
-  VRi(vb).dword[1] = byteswap_be<u32>(VRi(vb).dword[1]);
-  VRi(vb).dword[2] = byteswap_be<u32>(VRi(vb).dword[2]);
-  VRi(vb).dword[3] = byteswap_be<u32>(VRi(vb).dword[3]);
-
-  for (u8 idx = 0; idx < 16; idx++) {
-    VRi(vd).bytes[idx] = vsldoiHelper(sh + idx, VRi(va), VRi(vb));
-  }
+// Vector Maximum Signed Halfword (x'1000 0142')
+void PPCInterpreter::PPCInterpreter_vmaxsh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    if (vA)i:i+15 >si (vB)i:i+15 then vDi:i+15 <- (vA)i:i+15
+    else vDi:i+15 <- (vB)i:i+15
+  end
+  */
+
+  CHECK_VXU;
 
-  VRi(vd).dword[0] = byteswap_be<u32>(VRi(vd).dword[0]);
-  VRi(vd).dword[1] = byteswap_be<u32>(VRi(vd).dword[1]);
-  VRi(vd).dword[2] = byteswap_be<u32>(VRi(vd).dword[2]);
-  VRi(vd).dword[3] = byteswap_be<u32>(VRi(vd).dword[3]);
-#endif
+  VRi(vd) = VXU::MaxS16(VRi(va), VRi(vb));
 }
 
-// Vector Splat Byte (x'1000 020C')
-void PPCInterpreter::PPCInterpreter_vspltb(PPU_STATE *ppuState) {
+// Vector Maximum Signed Word (x'1000 0182')
+void PPCInterpreter::PPCInterpreter_vmaxsw(PPU_STATE *ppuState) {
   /*
-   b <- UIMM*8
-  do i=0 to 127 by 8
-  (vD)i:i+7 <- (vB)b:b+7
+  do i=0 to 127 by 32
+    if (vA)i:i+31 >si (vB)i:i+31 then vDi:i+31 <- (vA)i:i+31
+    else vDi:i+31 <- (vB)i:i+31
   end
   */
 
   CHECK_VXU;
 
-  // Need to byteswap becuase of byte endianness.
-  Base::Vector128 vec = VRi(vb);
-  vec.dword[0] = byteswap_be<u32>(vec.dword[0]);
-  vec.dword[1] = byteswap_be<u32>(vec.dword[1]);
-  vec.dword[2] = byteswap_be<u32>(vec.dword[2]);
-  vec.dword[3] = byteswap_be<u32>(vec.dword[3]);
+  VRi(vd) = VXU::kernels.maxS32(VRi(va), VRi(vb));
+}
+
+// Vector Minimum Unsigned Byte (x'1000 0202')
+void PPCInterpreter::PPCInterpreter_vminub(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 8
+    if (vA)i:i+7 <ui (vB)i:i+7 then vDi:i+7 <- (vA)i:i+7
+    else vDi:i+7 <- (vB)i:i+7
+  end
+  */
 
-  const u8 uimm = _instr.vuimm;
+  CHECK_VXU;
 
-  for (u8 idx = 0; idx < 16; idx++) {
-    VRi(vd).bytes[idx] = vec.bytes[uimm];
-  }
+  VRi(vd) = VXU::MinU8(VRi(va), VRi(vb));
 }
 
-// Vector Splat Immediate Signed Halfword (x'1000 034C')
-void PPCInterpreter::PPCInterpreter_vspltish(PPU_STATE *ppuState) {
+// Vector Minimum Unsigned Halfword (x'1000 0242')
+void PPCInterpreter::PPCInterpreter_vminuh(PPU_STATE *ppuState) {
   /*
   do i=0 to 127 by 16
-    (vD)i:i+15 <- SignExtend(SIMM,16)
+    if (vA)i:i+15 <ui (vB)i:i+15 then vDi:i+15 <- (vA)i:i+15
+    else vDi:i+15 <- (vB)i:i+15
   end
   */
 
   CHECK_VXU;
 
-  s32 simm = 0;
+  VRi(vd) = VXU::kernels.minU16(VRi(va), VRi(vb));
+}
+
+// Vector Minimum Unsigned Word (x'1000 0282')
+void PPCInterpreter::PPCInterpreter_vminuw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    if (vA)i:i+31 <ui (vB)i:i+31 then vDi:i+31 <- (vA)i:i+31
+    else vDi:i+31 <- (vB)i:i+31
+  end
+  */
 
-  if (_instr.vsimm) { simm = ((_instr.vsimm & 0x10) ? (_instr.vsimm | 0xFFFFFFF0) : _instr.vsimm); }
+  CHECK_VXU;
 
-  for (u8 idx = 0; idx < 8; idx++) {
-    VRi(vd).sword[idx] = static_cast<s16>(simm);
-  }
+  VRi(vd) = VXU::kernels.minU32(VRi(va), VRi(vb));
 }
 
-// Vector Splat Immediate Signed Word (x'1000 038C)
-void PPCInterpreter::PPCInterpreter_vspltisw(PPU_STATE *ppuState) {
+// Vector Minimum Signed Byte (x'1000 0302')
+void PPCInterpreter::PPCInterpreter_vminsb(PPU_STATE *ppuState) {
   /*
-  do i=0 to 127 by 32
-    vDi:i+31 <- SignExtend(SIMM,32)
+  do i=0 to 127 by 8
+    if (vA)i:i+7 <si (vB)i:i+7 then vDi:i+7 <- (vA)i:i+7
+    else vDi:i+7 <- (vB)i:i+7
   end
   */
-  
+
   CHECK_VXU;
 
-  s32 simm = 0;
+  VRi(vd) = VXU::kernels.minS8(VRi(va), VRi(vb));
+}
+
+// Vector Minimum Signed Halfword (x'1000 0342')
+void PPCInterpreter::PPCInterpreter_vminsh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    if (vA)i:i+15 <si (vB)i:i+15 then vDi:i+15 <- (vA)i:i+15
+    else vDi:i+15 <- (vB)i:i+15
+  end
+  */
 
-  if (_instr.vsimm) { simm = ((_instr.vsimm & 0x10) ? (_instr.vsimm | 0xFFFFFFF0) : _instr.vsimm); }
+  CHECK_VXU;
 
-  for (u8 idx = 0; idx < 4; idx++) {
-    VRi(vd).dsword[idx] = simm;
-  }
+  VRi(vd) = VXU::MinS16(VRi(va), VRi(vb));
 }
 
-// Vector Splat Immediate Signed Byte (x'1000 030C')
-void PPCInterpreter::PPCInterpreter_vspltisb(PPU_STATE *ppuState) {
+// Vector Minimum Signed Word (x'1000 0382')
+void PPCInterpreter::PPCInterpreter_vminsw(PPU_STATE *ppuState) {
   /*
-   do i = 0 to 127 by 8
-   vDi:i+7 <- SignExtend(SIMM,8)
-   end
+  do i=0 to 127 by 32
+    if (vA)i:i+31 <si (vB)i:i+31 then vDi:i+31 <- (vA)i:i+31
+    else vDi:i+31 <- (vB)i:i+31
+  end
   */
 
   CHECK_VXU;
 
-  s32 simm = 0;
+  VRi(vd) = VXU::kernels.minS32(VRi(va), VRi(vb));
+}
+
+// Vector Multiply Even Unsigned Byte (x'1000 0208')
+void PPCInterpreter::PPCInterpreter_vmuleub(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    vDi:i+15 <- (vA)i:i+7 *ui (vB)i:i+7
+  end
+  */
 
-  if (_instr.vsimm) { simm = ((_instr.vsimm & 0x10) ? (_instr.vsimm | 0xFFFFFFF0) : _instr.vsimm); }
+  CHECK_VXU;
 
-  for (u8 idx = 0; idx < 16; idx++) {
-    VRi(vd).bytes[idx] = static_cast<s8>(simm);
-  }
+  VRi(vd) = VXU::MulEvenU8(VRi(va), VRi(vb));
 }
 
-// Vector128 Splat Immediate Signed Word
-void PPCInterpreter::PPCInterpreter_vspltisw128(PPU_STATE *ppuState) {
+// Vector Multiply Even Unsigned Halfword (x'1000 0248')
+void PPCInterpreter::PPCInterpreter_vmuleuh(PPU_STATE *ppuState) {
   /*
-  (VRD.xyzw) <- sign_extend(uimm)
+  do i=0 to 127 by 32
+    vDi:i+31 <- (vA)i:i+15 *ui (vB)i:i+15
+  end
   */
 
   CHECK_VXU;
 
-  s32 simm = 0;
+  VRi(vd) = VXU::MulEvenU16(VRi(va), VRi(vb));
+}
 
-  if (VMX128_3_IMM) {
-    simm = ((VMX128_3_IMM & 0x10) ? (VMX128_3_IMM | 0xFFFFFFF0) : VMX128_3_IMM);
-  }
+// Vector Multiply Even Signed Byte (x'1000 0308')
+void PPCInterpreter::PPCInterpreter_vmulesb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    vDi:i+15 <- (vA)i:i+7 *si (vB)i:i+7
+  end
+  */
 
-  for (u8 idx = 0; idx < 4; idx++) {
-    VR(VMX128_3_VD128).dsword[idx] = simm;
-  }
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MulEvenS8(VRi(va), VRi(vb));
 }
 
-// Vector Logical XOR (x'1000 04C4')
-void PPCInterpreter::PPCInterpreter_vxor(PPU_STATE *ppuState) {
+// Vector Multiply Even Signed Halfword (x'1000 0348')
+void PPCInterpreter::PPCInterpreter_vmulesh(PPU_STATE *ppuState) {
   /*
-  vD <- (vA) ^ (vB)
+  do i=0 to 127 by 32
+    vDi:i+31 <- (vA)i:i+15 *si (vB)i:i+15
+  end
   */
 
   CHECK_VXU;
 
-  VRi(vd).dword[0] = VRi(va).dword[0] ^ VRi(vb).dword[0];
-  VRi(vd).dword[1] = VRi(va).dword[1] ^ VRi(vb).dword[1];
-  VRi(vd).dword[2] = VRi(va).dword[2] ^ VRi(vb).dword[2];
-  VRi(vd).dword[3] = VRi(va).dword[3] ^ VRi(vb).dword[3];
+  VRi(vd) = VXU::MulEvenS16(VRi(va), VRi(vb));
+}
+
+// Vector Multiply Odd Unsigned Byte (x'1000 0008')
+void PPCInterpreter::PPCInterpreter_vmuloub(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    vDi:i+15 <- (vA)i+8:i+15 *ui (vB)i+8:i+15
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MulOddU8(VRi(va), VRi(vb));
+}
+
+// Vector Multiply Odd Unsigned Halfword (x'1000 0048')
+void PPCInterpreter::PPCInterpreter_vmulouh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- (vA)i+16:i+31 *ui (vB)i+16:i+31
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MulOddU16(VRi(va), VRi(vb));
+}
+
+// Vector Multiply Odd Signed Byte (x'1000 0108')
+void PPCInterpreter::PPCInterpreter_vmulosb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    vDi:i+15 <- (vA)i+8:i+15 *si (vB)i+8:i+15
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MulOddS8(VRi(va), VRi(vb));
+}
+
+// Vector Multiply Odd Signed Halfword (x'1000 0148')
+void PPCInterpreter::PPCInterpreter_vmulosh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- (vA)i+16:i+31 *si (vB)i+16:i+31
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MulOddS16(VRi(va), VRi(vb));
+}
+
+// Vector Multiply-High and Add Signed Halfword Saturate (x'1000 0020')
+void PPCInterpreter::PPCInterpreter_vmhaddshs(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    prod <- (vA)i:i+15 *si (vB)i:i+15
+    vDi:i+15 <- SClamp(prod0:16 +int (vC)i:i+15)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::MultiplyHighAddSatS16(VRi(va), VRi(vb), VRi(vc), false, sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Multiply-High Round and Add Signed Halfword Saturate (x'1000 0021')
+void PPCInterpreter::PPCInterpreter_vmhraddshs(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    prod <- (vA)i:i+15 *si (vB)i:i+15 +int 0x0000_4000
+    vDi:i+15 <- SClamp(prod0:16 +int (vC)i:i+15)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::MultiplyHighAddSatS16(VRi(va), VRi(vb), VRi(vc), true, sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Multiply-Low and Add Unsigned Halfword Modulo (x'1000 0022')
+void PPCInterpreter::PPCInterpreter_vmladduhm(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    vDi:i+15 <- ((vA)i:i+15 *ui (vB)i:i+15)16:31 +int (vC)i:i+15
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MultiplyLowAddU16(VRi(va), VRi(vb), VRi(vc));
+}
+
+// Vector Multiply-Sum Unsigned Byte Modulo (x'1000 0024')
+void PPCInterpreter::PPCInterpreter_vmsumubm(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- (vC)i:i+31 +int sum of the four (vA)j:j+7 *ui (vB)j:j+7 in word i
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MultiplySumU8(VRi(va), VRi(vb), VRi(vc));
+}
+
+// Vector Multiply-Sum Mixed-Sign Byte Modulo (x'1000 0025')
+void PPCInterpreter::PPCInterpreter_vmsummbm(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- (vC)i:i+31 +int sum of the four (vA)j:j+7 *si (vB)j:j+7 in word i
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MultiplySumMixedS8(VRi(va), VRi(vb), VRi(vc));
+}
+
+// Vector Multiply-Sum Unsigned Halfword Modulo (x'1000 0026')
+void PPCInterpreter::PPCInterpreter_vmsumuhm(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- (vC)i:i+31 +int sum of the two (vA)j:j+15 *ui (vB)j:j+15 in word i
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MultiplySumU16(VRi(va), VRi(vb), VRi(vc));
+}
+
+// Vector Multiply-Sum Unsigned Halfword Saturate (x'1000 0027')
+void PPCInterpreter::PPCInterpreter_vmsumuhs(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- UClamp((vC)i:i+31 +int sum of the two (vA)j:j+15 *ui (vB)j:j+15 in word i)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::MultiplySumSatU16(VRi(va), VRi(vb), VRi(vc), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Multiply-Sum Signed Halfword Modulo (x'1000 0028')
+void PPCInterpreter::PPCInterpreter_vmsumshm(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- (vC)i:i+31 +int sum of the two (vA)j:j+15 *si (vB)j:j+15 in word i
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MultiplySumS16(VRi(va), VRi(vb), VRi(vc));
+}
+
+// Vector Multiply-Sum Signed Halfword Saturate (x'1000 0029')
+void PPCInterpreter::PPCInterpreter_vmsumshs(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- SClamp((vC)i:i+31 +int sum of the two (vA)j:j+15 *si (vB)j:j+15 in word i)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::MultiplySumSatS16(VRi(va), VRi(vb), VRi(vc), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Sum Across Partial (1/4) Unsigned Byte Saturate (x'1000 0608')
+void PPCInterpreter::PPCInterpreter_vsum4ubs(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- UClamp((vB)i:i+31 +int sum of the four bytes of (vA)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::Sum4SatU8(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Sum Across Partial (1/4) Signed Byte Saturate (x'1000 0708')
+void PPCInterpreter::PPCInterpreter_vsum4sbs(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- SClamp((vB)i:i+31 +int sum of the four bytes of (vA)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::Sum4SatS8(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Sum Across Partial (1/4) Signed Halfword Saturate (x'1000 0648')
+void PPCInterpreter::PPCInterpreter_vsum4shs(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- SClamp((vB)i:i+31 +int sum of the two halfwords of (vA)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::Sum4SatS16(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Sum Across Partial (1/2) Signed Word Saturate (x'1000 0688')
+void PPCInterpreter::PPCInterpreter_vsum2sws(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 64
+    vDi:i+31 <- 0
+    vDi+32:i+63 <- SClamp((vA)i:i+31 +int (vA)i+32:i+63 +int (vB)i+32:i+63)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::SumAcross2S32(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Sum Across Signed Word Saturate (x'1000 0788')
+void PPCInterpreter::PPCInterpreter_vsumsws(PPU_STATE *ppuState) {
+  /*
+  vD0:95 <- 0
+  vD96:127 <- SClamp((vA)0:31 +int (vA)32:63 +int (vA)64:95 +int (vA)96:127 +int (vB)96:127)
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::SumAcrossS32(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Logical AND (x'1000 0404')
+void PPCInterpreter::PPCInterpreter_vand(PPU_STATE *ppuState) {
+  /*
+  vD <- (vA) & (vB)
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::And(VRi(va), VRi(vb));
+}
+
+// Vector Logical AND with Complement (x'1000 0444')
+void PPCInterpreter::PPCInterpreter_vandc(PPU_STATE *ppuState) {
+  /*
+  vD <- (vA) & ~(vB)
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::AndC(VRi(va), VRi(vb));
+}
+
+// Vector Logical OR (x'1000 0484')
+void PPCInterpreter::PPCInterpreter_vor(PPU_STATE *ppuState) {
+  /*
+  vD <- (vA) | (vB)
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::Or(VRi(va), VRi(vb));
+}
+
+// Vector Logical NOR (x'1000 0504')
+void PPCInterpreter::PPCInterpreter_vnor(PPU_STATE *ppuState) {
+  /*
+  vD <- ~((vA) | (vB))
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::Nor(VRi(va), VRi(vb));
+}
+
+// Vector Logical XOR (x'1000 04C4')
+void PPCInterpreter::PPCInterpreter_vxor(PPU_STATE *ppuState) {
+  /*
+  vD <- (vA) ^ (vB)
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::Xor(VRi(va), VRi(vb));
+}
+
+// Vector Select (x'1000 002A')
+void PPCInterpreter::PPCInterpreter_vsel(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127
+    if (vC)i = 0 then vDi <- (vA)i
+    else vDi <- (vB)i
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::SelectBits(VRi(va), VRi(vb), VRi(vc));
+}
+
+// Vector Compare Equal-to Unsigned Byte (x'1000 0006')
+void PPCInterpreter::PPCInterpreter_vcmpequb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 8
+    if (vA)i:i+7 =int (vB)i:i+7 then vDi:i+7 <- 1s
+    else vDi:i+7 <- 0s
+  end
+  if Rc = 1 then CR6 <- all_true || 0b0 || all_false || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::CmpEqU8(VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuCompareCR6(ppuState, VRi(vd));
+}
+
+// Vector Compare Equal-to Unsigned Halfword (x'1000 0046')
+void PPCInterpreter::PPCInterpreter_vcmpequh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    if (vA)i:i+15 =int (vB)i:i+15 then vDi:i+15 <- 1s
+    else vDi:i+15 <- 0s
+  end
+  if Rc = 1 then CR6 <- all_true || 0b0 || all_false || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::CmpEqU16(VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuCompareCR6(ppuState, VRi(vd));
+}
+
+// Vector Compare Equal-to Unsigned Word (x'1000 0086')
+void PPCInterpreter::PPCInterpreter_vcmpequw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    if (vA)i:i+31 =int (vB)i:i+31 then vDi:i+31 <- 1s
+    else vDi:i+31 <- 0s
+  end
+  if Rc = 1 then CR6 <- all_true || 0b0 || all_false || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::CmpEqU32(VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuCompareCR6(ppuState, VRi(vd));
+}
+
+// Vector Compare Greater-Than Unsigned Byte (x'1000 0206')
+void PPCInterpreter::PPCInterpreter_vcmpgtub(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 8
+    if (vA)i:i+7 >ui (vB)i:i+7 then vDi:i+7 <- 1s
+    else vDi:i+7 <- 0s
+  end
+  if Rc = 1 then CR6 <- all_true || 0b0 || all_false || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::CmpGtU8(VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuCompareCR6(ppuState, VRi(vd));
+}
+
+// Vector Compare Greater-Than Unsigned Halfword (x'1000 0246')
+void PPCInterpreter::PPCInterpreter_vcmpgtuh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    if (vA)i:i+15 >ui (vB)i:i+15 then vDi:i+15 <- 1s
+    else vDi:i+15 <- 0s
+  end
+  if Rc = 1 then CR6 <- all_true || 0b0 || all_false || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::CmpGtU16(VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuCompareCR6(ppuState, VRi(vd));
+}
+
+// Vector Compare Greater-Than Unsigned Word (x'1000 0286')
+void PPCInterpreter::PPCInterpreter_vcmpgtuw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    if (vA)i:i+31 >ui (vB)i:i+31 then vDi:i+31 <- 1s
+    else vDi:i+31 <- 0s
+  end
+  if Rc = 1 then CR6 <- all_true || 0b0 || all_false || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::CmpGtU32(VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuCompareCR6(ppuState, VRi(vd));
+}
+
+// Vector Compare Greater-Than Signed Byte (x'1000 0306')
+void PPCInterpreter::PPCInterpreter_vcmpgtsb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 8
+    if (vA)i:i+7 >si (vB)i:i+7 then vDi:i+7 <- 1s
+    else vDi:i+7 <- 0s
+  end
+  if Rc = 1 then CR6 <- all_true || 0b0 || all_false || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::CmpGtS8(VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuCompareCR6(ppuState, VRi(vd));
+}
+
+// Vector Compare Greater-Than Signed Halfword (x'1000 0346')
+void PPCInterpreter::PPCInterpreter_vcmpgtsh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    if (vA)i:i+15 >si (vB)i:i+15 then vDi:i+15 <- 1s
+    else vDi:i+15 <- 0s
+  end
+  if Rc = 1 then CR6 <- all_true || 0b0 || all_false || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::CmpGtS16(VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuCompareCR6(ppuState, VRi(vd));
+}
+
+// Vector Compare Greater-Than Signed Word (x'1000 0386')
+void PPCInterpreter::PPCInterpreter_vcmpgtsw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    if (vA)i:i+31 >si (vB)i:i+31 then vDi:i+31 <- 1s
+    else vDi:i+31 <- 0s
+  end
+  if Rc = 1 then CR6 <- all_true || 0b0 || all_false || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::CmpGtS32(VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuCompareCR6(ppuState, VRi(vd));
+}
+
+// Vector Compare Equal-to Floating Point (x'1000 00C6')
+void PPCInterpreter::PPCInterpreter_vcmpeqfp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    if (vA)i:i+31 =fp (vB)i:i+31 then vDi:i+31 <- 1s
+    else vDi:i+31 <- 0s
+  end
+  if Rc = 1 then CR6 <- all_true || 0b0 || all_false || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::CmpEqF, VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuCompareCR6(ppuState, VRi(vd));
+}
+
+// Vector Compare Greater-Than-or-Equal-to Floating Point (x'1000 01C6')
+void PPCInterpreter::PPCInterpreter_vcmpgefp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    if (vA)i:i+31 >=fp (vB)i:i+31 then vDi:i+31 <- 1s
+    else vDi:i+31 <- 0s
+  end
+  if Rc = 1 then CR6 <- all_true || 0b0 || all_false || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::CmpGeF, VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuCompareCR6(ppuState, VRi(vd));
+}
+
+// Vector Compare Greater-Than Floating Point (x'1000 02C6')
+void PPCInterpreter::PPCInterpreter_vcmpgtfp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    if (vA)i:i+31 >fp (vB)i:i+31 then vDi:i+31 <- 1s
+    else vDi:i+31 <- 0s
+  end
+  if Rc = 1 then CR6 <- all_true || 0b0 || all_false || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::CmpGtF, VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuCompareCR6(ppuState, VRi(vd));
+}
+
+// Vector Compare Bounds Floating Point (x'1000 03C6')
+void PPCInterpreter::PPCInterpreter_vcmpbfp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    le <- (vA)i:i+31 <=fp (vB)i:i+31
+    ge <- (vA)i:i+31 >=fp -(vB)i:i+31
+    vDi:i+31 <- ~le || ~ge || 0b00_0000_0000_0000_0000_0000_0000_0000
+  end
+  if Rc = 1 then CR6 <- 0b00 || all_in_bounds || 0b0
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::CmpBoundsF, VRi(va), VRi(vb));
+  if (_instr.vrc)
+    vxuBoundsCR6(ppuState, VRi(vd));
+}
+
+// Vector Add Floating Point (x'1000 000A')
+void PPCInterpreter::PPCInterpreter_vaddfp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- RndToNearFP32((vA)i:i+31 +fp (vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::AddF, VRi(va), VRi(vb));
+}
+
+// Vector Subtract Floating Point (x'1000 004A')
+void PPCInterpreter::PPCInterpreter_vsubfp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- RndToNearFP32((vA)i:i+31 -fp (vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::SubF, VRi(va), VRi(vb));
+}
+
+// Vector Multiply Add Floating Point (x'1000 002E')
+void PPCInterpreter::PPCInterpreter_vmaddfp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- RndToNearFP32(((vA)i:i+31 *fp (vC)i:i+31) +fp (vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::kernels.multiplyAdd, VRi(va), VRi(vc), VRi(vb));
+}
+
+// Vector Negative Multiply-Subtract Floating Point (x'1000 002F')
+void PPCInterpreter::PPCInterpreter_vnmsubfp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- -RndToNearFP32(((vA)i:i+31 *fp (vC)i:i+31) -fp (vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::kernels.negMultiplySub, VRi(va), VRi(vc), VRi(vb));
+}
+
+// Vector Maximum Floating Point (x'1000 040A')
+void PPCInterpreter::PPCInterpreter_vmaxfp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    if (vA)i:i+31 >fp (vB)i:i+31 then vDi:i+31 <- (vA)i:i+31
+    else vDi:i+31 <- (vB)i:i+31
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::MaxF, VRi(va), VRi(vb));
+}
+
+// Vector Minimum Floating Point (x'1000 044A')
+void PPCInterpreter::PPCInterpreter_vminfp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    if (vA)i:i+31 <fp (vB)i:i+31 then vDi:i+31 <- (vA)i:i+31
+    else vDi:i+31 <- (vB)i:i+31
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::MinF, VRi(va), VRi(vb));
+}
+
+// Vector Reciprocal Estimate Floating Point (x'1000 010A')
+void PPCInterpreter::PPCInterpreter_vrefp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- RecipEstimate((vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::ReciprocalEstimate, VRi(vb));
+}
+
+// Vector Reciprocal Square Root Estimate Floating Point (x'1000 014A')
+void PPCInterpreter::PPCInterpreter_vrsqrtefp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- RecipSqrtEstimate((vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::ReciprocalSqrtEstimate, VRi(vb));
+}
+
+// Vector 2 Raised to the Exponent Estimate Floating Point (x'1000 018A')
+void PPCInterpreter::PPCInterpreter_vexptefp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- Power2Estimate((vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::Exp2Estimate, VRi(vb));
+}
+
+// Vector Log2 Estimate Floating Point (x'1000 01CA')
+void PPCInterpreter::PPCInterpreter_vlogefp(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- Log2Estimate((vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::Log2Estimate, VRi(vb));
+}
+
+// Vector Round to Floating-Point Integer Nearest (x'1000 020A')
+void PPCInterpreter::PPCInterpreter_vrfin(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- RoundToNearest((vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::kernels.roundNearest, VRi(vb));
+}
+
+// Vector Round to Floating-Point Integer toward Zero (x'1000 024A')
+void PPCInterpreter::PPCInterpreter_vrfiz(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- RoundTowardZero((vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::kernels.roundZero, VRi(vb));
+}
+
+// Vector Round to Floating-Point Integer toward Positive Infinity (x'1000 028A')
+void PPCInterpreter::PPCInterpreter_vrfip(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- Ceil((vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::kernels.roundUp, VRi(vb));
+}
+
+// Vector Round to Floating-Point Integer toward Minus Infinity (x'1000 02CA')
+void PPCInterpreter::PPCInterpreter_vrfim(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- Floor((vB)i:i+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = vxuFloat(ppuState, VXU::kernels.roundDown, VRi(vb));
+}
+
+// Vector Convert from Unsigned Fixed-Point Word (x'1000 030A')
+void PPCInterpreter::PPCInterpreter_vcfux(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- CnvtUI32ToFP32((vB)i:i+31) /fp 2^UIMM
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ConvertFromU32(VRi(vb), _instr.vuimm);
+}
+
+// Vector Convert from Signed Fixed-Point Word (x'1000 034A')
+void PPCInterpreter::PPCInterpreter_vcfsx(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- CnvtSI32ToFP32((vB)i:i+31) /fp 2^UIMM
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ConvertFromS32(VRi(vb), _instr.vuimm);
+}
+
+// Vector Convert to Unsigned Fixed-Point Word Saturate (x'1000 038A')
+void PPCInterpreter::PPCInterpreter_vctuxs(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- CnvtFP32ToUI32Sat((vB)i:i+31 *fp 2^UIMM)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::ConvertToU32Sat(VRi(vb), _instr.vuimm, sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Convert to Signed Fixed-Point Word Saturate (x'1000 03CA')
+void PPCInterpreter::PPCInterpreter_vctsxs(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- CnvtFP32ToSI32Sat((vB)i:i+31 *fp 2^UIMM)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::ConvertToS32Sat(VRi(vb), _instr.vuimm, sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Merge High Byte (x'1000 000C')
+void PPCInterpreter::PPCInterpreter_vmrghb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 8
+    vDi*2:(i*2)+15 <- (vA)i:i+7 || (vB)i:i+7
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MergeHighU8(VRi(va), VRi(vb));
+}
+
+// Vector Merge High Halfword (x'1000 004C')
+void PPCInterpreter::PPCInterpreter_vmrghh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 16
+    vDi*2:(i*2)+31 <- (vA)i:i+15 || (vB)i:i+15
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MergeHighU16(VRi(va), VRi(vb));
+}
+
+// Vector Merge High Word (x'1000 008C')
+void PPCInterpreter::PPCInterpreter_vmrghw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 32
+    vDi*2:(i*2)+63 <- (vA)i:i+31 || (vB)i:i+31
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MergeHighU32(VRi(va), VRi(vb));
+}
+
+// Vector Merge Low Byte (x'1000 010C')
+void PPCInterpreter::PPCInterpreter_vmrglb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 8
+    vDi*2:(i*2)+15 <- (vA)i+64:i+71 || (vB)i+64:i+71
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MergeLowU8(VRi(va), VRi(vb));
+}
+
+// Vector Merge Low Halfword (x'1000 014C')
+void PPCInterpreter::PPCInterpreter_vmrglh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 16
+    vDi*2:(i*2)+31 <- (vA)i+64:i+79 || (vB)i+64:i+79
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MergeLowU16(VRi(va), VRi(vb));
+}
+
+// Vector Merge Low Word (x'1000 018C')
+void PPCInterpreter::PPCInterpreter_vmrglw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 32
+    vDi*2:(i*2)+63 <- (vA)i+64:i+95 || (vB)i+64:i+95
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::MergeLowU32(VRi(va), VRi(vb));
+}
+
+// Vector Pack Unsigned Halfword Unsigned Modulo (x'1000 000E')
+void PPCInterpreter::PPCInterpreter_vpkuhum(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 8
+    vDi:i+7 <- (vA)(i*2)+8:(i*2)+15
+    vDi+64:i+71 <- (vB)(i*2)+8:(i*2)+15
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::PackU16Mod(VRi(va), VRi(vb));
+}
+
+// Vector Pack Unsigned Word Unsigned Modulo (x'1000 004E')
+void PPCInterpreter::PPCInterpreter_vpkuwum(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 16
+    vDi:i+15 <- (vA)(i*2)+16:(i*2)+31
+    vDi+64:i+79 <- (vB)(i*2)+16:(i*2)+31
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::PackU32Mod(VRi(va), VRi(vb));
+}
+
+// Vector Pack Unsigned Halfword Unsigned Saturate (x'1000 008E')
+void PPCInterpreter::PPCInterpreter_vpkuhus(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 8
+    vDi:i+7 <- UClamp((vA)i*2:(i*2)+15)
+    vDi+64:i+71 <- UClamp((vB)i*2:(i*2)+15)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::PackU16Sat(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Pack Unsigned Word Unsigned Saturate (x'1000 00CE')
+void PPCInterpreter::PPCInterpreter_vpkuwus(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 16
+    vDi:i+15 <- UClamp((vA)i*2:(i*2)+31)
+    vDi+64:i+79 <- UClamp((vB)i*2:(i*2)+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::kernels.packU32Sat(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Pack Signed Halfword Unsigned Saturate (x'1000 010E')
+void PPCInterpreter::PPCInterpreter_vpkshus(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 8
+    vDi:i+7 <- UClamp((vA)i*2:(i*2)+15)
+    vDi+64:i+71 <- UClamp((vB)i*2:(i*2)+15)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::PackS16SatU(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Pack Signed Word Unsigned Saturate (x'1000 014E')
+void PPCInterpreter::PPCInterpreter_vpkswus(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 16
+    vDi:i+15 <- UClamp((vA)i*2:(i*2)+31)
+    vDi+64:i+79 <- UClamp((vB)i*2:(i*2)+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::kernels.packS32SatU(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Pack Signed Halfword Signed Saturate (x'1000 018E')
+void PPCInterpreter::PPCInterpreter_vpkshss(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 8
+    vDi:i+7 <- SClamp((vA)i*2:(i*2)+15)
+    vDi+64:i+71 <- SClamp((vB)i*2:(i*2)+15)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::PackS16Sat(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Pack Signed Word Signed Saturate (x'1000 01CE')
+void PPCInterpreter::PPCInterpreter_vpkswss(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 16
+    vDi:i+15 <- SClamp((vA)i*2:(i*2)+31)
+    vDi+64:i+79 <- SClamp((vB)i*2:(i*2)+31)
+  end
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VRi(vd) = VXU::PackS32Sat(VRi(va), VRi(vb), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector Pack Pixel (x'1000 030E')
+void PPCInterpreter::PPCInterpreter_vpkpx(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 16
+    vDi:i+15 <- (vA)(i*2)+7 || (vA)(i*2)+8:(i*2)+12 || (vA)(i*2)+16:(i*2)+20 || (vA)(i*2)+24:(i*2)+28
+    vDi+64:i+79 <- same for (vB)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::PackPixel(VRi(va), VRi(vb));
+}
+
+// Vector Unpack High Signed Byte (x'1000 020E')
+void PPCInterpreter::PPCInterpreter_vupkhsb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 8
+    vDi*2:(i*2)+15 <- SignExtend((vB)i:i+7)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::UnpackHighS8(VRi(vb));
+}
+
+// Vector Unpack High Signed Halfword (x'1000 024E')
+void PPCInterpreter::PPCInterpreter_vupkhsh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 16
+    vDi*2:(i*2)+31 <- SignExtend((vB)i:i+15)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::UnpackHighS16(VRi(vb));
+}
+
+// Vector Unpack Low Signed Byte (x'1000 028E')
+void PPCInterpreter::PPCInterpreter_vupklsb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 8
+    vDi*2:(i*2)+15 <- SignExtend((vB)i+64:i+71)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::UnpackLowS8(VRi(vb));
+}
+
+// Vector Unpack Low Signed Halfword (x'1000 02CE')
+void PPCInterpreter::PPCInterpreter_vupklsh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 16
+    vDi*2:(i*2)+31 <- SignExtend((vB)i+64:i+79)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::UnpackLowS16(VRi(vb));
+}
+
+// Vector Unpack High Pixel (x'1000 034E')
+void PPCInterpreter::PPCInterpreter_vupkhpx(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 16
+    vDi*2:(i*2)+31 <- SignExtend((vB)i) || 0b000 || (vB)i+1:i+5 || 0b000 || (vB)i+6:i+10 || 0b000 || (vB)i+11:i+15
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::UnpackHighPixel(VRi(vb));
+}
+
+// Vector Unpack Low Pixel (x'1000 03CE')
+void PPCInterpreter::PPCInterpreter_vupklpx(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 63 by 16
+    vDi*2:(i*2)+31 <- SignExtend((vB)i+64) || 0b000 || (vB)i+65:i+69 || 0b000 || (vB)i+70:i+74 || 0b000 || (vB)i+75:i+79
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::UnpackLowPixel(VRi(vb));
+}
+
+// Vector Rotate Left Integer Byte (x'1000 0004')
+void PPCInterpreter::PPCInterpreter_vrlb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 8
+    sh <- (vB)i+5:i+7
+    vDi:i+7 <- ROTL((vA)i:i+7, sh)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::RotateU8(VRi(va), VRi(vb));
+}
+
+// Vector Rotate Left Integer Halfword (x'1000 0044')
+void PPCInterpreter::PPCInterpreter_vrlh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    sh <- (vB)i+12:i+15
+    vDi:i+15 <- ROTL((vA)i:i+15, sh)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::RotateU16(VRi(va), VRi(vb));
+}
+
+// Vector Rotate Left Integer Word (x'1000 0084')
+void PPCInterpreter::PPCInterpreter_vrlw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    sh <- (vB)i+27:i+31
+    vDi:i+31 <- ROTL((vA)i:i+31, sh)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::kernels.rotateU32(VRi(va), VRi(vb));
+}
+
+// Vector Shift Left Integer Byte (x'1000 0104')
+void PPCInterpreter::PPCInterpreter_vslb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 8
+    sh <- (vB)i+5:i+7
+    vDi:i+7 <- SHL((vA)i:i+7, sh)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ShiftLeftU8(VRi(va), VRi(vb));
+}
+
+// Vector Shift Left Integer Halfword (x'1000 0144')
+void PPCInterpreter::PPCInterpreter_vslh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    sh <- (vB)i+12:i+15
+    vDi:i+15 <- SHL((vA)i:i+15, sh)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ShiftLeftU16(VRi(va), VRi(vb));
+}
+
+// Vector Shift Left Integer Word (x'1000 0184')
+void PPCInterpreter::PPCInterpreter_vslw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    sh <- (vB)i+27:i+31
+    vDi:i+31 <- SHL((vA)i:i+31, sh)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::kernels.shiftLeftU32(VRi(va), VRi(vb));
+}
+
+// Vector Shift Right Integer Byte (x'1000 0204')
+void PPCInterpreter::PPCInterpreter_vsrb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 8
+    sh <- (vB)i+5:i+7
+    vDi:i+7 <- SHR((vA)i:i+7, sh)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ShiftRightU8(VRi(va), VRi(vb));
+}
+
+// Vector Shift Right Integer Halfword (x'1000 0244')
+void PPCInterpreter::PPCInterpreter_vsrh(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    sh <- (vB)i+12:i+15
+    vDi:i+15 <- SHR((vA)i:i+15, sh)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ShiftRightU16(VRi(va), VRi(vb));
+}
+
+// Vector Shift Right Integer Word (x'1000 0284')
+void PPCInterpreter::PPCInterpreter_vsrw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    sh <- (vB)i+27:i+31
+    vDi:i+31 <- SHR((vA)i:i+31, sh)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::kernels.shiftRightU32(VRi(va), VRi(vb));
+}
+
+// Vector Shift Right Algebraic Integer Byte (x'1000 0304')
+void PPCInterpreter::PPCInterpreter_vsrab(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 8
+    sh <- (vB)i+5:i+7
+    vDi:i+7 <- SHRA((vA)i:i+7, sh)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ShiftRightS8(VRi(va), VRi(vb));
+}
+
+// Vector Shift Right Algebraic Integer Halfword (x'1000 0344')
+void PPCInterpreter::PPCInterpreter_vsrah(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    sh <- (vB)i+12:i+15
+    vDi:i+15 <- SHRA((vA)i:i+15, sh)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ShiftRightS16(VRi(va), VRi(vb));
+}
+
+// Vector Shift Right Algebraic Integer Word (x'1000 0384')
+void PPCInterpreter::PPCInterpreter_vsraw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    sh <- (vB)i+27:i+31
+    vDi:i+31 <- SHRA((vA)i:i+31, sh)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::kernels.shiftRightS32(VRi(va), VRi(vb));
+}
+
+// Vector Shift Left (x'1000 01C4')
+void PPCInterpreter::PPCInterpreter_vsl(PPU_STATE *ppuState) {
+  /*
+  sh <- (vB)125:127
+  vD <- (vA) << sh
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ShiftLeftBits(VRi(va), VXU::GetByte(VRi(vb), 15) & 7);
+}
+
+// Vector Shift Right (x'1000 02C4')
+void PPCInterpreter::PPCInterpreter_vsr(PPU_STATE *ppuState) {
+  /*
+  sh <- (vB)125:127
+  vD <- (vA) >> sh
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ShiftRightBits(VRi(va), VXU::GetByte(VRi(vb), 15) & 7);
+}
+
+// Vector Shift Left by Octet (x'1000 040C')
+void PPCInterpreter::PPCInterpreter_vslo(PPU_STATE *ppuState) {
+  /*
+  shb <- (vB)121:124
+  vD <- (vA) << (shb * 8)
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ShiftLeftOctets(VRi(va), (VXU::GetByte(VRi(vb), 15) >> 3) & 0xF);
+}
+
+// Vector Shift Right by Octet (x'1000 044C')
+void PPCInterpreter::PPCInterpreter_vsro(PPU_STATE *ppuState) {
+  /*
+  shb <- (vB)121:124
+  vD <- (vA) >> (shb * 8)
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ShiftRightOctets(VRi(va), (VXU::GetByte(VRi(vb), 15) >> 3) & 0xF);
+}
+
+// Vector Shift Left Double by Octet Immediate (x'1000 002C')
+void PPCInterpreter::PPCInterpreter_vsldoi(PPU_STATE *ppuState) {
+  /*
+  vD <- ((vA) || (vB))SH*8:(SH*8)+127
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::ShiftLeftDouble(VRi(va), VRi(vb), _instr.vsh);
+}
+
+// Vector Permute (x'1000 002B')
+void PPCInterpreter::PPCInterpreter_vperm(PPU_STATE *ppuState) {
+  /*
+  temp0:255 <- (vA) || (vB)
+  do i=0 to 127 by 8
+    b <- (vC)i+3:i+7 || 0b000
+    vDi:i+7 <- tempb:b+7
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = VXU::kernels.permute(VRi(va), VRi(vb), VRi(vc));
+}
+
+// Vector Splat Byte (x'1000 020C')
+void PPCInterpreter::PPCInterpreter_vspltb(PPU_STATE *ppuState) {
+  /*
+  b <- UIMM*8
+  do i=0 to 127 by 8
+    vDi:i+7 <- (vB)b:b+7
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = Base::Vector128b(VXU::GetByte(VRi(vb), _instr.vuimm & 0xF));
+}
+
+// Vector Splat Halfword (x'1000 024C')
+void PPCInterpreter::PPCInterpreter_vsplth(PPU_STATE *ppuState) {
+  /*
+  b <- UIMM*16
+  do i=0 to 127 by 16
+    vDi:i+15 <- (vB)b:b+15
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = Base::Vector128s(VXU::GetHalf(VRi(vb), _instr.vuimm & 0x7));
+}
+
+// Vector Splat Word (x'1000 028C')
+void PPCInterpreter::PPCInterpreter_vspltw(PPU_STATE *ppuState) {
+  /*
+  b <- UIMM*32
+  do i=0 to 127 by 32
+    vDi:i+31 <- (vB)b:b+31
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = Base::Vector128i(VRi(vb).dword[_instr.vuimm & 0x3]);
+}
+
+// Vector Splat Immediate Signed Byte (x'1000 030C')
+void PPCInterpreter::PPCInterpreter_vspltisb(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 8
+    vDi:i+7 <- SignExtend(SIMM, 8)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = Base::Vector128b(static_cast<u8>(_instr.vsimm));
+}
+
+// Vector Splat Immediate Signed Halfword (x'1000 034C')
+void PPCInterpreter::PPCInterpreter_vspltish(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 16
+    vDi:i+15 <- SignExtend(SIMM, 16)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = Base::Vector128s(static_cast<u16>(_instr.vsimm));
+}
+
+// Vector Splat Immediate Signed Word (x'1000 038C')
+void PPCInterpreter::PPCInterpreter_vspltisw(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 127 by 32
+    vDi:i+31 <- SignExtend(SIMM, 32)
+  end
+  */
+
+  CHECK_VXU;
+
+  VRi(vd) = Base::Vector128i(static_cast<u32>(_instr.vsimm));
+}
+
+// Vector128 Shift Left Double by Octet Immediate
+void PPCInterpreter::PPCInterpreter_vsldoi128(PPU_STATE *ppuState) {
+  /*
+  vD <- ((vA) || (vB))SH*8:(SH*8)+127
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_5_VD128) = VXU::ShiftLeftDouble(VR(VMX128_5_VA128), VR(VMX128_5_VB128), VMX128_5_SH);
+}
+
+// Vector128 Add Floating Point
+void PPCInterpreter::PPCInterpreter_vaddfp128(PPU_STATE *ppuState) {
+  /*
+  vD <- vA + vB (4 x FP)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = vxuFloat(ppuState, VXU::AddF, VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Subtract Floating Point
+void PPCInterpreter::PPCInterpreter_vsubfp128(PPU_STATE *ppuState) {
+  /*
+  vD <- vA - vB (4 x FP)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = vxuFloat(ppuState, VXU::SubF, VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Multiply Floating Point
+void PPCInterpreter::PPCInterpreter_vmulfp128(PPU_STATE *ppuState) {
+  /*
+  vD <- vA * vB (4 x FP)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = vxuFloat(ppuState, VXU::MulF, VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Multiply Add Floating Point
+void PPCInterpreter::PPCInterpreter_vmaddfp128(PPU_STATE *ppuState) {
+  /*
+  vD <- vA * vB + vD (4 x FP)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = vxuFloat(ppuState, VXU::kernels.multiplyAdd, VR(VMX128_VA128), VR(VMX128_VB128), VR(VMX128_VD128));
+}
+
+// Vector128 Multiply Add Carry Floating Point
+void PPCInterpreter::PPCInterpreter_vmaddcfp128(PPU_STATE *ppuState) {
+  /*
+  vD <- vA * vD + vB (4 x FP)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = vxuFloat(ppuState, VXU::kernels.multiplyAdd, VR(VMX128_VA128), VR(VMX128_VD128), VR(VMX128_VB128));
+}
+
+// Vector128 Negative Multiply-Subtract Floating Point
+void PPCInterpreter::PPCInterpreter_vnmsubfp128(PPU_STATE *ppuState) {
+  /*
+  vD <- -(vA * vB - vD) (4 x FP)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = vxuFloat(ppuState, VXU::kernels.negMultiplySub, VR(VMX128_VA128), VR(VMX128_VB128), VR(VMX128_VD128));
+}
+
+// Vector128 Multiply Sum 3-way Floating Point
+void PPCInterpreter::PPCInterpreter_vmsum3fp128(PPU_STATE *ppuState) {
+  /*
+  vD.xyzw <- vA.x * vB.x + vA.y * vB.y + vA.z * vB.z
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = vxuFloat(ppuState, VXU::kernels.dot3, VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Multiply Sum 4-way Floating Point
+void PPCInterpreter::PPCInterpreter_vmsum4fp128(PPU_STATE *ppuState) {
+  /*
+  vD.xyzw <- vA.x * vB.x + vA.y * vB.y + vA.z * vB.z + vA.w * vB.w
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = vxuFloat(ppuState, VXU::kernels.dot4, VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Pack Signed Halfword Signed Saturate
+void PPCInterpreter::PPCInterpreter_vpkshss128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  bool sat = false;
+  VR(VMX128_VD128) = VXU::PackS16Sat(VR(VMX128_VA128), VR(VMX128_VB128), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector128 Pack Signed Halfword Unsigned Saturate
+void PPCInterpreter::PPCInterpreter_vpkshus128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  bool sat = false;
+  VR(VMX128_VD128) = VXU::PackS16SatU(VR(VMX128_VA128), VR(VMX128_VB128), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector128 Pack Signed Word Signed Saturate
+void PPCInterpreter::PPCInterpreter_vpkswss128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  bool sat = false;
+  VR(VMX128_VD128) = VXU::PackS32Sat(VR(VMX128_VA128), VR(VMX128_VB128), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector128 Pack Signed Word Unsigned Saturate
+void PPCInterpreter::PPCInterpreter_vpkswus128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  bool sat = false;
+  VR(VMX128_VD128) = VXU::kernels.packS32SatU(VR(VMX128_VA128), VR(VMX128_VB128), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector128 Pack Unsigned Halfword Unsigned Modulo
+void PPCInterpreter::PPCInterpreter_vpkuhum128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::PackU16Mod(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Pack Unsigned Halfword Unsigned Saturate
+void PPCInterpreter::PPCInterpreter_vpkuhus128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  bool sat = false;
+  VR(VMX128_VD128) = VXU::PackU16Sat(VR(VMX128_VA128), VR(VMX128_VB128), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector128 Pack Unsigned Word Unsigned Modulo
+void PPCInterpreter::PPCInterpreter_vpkuwum128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::PackU32Mod(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Pack Unsigned Word Unsigned Saturate
+void PPCInterpreter::PPCInterpreter_vpkuwus128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  bool sat = false;
+  VR(VMX128_VD128) = VXU::kernels.packU32Sat(VR(VMX128_VA128), VR(VMX128_VB128), sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector128 Logical AND
+void PPCInterpreter::PPCInterpreter_vand128(PPU_STATE *ppuState) {
+  /*
+  vD <- (vA) & (vB)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::And(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Logical AND with Complement
+void PPCInterpreter::PPCInterpreter_vandc128(PPU_STATE *ppuState) {
+  /*
+  vD <- (vA) & ~(vB)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::AndC(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Logical OR
+void PPCInterpreter::PPCInterpreter_vor128(PPU_STATE *ppuState) {
+  /*
+  vD <- (vA) | (vB)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::Or(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Logical NOR
+void PPCInterpreter::PPCInterpreter_vnor128(PPU_STATE *ppuState) {
+  /*
+  vD <- ~((vA) | (vB))
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::Nor(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Logical XOR
+void PPCInterpreter::PPCInterpreter_vxor128(PPU_STATE *ppuState) {
+  /*
+  vD <- (vA) ^ (vB)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::Xor(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Select
+void PPCInterpreter::PPCInterpreter_vsel128(PPU_STATE *ppuState) {
+  /*
+  vD <- ((vA) & ~(vD)) | ((vB) & (vD))
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::SelectBits(VR(VMX128_VA128), VR(VMX128_VB128), VR(VMX128_VD128));
+}
+
+// Vector128 Shift Left by Octet
+void PPCInterpreter::PPCInterpreter_vslo128(PPU_STATE *ppuState) {
+  /*
+  vD <- (vA) << ((vB)121:124 * 8)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::ShiftLeftOctets(VR(VMX128_VA128), (VXU::GetByte(VR(VMX128_VB128), 15) >> 3) & 0xF);
+}
+
+// Vector128 Shift Right by Octet
+void PPCInterpreter::PPCInterpreter_vsro128(PPU_STATE *ppuState) {
+  /*
+  vD <- (vA) >> ((vB)121:124 * 8)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::ShiftRightOctets(VR(VMX128_VA128), (VXU::GetByte(VR(VMX128_VB128), 15) >> 3) & 0xF);
+}
+
+// Vector128 Permute
+void PPCInterpreter::PPCInterpreter_vperm128(PPU_STATE *ppuState) {
+  /*
+  vD <- Permute((vA) || (vB), (vC)), vC is one of VR0-7
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_2_VD128) = VXU::kernels.permute(VR(VMX128_2_VA128), VR(VMX128_2_VB128), VR(VMX128_2_VC));
+}
+
+// Vector128 Compare Equal-to Floating Point
+void PPCInterpreter::PPCInterpreter_vcmpeqfp128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_R_VD128) = vxuFloat(ppuState, VXU::CmpEqF, VR(VMX128_R_VA128), VR(VMX128_R_VB128));
+  if (VMX128_R_RC)
+    vxuCompareCR6(ppuState, VR(VMX128_R_VD128));
+}
+
+// Vector128 Compare Greater-Than-or-Equal-to Floating Point
+void PPCInterpreter::PPCInterpreter_vcmpgefp128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_R_VD128) = vxuFloat(ppuState, VXU::CmpGeF, VR(VMX128_R_VA128), VR(VMX128_R_VB128));
+  if (VMX128_R_RC)
+    vxuCompareCR6(ppuState, VR(VMX128_R_VD128));
+}
+
+// Vector128 Compare Greater-Than Floating Point
+void PPCInterpreter::PPCInterpreter_vcmpgtfp128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_R_VD128) = vxuFloat(ppuState, VXU::CmpGtF, VR(VMX128_R_VA128), VR(VMX128_R_VB128));
+  if (VMX128_R_RC)
+    vxuCompareCR6(ppuState, VR(VMX128_R_VD128));
+}
+
+// Vector128 Compare Bounds Floating Point
+void PPCInterpreter::PPCInterpreter_vcmpbfp128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_R_VD128) = vxuFloat(ppuState, VXU::CmpBoundsF, VR(VMX128_R_VA128), VR(VMX128_R_VB128));
+  if (VMX128_R_RC)
+    vxuBoundsCR6(ppuState, VR(VMX128_R_VD128));
+}
+
+// Vector128 Compare Equal-to Unsigned Word
+void PPCInterpreter::PPCInterpreter_vcmpequw128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_R_VD128) = VXU::CmpEqU32(VR(VMX128_R_VA128), VR(VMX128_R_VB128));
+  if (VMX128_R_RC)
+    vxuCompareCR6(ppuState, VR(VMX128_R_VD128));
+}
+
+// Vector128 Rotate Left Word
+void PPCInterpreter::PPCInterpreter_vrlw128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::kernels.rotateU32(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Shift Left Word
+void PPCInterpreter::PPCInterpreter_vslw128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::kernels.shiftLeftU32(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Shift Right Arithmetic Word
+void PPCInterpreter::PPCInterpreter_vsraw128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::kernels.shiftRightS32(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Shift Right Word
+void PPCInterpreter::PPCInterpreter_vsrw128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::kernels.shiftRightU32(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Maximum Floating Point
+void PPCInterpreter::PPCInterpreter_vmaxfp128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = vxuFloat(ppuState, VXU::MaxF, VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Minimum Floating Point
+void PPCInterpreter::PPCInterpreter_vminfp128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = vxuFloat(ppuState, VXU::MinF, VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Merge High Word
+void PPCInterpreter::PPCInterpreter_vmrghw128(PPU_STATE *ppuState) {
+  /*
+  vD <- vA.x || vB.x || vA.y || vB.y
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::MergeHighU32(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Merge Low Word
+void PPCInterpreter::PPCInterpreter_vmrglw128(PPU_STATE *ppuState) {
+  /*
+  vD <- vA.z || vB.z || vA.w || vB.w
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::MergeLowU32(VR(VMX128_VA128), VR(VMX128_VB128));
+}
+
+// Vector128 Unpack High Signed Byte
+void PPCInterpreter::PPCInterpreter_vupkhsb128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::UnpackHighS8(VR(VMX128_VB128));
+}
+
+// Vector128 Unpack Low Signed Byte
+void PPCInterpreter::PPCInterpreter_vupklsb128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_VD128) = VXU::UnpackLowS8(VR(VMX128_VB128));
+}
+
+// Vector128 Permutate Word Immediate
+void PPCInterpreter::PPCInterpreter_vpermwi128(PPU_STATE *ppuState) {
+  /*
+  do i=0 to 3
+    vD.word[i] <- vB.word[PERM[i*2:i*2+1]]
+  end
+  */
+
+  CHECK_VXU;
+
+  const Base::Vector128 source = VR(VMX128_P_VB128);
+  const u32 perm = VMX128_P_PERM;
+  for (u32 i = 0; i != 4; i++) {
+    VR(VMX128_P_VD128).dword[i] = source.dword[(perm >> (6 - i * 2)) & 3];
+  }
+}
+
+// Vector128 Convert From Floating-Point to Signed Fixed-Point Word Saturate
+void PPCInterpreter::PPCInterpreter_vcfpsxws128(PPU_STATE *ppuState) {
+  /*
+  vD <- CnvtFP32ToSI32Sat(vB *fp 2^UIMM)
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VR(VMX128_3_VD128) = VXU::ConvertToS32Sat(VR(VMX128_3_VB128), VMX128_3_IMM, sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector128 Convert From Floating-Point to Unsigned Fixed-Point Word Saturate
+void PPCInterpreter::PPCInterpreter_vcfpuxws128(PPU_STATE *ppuState) {
+  /*
+  vD <- CnvtFP32ToUI32Sat(vB *fp 2^UIMM)
+  */
+
+  CHECK_VXU;
+
+  bool sat = false;
+  VR(VMX128_3_VD128) = VXU::ConvertToU32Sat(VR(VMX128_3_VB128), VMX128_3_IMM, sat);
+  vxuSetSat(ppuState, sat);
+}
+
+// Vector128 Convert From Signed Fixed-Point Word to Floating-Point
+void PPCInterpreter::PPCInterpreter_vcsxwfp128(PPU_STATE *ppuState) {
+  /*
+  vD <- CnvtSI32ToFP32(vB) /fp 2^UIMM
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_3_VD128) = VXU::ConvertFromS32(VR(VMX128_3_VB128), VMX128_3_IMM);
+}
+
+// Vector128 Convert From Unsigned Fixed-Point Word to Floating-Point
+void PPCInterpreter::PPCInterpreter_vcuxwfp128(PPU_STATE *ppuState) {
+  /*
+  vD <- CnvtUI32ToFP32(vB) /fp 2^UIMM
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_3_VD128) = VXU::ConvertFromU32(VR(VMX128_3_VB128), VMX128_3_IMM);
+}
+
+// Vector128 Round to Floating-Point Integer toward Minus Infinity
+void PPCInterpreter::PPCInterpreter_vrfim128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_3_VD128) = vxuFloat(ppuState, VXU::kernels.roundDown, VR(VMX128_3_VB128));
+}
+
+// Vector128 Round to Floating-Point Integer Nearest
+void PPCInterpreter::PPCInterpreter_vrfin128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_3_VD128) = vxuFloat(ppuState, VXU::kernels.roundNearest, VR(VMX128_3_VB128));
+}
+
+// Vector128 Round to Floating-Point Integer toward Positive Infinity
+void PPCInterpreter::PPCInterpreter_vrfip128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_3_VD128) = vxuFloat(ppuState, VXU::kernels.roundUp, VR(VMX128_3_VB128));
+}
+
+// Vector128 Round to Floating-Point Integer toward Zero
+void PPCInterpreter::PPCInterpreter_vrfiz128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_3_VD128) = vxuFloat(ppuState, VXU::kernels.roundZero, VR(VMX128_3_VB128));
+}
+
+// Vector128 Reciprocal Estimate Floating Point
+void PPCInterpreter::PPCInterpreter_vrefp128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_3_VD128) = vxuFloat(ppuState, VXU::ReciprocalEstimate, VR(VMX128_3_VB128));
+}
+
+// Vector128 Reciprocal Square Root Estimate Floating Point
+void PPCInterpreter::PPCInterpreter_vrsqrtefp128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_3_VD128) = vxuFloat(ppuState, VXU::ReciprocalSqrtEstimate, VR(VMX128_3_VB128));
+}
+
+// Vector128 2 Raised to the Exponent Estimate Floating Point
+void PPCInterpreter::PPCInterpreter_vexptefp128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_3_VD128) = vxuFloat(ppuState, VXU::Exp2Estimate, VR(VMX128_3_VB128));
+}
+
+// Vector128 Log2 Estimate Floating Point
+void PPCInterpreter::PPCInterpreter_vlogefp128(PPU_STATE *ppuState) {
+  CHECK_VXU;
+
+  VR(VMX128_3_VD128) = vxuFloat(ppuState, VXU::Log2Estimate, VR(VMX128_3_VB128));
+}
+
+// Vector128 Splat Word
+void PPCInterpreter::PPCInterpreter_vspltw128(PPU_STATE *ppuState) {
+  /*
+  vD.xyzw <- vB.word[UIMM]
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_3_VD128) = Base::Vector128i(VR(VMX128_3_VB128).dword[VMX128_3_IMM & 0x3]);
+}
+
+// Vector128 Splat Immediate Signed Word
+void PPCInterpreter::PPCInterpreter_vspltisw128(PPU_STATE *ppuState) {
+  /*
+  vD.xyzw <- SignExtend(SIMM, 32)
+  */
+
+  CHECK_VXU;
+
+  VR(VMX128_3_VD128) = Base::Vector128i(static_cast<u32>(static_cast<s32>(VMX128_3_IMM << 27) >> 27));
+}
+
+// Vector128 Unpack D3Dtype
+void PPCInterpreter::PPCInterpreter_vupkd3d128(PPU_STATE *ppuState) {
+  /*
+  vD <- Unpack(vB, TYPE), see VXU::UnpackD3D
+  */
+
+  CHECK_VXU;
+
+  const u32 type = VMX128_3_IMM >> 2;
+  bool valid = false;
+  const Base::Vector128 result = VXU::UnpackD3D(VR(VMX128_3_VB128), type, valid);
+  if (!valid) {
+    LOG_ERROR(Xenon, "vupkd3d128: Unknown type {}!", type);
+    return;
+  }
+  VR(VMX128_3_VD128) = result;
+}
+
+// Vector128 Pack D3Dtype, Rotate Left Immediate and Mask Insert
+void PPCInterpreter::PPCInterpreter_vpkd3d128(PPU_STATE *ppuState) {
+  /*
+  vD <- Insert(vD, Pack(vB, TYPE), PACK, SHIFT), see VXU::PackD3D
+  */
+
+  CHECK_VXU;
+
+  const u32 type = VMX128_4_IMM >> 2;
+  const u32 shift = VMX128_4_IMM & 0x3;
+  const u32 pack = VMX128_4_Z;
+  bool valid = false;
+  const Base::Vector128 packed = VXU::PackD3D(VR(VMX128_4_VB128), type, valid);
+  if (!valid || pack == 0) {
+    LOG_ERROR(Xenon, "vpkd3d128: Unknown type {} / pack {}!", type, pack);
+    return;
+  }
+  // The packed data ends at word 3 (w), insert it shift words to the left
+  Base::Vector128 &vd = VR(VMX128_4_VD128);
+  if (pack == 1) {
+    // 32 bits
+    vd.dword[3 - shift] = packed.dword[3];
+  } else if (shift != 3) {
+    // 64 bits
+    vd.dword[2 - shift] = packed.dword[2];
+    vd.dword[3 - shift] = packed.dword[3];
+  } else if (pack == 2) {
+    // Only the low half fits, it wraps around to word 0
+    vd.dword[0] = packed.dword[3];
+  } else {
+    // Only the high half is kept, in word 3
+    vd.dword[3] = packed.dword[2];
+  }
+}
+
+// Vector128 Rotate Left Immediate and Mask Insert
+void PPCInterpreter::PPCInterpreter_vrlimi128(PPU_STATE *ppuState) {
+  /*
+  temp <- vB rotated left by z words
+  do i=0 to 3
+    if IMM[i] then vD.word[i] <- temp.word[i]
+  end
+  */
+
+  CHECK_VXU;
+
+  const Base::Vector128 source = VR(VMX128_4_VB128);
+  const u32 rotate = VMX128_4_Z;
+  const u32 mask = VMX128_4_IMM;
+  for (u32 i = 0; i != 4; i++) {
+    if (mask & (8 >> i))
+      VR(VMX128_4_VD128).dword[i] = source.dword[(i + rotate) & 3];
+  }
 }
@@ -0,0 +1,1475 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#include "Base/Arch.h"
+#include "Base/Types.h"
+#include "Base/HostCPU.h"
+#include "Base/Vector128.h"
+
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+#include <immintrin.h>
+#endif
+
+//
+// VMX kernels.
+//
+// Vector registers keep every word in host order, so guest byte i is host byte i ^ 3 and guest
+// halfword i is host halfword i ^ 1. Element wise kernels don't care about it, the ones moving
+// elements around (merges, packs, permutes, octet shifts) apply that remapping.
+//
+// x86 kernels are written for SSSE3, which we're built with. The ones that gain from newer
+// extensions also have SSE4.1 or AVX2/FMA variants, picked once from the host CPU features through
+// the kernel table. Other architectures use scalar kernels.
+//
+
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+#define VXU_SIMD 1
+#ifdef __GNUC__
+#define VXU_TARGET(features) __attribute__((target(features)))
+#else
+#define VXU_TARGET(features)
+#endif
+#endif
+
+namespace VXU {
+
+using Base::Vector128;
+
+//
+// Scalar Helpers
+//
+
+// Guest order element access
+inline u8 GetByte(const Vector128 &v, u32 i) { return v.bytes[i ^ 3]; }
+inline void SetByte(Vector128 &v, u32 i, u8 value) { v.bytes[i ^ 3] = value; }
+inline u16 GetHalf(const Vector128 &v, u32 i) { return v.word[i ^ 1]; }
+inline void SetHalf(Vector128 &v, u32 i, u16 value) { v.word[i ^ 1] = value; }
+
+// Clamps value to the range of T, flagging sat when it didn't fit
+template <typename T>
+inline T Saturate(s64 value, bool &sat) {
+  constexpr s64 min = std::numeric_limits<T>::min();
+  constexpr s64 max = std::numeric_limits<T>::max();
+  if (value < min || value > max) {
+    sat = true;
+    return static_cast<T>(value < min ? min : max);
+  }
+  return static_cast<T>(value);
+}
+
+// Applies op to every lane of type T
+template <typename T, typename F>
+inline Vector128 Map(const Vector128 &a, F op) {
+  Vector128 result{};
+  const T *x = reinterpret_cast<const T *>(a.bytes.data());
+  T *r = reinterpret_cast<T *>(result.bytes.data());
+  for (u32 i = 0; i != 16 / sizeof(T); i++) {
+    r[i] = static_cast<T>(op(x[i]));
+  }
+  return result;
+}
+
+template <typename T, typename F>
+inline Vector128 Map(const Vector128 &a, const Vector128 &b, F op) {
+  Vector128 result{};
+  const T *x = reinterpret_cast<const T *>(a.bytes.data());
+  const T *y = reinterpret_cast<const T *>(b.bytes.data());
+  T *r = reinterpret_cast<T *>(result.bytes.data());
+  for (u32 i = 0; i != 16 / sizeof(T); i++) {
+    r[i] = static_cast<T>(op(x[i], y[i]));
+  }
+  return result;
+}
+
+template <typename T, typename F>
+inline Vector128 Map(const Vector128 &a, const Vector128 &b, const Vector128 &c, F op) {
+  Vector128 result{};
+  const T *x = reinterpret_cast<const T *>(a.bytes.data());
+  const T *y = reinterpret_cast<const T *>(b.bytes.data());
+  const T *z = reinterpret_cast<const T *>(c.bytes.data());
+  T *r = reinterpret_cast<T *>(result.bytes.data());
+  for (u32 i = 0; i != 16 / sizeof(T); i++) {
+    r[i] = static_cast<T>(op(x[i], y[i], z[i]));
+  }
+  return result;
+}
+
+// 2^exponent, exactly
+inline f32 Pow2(s32 exponent) {
+  return std::bit_cast<f32>(static_cast<u32>(127 + exponent) << 23);
+}
+
+//
+// Kernels Used On Every Architecture
+//
+
+// Per element shifts. Only word shifts exist in SSE/AVX2, bytes and halfwords are left to the compiler.
+inline Vector128 ShiftLeftU8(const Vector128 &a, const Vector128 &b) {
+  return Map<u8>(a, b, [](u8 x, u8 y) { return x << (y & 7); });
+}
+inline Vector128 ShiftRightU8(const Vector128 &a, const Vector128 &b) {
+  return Map<u8>(a, b, [](u8 x, u8 y) { return x >> (y & 7); });
+}
+inline Vector128 ShiftRightS8(const Vector128 &a, const Vector128 &b) {
+  return Map<s8>(a, b, [](s8 x, s8 y) { return x >> (y & 7); });
+}
+inline Vector128 RotateU8(const Vector128 &a, const Vector128 &b) {
+  return Map<u8>(a, b, [](u8 x, u8 y) { return std::rotl(x, y & 7); });
+}
+inline Vector128 ShiftLeftU16(const Vector128 &a, const Vector128 &b) {
+  return Map<u16>(a, b, [](u16 x, u16 y) { return x << (y & 15); });
+}
+inline Vector128 ShiftRightU16(const Vector128 &a, const Vector128 &b) {
+  return Map<u16>(a, b, [](u16 x, u16 y) { return x >> (y & 15); });
+}
+inline Vector128 ShiftRightS16(const Vector128 &a, const Vector128 &b) {
+  return Map<s16>(a, b, [](s16 x, s16 y) { return x >> (y & 15); });
+}
+inline Vector128 RotateU16(const Vector128 &a, const Vector128 &b) {
+  return Map<u16>(a, b, [](u16 x, u16 y) { return std::rotl(x, y & 15); });
+}
+
+// Exponent and logarithm estimates, there's nothing to gain from SIMD here
+inline Vector128 Exp2Estimate(const Vector128 &a) {
+  return Map<f32>(a, [](f32 x) { return std::exp2(x); });
+}
+inline Vector128 Log2Estimate(const Vector128 &a) {
+  return Map<f32>(a, [](f32 x) { return std::log2(x); });
+}
+
+// Sums needing more than 32 bits of intermediate precision
+inline Vector128 MultiplySumSatU16(const Vector128 &a, const Vector128 &b, const Vector128 &c, bool &sat) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    u64 sum = c.dword[i];
+    sum += static_cast<u64>(a.word[i * 2]) * b.word[i * 2];
+    sum += static_cast<u64>(a.word[i * 2 + 1]) * b.word[i * 2 + 1];
+    result.dword[i] = Saturate<u32>(static_cast<s64>(sum), sat);
+  }
+  return result;
+}
+inline Vector128 MultiplySumSatS16(const Vector128 &a, const Vector128 &b, const Vector128 &c, bool &sat) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    s64 sum = c.dsword[i];
+    sum += static_cast<s32>(a.sword[i * 2]) * b.sword[i * 2];
+    sum += static_cast<s32>(a.sword[i * 2 + 1]) * b.sword[i * 2 + 1];
+    result.dsword[i] = Saturate<s32>(sum, sat);
+  }
+  return result;
+}
+inline Vector128 SumAcross2S32(const Vector128 &a, const Vector128 &b, bool &sat) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i += 2) {
+    const s64 sum = static_cast<s64>(a.dsword[i]) + a.dsword[i + 1] + b.dsword[i + 1];
+    result.dsword[i + 1] = Saturate<s32>(sum, sat);
+  }
+  return result;
+}
+inline Vector128 SumAcrossS32(const Vector128 &a, const Vector128 &b, bool &sat) {
+  Vector128 result{};
+  const s64 sum = static_cast<s64>(a.dsword[0]) + a.dsword[1] + a.dsword[2] + a.dsword[3] + b.dsword[3];
+  result.dsword[3] = Saturate<s32>(sum, sat);
+  return result;
+}
+
+#ifdef VXU_SIMD
+//
+// SSE Kernels
+//
+
+inline __m128i Load(const Vector128 &v) { return _mm_load_si128(reinterpret_cast<const __m128i *>(v.bytes.data())); }
+inline __m128 LoadF(const Vector128 &v) { return _mm_load_ps(v.flt.data()); }
+inline Vector128 Store(__m128i x) {
+  Vector128 result;
+  _mm_store_si128(reinterpret_cast<__m128i *>(result.bytes.data()), x);
+  return result;
+}
+inline Vector128 StoreF(__m128 x) {
+  Vector128 result;
+  _mm_store_ps(result.flt.data(), x);
+  return result;
+}
+
+// Host halfword i <-> halfword i ^ 1, which maps between guest and host halfword order
+inline __m128i SwapHalves(__m128i x) {
+  return _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, 0xB1), 0xB1);
+}
+// Host byte index i ^ 3 for every byte, the base of a permute control
+inline __m128i GuestByteIndex() {
+  return _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+}
+// Mask of the lanes selecting a, mask ? a : b
+inline __m128i Select(__m128i mask, __m128i a, __m128i b) {
+  return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+inline __m128 SelectF(__m128 mask, __m128 a, __m128 b) {
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+inline bool AnyDifferent(__m128i a, __m128i b) {
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xFFFF;
+}
+inline bool AnySet(__m128i mask) {
+  return _mm_movemask_epi8(mask) != 0;
+}
+inline __m128i SignBias32() { return _mm_set1_epi32(static_cast<s32>(0x80000000)); }
+
+// Denormals to zero of the same sign, for VSCR[NJ]
+inline Vector128 FlushDenormals(const Vector128 &a) {
+  const __m128i v = Load(a);
+  const __m128i zeroExp = _mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(0x7F800000)), _mm_setzero_si128());
+  return Store(_mm_andnot_si128(_mm_andnot_si128(SignBias32(), zeroExp), v));
+}
+
+// Logical
+inline Vector128 And(const Vector128 &a, const Vector128 &b) { return Store(_mm_and_si128(Load(a), Load(b))); }
+inline Vector128 AndC(const Vector128 &a, const Vector128 &b) { return Store(_mm_andnot_si128(Load(b), Load(a))); }
+inline Vector128 Or(const Vector128 &a, const Vector128 &b) { return Store(_mm_or_si128(Load(a), Load(b))); }
+inline Vector128 Nor(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_xor_si128(_mm_or_si128(Load(a), Load(b)), _mm_set1_epi32(-1)));
+}
+inline Vector128 Xor(const Vector128 &a, const Vector128 &b) { return Store(_mm_xor_si128(Load(a), Load(b))); }
+// (a & ~c) | (b & c)
+inline Vector128 SelectBits(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  return Store(Select(Load(c), Load(b), Load(a)));
+}
+
+// Modulo add/sub
+inline Vector128 AddU8(const Vector128 &a, const Vector128 &b) { return Store(_mm_add_epi8(Load(a), Load(b))); }
+inline Vector128 AddU16(const Vector128 &a, const Vector128 &b) { return Store(_mm_add_epi16(Load(a), Load(b))); }
+inline Vector128 AddU32(const Vector128 &a, const Vector128 &b) { return Store(_mm_add_epi32(Load(a), Load(b))); }
+inline Vector128 SubU8(const Vector128 &a, const Vector128 &b) { return Store(_mm_sub_epi8(Load(a), Load(b))); }
+inline Vector128 SubU16(const Vector128 &a, const Vector128 &b) { return Store(_mm_sub_epi16(Load(a), Load(b))); }
+inline Vector128 SubU32(const Vector128 &a, const Vector128 &b) { return Store(_mm_sub_epi32(Load(a), Load(b))); }
+
+// Saturating add/sub, sat is set if any element saturated
+#define VXU_SAT_KERNEL(name, satOp, modOp) \
+inline Vector128 name(const Vector128 &a, const Vector128 &b, bool &sat) { \
+  const __m128i x = Load(a), y = Load(b); \
+  const __m128i result = satOp(x, y); \
+  sat |= AnyDifferent(result, modOp(x, y)); \
+  return Store(result); \
+}
+VXU_SAT_KERNEL(AddSatU8, _mm_adds_epu8, _mm_add_epi8)
+VXU_SAT_KERNEL(AddSatS8, _mm_adds_epi8, _mm_add_epi8)
+VXU_SAT_KERNEL(AddSatU16, _mm_adds_epu16, _mm_add_epi16)
+VXU_SAT_KERNEL(AddSatS16, _mm_adds_epi16, _mm_add_epi16)
+VXU_SAT_KERNEL(SubSatU8, _mm_subs_epu8, _mm_sub_epi8)
+VXU_SAT_KERNEL(SubSatS8, _mm_subs_epi8, _mm_sub_epi8)
+VXU_SAT_KERNEL(SubSatU16, _mm_subs_epu16, _mm_sub_epi16)
+VXU_SAT_KERNEL(SubSatS16, _mm_subs_epi16, _mm_sub_epi16)
+#undef VXU_SAT_KERNEL
+
+inline __m128i AddSatU32(__m128i x, __m128i y, bool &sat) {
+  const __m128i sum = _mm_add_epi32(x, y);
+  const __m128i carry = _mm_cmpgt_epi32(_mm_xor_si128(x, SignBias32()), _mm_xor_si128(sum, SignBias32()));
+  sat |= AnySet(carry);
+  return _mm_or_si128(sum, carry);
+}
+inline __m128i AddSatS32(__m128i x, __m128i y, bool &sat) {
+  const __m128i sum = _mm_add_epi32(x, y);
+  const __m128i overflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(x, sum), _mm_xor_si128(y, sum)), 31);
+  sat |= AnySet(overflow);
+  const __m128i clamped = _mm_xor_si128(_mm_srai_epi32(x, 31), _mm_set1_epi32(0x7FFFFFFF));
+  return Select(overflow, clamped, sum);
+}
+inline Vector128 AddSatU32(const Vector128 &a, const Vector128 &b, bool &sat) { return Store(AddSatU32(Load(a), Load(b), sat)); }
+inline Vector128 AddSatS32(const Vector128 &a, const Vector128 &b, bool &sat) { return Store(AddSatS32(Load(a), Load(b), sat)); }
+inline Vector128 SubSatU32(const Vector128 &a, const Vector128 &b, bool &sat) {
+  const __m128i x = Load(a), y = Load(b);
+  const __m128i borrow = _mm_cmpgt_epi32(_mm_xor_si128(y, SignBias32()), _mm_xor_si128(x, SignBias32()));
+  sat |= AnySet(borrow);
+  return Store(_mm_andnot_si128(borrow, _mm_sub_epi32(x, y)));
+}
+inline Vector128 SubSatS32(const Vector128 &a, const Vector128 &b, bool &sat) {
+  const __m128i x = Load(a), y = Load(b);
+  const __m128i diff = _mm_sub_epi32(x, y);
+  const __m128i overflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(x, y), _mm_xor_si128(x, diff)), 31);
+  sat |= AnySet(overflow);
+  const __m128i clamped = _mm_xor_si128(_mm_srai_epi32(x, 31), _mm_set1_epi32(0x7FFFFFFF));
+  return Store(Select(overflow, clamped, diff));
+}
+// Carry out of a + b, borrow complement of a - b
+inline Vector128 AddCarryU32(const Vector128 &a, const Vector128 &b) {
+  const __m128i x = Load(a);
+  const __m128i sum = _mm_add_epi32(x, Load(b));
+  return Store(_mm_srli_epi32(_mm_cmpgt_epi32(_mm_xor_si128(x, SignBias32()), _mm_xor_si128(sum, SignBias32())), 31));
+}
+inline Vector128 SubCarryU32(const Vector128 &a, const Vector128 &b) {
+  const __m128i borrow = _mm_cmpgt_epi32(_mm_xor_si128(Load(b), SignBias32()), _mm_xor_si128(Load(a), SignBias32()));
+  return Store(_mm_andnot_si128(borrow, _mm_set1_epi32(1)));
+}
+
+// Rounded up averages
+inline Vector128 AvgU8(const Vector128 &a, const Vector128 &b) { return Store(_mm_avg_epu8(Load(a), Load(b))); }
+inline Vector128 AvgU16(const Vector128 &a, const Vector128 &b) { return Store(_mm_avg_epu16(Load(a), Load(b))); }
+inline Vector128 AvgS8(const Vector128 &a, const Vector128 &b) {
+  const __m128i bias = _mm_set1_epi8(static_cast<s8>(0x80));
+  return Store(_mm_xor_si128(_mm_avg_epu8(_mm_xor_si128(Load(a), bias), _mm_xor_si128(Load(b), bias)), bias));
+}
+inline Vector128 AvgS16(const Vector128 &a, const Vector128 &b) {
+  const __m128i bias = _mm_set1_epi16(static_cast<s16>(0x8000));
+  return Store(_mm_xor_si128(_mm_avg_epu16(_mm_xor_si128(Load(a), bias), _mm_xor_si128(Load(b), bias)), bias));
+}
+inline Vector128 AvgU32(const Vector128 &a, const Vector128 &b) {
+  const __m128i x = Load(a), y = Load(b);
+  const __m128i round = _mm_and_si128(_mm_or_si128(x, y), _mm_set1_epi32(1));
+  return Store(_mm_add_epi32(_mm_add_epi32(_mm_srli_epi32(x, 1), _mm_srli_epi32(y, 1)), round));
+}
+inline Vector128 AvgS32(const Vector128 &a, const Vector128 &b) {
+  const __m128i x = Load(a), y = Load(b);
+  const __m128i round = _mm_and_si128(_mm_or_si128(x, y), _mm_set1_epi32(1));
+  return Store(_mm_add_epi32(_mm_add_epi32(_mm_srai_epi32(x, 1), _mm_srai_epi32(y, 1)), round));
+}
+
+// Min/max with native SSE2 instructions, the rest go through the kernel table
+inline Vector128 MaxU8(const Vector128 &a, const Vector128 &b) { return Store(_mm_max_epu8(Load(a), Load(b))); }
+inline Vector128 MinU8(const Vector128 &a, const Vector128 &b) { return Store(_mm_min_epu8(Load(a), Load(b))); }
+inline Vector128 MaxS16(const Vector128 &a, const Vector128 &b) { return Store(_mm_max_epi16(Load(a), Load(b))); }
+inline Vector128 MinS16(const Vector128 &a, const Vector128 &b) { return Store(_mm_min_epi16(Load(a), Load(b))); }
+
+// Integer compares, all ones where true
+inline Vector128 CmpEqU8(const Vector128 &a, const Vector128 &b) { return Store(_mm_cmpeq_epi8(Load(a), Load(b))); }
+inline Vector128 CmpEqU16(const Vector128 &a, const Vector128 &b) { return Store(_mm_cmpeq_epi16(Load(a), Load(b))); }
+inline Vector128 CmpEqU32(const Vector128 &a, const Vector128 &b) { return Store(_mm_cmpeq_epi32(Load(a), Load(b))); }
+inline Vector128 CmpGtS8(const Vector128 &a, const Vector128 &b) { return Store(_mm_cmpgt_epi8(Load(a), Load(b))); }
+inline Vector128 CmpGtS16(const Vector128 &a, const Vector128 &b) { return Store(_mm_cmpgt_epi16(Load(a), Load(b))); }
+inline Vector128 CmpGtS32(const Vector128 &a, const Vector128 &b) { return Store(_mm_cmpgt_epi32(Load(a), Load(b))); }
+inline Vector128 CmpGtU8(const Vector128 &a, const Vector128 &b) {
+  const __m128i bias = _mm_set1_epi8(static_cast<s8>(0x80));
+  return Store(_mm_cmpgt_epi8(_mm_xor_si128(Load(a), bias), _mm_xor_si128(Load(b), bias)));
+}
+inline Vector128 CmpGtU16(const Vector128 &a, const Vector128 &b) {
+  const __m128i bias = _mm_set1_epi16(static_cast<s16>(0x8000));
+  return Store(_mm_cmpgt_epi16(_mm_xor_si128(Load(a), bias), _mm_xor_si128(Load(b), bias)));
+}
+inline Vector128 CmpGtU32(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_cmpgt_epi32(_mm_xor_si128(Load(a), SignBias32()), _mm_xor_si128(Load(b), SignBias32())));
+}
+
+// Float arithmetic, host rounding is always round to nearest
+inline Vector128 AddF(const Vector128 &a, const Vector128 &b) { return StoreF(_mm_add_ps(LoadF(a), LoadF(b))); }
+inline Vector128 SubF(const Vector128 &a, const Vector128 &b) { return StoreF(_mm_sub_ps(LoadF(a), LoadF(b))); }
+inline Vector128 MulF(const Vector128 &a, const Vector128 &b) { return StoreF(_mm_mul_ps(LoadF(a), LoadF(b))); }
+// VMX returns the NaN operand and orders -0 below +0, SSE returns the second operand for both
+inline Vector128 MaxF(const Vector128 &a, const Vector128 &b) {
+  const __m128 x = LoadF(a), y = LoadF(b);
+  __m128 result = SelectF(_mm_cmpeq_ps(x, y), _mm_and_ps(x, y), _mm_max_ps(x, y));
+  return StoreF(SelectF(_mm_cmpunord_ps(x, y), _mm_add_ps(x, y), result));
+}
+inline Vector128 MinF(const Vector128 &a, const Vector128 &b) {
+  const __m128 x = LoadF(a), y = LoadF(b);
+  __m128 result = SelectF(_mm_cmpeq_ps(x, y), _mm_or_ps(x, y), _mm_min_ps(x, y));
+  return StoreF(SelectF(_mm_cmpunord_ps(x, y), _mm_add_ps(x, y), result));
+}
+// Full precision, games may depend on the estimate being at least as good as the hardware one
+inline Vector128 ReciprocalEstimate(const Vector128 &a) {
+  return StoreF(_mm_div_ps(_mm_set1_ps(1.0f), LoadF(a)));
+}
+inline Vector128 ReciprocalSqrtEstimate(const Vector128 &a) {
+  return StoreF(_mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(LoadF(a))));
+}
+
+// Float compares, all ones where true and false on NaN
+inline Vector128 CmpEqF(const Vector128 &a, const Vector128 &b) { return StoreF(_mm_cmpeq_ps(LoadF(a), LoadF(b))); }
+inline Vector128 CmpGeF(const Vector128 &a, const Vector128 &b) { return StoreF(_mm_cmpge_ps(LoadF(a), LoadF(b))); }
+inline Vector128 CmpGtF(const Vector128 &a, const Vector128 &b) { return StoreF(_mm_cmpgt_ps(LoadF(a), LoadF(b))); }
+// Bit 0 set if a > b, bit 1 set if a < -b (both on NaN)
+inline Vector128 CmpBoundsF(const Vector128 &a, const Vector128 &b) {
+  const __m128 x = LoadF(a), y = LoadF(b);
+  const __m128 le = _mm_cmple_ps(x, y);
+  const __m128 ge = _mm_cmpge_ps(x, _mm_xor_ps(y, _mm_castsi128_ps(SignBias32())));
+  return Store(_mm_or_si128(_mm_andnot_si128(_mm_castps_si128(le), SignBias32()),
+                            _mm_andnot_si128(_mm_castps_si128(ge), _mm_set1_epi32(0x40000000))));
+}
+
+// Fixed point conversions, scaled by 2^-uimm / 2^uimm
+inline Vector128 ConvertFromS32(const Vector128 &b, u32 uimm) {
+  return StoreF(_mm_mul_ps(_mm_cvtepi32_ps(Load(b)), _mm_set1_ps(Pow2(-static_cast<s32>(uimm)))));
+}
+inline Vector128 ConvertFromU32(const Vector128 &b, u32 uimm) {
+  const __m128i x = Load(b);
+  // Both halves convert exactly, the sum rounds once
+  const __m128 hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(x, 16)), _mm_set1_ps(65536.0f));
+  const __m128 lo = _mm_cvtepi32_ps(_mm_and_si128(x, _mm_set1_epi32(0xFFFF)));
+  return StoreF(_mm_mul_ps(_mm_add_ps(hi, lo), _mm_set1_ps(Pow2(-static_cast<s32>(uimm)))));
+}
+inline Vector128 ConvertToS32Sat(const Vector128 &b, u32 uimm, bool &sat) {
+  const __m128 scaled = _mm_mul_ps(LoadF(b), _mm_set1_ps(Pow2(uimm)));
+  const __m128 over = _mm_cmpge_ps(scaled, _mm_set1_ps(2147483648.0f));
+  const __m128 under = _mm_cmplt_ps(scaled, _mm_set1_ps(-2147483648.0f));
+  sat |= AnySet(_mm_castps_si128(_mm_or_ps(over, under)));
+  // Out of range gives 0x80000000, flipped to 0x7FFFFFFF on positive overflow. NaN gives 0.
+  const __m128i result = _mm_xor_si128(_mm_cvttps_epi32(scaled), _mm_castps_si128(over));
+  return Store(_mm_and_si128(result, _mm_castps_si128(_mm_cmpord_ps(scaled, scaled))));
+}
+inline Vector128 ConvertToU32Sat(const Vector128 &b, u32 uimm, bool &sat) {
+  const __m128 scaled = _mm_mul_ps(LoadF(b), _mm_set1_ps(Pow2(uimm)));
+  const __m128 over = _mm_cmpge_ps(scaled, _mm_set1_ps(4294967296.0f));
+  const __m128 under = _mm_cmple_ps(scaled, _mm_set1_ps(-1.0f));
+  sat |= AnySet(_mm_castps_si128(_mm_or_ps(over, under)));
+  // max_ps takes the second operand on NaN
+  const __m128 x = _mm_max_ps(scaled, _mm_setzero_ps());
+  const __m128 high = _mm_cmpge_ps(x, _mm_set1_ps(2147483648.0f));
+  const __m128 low = _mm_sub_ps(x, _mm_and_ps(high, _mm_set1_ps(2147483648.0f)));
+  const __m128i result = _mm_or_si128(_mm_cvttps_epi32(low), _mm_and_si128(_mm_castps_si128(high), SignBias32()));
+  return Store(_mm_or_si128(result, _mm_castps_si128(over)));
+}
+
+// Merges
+inline Vector128 MergeHighU8(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_shuffle_epi32(_mm_unpacklo_epi8(Load(b), Load(a)), 0xB1));
+}
+inline Vector128 MergeLowU8(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_shuffle_epi32(_mm_unpackhi_epi8(Load(b), Load(a)), 0xB1));
+}
+inline Vector128 MergeHighU16(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_shuffle_epi32(_mm_unpacklo_epi16(Load(b), Load(a)), 0xB1));
+}
+inline Vector128 MergeLowU16(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_shuffle_epi32(_mm_unpackhi_epi16(Load(b), Load(a)), 0xB1));
+}
+inline Vector128 MergeHighU32(const Vector128 &a, const Vector128 &b) { return Store(_mm_unpacklo_epi32(Load(a), Load(b))); }
+inline Vector128 MergeLowU32(const Vector128 &a, const Vector128 &b) { return Store(_mm_unpackhi_epi32(Load(a), Load(b))); }
+
+// Packs. Packing host lanes in order leaves each result halfword swapped with its neighbour.
+inline Vector128 PackU16Mod(const Vector128 &a, const Vector128 &b) {
+  const __m128i mask = _mm_set1_epi16(0xFF);
+  return Store(SwapHalves(_mm_packus_epi16(_mm_and_si128(Load(a), mask), _mm_and_si128(Load(b), mask))));
+}
+inline Vector128 PackU32Mod(const Vector128 &a, const Vector128 &b) {
+  const __m128i x = _mm_srai_epi32(_mm_slli_epi32(Load(a), 16), 16);
+  const __m128i y = _mm_srai_epi32(_mm_slli_epi32(Load(b), 16), 16);
+  return Store(SwapHalves(_mm_packs_epi32(x, y)));
+}
+inline Vector128 PackU16Sat(const Vector128 &a, const Vector128 &b, bool &sat) {
+  const __m128i x = Load(a), y = Load(b);
+  const __m128i max = _mm_set1_epi16(0xFF);
+  // min(v, 0xFF), unsigned
+  const __m128i cx = _mm_sub_epi16(x, _mm_subs_epu16(x, max));
+  const __m128i cy = _mm_sub_epi16(y, _mm_subs_epu16(y, max));
+  sat |= AnyDifferent(cx, x) || AnyDifferent(cy, y);
+  return Store(SwapHalves(_mm_packus_epi16(cx, cy)));
+}
+inline Vector128 PackS16SatU(const Vector128 &a, const Vector128 &b, bool &sat) {
+  const __m128i x = Load(a), y = Load(b);
+  const __m128i min = _mm_setzero_si128(), max = _mm_set1_epi16(0xFF);
+  sat |= AnyDifferent(_mm_max_epi16(_mm_min_epi16(x, max), min), x) ||
+         AnyDifferent(_mm_max_epi16(_mm_min_epi16(y, max), min), y);
+  return Store(SwapHalves(_mm_packus_epi16(x, y)));
+}
+inline Vector128 PackS16Sat(const Vector128 &a, const Vector128 &b, bool &sat) {
+  const __m128i x = Load(a), y = Load(b);
+  const __m128i min = _mm_set1_epi16(-128), max = _mm_set1_epi16(127);
+  sat |= AnyDifferent(_mm_max_epi16(_mm_min_epi16(x, max), min), x) ||
+         AnyDifferent(_mm_max_epi16(_mm_min_epi16(y, max), min), y);
+  return Store(SwapHalves(_mm_packs_epi16(x, y)));
+}
+inline Vector128 PackS32Sat(const Vector128 &a, const Vector128 &b, bool &sat) {
+  const __m128i x = Load(a), y = Load(b);
+  const __m128i min = _mm_set1_epi32(-32768), max = _mm_set1_epi32(32767);
+  sat |= AnySet(_mm_or_si128(_mm_or_si128(_mm_cmpgt_epi32(x, max), _mm_cmplt_epi32(x, min)),
+                             _mm_or_si128(_mm_cmpgt_epi32(y, max), _mm_cmplt_epi32(y, min))));
+  return Store(SwapHalves(_mm_packs_epi32(x, y)));
+}
+// 1/5/5/5 pixels from the 8/8/8/8 ones
+inline Vector128 PackPixel(const Vector128 &a, const Vector128 &b) {
+  const auto pixel = [](__m128i x) {
+    const __m128i result = _mm_or_si128(_mm_or_si128(
+      _mm_and_si128(_mm_srli_epi32(x, 9), _mm_set1_epi32(0xFC00)),
+      _mm_and_si128(_mm_srli_epi32(x, 6), _mm_set1_epi32(0x03E0))),
+      _mm_and_si128(_mm_srli_epi32(x, 3), _mm_set1_epi32(0x001F)));
+    return _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+  };
+  return Store(SwapHalves(_mm_packs_epi32(pixel(Load(a)), pixel(Load(b)))));
+}
+
+// Sign extending unpacks of the high (first) or low (last) half
+inline Vector128 UnpackHighS8(const Vector128 &a) {
+  const __m128i x = SwapHalves(Load(a));
+  return Store(_mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8));
+}
+inline Vector128 UnpackLowS8(const Vector128 &a) {
+  const __m128i x = SwapHalves(Load(a));
+  return Store(_mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8));
+}
+inline Vector128 UnpackHighS16(const Vector128 &a) {
+  const __m128i x = SwapHalves(Load(a));
+  return Store(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+}
+inline Vector128 UnpackLowS16(const Vector128 &a) {
+  const __m128i x = SwapHalves(Load(a));
+  return Store(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16));
+}
+// 8/8/8/8 pixels from the 1/5/5/5 ones, the first channel is the sign extended bit
+inline __m128i UnpackPixel(__m128i sext) {
+  return _mm_or_si128(_mm_or_si128(
+    _mm_and_si128(sext, _mm_set1_epi32(static_cast<s32>(0xFF000000))),
+    _mm_and_si128(_mm_slli_epi32(sext, 6), _mm_set1_epi32(0x001F0000))), _mm_or_si128(
+    _mm_and_si128(_mm_slli_epi32(sext, 3), _mm_set1_epi32(0x00001F00)),
+    _mm_and_si128(sext, _mm_set1_epi32(0x0000001F))));
+}
+inline Vector128 UnpackHighPixel(const Vector128 &a) { return Store(UnpackPixel(Load(UnpackHighS16(a)))); }
+inline Vector128 UnpackLowPixel(const Vector128 &a) { return Store(UnpackPixel(Load(UnpackLowS16(a)))); }
+
+// Even (first) and odd element multiplies
+inline Vector128 MulEvenU8(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_mullo_epi16(_mm_srli_epi16(Load(a), 8), _mm_srli_epi16(Load(b), 8)));
+}
+inline Vector128 MulOddU8(const Vector128 &a, const Vector128 &b) {
+  const __m128i mask = _mm_set1_epi16(0xFF);
+  return Store(_mm_mullo_epi16(_mm_and_si128(Load(a), mask), _mm_and_si128(Load(b), mask)));
+}
+inline Vector128 MulEvenS8(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_mullo_epi16(_mm_srai_epi16(Load(a), 8), _mm_srai_epi16(Load(b), 8)));
+}
+inline Vector128 MulOddS8(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_mullo_epi16(_mm_srai_epi16(_mm_slli_epi16(Load(a), 8), 8), _mm_srai_epi16(_mm_slli_epi16(Load(b), 8), 8)));
+}
+inline __m128i MulEvenU16(__m128i x, __m128i y) {
+  const __m128i lo = _mm_mullo_epi16(x, y), hi = _mm_mulhi_epu16(x, y);
+  return _mm_or_si128(_mm_and_si128(hi, _mm_set1_epi32(static_cast<s32>(0xFFFF0000))), _mm_srli_epi32(lo, 16));
+}
+inline __m128i MulOddU16(__m128i x, __m128i y) {
+  const __m128i lo = _mm_mullo_epi16(x, y), hi = _mm_mulhi_epu16(x, y);
+  return _mm_or_si128(_mm_slli_epi32(hi, 16), _mm_and_si128(lo, _mm_set1_epi32(0xFFFF)));
+}
+inline Vector128 MulEvenU16(const Vector128 &a, const Vector128 &b) { return Store(MulEvenU16(Load(a), Load(b))); }
+inline Vector128 MulOddU16(const Vector128 &a, const Vector128 &b) { return Store(MulOddU16(Load(a), Load(b))); }
+inline Vector128 MulEvenS16(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_madd_epi16(_mm_and_si128(Load(a), _mm_set1_epi32(static_cast<s32>(0xFFFF0000))), Load(b)));
+}
+inline Vector128 MulOddS16(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_madd_epi16(_mm_and_si128(Load(a), _mm_set1_epi32(0xFFFF)), Load(b)));
+}
+
+// Multiply-high and add, (a * b) >> 15 + c, optionally rounded
+inline Vector128 MultiplyHighAddSatS16(const Vector128 &a, const Vector128 &b, const Vector128 &c, bool round, bool &sat) {
+  const __m128i x = Load(a), y = Load(b), z = Load(c);
+  const __m128i lo = _mm_mullo_epi16(x, y), hi = _mm_mulhi_epi16(x, y);
+  const __m128i bias = _mm_set1_epi32(round ? 0x4000 : 0);
+  const __m128i p0 = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(_mm_unpacklo_epi16(lo, hi), bias), 15),
+                                   _mm_srai_epi32(_mm_unpacklo_epi16(z, z), 16));
+  const __m128i p1 = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(_mm_unpackhi_epi16(lo, hi), bias), 15),
+                                   _mm_srai_epi32(_mm_unpackhi_epi16(z, z), 16));
+  const __m128i min = _mm_set1_epi32(-32768), max = _mm_set1_epi32(32767);
+  sat |= AnySet(_mm_or_si128(_mm_or_si128(_mm_cmpgt_epi32(p0, max), _mm_cmplt_epi32(p0, min)),
+                             _mm_or_si128(_mm_cmpgt_epi32(p1, max), _mm_cmplt_epi32(p1, min))));
+  return Store(_mm_packs_epi32(p0, p1));
+}
+inline Vector128 MultiplyLowAddU16(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  return Store(_mm_add_epi16(_mm_mullo_epi16(Load(a), Load(b)), Load(c)));
+}
+// Multiply-sum, products of the elements of every word summed into c
+inline Vector128 MultiplySumU8(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  const __m128i x = Load(a), y = Load(b), mask = _mm_set1_epi16(0xFF);
+  const __m128i even = _mm_madd_epi16(_mm_srli_epi16(x, 8), _mm_srli_epi16(y, 8));
+  const __m128i odd = _mm_madd_epi16(_mm_and_si128(x, mask), _mm_and_si128(y, mask));
+  return Store(_mm_add_epi32(_mm_add_epi32(even, odd), Load(c)));
+}
+inline Vector128 MultiplySumMixedS8(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  const __m128i x = Load(a), y = Load(b);
+  const __m128i even = _mm_madd_epi16(_mm_srai_epi16(x, 8), _mm_srli_epi16(y, 8));
+  const __m128i odd = _mm_madd_epi16(_mm_srai_epi16(_mm_slli_epi16(x, 8), 8), _mm_and_si128(y, _mm_set1_epi16(0xFF)));
+  return Store(_mm_add_epi32(_mm_add_epi32(even, odd), Load(c)));
+}
+inline Vector128 MultiplySumU16(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  const __m128i x = Load(a), y = Load(b);
+  return Store(_mm_add_epi32(_mm_add_epi32(MulEvenU16(x, y), MulOddU16(x, y)), Load(c)));
+}
+inline Vector128 MultiplySumS16(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  return Store(_mm_add_epi32(_mm_madd_epi16(Load(a), Load(b)), Load(c)));
+}
+
+// Sums of the elements of every word, saturated into b
+inline Vector128 Sum4SatU8(const Vector128 &a, const Vector128 &b, bool &sat) {
+  const __m128i pairs = _mm_maddubs_epi16(Load(a), _mm_set1_epi8(1));
+  return Store(AddSatU32(_mm_madd_epi16(pairs, _mm_set1_epi16(1)), Load(b), sat));
+}
+inline Vector128 Sum4SatS8(const Vector128 &a, const Vector128 &b, bool &sat) {
+  const __m128i pairs = _mm_maddubs_epi16(_mm_set1_epi8(1), Load(a));
+  return Store(AddSatS32(_mm_madd_epi16(pairs, _mm_set1_epi16(1)), Load(b), sat));
+}
+inline Vector128 Sum4SatS16(const Vector128 &a, const Vector128 &b, bool &sat) {
+  return Store(AddSatS32(_mm_madd_epi16(Load(a), _mm_set1_epi16(1)), Load(b), sat));
+}
+
+// Whole register shifts, by bits (0-7) and by octets (0-16)
+inline Vector128 ShiftLeftBits(const Vector128 &a, u32 sh) {
+  const __m128i x = Load(a);
+  const __m128i next = _mm_srli_si128(x, 4);
+  return Store(_mm_or_si128(_mm_sll_epi32(x, _mm_cvtsi32_si128(sh)), _mm_srl_epi32(next, _mm_cvtsi32_si128(32 - sh))));
+}
+inline Vector128 ShiftRightBits(const Vector128 &a, u32 sh) {
+  const __m128i x = Load(a);
+  const __m128i prev = _mm_slli_si128(x, 4);
+  return Store(_mm_or_si128(_mm_srl_epi32(x, _mm_cvtsi32_si128(sh)), _mm_sll_epi32(prev, _mm_cvtsi32_si128(32 - sh))));
+}
+// Permute control selecting guest bytes sh to sh + 15 of a || b
+inline Vector128 ShiftControl(u32 sh) {
+  return Store(_mm_add_epi8(GuestByteIndex(), _mm_set1_epi8(static_cast<s8>(sh))));
+}
+
+// Kernel table entries
+inline Vector128 Permute_SSSE3(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  // Host index of the selected guest byte, bit 4 picks b
+  const __m128i index = _mm_xor_si128(_mm_and_si128(Load(c), _mm_set1_epi8(0x1F)), _mm_set1_epi8(3));
+  const __m128i fromB = _mm_cmpgt_epi8(index, _mm_set1_epi8(15));
+  return Store(Select(fromB, _mm_shuffle_epi8(Load(b), index), _mm_shuffle_epi8(Load(a), index)));
+}
+VXU_TARGET("sse4.1")
+inline Vector128 Permute_SSE41(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  const __m128i index = _mm_xor_si128(_mm_and_si128(Load(c), _mm_set1_epi8(0x1F)), _mm_set1_epi8(3));
+  // Bit 4 of every byte to bit 7
+  return Store(_mm_blendv_epi8(_mm_shuffle_epi8(Load(a), index), _mm_shuffle_epi8(Load(b), index), _mm_slli_epi16(index, 3)));
+}
+
+inline Vector128 MaxS8_SSE2(const Vector128 &a, const Vector128 &b) {
+  const __m128i x = Load(a), y = Load(b);
+  return Store(Select(_mm_cmpgt_epi8(x, y), x, y));
+}
+inline Vector128 MinS8_SSE2(const Vector128 &a, const Vector128 &b) {
+  const __m128i x = Load(a), y = Load(b);
+  return Store(Select(_mm_cmpgt_epi8(x, y), y, x));
+}
+inline Vector128 MaxU16_SSE2(const Vector128 &a, const Vector128 &b) {
+  const __m128i bias = _mm_set1_epi16(static_cast<s16>(0x8000));
+  return Store(_mm_xor_si128(_mm_max_epi16(_mm_xor_si128(Load(a), bias), _mm_xor_si128(Load(b), bias)), bias));
+}
+inline Vector128 MinU16_SSE2(const Vector128 &a, const Vector128 &b) {
+  const __m128i bias = _mm_set1_epi16(static_cast<s16>(0x8000));
+  return Store(_mm_xor_si128(_mm_min_epi16(_mm_xor_si128(Load(a), bias), _mm_xor_si128(Load(b), bias)), bias));
+}
+inline Vector128 MaxS32_SSE2(const Vector128 &a, const Vector128 &b) {
+  const __m128i x = Load(a), y = Load(b);
+  return Store(Select(_mm_cmpgt_epi32(x, y), x, y));
+}
+inline Vector128 MinS32_SSE2(const Vector128 &a, const Vector128 &b) {
+  const __m128i x = Load(a), y = Load(b);
+  return Store(Select(_mm_cmpgt_epi32(x, y), y, x));
+}
+inline Vector128 MaxU32_SSE2(const Vector128 &a, const Vector128 &b) {
+  const __m128i x = Load(a), y = Load(b);
+  return Store(Select(_mm_cmpgt_epi32(_mm_xor_si128(x, SignBias32()), _mm_xor_si128(y, SignBias32())), x, y));
+}
+inline Vector128 MinU32_SSE2(const Vector128 &a, const Vector128 &b) {
+  const __m128i x = Load(a), y = Load(b);
+  return Store(Select(_mm_cmpgt_epi32(_mm_xor_si128(x, SignBias32()), _mm_xor_si128(y, SignBias32())), y, x));
+}
+VXU_TARGET("sse4.1") inline Vector128 MaxS8_SSE41(const Vector128 &a, const Vector128 &b) { return Store(_mm_max_epi8(Load(a), Load(b))); }
+VXU_TARGET("sse4.1") inline Vector128 MinS8_SSE41(const Vector128 &a, const Vector128 &b) { return Store(_mm_min_epi8(Load(a), Load(b))); }
+VXU_TARGET("sse4.1") inline Vector128 MaxU16_SSE41(const Vector128 &a, const Vector128 &b) { return Store(_mm_max_epu16(Load(a), Load(b))); }
+VXU_TARGET("sse4.1") inline Vector128 MinU16_SSE41(const Vector128 &a, const Vector128 &b) { return Store(_mm_min_epu16(Load(a), Load(b))); }
+VXU_TARGET("sse4.1") inline Vector128 MaxS32_SSE41(const Vector128 &a, const Vector128 &b) { return Store(_mm_max_epi32(Load(a), Load(b))); }
+VXU_TARGET("sse4.1") inline Vector128 MinS32_SSE41(const Vector128 &a, const Vector128 &b) { return Store(_mm_min_epi32(Load(a), Load(b))); }
+VXU_TARGET("sse4.1") inline Vector128 MaxU32_SSE41(const Vector128 &a, const Vector128 &b) { return Store(_mm_max_epu32(Load(a), Load(b))); }
+VXU_TARGET("sse4.1") inline Vector128 MinU32_SSE41(const Vector128 &a, const Vector128 &b) { return Store(_mm_min_epu32(Load(a), Load(b))); }
+
+// Signed words to unsigned halfwords
+inline Vector128 PackS32SatU_SSE2(const Vector128 &a, const Vector128 &b, bool &sat) {
+  const auto clamp = [&sat](__m128i x) {
+    const __m128i negative = _mm_srai_epi32(x, 31);
+    const __m128i over = _mm_cmpgt_epi32(x, _mm_set1_epi32(0xFFFF));
+    sat |= AnySet(_mm_or_si128(negative, over));
+    x = _mm_or_si128(_mm_andnot_si128(_mm_or_si128(negative, over), x), _mm_and_si128(over, _mm_set1_epi32(0xFFFF)));
+    // Into the signed range for packs
+    return _mm_sub_epi32(x, _mm_set1_epi32(0x8000));
+  };
+  const __m128i packed = _mm_packs_epi32(clamp(Load(a)), clamp(Load(b)));
+  return Store(SwapHalves(_mm_xor_si128(packed, _mm_set1_epi16(static_cast<s16>(0x8000)))));
+}
+VXU_TARGET("sse4.1")
+inline Vector128 PackS32SatU_SSE41(const Vector128 &a, const Vector128 &b, bool &sat) {
+  const __m128i x = Load(a), y = Load(b), max = _mm_set1_epi32(0xFFFF);
+  sat |= AnySet(_mm_or_si128(_mm_or_si128(_mm_srai_epi32(x, 31), _mm_cmpgt_epi32(x, max)),
+                             _mm_or_si128(_mm_srai_epi32(y, 31), _mm_cmpgt_epi32(y, max))));
+  return Store(SwapHalves(_mm_packus_epi32(x, y)));
+}
+// Unsigned words to unsigned halfwords
+inline Vector128 PackU32Sat_SSE2(const Vector128 &a, const Vector128 &b, bool &sat) {
+  const auto clamp = [&sat](__m128i x) {
+    const __m128i over = _mm_xor_si128(_mm_cmpeq_epi32(_mm_srli_epi32(x, 16), _mm_setzero_si128()), _mm_set1_epi32(-1));
+    sat |= AnySet(over);
+    x = _mm_or_si128(x, over);
+    return _mm_sub_epi32(_mm_and_si128(x, _mm_set1_epi32(0xFFFF)), _mm_set1_epi32(0x8000));
+  };
+  const __m128i packed = _mm_packs_epi32(clamp(Load(a)), clamp(Load(b)));
+  return Store(SwapHalves(_mm_xor_si128(packed, _mm_set1_epi16(static_cast<s16>(0x8000)))));
+}
+VXU_TARGET("sse4.1")
+inline Vector128 PackU32Sat_SSE41(const Vector128 &a, const Vector128 &b, bool &sat) {
+  const __m128i max = _mm_set1_epi32(0xFFFF);
+  const __m128i x = Load(a), y = Load(b);
+  const __m128i cx = _mm_min_epu32(x, max), cy = _mm_min_epu32(y, max);
+  sat |= AnyDifferent(cx, x) || AnyDifferent(cy, y);
+  return Store(SwapHalves(_mm_packus_epi32(cx, cy)));
+}
+
+// Rounding to an integral value
+inline Vector128 RoundNearest_SSE2(const Vector128 &a) { return Map<f32>(a, [](f32 x) { return std::nearbyint(x); }); }
+inline Vector128 RoundZero_SSE2(const Vector128 &a) { return Map<f32>(a, [](f32 x) { return std::trunc(x); }); }
+inline Vector128 RoundUp_SSE2(const Vector128 &a) { return Map<f32>(a, [](f32 x) { return std::ceil(x); }); }
+inline Vector128 RoundDown_SSE2(const Vector128 &a) { return Map<f32>(a, [](f32 x) { return std::floor(x); }); }
+VXU_TARGET("sse4.1")
+inline Vector128 RoundNearest_SSE41(const Vector128 &a) {
+  return StoreF(_mm_round_ps(LoadF(a), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+VXU_TARGET("sse4.1")
+inline Vector128 RoundZero_SSE41(const Vector128 &a) {
+  return StoreF(_mm_round_ps(LoadF(a), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+VXU_TARGET("sse4.1")
+inline Vector128 RoundUp_SSE41(const Vector128 &a) {
+  return StoreF(_mm_round_ps(LoadF(a), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+VXU_TARGET("sse4.1")
+inline Vector128 RoundDown_SSE41(const Vector128 &a) {
+  return StoreF(_mm_round_ps(LoadF(a), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+// Per word shifts by the low 5 bits of b
+inline Vector128 ShiftLeftU32_SSE2(const Vector128 &a, const Vector128 &b) {
+  return Map<u32>(a, b, [](u32 x, u32 y) { return x << (y & 31); });
+}
+inline Vector128 ShiftRightU32_SSE2(const Vector128 &a, const Vector128 &b) {
+  return Map<u32>(a, b, [](u32 x, u32 y) { return x >> (y & 31); });
+}
+inline Vector128 ShiftRightS32_SSE2(const Vector128 &a, const Vector128 &b) {
+  return Map<s32>(a, b, [](s32 x, s32 y) { return x >> (y & 31); });
+}
+inline Vector128 RotateU32_SSE2(const Vector128 &a, const Vector128 &b) {
+  return Map<u32>(a, b, [](u32 x, u32 y) { return std::rotl(x, y & 31); });
+}
+VXU_TARGET("avx2")
+inline Vector128 ShiftLeftU32_AVX2(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_sllv_epi32(Load(a), _mm_and_si128(Load(b), _mm_set1_epi32(31))));
+}
+VXU_TARGET("avx2")
+inline Vector128 ShiftRightU32_AVX2(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_srlv_epi32(Load(a), _mm_and_si128(Load(b), _mm_set1_epi32(31))));
+}
+VXU_TARGET("avx2")
+inline Vector128 ShiftRightS32_AVX2(const Vector128 &a, const Vector128 &b) {
+  return Store(_mm_srav_epi32(Load(a), _mm_and_si128(Load(b), _mm_set1_epi32(31))));
+}
+VXU_TARGET("avx2")
+inline Vector128 RotateU32_AVX2(const Vector128 &a, const Vector128 &b) {
+  const __m128i x = Load(a), sh = _mm_and_si128(Load(b), _mm_set1_epi32(31));
+  return Store(_mm_or_si128(_mm_sllv_epi32(x, sh), _mm_srlv_epi32(x, _mm_sub_epi32(_mm_set1_epi32(32), sh))));
+}
+
+// a * b + c, fused. Without FMA it's done in double precision: the product is exact there, and the
+// sum is rounded to odd so rounding it again to float gives the same result as a single rounding.
+inline __m128d MultiplyAddDouble(__m128d x, __m128d y, __m128d z) {
+  const __m128d product = _mm_mul_pd(x, y);
+  const __m128d sum = _mm_add_pd(product, z);
+  // Exact rounding error of the sum (TwoSum)
+  const __m128d zPart = _mm_sub_pd(sum, product);
+  const __m128d error = _mm_add_pd(_mm_sub_pd(product, _mm_sub_pd(sum, zPart)), _mm_sub_pd(z, zPart));
+  // Only when inexact, NaN and infinity errors compare false
+  const __m128d signMask = _mm_set1_pd(-0.0);
+  const __m128i inexact = _mm_castpd_si128(_mm_cmplt_pd(_mm_setzero_pd(), _mm_andnot_pd(signMask, error)));
+  // Truncate (one ulp towards zero if the sum was rounded away from it), then set the last bit
+  const __m128i roundedUp = _mm_castpd_si128(_mm_and_pd(_mm_xor_pd(error, sum), signMask));
+  const __m128i truncate = _mm_and_si128(inexact, _mm_srai_epi32(_mm_shuffle_epi32(roundedUp, 0xF5), 31));
+  const __m128i truncated = _mm_add_epi64(_mm_castpd_si128(sum), truncate);
+  return _mm_castsi128_pd(_mm_or_si128(truncated, _mm_and_si128(inexact, _mm_set1_epi64x(1))));
+}
+inline __m128 MultiplyAddDouble(__m128 x, __m128 y, __m128 z) {
+  const __m128 lo = _mm_cvtpd_ps(MultiplyAddDouble(_mm_cvtps_pd(x), _mm_cvtps_pd(y), _mm_cvtps_pd(z)));
+  const __m128 hi = _mm_cvtpd_ps(MultiplyAddDouble(_mm_cvtps_pd(_mm_movehl_ps(x, x)), _mm_cvtps_pd(_mm_movehl_ps(y, y)),
+                                                   _mm_cvtps_pd(_mm_movehl_ps(z, z))));
+  return _mm_movelh_ps(lo, hi);
+}
+inline Vector128 MultiplyAdd_SSE2(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  return StoreF(MultiplyAddDouble(LoadF(a), LoadF(b), LoadF(c)));
+}
+// -(a * b - c)
+inline Vector128 NegMultiplySub_SSE2(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  const __m128 sign = _mm_castsi128_ps(SignBias32());
+  return StoreF(_mm_xor_ps(MultiplyAddDouble(LoadF(a), LoadF(b), _mm_xor_ps(LoadF(c), sign)), sign));
+}
+VXU_TARGET("avx2,fma")
+inline Vector128 MultiplyAdd_FMA(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  return StoreF(_mm_fmadd_ps(LoadF(a), LoadF(b), LoadF(c)));
+}
+VXU_TARGET("avx2,fma")
+inline Vector128 NegMultiplySub_FMA(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  return StoreF(_mm_xor_ps(_mm_fmsub_ps(LoadF(a), LoadF(b), LoadF(c)), _mm_castsi128_ps(SignBias32())));
+}
+
+// Dot products of xyz and xyzw, in every element
+inline Vector128 Dot3_SSE2(const Vector128 &a, const Vector128 &b) {
+  const __m128 m = _mm_and_ps(_mm_mul_ps(LoadF(a), LoadF(b)), _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+  const __m128 s = _mm_add_ps(m, _mm_shuffle_ps(m, m, 0xB1));
+  return StoreF(_mm_add_ps(s, _mm_shuffle_ps(s, s, 0x4E)));
+}
+inline Vector128 Dot4_SSE2(const Vector128 &a, const Vector128 &b) {
+  const __m128 m = _mm_mul_ps(LoadF(a), LoadF(b));
+  const __m128 s = _mm_add_ps(m, _mm_shuffle_ps(m, m, 0xB1));
+  return StoreF(_mm_add_ps(s, _mm_shuffle_ps(s, s, 0x4E)));
+}
+VXU_TARGET("sse4.1")
+inline Vector128 Dot3_SSE41(const Vector128 &a, const Vector128 &b) { return StoreF(_mm_dp_ps(LoadF(a), LoadF(b), 0x7F)); }
+VXU_TARGET("sse4.1")
+inline Vector128 Dot4_SSE41(const Vector128 &a, const Vector128 &b) { return StoreF(_mm_dp_ps(LoadF(a), LoadF(b), 0xFF)); }
+
+#else
+//
+// Scalar Kernels
+//
+
+inline Vector128 FlushDenormals(const Vector128 &a) {
+  return Map<u32>(a, [](u32 x) { return (x & 0x7F800000) ? x : (x & 0x80000000); });
+}
+
+inline Vector128 And(const Vector128 &a, const Vector128 &b) { return a & b; }
+inline Vector128 AndC(const Vector128 &a, const Vector128 &b) { return a & ~b; }
+inline Vector128 Or(const Vector128 &a, const Vector128 &b) { return a | b; }
+inline Vector128 Nor(const Vector128 &a, const Vector128 &b) { return ~(a | b); }
+inline Vector128 Xor(const Vector128 &a, const Vector128 &b) { return a ^ b; }
+inline Vector128 SelectBits(const Vector128 &a, const Vector128 &b, const Vector128 &c) { return (a & ~c) | (b & c); }
+
+inline Vector128 AddU8(const Vector128 &a, const Vector128 &b) { return Map<u8>(a, b, [](u8 x, u8 y) { return x + y; }); }
+inline Vector128 AddU16(const Vector128 &a, const Vector128 &b) { return Map<u16>(a, b, [](u16 x, u16 y) { return x + y; }); }
+inline Vector128 AddU32(const Vector128 &a, const Vector128 &b) { return Map<u32>(a, b, [](u32 x, u32 y) { return x + y; }); }
+inline Vector128 SubU8(const Vector128 &a, const Vector128 &b) { return Map<u8>(a, b, [](u8 x, u8 y) { return x - y; }); }
+inline Vector128 SubU16(const Vector128 &a, const Vector128 &b) { return Map<u16>(a, b, [](u16 x, u16 y) { return x - y; }); }
+inline Vector128 SubU32(const Vector128 &a, const Vector128 &b) { return Map<u32>(a, b, [](u32 x, u32 y) { return x - y; }); }
+
+#define VXU_SAT_KERNEL(name, T, op) \
+inline Vector128 name(const Vector128 &a, const Vector128 &b, bool &sat) { \
+  return Map<T>(a, b, [&sat](T x, T y) { return Saturate<T>(static_cast<s64>(x) op static_cast<s64>(y), sat); }); \
+}
+VXU_SAT_KERNEL(AddSatU8, u8, +)
+VXU_SAT_KERNEL(AddSatS8, s8, +)
+VXU_SAT_KERNEL(AddSatU16, u16, +)
+VXU_SAT_KERNEL(AddSatS16, s16, +)
+VXU_SAT_KERNEL(AddSatU32, u32, +)
+VXU_SAT_KERNEL(AddSatS32, s32, +)
+VXU_SAT_KERNEL(SubSatU8, u8, -)
+VXU_SAT_KERNEL(SubSatS8, s8, -)
+VXU_SAT_KERNEL(SubSatU16, u16, -)
+VXU_SAT_KERNEL(SubSatS16, s16, -)
+VXU_SAT_KERNEL(SubSatU32, u32, -)
+VXU_SAT_KERNEL(SubSatS32, s32, -)
+#undef VXU_SAT_KERNEL
+inline Vector128 AddCarryU32(const Vector128 &a, const Vector128 &b) {
+  return Map<u32>(a, b, [](u32 x, u32 y) { return (static_cast<u64>(x) + y) >> 32; });
+}
+inline Vector128 SubCarryU32(const Vector128 &a, const Vector128 &b) {
+  return Map<u32>(a, b, [](u32 x, u32 y) { return x >= y ? 1 : 0; });
+}
+
+inline Vector128 AvgU8(const Vector128 &a, const Vector128 &b) { return Map<u8>(a, b, [](u8 x, u8 y) { return (x + y + 1) >> 1; }); }
+inline Vector128 AvgU16(const Vector128 &a, const Vector128 &b) { return Map<u16>(a, b, [](u16 x, u16 y) { return (x + y + 1) >> 1; }); }
+inline Vector128 AvgS8(const Vector128 &a, const Vector128 &b) { return Map<s8>(a, b, [](s8 x, s8 y) { return (x + y + 1) >> 1; }); }
+inline Vector128 AvgS16(const Vector128 &a, const Vector128 &b) { return Map<s16>(a, b, [](s16 x, s16 y) { return (x + y + 1) >> 1; }); }
+inline Vector128 AvgU32(const Vector128 &a, const Vector128 &b) {
+  return Map<u32>(a, b, [](u32 x, u32 y) { return (static_cast<u64>(x) + y + 1) >> 1; });
+}
+inline Vector128 AvgS32(const Vector128 &a, const Vector128 &b) {
+  return Map<s32>(a, b, [](s32 x, s32 y) { return (static_cast<s64>(x) + y + 1) >> 1; });
+}
+
+inline Vector128 MaxU8(const Vector128 &a, const Vector128 &b) { return Map<u8>(a, b, [](u8 x, u8 y) { return std::max(x, y); }); }
+inline Vector128 MinU8(const Vector128 &a, const Vector128 &b) { return Map<u8>(a, b, [](u8 x, u8 y) { return std::min(x, y); }); }
+inline Vector128 MaxS16(const Vector128 &a, const Vector128 &b) { return Map<s16>(a, b, [](s16 x, s16 y) { return std::max(x, y); }); }
+inline Vector128 MinS16(const Vector128 &a, const Vector128 &b) { return Map<s16>(a, b, [](s16 x, s16 y) { return std::min(x, y); }); }
+inline Vector128 MaxS8(const Vector128 &a, const Vector128 &b) { return Map<s8>(a, b, [](s8 x, s8 y) { return std::max(x, y); }); }
+inline Vector128 MinS8(const Vector128 &a, const Vector128 &b) { return Map<s8>(a, b, [](s8 x, s8 y) { return std::min(x, y); }); }
+inline Vector128 MaxU16(const Vector128 &a, const Vector128 &b) { return Map<u16>(a, b, [](u16 x, u16 y) { return std::max(x, y); }); }
+inline Vector128 MinU16(const Vector128 &a, const Vector128 &b) { return Map<u16>(a, b, [](u16 x, u16 y) { return std::min(x, y); }); }
+inline Vector128 MaxS32(const Vector128 &a, const Vector128 &b) { return Map<s32>(a, b, [](s32 x, s32 y) { return std::max(x, y); }); }
+inline Vector128 MinS32(const Vector128 &a, const Vector128 &b) { return Map<s32>(a, b, [](s32 x, s32 y) { return std::min(x, y); }); }
+inline Vector128 MaxU32(const Vector128 &a, const Vector128 &b) { return Map<u32>(a, b, [](u32 x, u32 y) { return std::max(x, y); }); }
+inline Vector128 MinU32(const Vector128 &a, const Vector128 &b) { return Map<u32>(a, b, [](u32 x, u32 y) { return std::min(x, y); }); }
+
+#define VXU_CMP_KERNEL(name, T, op) \
+inline Vector128 name(const Vector128 &a, const Vector128 &b) { \
+  return Map<T>(a, b, [](T x, T y) { return (x op y) ? static_cast<T>(-1) : static_cast<T>(0); }); \
+}
+VXU_CMP_KERNEL(CmpEqU8, u8, ==)
+VXU_CMP_KERNEL(CmpEqU16, u16, ==)
+VXU_CMP_KERNEL(CmpEqU32, u32, ==)
+VXU_CMP_KERNEL(CmpGtS8, s8, >)
+VXU_CMP_KERNEL(CmpGtS16, s16, >)
+VXU_CMP_KERNEL(CmpGtS32, s32, >)
+VXU_CMP_KERNEL(CmpGtU8, u8, >)
+VXU_CMP_KERNEL(CmpGtU16, u16, >)
+VXU_CMP_KERNEL(CmpGtU32, u32, >)
+#undef VXU_CMP_KERNEL
+#define VXU_CMP_KERNEL(name, op) \
+inline Vector128 name(const Vector128 &a, const Vector128 &b) { \
+  Vector128 result{}; \
+  for (u32 i = 0; i != 4; i++) { \
+    result.dword[i] = (a.flt[i] op b.flt[i]) ? 0xFFFFFFFF : 0; \
+  } \
+  return result; \
+}
+VXU_CMP_KERNEL(CmpEqF, ==)
+VXU_CMP_KERNEL(CmpGeF, >=)
+VXU_CMP_KERNEL(CmpGtF, >)
+#undef VXU_CMP_KERNEL
+inline Vector128 CmpBoundsF(const Vector128 &a, const Vector128 &b) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    result.dword[i] = (a.flt[i] <= b.flt[i] ? 0 : 0x80000000) | (a.flt[i] >= -b.flt[i] ? 0 : 0x40000000);
+  }
+  return result;
+}
+
+inline Vector128 AddF(const Vector128 &a, const Vector128 &b) { return Map<f32>(a, b, [](f32 x, f32 y) { return x + y; }); }
+inline Vector128 SubF(const Vector128 &a, const Vector128 &b) { return Map<f32>(a, b, [](f32 x, f32 y) { return x - y; }); }
+inline Vector128 MulF(const Vector128 &a, const Vector128 &b) { return Map<f32>(a, b, [](f32 x, f32 y) { return x * y; }); }
+inline Vector128 MaxF(const Vector128 &a, const Vector128 &b) {
+  return Map<f32>(a, b, [](f32 x, f32 y) {
+    if (std::isnan(x) || std::isnan(y)) return x + y;
+    return (x == y) ? std::bit_cast<f32>(std::bit_cast<u32>(x) & std::bit_cast<u32>(y)) : std::max(x, y);
+  });
+}
+inline Vector128 MinF(const Vector128 &a, const Vector128 &b) {
+  return Map<f32>(a, b, [](f32 x, f32 y) {
+    if (std::isnan(x) || std::isnan(y)) return x + y;
+    return (x == y) ? std::bit_cast<f32>(std::bit_cast<u32>(x) | std::bit_cast<u32>(y)) : std::min(x, y);
+  });
+}
+inline Vector128 ReciprocalEstimate(const Vector128 &a) { return Map<f32>(a, [](f32 x) { return 1.0f / x; }); }
+inline Vector128 ReciprocalSqrtEstimate(const Vector128 &a) { return Map<f32>(a, [](f32 x) { return 1.0f / std::sqrt(x); }); }
+
+inline Vector128 ConvertFromS32(const Vector128 &b, u32 uimm) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    result.flt[i] = static_cast<f32>(b.dsword[i]) * Pow2(-static_cast<s32>(uimm));
+  }
+  return result;
+}
+inline Vector128 ConvertFromU32(const Vector128 &b, u32 uimm) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    result.flt[i] = static_cast<f32>(b.dword[i]) * Pow2(-static_cast<s32>(uimm));
+  }
+  return result;
+}
+inline Vector128 ConvertToS32Sat(const Vector128 &b, u32 uimm, bool &sat) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    const f64 value = std::trunc(static_cast<f64>(b.flt[i]) * Pow2(uimm));
+    result.dsword[i] = std::isnan(value) ? 0 : Saturate<s32>(static_cast<s64>(std::clamp(value, -4294967296.0, 4294967296.0)), sat);
+  }
+  return result;
+}
+inline Vector128 ConvertToU32Sat(const Vector128 &b, u32 uimm, bool &sat) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    const f64 value = std::trunc(static_cast<f64>(b.flt[i]) * Pow2(uimm));
+    result.dword[i] = std::isnan(value) ? 0 : Saturate<u32>(static_cast<s64>(std::clamp(value, -4294967296.0, 8589934592.0)), sat);
+  }
+  return result;
+}
+
+#define VXU_MERGE_KERNEL(name, get, set, count, first) \
+inline Vector128 name(const Vector128 &a, const Vector128 &b) { \
+  Vector128 result{}; \
+  for (u32 i = 0; i != count / 2; i++) { \
+    set(result, i * 2, get(a, first + i)); \
+    set(result, i * 2 + 1, get(b, first + i)); \
+  } \
+  return result; \
+}
+inline u32 GetWord(const Vector128 &v, u32 i) { return v.dword[i]; }
+inline void SetWord(Vector128 &v, u32 i, u32 value) { v.dword[i] = value; }
+VXU_MERGE_KERNEL(MergeHighU8, GetByte, SetByte, 16, 0)
+VXU_MERGE_KERNEL(MergeLowU8, GetByte, SetByte, 16, 8)
+VXU_MERGE_KERNEL(MergeHighU16, GetHalf, SetHalf, 8, 0)
+VXU_MERGE_KERNEL(MergeLowU16, GetHalf, SetHalf, 8, 4)
+VXU_MERGE_KERNEL(MergeHighU32, GetWord, SetWord, 4, 0)
+VXU_MERGE_KERNEL(MergeLowU32, GetWord, SetWord, 4, 2)
+#undef VXU_MERGE_KERNEL
+
+// Packs guest order elements of a || b with op
+template <typename F>
+inline Vector128 PackHalves(const Vector128 &a, const Vector128 &b, F op) {
+  Vector128 result{};
+  for (u32 i = 0; i != 8; i++) {
+    SetByte(result, i, op(GetHalf(a, i)));
+    SetByte(result, i + 8, op(GetHalf(b, i)));
+  }
+  return result;
+}
+template <typename F>
+inline Vector128 PackWords(const Vector128 &a, const Vector128 &b, F op) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    SetHalf(result, i, op(a.dword[i]));
+    SetHalf(result, i + 4, op(b.dword[i]));
+  }
+  return result;
+}
+inline Vector128 PackU16Mod(const Vector128 &a, const Vector128 &b) { return PackHalves(a, b, [](u16 x) { return static_cast<u8>(x); }); }
+inline Vector128 PackU32Mod(const Vector128 &a, const Vector128 &b) { return PackWords(a, b, [](u32 x) { return static_cast<u16>(x); }); }
+inline Vector128 PackU16Sat(const Vector128 &a, const Vector128 &b, bool &sat) {
+  return PackHalves(a, b, [&sat](u16 x) { return Saturate<u8>(x, sat); });
+}
+inline Vector128 PackS16SatU(const Vector128 &a, const Vector128 &b, bool &sat) {
+  return PackHalves(a, b, [&sat](u16 x) { return Saturate<u8>(static_cast<s16>(x), sat); });
+}
+inline Vector128 PackS16Sat(const Vector128 &a, const Vector128 &b, bool &sat) {
+  return PackHalves(a, b, [&sat](u16 x) { return static_cast<u8>(Saturate<s8>(static_cast<s16>(x), sat)); });
+}
+inline Vector128 PackS32Sat(const Vector128 &a, const Vector128 &b, bool &sat) {
+  return PackWords(a, b, [&sat](u32 x) { return static_cast<u16>(Saturate<s16>(static_cast<s32>(x), sat)); });
+}
+inline Vector128 PackS32SatU(const Vector128 &a, const Vector128 &b, bool &sat) {
+  return PackWords(a, b, [&sat](u32 x) { return Saturate<u16>(static_cast<s32>(x), sat); });
+}
+inline Vector128 PackU32Sat(const Vector128 &a, const Vector128 &b, bool &sat) {
+  return PackWords(a, b, [&sat](u32 x) { return Saturate<u16>(x, sat); });
+}
+inline Vector128 PackPixel(const Vector128 &a, const Vector128 &b) {
+  return PackWords(a, b, [](u32 x) { return static_cast<u16>(((x >> 9) & 0xFC00) | ((x >> 6) & 0x3E0) | ((x >> 3) & 0x1F)); });
+}
+
+inline Vector128 UnpackHighS8(const Vector128 &a) {
+  Vector128 result{};
+  for (u32 i = 0; i != 8; i++) {
+    SetHalf(result, i, static_cast<s8>(GetByte(a, i)));
+  }
+  return result;
+}
+inline Vector128 UnpackLowS8(const Vector128 &a) {
+  Vector128 result{};
+  for (u32 i = 0; i != 8; i++) {
+    SetHalf(result, i, static_cast<s8>(GetByte(a, i + 8)));
+  }
+  return result;
+}
+inline Vector128 UnpackHighS16(const Vector128 &a) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    result.dsword[i] = static_cast<s16>(GetHalf(a, i));
+  }
+  return result;
+}
+inline Vector128 UnpackLowS16(const Vector128 &a) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    result.dsword[i] = static_cast<s16>(GetHalf(a, i + 4));
+  }
+  return result;
+}
+inline u32 UnpackPixel(u16 x) {
+  return ((x & 0x8000) ? 0xFF000000 : 0) | ((x & 0x7C00) << 6) | ((x & 0x3E0) << 3) | (x & 0x1F);
+}
+inline Vector128 UnpackHighPixel(const Vector128 &a) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    result.dword[i] = UnpackPixel(GetHalf(a, i));
+  }
+  return result;
+}
+inline Vector128 UnpackLowPixel(const Vector128 &a) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    result.dword[i] = UnpackPixel(GetHalf(a, i + 4));
+  }
+  return result;
+}
+
+// Even elements are the most significant half of every pair
+inline Vector128 MulEvenU8(const Vector128 &a, const Vector128 &b) { return Map<u16>(a, b, [](u16 x, u16 y) { return (x >> 8) * (y >> 8); }); }
+inline Vector128 MulOddU8(const Vector128 &a, const Vector128 &b) { return Map<u16>(a, b, [](u16 x, u16 y) { return (x & 0xFF) * (y & 0xFF); }); }
+inline Vector128 MulEvenS8(const Vector128 &a, const Vector128 &b) { return Map<s16>(a, b, [](s16 x, s16 y) { return (x >> 8) * (y >> 8); }); }
+inline Vector128 MulOddS8(const Vector128 &a, const Vector128 &b) {
+  return Map<s16>(a, b, [](s16 x, s16 y) { return static_cast<s8>(x) * static_cast<s8>(y); });
+}
+inline Vector128 MulEvenU16(const Vector128 &a, const Vector128 &b) { return Map<u32>(a, b, [](u32 x, u32 y) { return (x >> 16) * (y >> 16); }); }
+inline Vector128 MulOddU16(const Vector128 &a, const Vector128 &b) { return Map<u32>(a, b, [](u32 x, u32 y) { return (x & 0xFFFF) * (y & 0xFFFF); }); }
+inline Vector128 MulEvenS16(const Vector128 &a, const Vector128 &b) { return Map<s32>(a, b, [](s32 x, s32 y) { return (x >> 16) * (y >> 16); }); }
+inline Vector128 MulOddS16(const Vector128 &a, const Vector128 &b) {
+  return Map<s32>(a, b, [](s32 x, s32 y) { return static_cast<s16>(x) * static_cast<s16>(y); });
+}
+
+inline Vector128 MultiplyHighAddSatS16(const Vector128 &a, const Vector128 &b, const Vector128 &c, bool round, bool &sat) {
+  return Map<s16>(a, b, c, [round, &sat](s16 x, s16 y, s16 z) {
+    return Saturate<s16>(((static_cast<s32>(x) * y + (round ? 0x4000 : 0)) >> 15) + z, sat);
+  });
+}
+inline Vector128 MultiplyLowAddU16(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  return Map<u16>(a, b, c, [](u16 x, u16 y, u16 z) { return x * y + z; });
+}
+inline Vector128 MultiplySumU8(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  Vector128 result = c;
+  for (u32 i = 0; i != 16; i++) {
+    result.dword[i / 4] += static_cast<u32>(a.bytes[i]) * b.bytes[i];
+  }
+  return result;
+}
+inline Vector128 MultiplySumMixedS8(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  Vector128 result = c;
+  for (u32 i = 0; i != 16; i++) {
+    result.dword[i / 4] += static_cast<u32>(static_cast<s8>(a.bytes[i]) * b.bytes[i]);
+  }
+  return result;
+}
+inline Vector128 MultiplySumU16(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  Vector128 result = c;
+  for (u32 i = 0; i != 8; i++) {
+    result.dword[i / 2] += static_cast<u32>(a.word[i]) * b.word[i];
+  }
+  return result;
+}
+inline Vector128 MultiplySumS16(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  Vector128 result = c;
+  for (u32 i = 0; i != 8; i++) {
+    result.dword[i / 2] += static_cast<u32>(static_cast<s32>(a.sword[i]) * b.sword[i]);
+  }
+  return result;
+}
+
+inline Vector128 Sum4SatU8(const Vector128 &a, const Vector128 &b, bool &sat) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    s64 sum = b.dword[i];
+    for (u32 j = 0; j != 4; j++) {
+      sum += a.bytes[i * 4 + j];
+    }
+    result.dword[i] = Saturate<u32>(sum, sat);
+  }
+  return result;
+}
+inline Vector128 Sum4SatS8(const Vector128 &a, const Vector128 &b, bool &sat) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    s64 sum = b.dsword[i];
+    for (u32 j = 0; j != 4; j++) {
+      sum += static_cast<s8>(a.bytes[i * 4 + j]);
+    }
+    result.dsword[i] = Saturate<s32>(sum, sat);
+  }
+  return result;
+}
+inline Vector128 Sum4SatS16(const Vector128 &a, const Vector128 &b, bool &sat) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    const s64 sum = static_cast<s64>(b.dsword[i]) + a.sword[i * 2] + a.sword[i * 2 + 1];
+    result.dsword[i] = Saturate<s32>(sum, sat);
+  }
+  return result;
+}
+
+inline Vector128 ShiftLeftBits(const Vector128 &a, u32 sh) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    const u64 pair = (static_cast<u64>(a.dword[i]) << 32) | (i != 3 ? a.dword[i + 1] : 0);
+    result.dword[i] = static_cast<u32>((pair << sh) >> 32);
+  }
+  return result;
+}
+inline Vector128 ShiftRightBits(const Vector128 &a, u32 sh) {
+  Vector128 result{};
+  for (u32 i = 0; i != 4; i++) {
+    const u64 pair = (static_cast<u64>(i != 0 ? a.dword[i - 1] : 0) << 32) | a.dword[i];
+    result.dword[i] = static_cast<u32>(pair >> sh);
+  }
+  return result;
+}
+inline Vector128 ShiftControl(u32 sh) {
+  Vector128 result{};
+  for (u32 i = 0; i != 16; i++) {
+    SetByte(result, i, static_cast<u8>(sh + i));
+  }
+  return result;
+}
+
+inline Vector128 Permute(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  Vector128 result{};
+  for (u32 i = 0; i != 16; i++) {
+    const u8 index = GetByte(c, i) & 0x1F;
+    SetByte(result, i, index < 16 ? GetByte(a, index) : GetByte(b, index - 16));
+  }
+  return result;
+}
+
+inline Vector128 RoundNearest(const Vector128 &a) { return Map<f32>(a, [](f32 x) { return std::nearbyint(x); }); }
+inline Vector128 RoundZero(const Vector128 &a) { return Map<f32>(a, [](f32 x) { return std::trunc(x); }); }
+inline Vector128 RoundUp(const Vector128 &a) { return Map<f32>(a, [](f32 x) { return std::ceil(x); }); }
+inline Vector128 RoundDown(const Vector128 &a) { return Map<f32>(a, [](f32 x) { return std::floor(x); }); }
+
+inline Vector128 ShiftLeftU32(const Vector128 &a, const Vector128 &b) { return Map<u32>(a, b, [](u32 x, u32 y) { return x << (y & 31); }); }
+inline Vector128 ShiftRightU32(const Vector128 &a, const Vector128 &b) { return Map<u32>(a, b, [](u32 x, u32 y) { return x >> (y & 31); }); }
+inline Vector128 ShiftRightS32(const Vector128 &a, const Vector128 &b) { return Map<s32>(a, b, [](s32 x, s32 y) { return x >> (y & 31); }); }
+inline Vector128 RotateU32(const Vector128 &a, const Vector128 &b) { return Map<u32>(a, b, [](u32 x, u32 y) { return std::rotl(x, y & 31); }); }
+
+inline Vector128 MultiplyAdd(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  return Map<f32>(a, b, c, [](f32 x, f32 y, f32 z) { return std::fma(x, y, z); });
+}
+inline Vector128 NegMultiplySub(const Vector128 &a, const Vector128 &b, const Vector128 &c) {
+  return Map<f32>(a, b, c, [](f32 x, f32 y, f32 z) { return -std::fma(x, y, -z); });
+}
+
+inline Vector128 Dot3(const Vector128 &a, const Vector128 &b) {
+  // Same association as the SIMD ones, w contributes +0
+  return Base::Vector128f((a.flt[0] * b.flt[0] + a.flt[1] * b.flt[1]) + (a.flt[2] * b.flt[2] + 0.0f));
+}
+inline Vector128 Dot4(const Vector128 &a, const Vector128 &b) {
+  return Base::Vector128f((a.flt[0] * b.flt[0] + a.flt[1] * b.flt[1]) + (a.flt[2] * b.flt[2] + a.flt[3] * b.flt[3]));
+}
+#endif // VXU_SIMD
+
+//
+// Kernel Table
+//
+
+using KernelOp1 = Vector128 (*)(const Vector128 &a);
+using KernelOp2 = Vector128 (*)(const Vector128 &a, const Vector128 &b);
+using KernelOp3 = Vector128 (*)(const Vector128 &a, const Vector128 &b, const Vector128 &c);
+using KernelOp2Sat = Vector128 (*)(const Vector128 &a, const Vector128 &b, bool &sat);
+
+// Kernels with variants for newer host extensions
+struct Kernels {
+  KernelOp3 permute;
+  KernelOp2 maxS8, minS8, maxU16, minU16, maxS32, minS32, maxU32, minU32;
+  KernelOp2Sat packS32SatU, packU32Sat;
+  KernelOp1 roundNearest, roundZero, roundUp, roundDown;
+  KernelOp2 shiftLeftU32, shiftRightU32, shiftRightS32, rotateU32;
+  KernelOp3 multiplyAdd, negMultiplySub;
+  KernelOp2 dot3, dot4;
+};
+
+inline Kernels SelectKernels() {
+#ifdef VXU_SIMD
+  const Base::HostCPUFeatures &host = Base::GetHostCPUFeatures();
+  Kernels kernels = {
+    Permute_SSSE3,
+    MaxS8_SSE2, MinS8_SSE2, MaxU16_SSE2, MinU16_SSE2, MaxS32_SSE2, MinS32_SSE2, MaxU32_SSE2, MinU32_SSE2,
+    PackS32SatU_SSE2, PackU32Sat_SSE2,
+    RoundNearest_SSE2, RoundZero_SSE2, RoundUp_SSE2, RoundDown_SSE2,
+    ShiftLeftU32_SSE2, ShiftRightU32_SSE2, ShiftRightS32_SSE2, RotateU32_SSE2,
+    MultiplyAdd_SSE2, NegMultiplySub_SSE2,
+    Dot3_SSE2, Dot4_SSE2
+  };
+  if (host.sse41) {
+    kernels.permute = Permute_SSE41;
+    kernels.maxS8 = MaxS8_SSE41;
+    kernels.minS8 = MinS8_SSE41;
+    kernels.maxU16 = MaxU16_SSE41;
+    kernels.minU16 = MinU16_SSE41;
+    kernels.maxS32 = MaxS32_SSE41;
+    kernels.minS32 = MinS32_SSE41;
+    kernels.maxU32 = MaxU32_SSE41;
+    kernels.minU32 = MinU32_SSE41;
+    kernels.packS32SatU = PackS32SatU_SSE41;
+    kernels.packU32Sat = PackU32Sat_SSE41;
+    kernels.roundNearest = RoundNearest_SSE41;
+    kernels.roundZero = RoundZero_SSE41;
+    kernels.roundUp = RoundUp_SSE41;
+    kernels.roundDown = RoundDown_SSE41;
+    kernels.dot3 = Dot3_SSE41;
+    kernels.dot4 = Dot4_SSE41;
+  }
+  if (host.avx2) {
+    kernels.shiftLeftU32 = ShiftLeftU32_AVX2;
+    kernels.shiftRightU32 = ShiftRightU32_AVX2;
+    kernels.shiftRightS32 = ShiftRightS32_AVX2;
+    kernels.rotateU32 = RotateU32_AVX2;
+  }
+  if (host.avx2 && host.fma) {
+    kernels.multiplyAdd = MultiplyAdd_FMA;
+    kernels.negMultiplySub = NegMultiplySub_FMA;
+  }
+  return kernels;
+#else
+  return {
+    Permute,
+    MaxS8, MinS8, MaxU16, MinU16, MaxS32, MinS32, MaxU32, MinU32,
+    PackS32SatU, PackU32Sat,
+    RoundNearest, RoundZero, RoundUp, RoundDown,
+    ShiftLeftU32, ShiftRightU32, ShiftRightS32, RotateU32,
+    MultiplyAdd, NegMultiplySub,
+    Dot3, Dot4
+  };
+#endif
+}
+
+// Selected once, on startup
+inline const Kernels kernels = SelectKernels();
+
+// Guest bytes n to n + 15 of a || b
+inline Vector128 ShiftLeftDouble(const Vector128 &a, const Vector128 &b, u32 n) {
+  return kernels.permute(a, b, ShiftControl(n));
+}
+inline Vector128 ShiftLeftOctets(const Vector128 &a, u32 n) {
+  return ShiftLeftDouble(a, Vector128{}, n);
+}
+inline Vector128 ShiftRightOctets(const Vector128 &a, u32 n) {
+  return ShiftLeftDouble(Vector128{}, a, 16 - n);
+}
+
+//
+// Xenos Vertex Formats
+//
+// vpkd3d128/vupkd3d128 convert between floats and the packed formats D3D uses for vertex data.
+// Packed integers are stored as floats biased by 3.0, so their bits land in the low mantissa bits.
+//
+
+// Xenos half floats have no infinity or NaN, the largest exponent is a regular one
+inline u16 FloatToXenosHalf(f32 value) {
+  u32 bits = std::bit_cast<u32>(value);
+  const u16 sign = static_cast<u16>((bits >> 16) & 0x8000);
+  bits &= 0x7FFFFFFF;
+  // Too large and NaN saturate
+  if (bits > 0x47FFEFFF)
+    return sign | 0x7FFF;
+  if (bits < 0x38800000) {
+    // Denormalized half
+    const u32 shift = 113 - (bits >> 23);
+    bits = shift < 24 ? (0x800000 | (bits & 0x7FFFFF)) >> shift : 0;
+  } else {
+    // Rebias the exponent
+    bits += 0xC8000000;
+  }
+  return sign | static_cast<u16>(((bits + 0x0FFF + ((bits >> 13) & 1)) >> 13) & 0x7FFF);
+}
+
+inline f32 XenosHalfToFloat(u16 value) {
+  const u32 sign = static_cast<u32>(value & 0x8000) << 16;
+  s32 exponent = (value >> 10) & 0x1F;
+  u32 mantissa = value & 0x3FF;
+  if (exponent == 0) {
+    if (mantissa == 0)
+      return std::bit_cast<f32>(sign);
+    // Denormalized half, normalize it
+    exponent = 1;
+    while (!(mantissa & 0x400)) {
+      mantissa <<= 1;
+      exponent--;
+    }
+    mantissa &= 0x3FF;
+  }
+  return std::bit_cast<f32>(sign | (static_cast<u32>(exponent + 112) << 23) | (mantissa << 13));
+}
+
+// Low bits of a biased float clamped to [min, max]
+inline u32 PackBiased(f32 value, u32 min, u32 max) {
+  return std::bit_cast<u32>(std::clamp(value, std::bit_cast<f32>(min), std::bit_cast<f32>(max)));
+}
+
+inline constexpr u32 kBiasedOne = 0x3F800000; // 1.0
+inline constexpr u32 kBiasedThree = 0x40400000; // 3.0
+
+// Packs a, 64 bits at most are written to words 2 and 3, according to the vpkd3d128 type
+inline Vector128 PackD3D(const Vector128 &a, u32 type, bool &valid) {
+  Vector128 result{};
+  valid = true;
+  switch (type) {
+  case 0: { // D3DCOLOR, ARGB from xyzw
+    const auto channel = [&a](u32 i) { return PackBiased(a.flt[i], kBiasedThree, kBiasedThree + 0xFF) & 0xFF; };
+    result.dword[3] = (channel(3) << 24) | (channel(0) << 16) | (channel(1) << 8) | channel(2);
+  } break;
+  case 1: // NORMSHORT2
+  case 4: { // NORMSHORT4
+    const auto channel = [&a](u32 i) { return PackBiased(a.flt[i], kBiasedThree - 0x7FFF, kBiasedThree + 0x7FFF) & 0xFFFF; };
+    if (type == 1) {
+      result.dword[3] = (channel(0) << 16) | channel(1);
+    } else {
+      result.dword[2] = (channel(0) << 16) | channel(1);
+      result.dword[3] = (channel(2) << 16) | channel(3);
+    }
+  } break;
+  case 2: { // NORMPACKED32, 2_10_10_10 as wzyx
+    const auto channel = [&a](u32 i) { return PackBiased(a.flt[i], kBiasedThree - 0x1FF, kBiasedThree + 0x1FF) & 0x3FF; };
+    const u32 w = PackBiased(a.flt[3], kBiasedThree, kBiasedThree + 3) & 3;
+    result.dword[3] = (w << 30) | (channel(2) << 20) | (channel(1) << 10) | channel(0);
+  } break;
+  case 3: // FLOAT16_2
+    result.dword[3] = (static_cast<u32>(FloatToXenosHalf(a.flt[0])) << 16) | FloatToXenosHalf(a.flt[1]);
+    break;
+  case 5: // FLOAT16_4
+    result.dword[2] = (static_cast<u32>(FloatToXenosHalf(a.flt[0])) << 16) | FloatToXenosHalf(a.flt[1]);
+    result.dword[3] = (static_cast<u32>(FloatToXenosHalf(a.flt[2])) << 16) | FloatToXenosHalf(a.flt[3]);
+    break;
+  case 6: { // NORMPACKED64, 4_20_20_20 as wzyx
+    const auto channel = [&a](u32 i) {
+      return static_cast<u64>(PackBiased(a.flt[i], kBiasedThree - 0x7FFFF, kBiasedThree + 0x7FFFF) & 0xFFFFF);
+    };
+    const u64 w = PackBiased(a.flt[3], kBiasedThree, kBiasedThree + 0xF) & 0xF;
+    const u64 packed = (w << 60) | (channel(2) << 40) | (channel(1) << 20) | channel(0);
+    result.dword[2] = static_cast<u32>(packed >> 32);
+    result.dword[3] = static_cast<u32>(packed);
+  } break;
+  default:
+    valid = false;
+    break;
+  }
+  return result;
+}
+
+// Unpacks the vupkd3d128 type from the last words of a
+inline Vector128 UnpackD3D(const Vector128 &a, u32 type, bool &valid) {
+  Vector128 result{};
+  valid = true;
+  // Sign extended bits field of packed into a 3.0 biased float
+  const auto biased = [](u64 packed, u32 shift, u32 bits) {
+    const s32 value = static_cast<s32>(static_cast<u32>(packed >> shift) << (32 - bits)) >> (32 - bits);
+    return kBiasedThree + value;
+  };
+  switch (type) {
+  case 0: { // D3DCOLOR, xyzw from ARGB
+    const u32 color = a.dword[3];
+    result.dword[0] = kBiasedOne | ((color >> 16) & 0xFF);
+    result.dword[1] = kBiasedOne | ((color >> 8) & 0xFF);
+    result.dword[2] = kBiasedOne | (color & 0xFF);
+    result.dword[3] = kBiasedOne | (color >> 24);
+  } break;
+  case 1: // NORMSHORT2
+    result.dword[0] = biased(a.dword[3], 16, 16);
+    result.dword[1] = biased(a.dword[3], 0, 16);
+    result.flt[2] = 0.0f;
+    result.flt[3] = 1.0f;
+    break;
+  case 4: // NORMSHORT4
+    result.dword[0] = biased(a.dword[2], 16, 16);
+    result.dword[1] = biased(a.dword[2], 0, 16);
+    result.dword[2] = biased(a.dword[3], 16, 16);
+    result.dword[3] = biased(a.dword[3], 0, 16);
+    break;
+  case 2: // NORMPACKED32, 2_10_10_10 as wzyx
+    result.dword[0] = biased(a.dword[3], 0, 10);
+    result.dword[1] = biased(a.dword[3], 10, 10);
+    result.dword[2] = biased(a.dword[3], 20, 10);
+    result.dword[3] = kBiasedThree + (a.dword[3] >> 30);
+    break;
+  case 3: // FLOAT16_2
+    result.flt[0] = XenosHalfToFloat(static_cast<u16>(a.dword[3] >> 16));
+    result.flt[1] = XenosHalfToFloat(static_cast<u16>(a.dword[3]));
+    result.flt[2] = 0.0f;
+    result.flt[3] = 1.0f;
+    break;
+  case 5: // FLOAT16_4
+    result.flt[0] = XenosHalfToFloat(static_cast<u16>(a.dword[2] >> 16));
+    result.flt[1] = XenosHalfToFloat(static_cast<u16>(a.dword[2]));
+    result.flt[2] = XenosHalfToFloat(static_cast<u16>(a.dword[3] >> 16));
+    result.flt[3] = XenosHalfToFloat(static_cast<u16>(a.dword[3]));
+    break;
+  case 6: { // NORMPACKED64, 4_20_20_20 as wzyx
+    const u64 packed = (static_cast<u64>(a.dword[2]) << 32) | a.dword[3];
+    result.dword[0] = biased(packed, 0, 20);
+    result.dword[1] = biased(packed, 20, 20);
+    result.dword[2] = biased(packed, 40, 20);
+    result.dword[3] = kBiasedThree + static_cast<u32>(packed >> 60);
+  } break;
+  default:
+    valid = false;
+    break;
+  }
+  return result;
+}
+
+} // namespace VXU
@@ -0,0 +1,137 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#pragma once
+
+//
+// Effective to Real Address Translation cache (ERAT).
+//
+// Software model of the per-thread I-ERAT/D-ERAT found on the Xenon PPE: 64 entries, 2 way set
+// associative, indexed by the 4KB effective page. Every entry is tagged with the MSR bits that
+// were used during the translation (SF, HV, PR, IR, DR), so a mode change simply misses instead of
+// requiring a flush. Owned and accessed only by its hardware thread, so no locking is needed.
+// Pages backed by main RAM also carry the host address of the page, so loads and stores to them
+// can skip the bus entirely. The JIT probes the D-ERAT inline, hits from generated code don't
+// update the replacement way.
+//
+
+// Amount of entries in each ERAT.
+#define XE_ERAT_ENTRIES 64
+// Associativity of each ERAT.
+#define XE_ERAT_WAYS 2
+// Amount of sets (congruence classes).
+#define XE_ERAT_SETS (XE_ERAT_ENTRIES / XE_ERAT_WAYS)
+
+// Tag value used for invalid entries, no valid EA page can ever match this.
+#define XE_ERAT_INVALID_TAG 0xFFFFFFFFFFFFFFFFULL
+
+struct ERATEntry {
+  // Effective page number (EA >> 12).
+  u64 eaPage = XE_ERAT_INVALID_TAG;
+  // Real page address (RA & ~0xFFF).
+  u64 raPage = 0;
+  // Host address of the page when it is backed by main RAM, nullptr otherwise.
+  u8 *hostPage = nullptr;
+  // MSR mode bits this translation is valid for.
+  u8 mode = 0;
+};
+
+class alignas(64) ERAT {
+public:
+  ERAT() { InvalidateAll(); }
+
+  // Builds the mode tag for an entry from the current MSR bits.
+  static constexpr u8 BuildMode(bool SF, bool HV, bool PR, bool IR, bool DR) {
+    return static_cast<u8>((SF << 4) | (HV << 3) | (PR << 2) | (IR << 1) | DR);
+  }
+
+  // Looks up a translation, returns true and the real page address on hit.
+  inline bool Lookup(u64 EA, u8 mode, u64 *raPage) {
+    const u64 eaPage = EA >> 12;
+    ERATEntry *set = &entries[eaPage & (XE_ERAT_SETS - 1)][0];
+    for (u8 way = 0; way < XE_ERAT_WAYS; way++) {
+      if (set[way].eaPage == eaPage && set[way].mode == mode) {
+        // Mark the other way as the next one to be replaced.
+        lruWay[eaPage & (XE_ERAT_SETS - 1)] = way ^ 1;
+        *raPage = set[way].raPage;
+        hits++;
+        return true;
+      }
+    }
+    misses++;
+    return false;
+  }
+
+  // Looks up a RAM backed translation, returns the host address for EA on hit, nullptr otherwise.
+  // Also returns the real address of the access, needed for reservation checks.
+  inline u8 *LookupHost(u64 EA, u8 mode, u64 *RA) {
+    const u64 eaPage = EA >> 12;
+    ERATEntry *set = &entries[eaPage & (XE_ERAT_SETS - 1)][0];
+    for (u8 way = 0; way < XE_ERAT_WAYS; way++) {
+      if (set[way].eaPage == eaPage && set[way].mode == mode) {
+        if (!set[way].hostPage) {
+          return nullptr;
+        }
+        lruWay[eaPage & (XE_ERAT_SETS - 1)] = way ^ 1;
+        *RA = set[way].raPage | (EA & 0xFFF);
+        hits++;
+        return set[way].hostPage + (EA & 0xFFF);
+      }
+    }
+    return nullptr;
+  }
+
+  // Inserts a translation, replacing the least recently used way of the set.
+  inline void Insert(u64 EA, u64 RA, u8 mode, u8 *hostPage) {
+    const u64 eaPage = EA >> 12;
+    const u32 setIdx = eaPage & (XE_ERAT_SETS - 1);
+    ERATEntry *set = &entries[setIdx][0];
+    u8 way = lruWay[setIdx];
+    // Prefer refreshing an existing entry for the same page.
+    for (u8 i = 0; i < XE_ERAT_WAYS; i++) {
+      if (set[i].eaPage == eaPage) {
+        way = i;
+        break;
+      }
+    }
+    set[way].eaPage = eaPage;
+    set[way].raPage = RA & ~0xFFFULL;
+    set[way].hostPage = hostPage;
+    set[way].mode = mode;
+    lruWay[setIdx] = way ^ 1;
+  }
+
+  // Invalidates every entry that maps a page inside [EA, EA + size).
+  void InvalidateRange(u64 EA, u64 size) {
+    const u64 firstPage = EA >> 12;
+    const u64 lastPage = (EA + size - 1) >> 12;
+    // Large ranges cover every set, cheaper to just scan all entries once.
+    for (auto &set : entries) {
+      for (auto &entry : set) {
+        if (entry.eaPage != XE_ERAT_INVALID_TAG && entry.eaPage >= firstPage && entry.eaPage <= lastPage) {
+          entry.eaPage = XE_ERAT_INVALID_TAG;
+        }
+      }
+    }
+  }
+
+  // Invalidates the whole ERAT.
+  void InvalidateAll() {
+    for (auto &set : entries) {
+      for (auto &entry : set) {
+        entry.eaPage = XE_ERAT_INVALID_TAG;
+      }
+    }
+    for (auto &way : lruWay) {
+      way = 0;
+    }
+  }
+
+  // Statistics, flushed periodically to microprofile by the owning PPU.
+  u64 hits = 0;
+  u64 misses = 0;
+
+  // Public so JIT loads and stores can probe the sets from generated code.
+  ERATEntry entries[XE_ERAT_SETS][XE_ERAT_WAYS];
+private:
+  u8 lruWay[XE_ERAT_SETS];
+};
@@ -7,12 +7,15 @@
 #include <thread>
 
 #include "Core/XeMain.h"
+#include "Core/SaveState.h"
+#include "Core/Scheduler.h"
 #include "Base/Config.h"
 #include "Base/Thread.h"
 #include "Base/Logging/Log.h"
 #include "Core/XCPU/Interpreter/PPCInterpreter.h"
 #include "Core/XCPU/elf_abi.h"
 #include "PPU_JIT.h"
+#include "PPU_DecodeCache.h"
 
 // Clocks per instruction / Ticks per instruction
 static constexpr f64 cpi_a = -5.8868;
@@ -53,6 +56,9 @@ PPU::PPU(XENON_CONTEXT *inXenonContext, RootBus *mainBus, u64 resetVector, u32 P
   case "Hybrid"_jLower:
     currentExecMode = eExecutorMode::Hybrid;
     break;
+  case "Cached"_jLower:
+    currentExecMode = eExecutorMode::Cached;
+    break;
   default:
     LOG_WARNING(Xenon, "Invalid execution mode '{}'! Defaulting to Interpreted", Config::highlyExperimental.cpuExecutor);
     currentExecMode = eExecutorMode::Interpreter;
@@ -76,6 +82,11 @@ PPU::PPU(XENON_CONTEXT *inXenonContext, RootBus *mainBus, u64 resetVector, u32 P
   // Set PPU Name
   ppuState->ppuName = fmt::format("PPU{}", ppuState->ppuID);
 
+  // Take turns with the other PPUs and devices
+  if (XeMain::GetScheduler()->IsDeterministic()) {
+    schedulerId = XeMain::GetScheduler()->Register(ppuState->ppuName);
+  }
+
   // Initialize Both threads as in a Reset
   for (u8 thrdNum = 0; thrdNum < 2; thrdNum++) {
     // Set Reset vector for both threads
@@ -88,11 +99,17 @@ PPU::PPU(XENON_CONTEXT *inXenonContext, RootBus *mainBus, u64 resetVector, u32 P
   ppuState->SPR.TTR = 0x1000; // Execute 4096 instructions
 
   ppuJIT = std::make_unique<PPU_JIT>(this);
+  if (currentExecMode == eExecutorMode::Cached)
+    ppuDecodeCache = std::make_unique<PPU_DecodeCache>(this);
 
   // Asign global Xenon context
   xenonContext = inXenonContext;
 
-  if (Config::xcpu.clocksPerInstruction) {
+  if (schedulerId) {
+    // Host speed must not leak into guest time
+    clocksPerInstruction = 1;
+    LOG_INFO(Xenon, "{}: Deterministic scheduling, using a fixed CPI", ppuState->ppuName);
+  } else if (Config::xcpu.clocksPerInstruction) {
     clocksPerInstruction = Config::xcpu.clocksPerInstruction;
     LOG_INFO(Xenon, "{}: Using cached CPI from Config, got {}", ppuState->ppuName, clocksPerInstruction);
   } else {
@@ -108,6 +125,7 @@ PPU::PPU(XENON_CONTEXT *inXenonContext, RootBus *mainBus, u64 resetVector, u32 P
     LOG_INFO(Xenon, "{}: {} clocks per instruction (Overwritten! Actual CPI: {})", ppuState->ppuName, Config::highlyExperimental.clocksPerInstructionBypass, clocksPerInstruction);
     clocksPerInstruction = Config::highlyExperimental.clocksPerInstructionBypass;
   }
+  ppuState->timeBase.ticksPerInstr = clocksPerInstruction;
 
   // If we have a specific halt address, set it here
   ppuHaltOn = Config::debug.haltOnAddress;
@@ -120,10 +138,6 @@ PPU::PPU(XENON_CONTEXT *inXenonContext, RootBus *mainBus, u64 resetVector, u32 P
 
     // Set the decrementer as per docs. See CBE Public Registers pdf in Docs
     thread.SPR.DEC = 0x7FFFFFFF;
-
-    // Resize ERATs
-    thread.iERAT.resizeCache(64);
-    thread.dERAT.resizeCache(64);
   }
 
   // Set PVR and PIR
@@ -155,10 +169,14 @@ PPU::~PPU() {
   // Signal we're quitting
   ppuThreadState.store(eThreadState::Quiting);
   ppuThreadActive = false;
+  // Wake the thread if it's waiting for its turn
+  if (schedulerId)
+    XeMain::GetScheduler()->Unregister(schedulerId);
   // Kill the thread
   if (ppuThread.joinable())
     ppuThread.join();
   ppuJIT.reset();
+  ppuDecodeCache.reset();
   ppuState.reset();
 }
 
@@ -232,6 +250,7 @@ void PPU::Halt(u64 haltOn, bool requestedByGuest, s8 ppuId, ePPUThread threadId)
 #endif
   if (ppuThreadPreviousState == eThreadState::None) // If we were told to ignore it, then do so
     ppuThreadPreviousState.store(ppuThreadState.load());
+  ppuParked.store(false, std::memory_order_release);
   ppuThreadState = eThreadState::Halted;
 }
 void PPU::Continue() {
@@ -267,6 +286,18 @@ void PPU::Step(int amount) {
 
 // PPU Entry Point.
 void PPU::PPURunInstructions(u64 numInstrs, bool enableHalt) {
+  // Counted instructions belong to the other thread, account them before switching
+  if (ppuState->timeBase.thread != curThreadId)
+    UpdateTimeBase();
+  // Decoded blocks don't stop on the halt address, only use them while running free
+  if (ppuDecodeCache && !enableHalt) {
+    ppuDecodeCache->ExecuteInstrs(numInstrs);
+    return;
+  }
+  PPUInterpretInstructions(numInstrs, enableHalt);
+}
+
+void PPU::PPUInterpretInstructions(u64 numInstrs, bool enableHalt) {
   // Start Profile
   MICROPROFILE_SCOPEI("[Xe::PPU]", "PPURunInstructions", MP_AUTO);
   for (size_t instrCount = 0; instrCount < numInstrs && ppuThreadActive; ++instrCount) {
@@ -312,6 +343,19 @@ void PPU::PPURunInstructions(u64 numInstrs, bool enableHalt) {
   }
 }
 
+// Adds the ERAT hit/miss counts gathered since the last call to the profiler counters
+void PPU::FlushERATStats() {
+  for (u8 thrdID = 0; thrdID < 2; thrdID++) {
+    PPU_THREAD_REGISTERS &thread = ppuState->ppuThread[thrdID];
+    MICROPROFILE_COUNTER_ADD("xcpu/erat/ihit", thread.iERAT.hits);
+    MICROPROFILE_COUNTER_ADD("xcpu/erat/imiss", thread.iERAT.misses);
+    MICROPROFILE_COUNTER_ADD("xcpu/erat/dhit", thread.dERAT.hits);
+    MICROPROFILE_COUNTER_ADD("xcpu/erat/dmiss", thread.dERAT.misses);
+    thread.iERAT.hits = thread.iERAT.misses = 0;
+    thread.dERAT.hits = thread.dERAT.misses = 0;
+  }
+}
+
 // PPU Thread state machine, handles all execution and codeflow
 void PPU::ThreadStateMachine() {
   // Check if we should exit or not
@@ -327,36 +371,43 @@ void PPU::ThreadStateMachine() {
   case eThreadState::Running: {
     // Check our threads to see if any are running
     u8 state = GetCurrentRunningThreads();
-    if (currentExecMode == eExecutorMode::Interpreter) {
+    // Deterministic scheduling runs a fixed quantum per turn instead of the TTR
+    const u64 sliceInstrs = schedulerId ? XeMain::GetScheduler()->GetQuantum() : ppuState->SPR.TTR;
+    if (currentExecMode == eExecutorMode::Interpreter || currentExecMode == eExecutorMode::Cached) {
       if (!ppuThreadResetting && (state & ePPUThreadBit_Zero)) {
         // Thread 0 is running, process instructions until we reach TTR timeout.
         curThreadId = ePPUThread_Zero;
-        PPURunInstructions(ppuState->SPR.TTR, ppuHaltOn != 0);
+        PPURunInstructions(sliceInstrs, ppuHaltOn != 0);
       }
       if (!ppuThreadResetting && (state & ePPUThreadBit_One)) {
         // Thread 1 is running, process instructions until we reach TTR timeout.
         curThreadId = ePPUThread_One;
-        PPURunInstructions(ppuState->SPR.TTR, ppuHaltOn != 0);
+        PPURunInstructions(sliceInstrs, ppuHaltOn != 0);
       }
     } else {
       if (!ppuThreadResetting && (state & ePPUThreadBit_Zero)) {
         // Thread 1 is running, process instructions until we reach TTR timeout.
         curThreadId = ePPUThread_Zero;
-        ppuJIT->ExecuteJITInstrs(ppuState->SPR.TTR, ppuThreadActive, ppuHaltOn != 0);
+        ppuJIT->ExecuteJITInstrs(sliceInstrs, ppuThreadActive, ppuHaltOn != 0);
       }
       if (!ppuThreadResetting && (state & ePPUThreadBit_One)) {
         // Thread 1 is running, process instructions until we reach TTR timeout.
         curThreadId = ePPUThread_One;
-        ppuJIT->ExecuteJITInstrs(ppuState->SPR.TTR, ppuThreadActive, ppuHaltOn != 0);
+        ppuJIT->ExecuteJITInstrs(sliceInstrs, ppuThreadActive, ppuHaltOn != 0);
       }
     }
+    if (schedulerId && state != ePPUThreadBit_None) {
+      XeMain::GetScheduler()->AdvanceTime(sliceInstrs * clocksPerInstruction);
+    }
+    // Publish translation statistics
+    FlushERATStats();
   } break;
   case eThreadState::Halted: {
     // Check if we should exit or not
     ppuThreadActive = ppuThreadState.load() != eThreadState::None;
     // Handle stepping
     u8 state = GetCurrentRunningThreads();
-    if (currentExecMode == eExecutorMode::Interpreter) {
+    if (currentExecMode == eExecutorMode::Interpreter || currentExecMode == eExecutorMode::Cached) {
       if (state & ePPUThreadBit_Zero) {
         curThreadId = ePPUThread_Zero;
         if (ppuStepAmount > 0) {
@@ -390,7 +441,8 @@ void PPU::ThreadStateMachine() {
   } break;
   case eThreadState::Sleeping: {
     // Waiting for an event, do nothing
-    std::this_thread::sleep_for(1ns); // Don't burn the CPU
+    if (!schedulerId)
+      std::this_thread::sleep_for(1ns); // Don't burn the CPU
   } break;
   case eThreadState::Unused: {
     ppuThreadState.store(eThreadState::None);
@@ -414,22 +466,81 @@ void PPU::ThreadLoop() {
   // Set thread name
   if (ppuState.get())
     Base::SetCurrentThreadName("[Xe] " + ppuState->ppuName);
+  Xe::Scheduler *scheduler = XeMain::GetScheduler();
   while (ppuThreadActive) {
     // Start Profile
     MICROPROFILE_SCOPEI("[Xe::PPU]", "ThreadLoop", MP_AUTO);
+    // Wait for our turn
+    if (schedulerId && !scheduler->BeginSlice(schedulerId))
+      break;
+
     // Run state machine
     ThreadStateMachine();
+    // Nothing runs until the next iteration, let anyone waiting on a halt know
+    ppuParked.store(ppuThreadState.load() == eThreadState::Halted, std::memory_order_release);
 
-    // If our thread is not active while running, abort early.
-    // We are likely destroying the handle
-    if (!ppuThreadActive)
-      break;
+    // Check interrupts, unless we are likely destroying the handle
+    if (ppuThreadActive)
+      PPUCheckInterrupts();
 
-    if (PPUCheckInterrupts())
-      continue;
+    if (schedulerId)
+      scheduler->EndSlice(schedulerId);
   }
   // Thread is done executing, just tell it to exit
   ppuThreadActive = false;
+  // Leave the turn order, so nobody waits on us
+  if (schedulerId)
+    scheduler->Unregister(schedulerId);
+}
+
+void PPU::DoState(Xe::StateStream &stream) {
+  stream.DoMarker(ppuState->ppuName.c_str());
+  // We're halted, so keep what we were doing before that
+  eThreadState resumeState = ppuThreadPreviousState.load();
+  stream.Do(resumeState);
+  for (u8 thrdID = 0; thrdID < 2; thrdID++) {
+    PPU_THREAD_REGISTERS &thread = ppuState->ppuThread[thrdID];
+    stream.Do(thread.SPR);
+    stream.Do(thread.CIA);
+    stream.Do(thread.NIA);
+    stream.Do(thread.CI);
+    stream.DoArray(thread.GPR, 32);
+    stream.DoArray(thread.FPR, 32);
+    stream.DoArray(thread.VR, 128);
+    stream.Do(thread.CR);
+    // FPRF may be pending in fast FPU mode
+    if (stream.IsSaving())
+      PPCInterpreter::ppuResolveFPRF(&thread);
+    stream.Do(thread.FPSCR);
+    stream.DoArray(thread.SLB, 64);
+    stream.Do(thread.VSCR);
+    stream.Do(thread.exceptReg);
+    stream.Do(thread.progExceptionType);
+    stream.Do(thread.exceptionTaken);
+    stream.Do(thread.exceptEA);
+    stream.Do(thread.exceptHVSysCall);
+    stream.Do(thread.intEA);
+  }
+  stream.Do(ppuState->currentThread);
+  stream.Do(ppuState->SPR);
+  stream.Do(ppuState->timeBase);
+  stream.Do(ppuState->TLB);
+  if (!stream.IsLoading() || stream.Failed())
+    return;
+
+  ppuThreadPreviousState.store(resumeState);
+  // Host pages and reservations refer to the old contents of RAM
+  for (u8 thrdID = 0; thrdID < 2; thrdID++) {
+    PPU_THREAD_REGISTERS &thread = ppuState->ppuThread[thrdID];
+    thread.iERAT.InvalidateAll();
+    thread.dERAT.InvalidateAll();
+    // The loaded FPSCR already has its FPRF, a pending one would overwrite it
+    thread.fprfPending = eFPRFPending::None;
+    if (thread.ppuRes)
+      xenonContext->xenonRes.Release(thread.ppuRes.get());
+  }
+  // The CPI is measured on this host, not the one that saved the state
+  ppuState->timeBase.ticksPerInstr = clocksPerInstruction;
 }
 
 // Returns a pointer to the specified thread.
@@ -467,7 +578,7 @@ u32 PPU::GetIPS() {
 
   // Execute the amount of cycles we're requested
   while (auto timerEnd = std::chrono::steady_clock::now() <= timerStart + 1s) {
-    if (currentExecMode != eExecutorMode::Interpreter) {
+    if (currentExecMode == eExecutorMode::JIT || currentExecMode == eExecutorMode::Hybrid) {
       ppuJIT->ExecuteJITInstrs(4, ppuThreadActive);
       instrCount += 4;
       continue;
@@ -848,40 +959,12 @@ bool PPU::PPUCheckExceptions() {
   return false;
 }
 
-void PPU::CheckTimeBaseStatus() {
-  // Start Profile
-  MICROPROFILE_SCOPEI("[Xe::PPU]", "CheckTimeBaseStatus", MP_AUTO);
-  // Increase Time Base Counter
-  if (xenonContext->timeBaseActive) {
-    // HID6[15]: Time-base and decrementer facility enable.
-    // 0 -> TBU, TBL, DEC, HDEC, and the hang-detection logic do not
-    // update. 1 -> TBU, TBL, DEC, HDEC, and the hang-detection logic
-    // are enabled to update
-    if (ppuState->SPR.HID6 & 0x1000000000000) {
-      UpdateTimeBase();
-    }
-  }
-}
-
 // Updates the time base based on the amount of ticks and checks for decrementer
 // interrupts if enabled.
 void PPU::UpdateTimeBase() {
-  // The Decrementer and the Time Base are driven by the same time frequency.
-  u32 newDec = 0;
-  u32 dec = 0;
-  // Update the Time Base.
-  ppuState->SPR.TB += clocksPerInstruction;
-  // Get the decrementer value.
-  dec = curThread.SPR.DEC;
-  newDec = dec - clocksPerInstruction;
-  // Update the new decrementer value.
-  curThread.SPR.DEC = newDec;
-  // Check if Previous decrementer measurement is smaller than current and a
-  // decrementer exception is not pending.
-  if (newDec > dec && !(_ex & PPU_EX_DEC)) {
-    // The decrementer must issue an interrupt.
-    _ex |= PPU_EX_DEC;
-  }
+  // Start Profile
+  MICROPROFILE_SCOPEI("[Xe::PPU]", "UpdateTimeBase", MP_AUTO);
+  PPCInterpreter::ppcUpdateTimeBase(ppuState.get());
 }
 
 // Returns current executing thread by reading CTRL register
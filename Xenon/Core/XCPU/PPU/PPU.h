@@ -9,11 +9,14 @@
 #include "Core/RootBus/RootBus.h"
 
 class PPU_JIT;
+class PPU_DecodeCache;
+namespace Xe { class StateStream; }
 
 enum class eExecutorMode : u8 {
   Interpreter,
   JIT,
-  Hybrid
+  Hybrid,
+  Cached
 };
 
 enum class eThreadState : u8 {
@@ -59,7 +62,11 @@ public:
   void PPURunInstructions(u64 numInstrs, bool enableHalt = true);
 
   // Sets the clocks per instruction
-  void SetCPI(u32 CPI) { clocksPerInstruction = CPI; }
+  void SetCPI(u32 CPI) {
+    clocksPerInstruction = CPI;
+    if (ppuState)
+      ppuState->timeBase.ticksPerInstr = CPI;
+  }
   // Gets the clocks per instruction
   u32 GetCPI() { return clocksPerInstruction; }
 
@@ -79,6 +86,15 @@ public:
     return guestHalt && IsHalted();
   }
 
+  // Checks if the thread stopped running instructions after a Halt, Halt doesn't wait for the
+  // current slice to finish
+  bool IsParked() {
+    return !ppuThreadActive || (IsHalted() && ppuParked.load(std::memory_order_acquire));
+  }
+
+  // Saves or restores the PPU state, must only be done while it's parked
+  void DoState(Xe::StateStream &stream);
+
   // Returns the thread state
   eThreadState ThreadState() { return ppuThreadState; }
 
@@ -108,6 +124,9 @@ private:
   // PPU thread state before halting
   std::atomic<eThreadState> ppuThreadPreviousState = eThreadState::None;
 
+  // Set by the PPU thread once it's done with the slice it was in when halted
+  std::atomic<bool> ppuParked = false;
+
   // If this is set to a non-zero value, it will halt on that address then clear it
   u64 ppuHaltOn = 0;
 
@@ -117,6 +136,9 @@ private:
   // Amount of instructions to step
   u64 ppuStepAmount = 0;
 
+  // Turn id in the deterministic scheduler, 0 when running free
+  u32 schedulerId = 0;
+
   // Execution threads inside this PPU.
   std::unique_ptr<PPU_STATE> ppuState;
 
@@ -135,7 +157,11 @@ private:
 
   std::unique_ptr<PPU_JIT> ppuJIT;
   friend class PPU_JIT;
-  friend bool callEpil(PPU *ppu, PPU_STATE *ppuState);
+  // Decoded blocks, only used by the cached interpreter
+  std::unique_ptr<PPU_DecodeCache> ppuDecodeCache;
+  friend class PPU_DecodeCache;
+  friend bool callBlockEpil(PPU *ppu, PPU_STATE *ppuState, u64 instrCount);
+  friend bool callExceptionExit(PPU *ppu, PPU_STATE *ppuState, u64 instrCount);
 
   //
   // Helpers
@@ -144,17 +170,25 @@ private:
   // Returns the number of instructions per second the current
   // host computer can process.
   u32 GetIPS();
+  // Interprets instructions one at a time, fetching and decoding each of them
+  void PPUInterpretInstructions(u64 numInstrs, bool enableHalt);
   // Read next intruction from memory
   bool PPUReadNextInstruction();
   // Checks for pending exceptions
   bool PPUCheckInterrupts();
   // Checks for pending exceptions
   bool PPUCheckExceptions();
-  // Checks if it should update the time base
-  void CheckTimeBaseStatus();
-  // Updates the current PPU's time base and decrementer based on
-  // the amount of ticks per instr we should perform.
+  // Counts executed instructions for the time base, updating it once the decrementer is due
+  void CheckTimeBaseStatus(u64 instrCount = 1) {
+    ppuState->timeBase.instrs += instrCount;
+    if (ppuState->timeBase.instrs >= ppuState->timeBase.eventInstrs) [[unlikely]]
+      UpdateTimeBase();
+  }
+  // Updates the current PPU's time base and decrementer with the counted
+  // instructions and schedules the next update.
   void UpdateTimeBase();
   // Gets the current running threads.
   u8 GetCurrentRunningThreads();
+  // Publishes ERAT hit/miss counters to the profiler.
+  void FlushERATStats();
 };
@@ -0,0 +1,158 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#include <algorithm>
+#include <cstring>
+
+#include "Base/Global.h"
+
+#include "Core/RAM/RAM.h"
+#include "Core/XCPU/Interpreter/PPCInterpreter.h"
+#include "Core/XCPU/Xenon.h"
+#include "Core/XeMain.h"
+#include "PPU.h"
+#include "PPU_DecodeCache.h"
+
+PPU_DecodeCache::PPU_DecodeCache(PPU *ppu) :
+  ppu(ppu),
+  ppuState(ppu->ppuState.get())
+{}
+
+void PPU_DecodeCache::ExecuteInstrs(u64 numInstrs) {
+  MICROPROFILE_SCOPEI("[Xe::PPU]", "ExecuteDecodedInstrs", MP_AUTO);
+  u64 instrsExecuted = 0;
+  while (instrsExecuted < numInstrs && ppu->ppuThreadActive) {
+    auto &thread = curThread;
+    // Drop blocks whose code was written to
+    if (XeMain::ram && XeMain::ram->HasDirtyCodePages(ppuState->ppuID))
+      InvalidateDirtyCodePages();
+
+    DecodedBlock *block = GetBlock(thread.NIA);
+    const u64 budget = std::min<u64>(block ? block->instrs.size() : 1, numInstrs - instrsExecuted);
+
+    // Code outside of RAM and hooked addresses go trough the regular interpreter
+    if (!block || block->hasPatch) {
+      ppu->PPUInterpretInstructions(budget, false);
+      instrsExecuted += budget;
+      if (ppu->ppuThreadState == eThreadState::Resetting)
+        break;
+      continue;
+    }
+
+    // Exceptions already pending (and masked) when entering the block
+    const u16 pendingEx = thread.exceptReg;
+    u64 count = 0;
+    while (count < budget) {
+      const DecodedInstr &instr = block->instrs[count++];
+      thread.CIA = thread.NIA;
+      thread.NIA += 4;
+      _instr.opcode = instr.opcode;
+      // Same as ppcExecuteSingleInstruction, for the debugger
+      if (thread.SPR.PIR == 0) {
+        thread.lastRegValue = GPR(11);
+      }
+      instr.handler(ppuState);
+      // Taken branches and new exceptions leave the block
+      if (thread.NIA != thread.CIA + 4 || thread.exceptReg != pendingEx)
+        break;
+    }
+    instrsExecuted += count;
+
+    // Same as the interpreter does after every instruction, once per block
+    ppu->CheckTimeBaseStatus(count);
+    if (thread.SPR.MSR.EE && ppu->xenonContext->xenonIIC.checkExtInterrupt(thread.SPR.PIR)) {
+      _ex |= PPU_EX_EXT;
+    }
+    ppu->PPUCheckExceptions();
+
+    if (ppu->ppuThreadState == eThreadState::Resetting)
+      break;
+  }
+}
+
+DecodedBlock *PPU_DecodeCache::GetBlock(u64 EA) {
+  // Accesses to 0x7FFFxxxx are redirected to the IIC
+  if (((EA & 0x000000007FFF0000ULL) >> 16) == 0x7FFF || !XeMain::ram)
+    return nullptr;
+
+  auto &thread = curThread;
+  // Translation faults are left to the interpreter to raise
+  const u16 savedEx = thread.exceptReg;
+  u64 RA = EA;
+  thread.instrFetch = true;
+  const bool translated = PPCInterpreter::MMUTranslateAddress(&RA, ppuState, false);
+  thread.instrFetch = false;
+  if (!translated) {
+    thread.exceptReg = savedEx;
+    return nullptr;
+  }
+
+  bool socAccess = false;
+  const u64 physAddr = PPCInterpreter::mmuContructEndAddressFromSecEngAddr(RA, &socAccess);
+  if (socAccess || physAddr >= XeMain::ram->GetSize())
+    return nullptr;
+
+  auto it = blocks.find(physAddr);
+  if (it == blocks.end()) {
+    // Tracked before decoding, so a write racing with it still drops the block
+    XeMain::ram->MarkCodePage(physAddr, ppuState->ppuID);
+    std::unique_ptr<DecodedBlock> newBlock = BuildBlock(physAddr);
+    if (!newBlock)
+      return nullptr;
+    codePageBlocks[static_cast<u32>(physAddr >> RAM_CODE_PAGE_SHIFT)].push_back(physAddr);
+    it = blocks.emplace(physAddr, std::move(newBlock)).first;
+  }
+
+  // The same physical code may be mapped at another address, hooks are by effective address
+  DecodedBlock *block = it->second.get();
+  if (block->patchCheckAddress != EA) {
+    block->hasPatch = PPCInterpreter::ppcHooks.HasHooks(EA, block->instrs.size() * 4);
+    block->patchCheckAddress = EA;
+  }
+  return block;
+}
+
+std::unique_ptr<DecodedBlock> PPU_DecodeCache::BuildBlock(u64 physAddress) {
+  const u8 *code = XeMain::ram->GetPointerToAddress(static_cast<u32>(physAddress));
+  if (!code)
+    return nullptr;
+
+  auto block = std::make_unique<DecodedBlock>();
+  block->physAddress = physAddress;
+  // Blocks never cross a page, the next one may be mapped anywhere else
+  const u64 pageEnd = (physAddress | ((1ULL << RAM_CODE_PAGE_SHIFT) - 1)) + 1;
+  for (u64 addr = physAddress; addr < pageEnd && block->instrs.size() < XE_DECODE_BLOCK_MAX_INSTRS; addr += 4) {
+    u32 opcode = 0;
+    memcpy(&opcode, code + (addr - physAddress), sizeof(opcode));
+    opcode = byteswap_be<u32>(opcode);
+    // The interpreter halts on these, let it
+    if (opcode == 0xFFFFFFFF)
+      break;
+    const PPCInterpreter::PPCInstrInfo &info = PPCInterpreter::ppcDecoder.getInfo(PPCDecode(opcode));
+    block->instrs.push_back({ PPCInterpreter::ppcDecoder.decode(opcode), opcode });
+    // Besides branches, stop after anything that may change how the next address translates
+    if ((info.flags & PPC_INSTR_ENDS_BLOCK) ||
+        info.nameId == PPCInterpreter::PPCInstrNameId("mtmsr") ||
+        info.nameId == PPCInterpreter::PPCInstrNameId("mtmsrd") ||
+        info.nameId == PPCInterpreter::PPCInstrNameId("isync") ||
+        info.nameId == PPCInterpreter::PPCInstrNameId("sc"))
+      break;
+  }
+
+  if (block->instrs.empty())
+    return nullptr;
+  return block;
+}
+
+void PPU_DecodeCache::InvalidateDirtyCodePages() {
+  XeMain::ram->TakeDirtyCodePages(ppuState->ppuID, dirtyCodePages);
+  for (u32 page : dirtyCodePages) {
+    auto it = codePageBlocks.find(page);
+    if (it == codePageBlocks.end())
+      continue;
+    for (u64 addr : it->second) {
+      blocks.erase(addr);
+    }
+    codePageBlocks.erase(it);
+  }
+  dirtyCodePages.clear();
+}
@@ -0,0 +1,65 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/XCPU/PPU/PowerPC.h"
+#include "Core/XCPU/Interpreter/PPC_Instruction.h"
+
+// Maximum amount of instructions in a decoded block
+#define XE_DECODE_BLOCK_MAX_INSTRS 256
+
+class PPU;
+
+// Instruction of a decoded block
+struct DecodedInstr {
+  // Handler, already resolved trough the decoder table
+  PPCInterpreter::instructionHandler handler = nullptr;
+  // Raw opcode, handlers read their operands from it
+  u32 opcode = 0;
+};
+
+// Straight line run of decoded instructions, never crosses a page
+struct DecodedBlock {
+  // Physical address of the first instruction
+  u64 physAddress = 0;
+  // Effective address hasPatch was computed for
+  u64 patchCheckAddress = 0;
+  // Contains an address with a guest hook, must go trough ppcExecuteSingleInstruction
+  bool hasPatch = false;
+  std::vector<DecodedInstr> instrs = {};
+};
+
+//
+// Cached interpreter.
+//
+// Decodes guest code once into blocks keyed by physical address and runs them in a tight loop,
+// skipping the per instruction fetch, translation and decode of the interpreter. Blocks are only
+// built from RAM, their pages are tracked the same way the JIT does and written pages drop them.
+//
+class PPU_DecodeCache {
+public:
+  PPU_DecodeCache(PPU *ppu);
+  ~PPU_DecodeCache() = default;
+
+  // Runs up to numInstrs instructions on the current thread
+  void ExecuteInstrs(u64 numInstrs);
+private:
+  // Returns the block at EA, building it if needed. nullptr when EA isn't cacheable
+  DecodedBlock *GetBlock(u64 EA);
+  // Decodes a block from RAM at physAddress
+  std::unique_ptr<DecodedBlock> BuildBlock(u64 physAddress);
+  // Drops every block decoded from a RAM page written since the last check
+  void InvalidateDirtyCodePages();
+
+  PPU *ppu = nullptr; // "Linked" PPU
+  PPU_STATE *ppuState = nullptr; // For easier thread access
+  std::unordered_map<u64, std::unique_ptr<DecodedBlock>> blocks = {};
+  // Blocks decoded from each physical RAM page
+  std::unordered_map<u32, std::vector<u64>> codePageBlocks = {};
+  // Scratch list of written code pages
+  std::vector<u32> dirtyCodePages = {};
+};
@@ -1,7 +1,16 @@
 // Copyright 2025 Xenon Emulator Project. All rights reserved.
 
+#include <algorithm>
+#include <cstring>
+#include <string>
+
 #include "Base/Logging/Log.h"
+#include "Base/Config.h"
 #include "Base/Global.h"
+#include "Base/Hash.h"
+#include "Base/HostCPU.h"
+#include "Base/PathUtil.h"
+#include "Base/Version.h"
 
 #if defined(ARCH_X86) || defined(ARCH_X86_64)
 #include "Core/XCPU/Interpreter/JIT/x86_64/JITEmitter_Helpers.h"
@@ -9,19 +18,17 @@
 #include "Core/XCPU/Interpreter/PPCInterpreter.h"
 #include "Core/XCPU/Interpreter/PPCInternal.h"
 #include "Core/XCPU/Xenon.h"
+#include "Core/XeMain.h"
 #include "PPU.h"
 #include "PPU_JIT.h"
 
 //
 //  Trampolines for Invoke
 //
-void callHalt() {
-  return XeMain::GetCPU()->Halt();
-}
-
-bool callEpil(PPU *ppu, PPU_STATE *ppuState) {
+// Runs at the end of every block. Advances the time base in bulk and takes pending interrupts
+bool callBlockEpil(PPU *ppu, PPU_STATE *ppuState, u64 instrCount) {
   // Check timebase
-  ppu->CheckTimeBaseStatus();
+  ppu->CheckTimeBaseStatus(instrCount);
 
   // Get current thread
   auto &thread = ppuState->ppuThread[ppuState->currentThread];
@@ -33,20 +40,356 @@ bool callEpil(PPU *ppu, PPU_STATE *ppuState) {
   return ppu->PPUCheckExceptions();
 }
 
+// Runs only when an instruction left an exception pending, leaves the block if it got taken
+bool callExceptionExit(PPU *ppu, PPU_STATE *ppuState, u64 instrCount) {
+  if (!ppu->PPUCheckExceptions())
+    return false;
+  ppu->CheckTimeBaseStatus(instrCount);
+  return true;
+}
+
 PPU_JIT::PPU_JIT(PPU *ppu) :
   ppu(ppu),
   ppuState(ppu->ppuState.get())
-{}
+{
+  BuildDispatcher();
+}
 
 PPU_JIT::~PPU_JIT() {
+  SaveDiskCache();
   for (auto &[hash, block] : jitBlocks)
     block.reset();
 }
 
 u64 PPU_JIT::ExecuteJITBlock(u64 addr, bool enableHalt) {
   auto &block = jitBlocks.at(addr);
-  block->codePtr(ppu, ppuState, enableHalt);
-  return block->size / 4;
+  const s64 budget = jitBudget;
+  exitBlock = nullptr;
+  // Runs this block and every block linked after it, until the budget runs out or an exit misses
+  dispatcher(ppu, ppuState, enableHalt, reinterpret_cast<void*>(block->codePtr));
+  return static_cast<u64>(budget - jitBudget);
+}
+
+void PPU_JIT::BuildDispatcher() {
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+  CodeHolder code{};
+  code.init(jitRuntime.environment(), jitRuntime.cpuFeatures());
+  x86::Compiler compiler(&code);
+
+  x86::Gp ppuReg = compiler.newGpz("ppu");
+  x86::Gp ppuStateReg = compiler.newGpz("ppuState");
+  x86::Gp haltBool = compiler.newGpb("enableHalt");
+  x86::Gp entry = compiler.newGpz("entry");
+
+  FuncNode *signature = nullptr;
+  compiler.addFuncNode(&signature, FuncSignature::build<void, PPU*, PPU_STATE*, bool, void*>());
+  signature->setArg(0, ppuReg);
+  signature->setArg(1, ppuStateReg);
+  signature->setArg(2, haltBool);
+  signature->setArg(3, entry);
+
+  // while (entry) entry = entry(ppu, ppuState, enableHalt);
+  Label loopLabel = compiler.newLabel();
+  Label doneLabel = compiler.newLabel();
+  compiler.bind(loopLabel);
+  compiler.test(entry, entry);
+  compiler.jz(doneLabel);
+  InvokeNode *call = nullptr;
+  compiler.invoke(&call, entry, FuncSignature::build<void*, PPU*, PPU_STATE*, bool>());
+  call->setArg(0, ppuReg);
+  call->setArg(1, ppuStateReg);
+  call->setArg(2, haltBool);
+  call->setRet(0, entry);
+  compiler.jmp(loopLabel);
+  compiler.bind(doneLabel);
+  compiler.ret();
+
+  compiler.endFunc();
+  compiler.finalize();
+
+  void *fnPtr = nullptr;
+  if (jitRuntime.add(&fnPtr, &code) != kErrorOk) {
+    LOG_CRITICAL(Xenon, "PPU_JIT: Failed to build the block dispatcher!");
+    return;
+  }
+  dispatcher = reinterpret_cast<JITDispatchFunc>(fnPtr);
+#endif
+}
+
+void PPU_JIT::LinkBlock(JITBlock *from, JITBlock *to) {
+  // Blocks that need revalidation must always be entered from the dispatcher
+  if (!to->codeTracked)
+    return;
+  void *code = reinterpret_cast<void*>(to->codePtr);
+  bool linked = false;
+  for (auto &link : from->links) {
+    if (link.target == to->ppuAddress && !link.code) {
+      link.code = code;
+      link.block = to;
+      to->incomingLinks.push_back(&link);
+      linked = true;
+    }
+  }
+  // Not a static successor, must be an indirect branch
+  if (!linked) {
+    lookupCache[LookupIndex(to->ppuAddress)] = { to->ppuAddress, code };
+  }
+}
+
+void PPU_JIT::UnlinkBlock(JITBlock *block) {
+  // Make every block linked to this one go back to the dispatcher instead
+  for (JITBlockLink *link : block->incomingLinks) {
+    link->code = nullptr;
+    link->block = nullptr;
+  }
+  block->incomingLinks.clear();
+  // Drop our own exits from the successors
+  for (auto &link : block->links) {
+    if (link.block) {
+      std::erase(link.block->incomingLinks, &link);
+    }
+    link.code = nullptr;
+    link.block = nullptr;
+  }
+  JITLookupEntry &entry = lookupCache[LookupIndex(block->ppuAddress)];
+  if (entry.tag == block->ppuAddress) {
+    entry = {};
+  }
+  if (exitBlock == block) {
+    exitBlock = nullptr;
+  }
+}
+
+bool PPU_JIT::TrackCodePage(u64 blockAddr, u64 EA) {
+  // Accesses to 0x7FFFxxxx are redirected to the IIC
+  if (((EA & 0x000000007FFF0000ULL) >> 16) == 0x7FFF || !XeMain::ram)
+    return false;
+
+  auto &thread = curThread;
+  u64 RA = EA;
+  thread.instrFetch = true;
+  const bool translated = PPCInterpreter::MMUTranslateAddress(&RA, ppuState, false);
+  thread.instrFetch = false;
+  if (!translated)
+    return false;
+
+  bool socAccess = false;
+  const u64 physAddr = PPCInterpreter::mmuContructEndAddressFromSecEngAddr(RA, &socAccess);
+  if (socAccess || physAddr >= XeMain::ram->GetSize())
+    return false;
+
+  XeMain::ram->MarkCodePage(physAddr, ppuState->ppuID);
+  codePageBlocks[static_cast<u32>(physAddr >> RAM_CODE_PAGE_SHIFT)].push_back(blockAddr);
+  return true;
+}
+
+void PPU_JIT::InvalidateDirtyCodePages() {
+  XeMain::ram->TakeDirtyCodePages(ppuState->ppuID, dirtyCodePages);
+  for (u32 page : dirtyCodePages) {
+    auto it = codePageBlocks.find(page);
+    if (it == codePageBlocks.end())
+      continue;
+    for (u64 addr : it->second) {
+      InvalidateBlock(addr);
+    }
+    codePageBlocks.erase(it);
+  }
+  dirtyCodePages.clear();
+}
+
+void PPU_JIT::InvalidateBlock(u64 addr) {
+  auto it = jitBlocks.find(addr);
+  if (it == jitBlocks.end())
+    return;
+  UnlinkBlock(it->second.get());
+  jitBlocks.erase(it);
+}
+
+void PPU_JIT::LoadDiskCache() {
+  diskCacheLoaded = true;
+  if (!Config::highlyExperimental.jitCache)
+    return;
+  diskCacheKey = DiskCacheKey();
+  diskCache.Load(DiskCachePath(), diskCacheKey);
+}
+
+void PPU_JIT::SaveDiskCache() {
+  if (!diskCacheLoaded || !diskCache.IsDirty())
+    return;
+  diskCache.Save(DiskCachePath(), diskCacheKey);
+}
+
+std::filesystem::path PPU_JIT::DiskCachePath() const {
+  const std::string &image = Config::xcpu.elfLoader ? Config::filepaths.elfBinary : Config::filepaths.nand;
+  return Base::FS::GetUserPath(Base::FS::PathType::JITCacheDir) /
+    fmt::format("ppu{}_{:08X}.jit", ppuState->ppuID, Base::JoaatStringHash(image, false));
+}
+
+u64 PPU_JIT::DiskCacheKey() const {
+  // Bump when the generated code changes in a way the rest of the key can't see
+  constexpr u64 XE_JIT_CACHE_VERSION = 4;
+  u64 key = JITBlockCache::HashCombine(0, XE_JIT_CACHE_VERSION);
+  for (char c : Base::Version)
+    key = JITBlockCache::HashCombine(key, static_cast<u8>(c));
+  // Catches rebuilds of the same version, function offsets move with any code change
+  const u64 imageBase = RelocBase(eJITReloc::Image, nullptr);
+  const void *anchors[] = {
+    reinterpret_cast<const void*>(&callExceptionExit),
+    reinterpret_cast<const void*>(&PPCInterpreter::PPCInterpreter_addx),
+    reinterpret_cast<const void*>(&PPCInterpreter::PPCInterpreterJIT_addx),
+    reinterpret_cast<const void*>(&PPCInterpreter::MMURead32)
+  };
+  for (const void *anchor : anchors)
+    key = JITBlockCache::HashCombine(key, reinterpret_cast<u64>(anchor) - imageBase);
+  // Options baked into the generated code
+  key = JITBlockCache::HashCombine(key, static_cast<u64>(ppu->currentExecMode));
+  key = JITBlockCache::HashCombine(key, XeMain::sfcx ? XeMain::sfcx->initSkip1 : 0);
+  key = JITBlockCache::HashCombine(key, XeMain::sfcx ? XeMain::sfcx->initSkip2 : 0);
+  key = JITBlockCache::HashCombine(key, Config::debug.haltOnReadAddress);
+  key = JITBlockCache::HashCombine(key, Config::debug.haltOnWriteAddress);
+  key = JITBlockCache::HashCombine(key, XeMain::ram != nullptr);
+  key = JITBlockCache::HashCombine(key, Config::highlyExperimental.fastFPU);
+  const Base::HostCPUFeatures &host = Base::GetHostCPUFeatures();
+  key = JITBlockCache::HashCombine(key, host.sse41);
+  key = JITBlockCache::HashCombine(key, host.avx2);
+  key = JITBlockCache::HashCombine(key, host.fma);
+  for (const PPCInterpreter::PPCHook &hook : PPCInterpreter::ppcHooks.GetHooks()) {
+    key = JITBlockCache::HashCombine(key, hook.address);
+    key = JITBlockCache::HashCombine(key, static_cast<u64>(hook.action) | (static_cast<u64>(hook.gpr) << 8) | (static_cast<u64>(hook.log) << 16));
+    key = JITBlockCache::HashCombine(key, hook.value);
+    key = JITBlockCache::HashCombine(key, Base::JoaatStringHash(hook.functionName, false));
+  }
+  return key;
+}
+
+u64 PPU_JIT::RelocBase(eJITReloc kind, const JITBlock *block) const {
+  switch (kind) {
+  case eJITReloc::Image:
+    return reinterpret_cast<u64>(&callBlockEpil);
+  case eJITReloc::JIT:
+    return reinterpret_cast<u64>(this);
+  case eJITReloc::Block:
+    return reinterpret_cast<u64>(block);
+  case eJITReloc::RAMBase:
+    return XeMain::ram ? reinterpret_cast<u64>(XeMain::ram->GetPointerToAddress(RAM_START_ADDR)) : 0;
+  case eJITReloc::CodePageMap:
+    return XeMain::ram ? reinterpret_cast<u64>(XeMain::ram->GetCodePageMap()) : 0;
+  case eJITReloc::DirtyCodePages:
+    return XeMain::ram ? reinterpret_cast<u64>(XeMain::ram->GetDirtyCodePagesFlag(ppuState->ppuID)) : 0;
+  case eJITReloc::ReservationCount:
+    return PPCInterpreter::CPUContext ? reinterpret_cast<u64>(PPCInterpreter::CPUContext->xenonRes.GetReservationCount()) : 0;
+  }
+  return 0;
+}
+
+std::shared_ptr<JITBlock> PPU_JIT::LoadCachedBlock(u64 addr) {
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+  const std::vector<JITCacheEntry> *variants = diskCache.Find(addr);
+  if (!variants)
+    return nullptr;
+
+  auto &thread = curThread;
+  std::vector<u32> opcodes{};
+  for (const JITCacheEntry &entry : *variants) {
+    if (entry.size == 0)
+      continue;
+    // Same as when compiling, pages are tracked before the code is read
+    bool codeTracked = true;
+    for (u64 offset = 0; offset < entry.size; offset += 4) {
+      const u64 pc = addr + offset;
+      if ((offset == 0 || (pc & 0xFFF) == 0) && !TrackCodePage(addr, pc))
+        codeTracked = false;
+    }
+
+    // The code in memory must be the one the block was compiled from
+    const u16 exceptReg = thread.exceptReg;
+    opcodes.resize(entry.size / 4);
+    for (u64 i = 0; i != opcodes.size(); i++) {
+      thread.instrFetch = true;
+      opcodes[i] = PPCInterpreter::MMURead32(ppuState, addr + i * 4);
+      thread.instrFetch = false;
+    }
+    if (thread.exceptReg != exceptReg) {
+      // Faulting fetch, leave it to the compiler
+      thread.exceptReg = exceptReg;
+      return nullptr;
+    }
+    if (JITBlockCache::HashCode(opcodes.data(), opcodes.size()) != entry.codeHash)
+      continue;
+
+    std::unique_ptr<JITBlockBuilder> jitBuilder = std::make_unique<STRIP_UNIQUE(jitBuilder)>(addr, &jitRuntime);
+    jitBuilder->size = entry.size;
+    std::shared_ptr<JITBlock> block = std::make_shared<STRIP_UNIQUE(block)>(&jitRuntime, addr, jitBuilder.get());
+
+    // Rebase the host addresses for this run
+    std::vector<u8> code = entry.code;
+    for (const JITCacheReloc &reloc : entry.relocs) {
+      const u64 base = RelocBase(reloc.kind, block.get());
+      if (!base)
+        return nullptr;
+      const u64 value = base + reloc.addend;
+      std::memcpy(code.data() + reloc.offset, &value, sizeof(value));
+    }
+    asmjit::x86::Assembler assembler(jitBuilder->Code());
+    assembler.embed(code.data(), code.size());
+    if (!block->Build() || !block->codePtr)
+      return nullptr;
+
+    block->codeTracked = codeTracked;
+    block->hash = 0;
+    for (u32 opcode : opcodes) {
+      block->hash += opcode;
+    }
+    block->links[0].target = entry.linkTargets[0];
+    block->links[1].target = entry.linkTargets[1];
+
+    jitBlocks.emplace(addr, std::move(block));
+    return jitBlocks.at(addr);
+  }
+#endif
+  return nullptr;
+}
+
+void PPU_JIT::StoreCachedBlock(const JITBlock *block, JITBlockBuilder *b, const std::vector<u32> &opcodes) {
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+  if (!diskCacheLoaded || !Config::highlyExperimental.jitCache || !block->codePtr)
+    return;
+  // Compiled from a faulting fetch, the opcodes aren't real
+  if (curThread.exceptReg & (PPU_EX_INSSTOR | PPU_EX_INSTSEGM))
+    return;
+
+  JITCacheEntry entry{};
+  entry.ppuAddress = block->ppuAddress;
+  entry.size = block->size;
+  entry.codeHash = JITBlockCache::HashCode(opcodes.data(), opcodes.size());
+  entry.linkTargets[0] = block->links[0].target;
+  entry.linkTargets[1] = block->links[1].target;
+  const u8 *hostCode = reinterpret_cast<const u8*>(block->codePtr);
+  entry.code.assign(hostCode, hostCode + block->codeSize);
+
+  // Every recorded host address is the immediate of a 10 byte movabs, bracketed by its labels
+  const asmjit::CodeHolder *code = b->Code();
+  for (const JITReloc &reloc : b->relocs) {
+    const u64 base = RelocBase(reloc.kind, block);
+    if (!base || !code->isLabelBound(reloc.start) || !code->isLabelBound(reloc.end))
+      return;
+    const u64 start = code->labelOffsetFromBase(reloc.start);
+    const u64 end = code->labelOffsetFromBase(reloc.end);
+    // Something else got placed between the labels (register allocator moves), don't guess
+    if (end - start != 10 || end > entry.code.size())
+      return;
+    u64 value = 0;
+    std::memcpy(&value, entry.code.data() + end - sizeof(u64), sizeof(value));
+    if (value != reloc.value)
+      return;
+    entry.relocs.push_back({ static_cast<u32>(end - sizeof(u64)), reloc.kind, static_cast<s64>(reloc.value - base) });
+  }
+  // Host addresses of this run mean nothing to the next one
+  for (const JITCacheReloc &reloc : entry.relocs) {
+    std::memset(entry.code.data() + reloc.offset, 0, sizeof(u64));
+  }
+  diskCache.Insert(std::move(entry));
+#endif
 }
 
 // get current PPU_THREAD_REGISTERS, use ppuState to get the current Thread
@@ -60,57 +403,145 @@ void PPU_JIT::setupContext(JITBlockBuilder *b) {
 #endif
 }
 
-void PPU_JIT::setupProl(JITBlockBuilder *b, u32 instrData, u32 decoded) {
+// Halt checks are done by ExecuteJITInstrs before entering a block, so this only has to update
+// CIA NIA _instr (CI). Inside a block the addresses are known when compiling.
+void PPU_JIT::setupProl(JITBlockBuilder *b, u64 pc, u32 instrData) {
 #if defined(ARCH_X86) || defined(ARCH_X86_64)
-  COMP->nop();
-  COMP->nop();
-
   x86::Gp temp = newGP64();
-  Label continueLabel = COMP->newLabel();
-
-  // enableHalt
-  COMP->test(b->haltBool, b->haltBool);
-  COMP->je(continueLabel);
-
-  // ppuHaltOn != NULL
-  COMP->mov(temp, b->ppu->scalar(&PPU::ppuHaltOn));
-  COMP->test(temp, temp);
-  COMP->je(continueLabel);
-
-  // ppuHaltOn == curThread.CIA - !guestHalt
-  COMP->cmp(temp, b->threadCtx->scalar(&PPU_THREAD_REGISTERS::CIA));
-  COMP->jne(continueLabel);
-  COMP->cmp(b->ppu->scalar(&PPU::guestHalt).Ptr<u8>(), 0);
-  COMP->jne(continueLabel);
-
-  // Call HALT
-  InvokeNode *out = nullptr;
-  COMP->invoke(&out, imm((void*)callHalt), FuncSignature::build<void>());
-
-  COMP->bind(continueLabel);
-
-  // Update CIA NIA _instr (CI)
-  auto emitter = PPCInterpreter::ppcDecoder.getJITTable()[decoded];
-  COMP->mov(temp, b->threadCtx->scalar(&PPU_THREAD_REGISTERS::NIA));
+  COMP->mov(temp, pc);
   COMP->mov(b->threadCtx->scalar(&PPU_THREAD_REGISTERS::CIA), temp);
   COMP->add(temp, 4);
   COMP->mov(b->threadCtx->scalar(&PPU_THREAD_REGISTERS::NIA), temp);
-  COMP->mov(temp, instrData);
-  COMP->mov(b->threadCtx->scalar(&PPU_THREAD_REGISTERS::CI).Ptr<u32>(), temp);
+  COMP->mov(b->threadCtx->scalar(&PPU_THREAD_REGISTERS::CI).Ptr<u32>(), instrData);
+#endif
+}
 
-  COMP->nop();
-  COMP->nop();
+bool PPU_JIT::patchHooks(JITBlockBuilder *b, u64 pc) {
+  const std::vector<u32> *hooks = PPCInterpreter::ppcHooks.Find(pc);
+  if (!hooks)
+    return false;
+  bool skip = false;
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+  for (u32 index : *hooks) {
+    const PPCInterpreter::PPCHook &hook = PPCInterpreter::ppcHooks.GetHooks()[index];
+    switch (hook.action) {
+    case PPCInterpreter::ePPCHookAction::SetGPR:
+      COMP->mov(b->regs.GPROut(hook.gpr), hook.value);
+      break;
+    case PPCInterpreter::ePPCHookAction::OrGPR: {
+      x86::Gp reg = b->regs.GPR(hook.gpr);
+      b->regs.GPROut(hook.gpr);
+      x86::Gp value = newGP64();
+      COMP->mov(value, hook.value);
+      COMP->or_(reg, value);
+    } break;
+    case PPCInterpreter::ePPCHookAction::Skip:
+      skip = true;
+      break;
+    default:
+      break;
+    }
+    // Logging and host functions
+    if (hook.log || hook.action == PPCInterpreter::ePPCHookAction::Call) {
+      b->regs.Flush();
+      InvokeNode *call = nullptr;
+      J_Invoke(b, &call, (void*)&PPCInterpreter::PPCHookRegistry::RunHost, FuncSignature::build<void, PPU_STATE*, u64>());
+      call->setArg(0, b->ppuState->Base());
+      call->setArg(1, imm(index));
+      b->regs.Invalidate();
+    }
+  }
 #endif
+  return skip;
 }
 
-void PPU_JIT::patchSkips(JITBlockBuilder *b, u32 addr) {
+void PPU_JIT::setupEpil(JITBlockBuilder *b, JITBlock *block, u64 instrCount, Label exitLabel) {
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+  x86::Gp next = newGPptr();
+  x86::Gp nia = newGP64();
+  x86::Gp ptr = newGPptr();
+  Label missLabel = COMP->newLabel();
+
+  // Guest registers only live in host registers inside the block
+  b->regs.Flush();
+
+  // Account for the executed instructions
+  J_MovHostPtr(b, ptr, eJITReloc::JIT, &jitBudget);
+  COMP->sub(x86::qword_ptr(ptr), instrCount);
+
+  // Time base, interrupts and exceptions, once per block
+  InvokeNode *epil = nullptr;
+  x86::Gp retVal = newGP8();
+  J_Invoke(b, &epil, (void*)callBlockEpil, FuncSignature::build<bool, PPU*, PPU_STATE*, u64>());
+  epil->setArg(0, b->ppu->Base());
+  epil->setArg(1, b->ppuState->Base());
+  epil->setArg(2, imm(instrCount));
+  epil->setRet(0, retVal);
+  COMP->test(retVal, retVal);
+  COMP->jnz(exitLabel);
+
+  // Stop chaining once the budget runs out
+  J_MovHostPtr(b, ptr, eJITReloc::JIT, &jitBudget);
+  COMP->cmp(x86::qword_ptr(ptr), 0);
+  COMP->jle(exitLabel);
+
+  // Code was written to, go back so it gets invalidated before chaining into it
+  if (XeMain::ram) {
+    J_MovHostPtr(b, ptr, eJITReloc::DirtyCodePages, XeMain::ram->GetDirtyCodePagesFlag(ppuState->ppuID));
+    COMP->cmp(x86::byte_ptr(ptr), 0);
+    COMP->jne(exitLabel);
+  }
+
+  COMP->mov(nia, b->threadCtx->scalar(&PPU_THREAD_REGISTERS::NIA));
+
+  // Static exits, jump straight to the linked successor
+  for (auto &link : block->links) {
+    if (link.target == XE_JIT_NO_LINK)
+      continue;
+    Label nextLink = COMP->newLabel();
+    J_MovHostPtr(b, ptr, eJITReloc::Block, &link);
+    COMP->cmp(nia, x86::qword_ptr(ptr, offsetof(JITBlockLink, target)));
+    COMP->jne(nextLink);
+    COMP->mov(next, x86::qword_ptr(ptr, offsetof(JITBlockLink, code)));
+    COMP->test(next, next);
+    COMP->jz(missLabel); // Not linked yet
+    COMP->ret(next);
+    COMP->bind(nextLink);
+  }
 
+  // Indirect exits, probe the lookup cache
+  static_assert(sizeof(JITLookupEntry) == 16);
+  x86::Gp index = newGP64();
+  COMP->mov(index, nia);
+  COMP->shr(index, 2);
+  COMP->and_(index, XE_JIT_LOOKUP_ENTRIES - 1);
+  COMP->shl(index, 4);
+  J_MovHostPtr(b, ptr, eJITReloc::JIT, lookupCache.data());
+  COMP->add(ptr, index);
+  COMP->cmp(nia, x86::qword_ptr(ptr, offsetof(JITLookupEntry, tag)));
+  COMP->jne(missLabel);
+  COMP->mov(next, x86::qword_ptr(ptr, offsetof(JITLookupEntry, code)));
+  COMP->ret(next);
+
+  // Miss, let the dispatcher find (or build) the next block and link it to us
+  COMP->bind(missLabel);
+  J_MovHostPtr(b, ptr, eJITReloc::JIT, &exitBlock);
+  J_MovHostPtr(b, next, eJITReloc::Block, block);
+  COMP->mov(x86::qword_ptr(ptr), next);
+
+  // Back to the dispatcher
+  COMP->bind(exitLabel);
+  COMP->xor_(next, next);
+  COMP->ret(next);
+#endif
 }
 
 #undef GPR
 using namespace asmjit;
 std::shared_ptr<JITBlock> PPU_JIT::BuildJITBlock(u64 addr, u64 maxBlockSize) {
   std::unique_ptr<JITBlockBuilder> jitBuilder = std::make_unique<STRIP_UNIQUE(jitBuilder)>(addr, &jitRuntime);
+  // Created upfront, the generated code references its link slots
+  std::shared_ptr<JITBlock> block = std::make_shared<STRIP_UNIQUE(block)>(&jitRuntime, addr, jitBuilder.get());
 
 #if defined(ARCH_X86) || defined(ARCH_X86_64)
   //
@@ -126,10 +557,17 @@ std::shared_ptr<JITBlock> PPU_JIT::BuildJITBlock(u64 addr, u64 maxBlockSize) {
   jitBuilder->haltBool = compiler.newGpb("enableHalt"); // bool
 
   FuncNode *signature = nullptr;
-  compiler.addFuncNode(&signature, FuncSignature::build<void, PPU*, PPU_STATE*, bool>());
+  compiler.addFuncNode(&signature, FuncSignature::build<void*, PPU*, PPU_STATE*, bool>());
   signature->setArg(0, jitBuilder->ppu->Base());
   signature->setArg(1, jitBuilder->ppuState->Base());
   signature->setArg(2, jitBuilder->haltBool);
+
+  // Shared exit back to the dispatcher
+  Label exitLabel = compiler.newLabel();
+  jitBuilder->exitLabel = exitLabel;
+  jitBuilder->budget = &jitBudget;
+
+  jitBuilder->regs.Init(&compiler, jitBuilder->threadCtx);
 #endif
 
   std::vector<u32> instrsTemp{};
@@ -140,10 +578,18 @@ std::shared_ptr<JITBlock> PPU_JIT::BuildJITBlock(u64 addr, u64 maxBlockSize) {
   // Instruction emitters
   //
   u64 instrCount = 0;
+  PPCOpcode lastOp{};
+  u16 lastOpNameId = 0;
   while (XeRunning && !XePaused) {
     u32 offset = instrCount * 4;
     u64 pc = addr + offset;
 
+    // Track the code page before reading from it, so no write in between can be missed
+    if (instrCount == 0 || (pc & 0xFFF) == 0) {
+      if (!TrackCodePage(addr, pc))
+        block->codeTracked = false;
+    }
+
     // Fetch instruction
     auto &thread = curThread;
     thread.CIA = thread.NIA;
@@ -157,60 +603,38 @@ std::shared_ptr<JITBlock> PPU_JIT::BuildJITBlock(u64 addr, u64 maxBlockSize) {
     // Decode and emit
 
     // Saves a few cycles to cache the value here
-    u32 decodedInstr = PPCDecode(opcode);
-    auto emitter = PPCInterpreter::ppcDecoder.getJITTable()[decodedInstr];
-    static thread_local std::unordered_map<u32, u32> opcodeHashCache;
-    u32 opName = opcodeHashCache.contains(opcode) ? opcodeHashCache[opcode] : opcodeHashCache[opcode] = Base::JoaatStringHash(PPCInterpreter::ppcDecoder.getNameTable()[decodedInstr]);
-
-    // Handle skips
-    bool skip = false;
-
-#if defined(ARCH_X86) || defined(ARCH_X86_64)
-    auto patchGPR = [&](s32 reg, u64 val) {
-      x86::Gp temp = compiler.newGpq();
-      compiler.mov(temp, val);
-      compiler.mov(jitBuilder->threadCtx->array(&PPU_THREAD_REGISTERS::GPR).Ptr(reg), temp);
-    };
-    switch (thread.CIA) {
-    case 0x0200C870: patchGPR(5, 0); break;
-    // RGH 2 17489 in a JRunner Corona XDKBuild
-    case 0x0200C7F0: patchGPR(3, 0); break;
-    // VdpWriteXDVOUllong. Set r10 to 1. Skips XDVO write loop
-    case 0x800EF7C0: patchGPR(10, 1); break;
-    // VdpSetDisplayTimingParameter. Set r11 to 0x10. Skips ANA Check
-    case 0x800F6264: patchGPR(11, 0x15E); break;
-    // Needed for FSB_FUNCTION_2
-    case 0x1003598ULL: patchGPR(11, 0x0E); break;
-    case 0x1003644ULL: patchGPR(11, 0x02); break;
-    // Pretend ARGON hardware is present, to avoid the call
-    case 0x800819E0:
-    case 0x80081A60: {
-      x86::Gp temp = compiler.newGpq();
-      compiler.mov(temp, jitBuilder->threadCtx->array(&PPU_THREAD_REGISTERS::GPR).Ptr(11));
-      compiler.or_(temp, 0x08);
-      compiler.mov(jitBuilder->threadCtx->array(&PPU_THREAD_REGISTERS::GPR).Ptr(11), temp);
-    } break;
-    }
-#endif
+    const PPCInterpreter::PPCInstrInfo &instrInfo = PPCInterpreter::ppcDecoder.getInfo(PPCDecode(opcode));
+    auto emitter = instrInfo.jitHandler;
 
     bool readNextInstr = true;
 
     // Prol
-    setupProl(jitBuilder.get(), opcode, decodedInstr);
+    setupProl(jitBuilder.get(), pc, opcode);
+
+    // Guest hooks, a skipped instruction is just left out of the block
+    const bool skip = patchHooks(jitBuilder.get(), pc);
 
     if ((curThread.exceptReg & PPU_EX_INSSTOR || curThread.exceptReg & PPU_EX_INSTSEGM) || opcode == 0xFFFFFFFF)
       readNextInstr = false;
 
+    // Native emitters set this when they call helpers that may raise exceptions
+    jitBuilder->checkExceptions = !readNextInstr;
+    jitBuilder->instrIndex = instrCount;
+
     // Call JIT emitter
     if (!skip && readNextInstr) {
       bool invalidInstr = emitter == &PPCInterpreter::PPCInterpreterJIT_invalid;
       if (ppu->currentExecMode == eExecutorMode::Hybrid && invalidInstr) {
-        auto intEmitter = PPCInterpreter::ppcDecoder.getTable()[decodedInstr];
+        auto intEmitter = instrInfo.handler;
 
 #if defined(ARCH_X86) || defined(ARCH_X86_64)
+        // The interpreter works on the thread context, so it must be up to date
+        jitBuilder->regs.Flush();
         InvokeNode *out = nullptr;
-        compiler.invoke(&out, imm((void *)intEmitter), FuncSignature::build<void, void *>());
+        J_Invoke(jitBuilder.get(), &out, (void *)intEmitter, FuncSignature::build<void, void *>());
         out->setArg(0, jitBuilder->ppuState->Base());
+        jitBuilder->regs.Invalidate();
+        jitBuilder->checkExceptions = true;
 #endif
       } else {
         emitter(ppuState, jitBuilder.get(), op);
@@ -218,24 +642,18 @@ std::shared_ptr<JITBlock> PPU_JIT::BuildJITBlock(u64 addr, u64 maxBlockSize) {
     }
 
 #if defined(ARCH_X86) || defined(ARCH_X86_64)
-    // Epil (check for exc and interrupts)
-    InvokeNode *tbCheck = nullptr;
-    x86::Gp retVal = compiler.newGpb();
-    compiler.invoke(&tbCheck, imm((void*)callEpil), FuncSignature::build<bool, PPU*, PPU_STATE*>());
-    tbCheck->setArg(0, jitBuilder->ppu->Base());
-    tbCheck->setArg(1, jitBuilder->ppuState->Base());
-    tbCheck->setRet(0, retVal);
-    Label skipRet = compiler.newLabel();
-    compiler.test(retVal, retVal);
-    compiler.je(skipRet);
-    compiler.ret();
-    compiler.bind(skipRet);
+    // Exceptions raised by the instruction, only leaves the straight line path when one is pending
+    if (jitBuilder->checkExceptions) {
+      J_ExitOnException(jitBuilder.get());
+    }
 #endif
 
     // If branch or block end
     instrCount++;
-    if (opName == "bclr"_j || opName == "bcctr"_j || opName == "bc"_j || opName == "b"_j || opName == "rfid"_j ||
-        opName == "invalid"_j || instrCount >= maxBlockSize)
+    lastOp = op;
+    // A skipped branch doesn't end the block nor give it successors
+    lastOpNameId = skip ? 0 : instrInfo.nameId;
+    if ((!skip && (instrInfo.flags & PPC_INSTR_ENDS_BLOCK)) || instrCount >= maxBlockSize)
       break;
   }
 
@@ -243,15 +661,28 @@ std::shared_ptr<JITBlock> PPU_JIT::BuildJITBlock(u64 addr, u64 maxBlockSize) {
   curThread.CIA = addr - 4;
   curThread.NIA = addr;
   jitBuilder->size = instrCount * 4;
+  block->size = jitBuilder->size;
+
+  // Static successors, linked once they get compiled
+  if (instrCount != 0) {
+    const u64 lastPC = addr + (instrCount - 1) * 4;
+    if (lastOpNameId == PPCInterpreter::PPCInstrNameId("b")) {
+      block->links[0].target = (lastOp.aa ? 0 : lastPC) + lastOp.bt24;
+    } else if (lastOpNameId == PPCInterpreter::PPCInstrNameId("bc")) {
+      block->links[0].target = (lastOp.aa ? 0 : lastPC) + (EXTS(lastOp.ds, 14) << 2);
+    }
+    if (lastOpNameId != PPCInterpreter::PPCInstrNameId("b") && lastOpNameId != PPCInterpreter::PPCInstrNameId("rfid")) {
+      block->links[1].target = lastPC + 4;
+    }
+  }
 
 #if defined(ARCH_X86) || defined(ARCH_X86_64)
-  compiler.ret();
+  setupEpil(jitBuilder.get(), block.get(), instrCount, exitLabel);
   compiler.endFunc();
   compiler.finalize();
 #endif
 
   // Create the final JITBlock
-  std::shared_ptr<JITBlock> block = std::make_shared<STRIP_UNIQUE(block)>(&jitRuntime, addr, jitBuilder.get());
   if (!block->Build()) {
     block.reset();
     return nullptr;
@@ -262,6 +693,8 @@ std::shared_ptr<JITBlock> PPU_JIT::BuildJITBlock(u64 addr, u64 maxBlockSize) {
   for (auto &instr : instrsTemp) {
     block->hash += instr;
   }
+
+  StoreCachedBlock(block.get(), jitBuilder.get(), instrsTemp);
   
   // Insert block into cache
   jitBlocks.emplace(addr, std::move(block));
@@ -271,41 +704,31 @@ std::shared_ptr<JITBlock> PPU_JIT::BuildJITBlock(u64 addr, u64 maxBlockSize) {
 
 void PPU_JIT::ExecuteJITInstrs(u64 numInstrs, bool active, bool enableHalt) {
   u32 instrsExecuted = 0;
+  // Block that exited to the dispatcher last, linked to the next one we run
+  JITBlock *lastExit = nullptr;
+  // Done here and not on construction, the key depends on the executor mode and the devices
+  if (!diskCacheLoaded)
+    LoadDiskCache();
+  // Counted instructions belong to the other thread, account them before switching
+  if (ppuState->timeBase.thread != ppuState->currentThread)
+    ppu->UpdateTimeBase();
   while (instrsExecuted < numInstrs && active && (XeRunning && !XePaused)) {
     auto &thread = curThread;
-    // This *must* be done here simply because of how we handle JIT.
-    // We run until the start of a block, which is a branch opcode (or until it's a invalid instruction),
-    // but these are branch opcodes, designed to avoid calling them.
-    // So, these will break under BuildJITBlock, and tp avoid the issue, it's done here
-    bool skipBlock = false;
-    switch (thread.NIA) {
-    // INIT_POWER_MODE bypass 2.0.17489.0
-    case 0x80081764:
-    // XAudioRenderDriverInitialize bypass 2.0.17489.0
-    case 0x8018B0EC:
-    // XDK 17.489.0 AudioChipCorder Device Detect bypass. This is not needed for
-    // older console revisions
-    case 0x801AF580:
-      skipBlock = true;
-      break;
-    default:
-      break;
-    }
-    if (skipBlock) {
-      instrsExecuted++;
-      thread.NIA += 4;
+    // Drop blocks whose code was written to
+    if (XeMain::ram && XeMain::ram->HasDirtyCodePages(ppuState->ppuID)) {
+      InvalidateDirtyCodePages();
+      lastExit = nullptr;
     }
     u64 blockStart = thread.NIA;
     auto it = jitBlocks.find(blockStart);
     if (it == jitBlocks.end()) {
-      if (it != jitBlocks.end())
-        jitBlocks.erase(blockStart);
-      auto block = BuildJITBlock(blockStart, numInstrs - instrsExecuted);
+      auto block = LoadCachedBlock(blockStart);
+      if (!block)
+        block = BuildJITBlock(blockStart, numInstrs - instrsExecuted);
       if (!block)
         break; // Failed to build block, abort
-      block->codePtr(ppu, ppuState, enableHalt);
-      instrsExecuted += block->size / 4;
-    } else {
+    } else if (!it->second->codeTracked) {
+      // Not in RAM (SRAM, SROM), writes to it aren't tracked so revalidate the code
       auto &block = it->second;
       u64 sum = 0;
       if (block->size % 8 == 0) {
@@ -326,12 +749,32 @@ void PPU_JIT::ExecuteJITInstrs(u64 numInstrs, bool active, bool enableHalt) {
       }
 
       if (block->hash != sum) {
+        UnlinkBlock(block.get());
+        if (lastExit == block.get())
+          lastExit = nullptr;
         block.reset();
         jitBlocks.erase(blockStart);
         continue;
       }
+    }
+
+    JITBlock *block = jitBlocks.at(blockStart).get();
 
-      instrsExecuted += ExecuteJITBlock(blockStart, enableHalt);
+    // Halt address inside this block, step it trough the interpreter so it halts on the exact instruction
+    if (enableHalt && !ppu->guestHalt && ppu->ppuHaltOn >= blockStart && ppu->ppuHaltOn < blockStart + block->size) {
+      ppu->PPURunInstructions(block->size / 4, true);
+      instrsExecuted += block->size / 4;
+      lastExit = nullptr;
+      continue;
     }
+
+    // Chain the previous block to this one, so next time it doesn't come back here
+    if (lastExit)
+      LinkBlock(lastExit, block);
+
+    // While halting is enabled, run a single block at a time so every block start gets checked
+    jitBudget = enableHalt ? 1 : static_cast<s64>(numInstrs - instrsExecuted);
+    instrsExecuted += ExecuteJITBlock(blockStart, enableHalt);
+    lastExit = exitBlock;
   }
 }
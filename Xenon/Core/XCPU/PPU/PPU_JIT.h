@@ -2,12 +2,15 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <filesystem>
 #include <functional>
 #include <memory>
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "Base/Arch.h"
@@ -19,10 +22,33 @@
 #endif
 
 #include "Core/XCPU/PPU/PowerPC.h"
+#include "Core/XCPU/PPU/PPU_JITCache.h"
 #include "Core/RootBus/RootBus.h"
 
 class PPU;
-using JITFunc = fptr<void(PPU*, PPU_STATE*, bool)>;
+// Compiled block, returns the code of the next block to run or nullptr to go back to the dispatcher
+using JITFunc = fptr<void*(PPU*, PPU_STATE*, bool)>;
+// Generated dispatcher, runs a chain of linked blocks starting at the given block code
+using JITDispatchFunc = fptr<void(PPU*, PPU_STATE*, bool, void*)>;
+
+// Called by generated code when an instruction left an exception pending, returns true if it got
+// taken and the block must be left
+bool callExceptionExit(PPU *ppu, PPU_STATE *ppuState, u64 instrCount);
+
+// Target address used for unused block exits, no valid NIA can ever match this.
+#define XE_JIT_NO_LINK 0xFFFFFFFFFFFFFFFFULL
+// Amount of entries in the indirect branch lookup cache. Must be a power of two.
+#define XE_JIT_LOOKUP_ENTRIES 4096
+
+// Host address embedded in generated code, recorded so the block can be rebased when it's loaded
+// from the disk cache.
+struct JITReloc {
+  eJITReloc kind = eJITReloc::Image;
+  u64 value = 0;
+  // Bound right before and after the mov, the immediate is the last 8 bytes between them
+  asmjit::Label start{};
+  asmjit::Label end{};
+};
 
 #if defined(ARCH_X86) || defined(ARCH_X86_64)
 template <typename T, typename fT>
@@ -133,6 +159,295 @@ private:
   asmjit::x86::Gp base;
   u64 offset = 0;
 };
+
+//
+// Guest register cache.
+//
+// Keeps the guest GPRs, CR, XER and VRs used by a block in host registers (asmjit virtual registers,
+// the compiler's allocator decides what really stays in a physical register). Values are loaded on
+// first use and only written back on Flush(), which the block builder emits at block exits, before
+// helper calls and on exception paths.
+// Usage state is tracked while emitting, so emitters with internal branches must fetch every cached
+// register they use before their first branch.
+// CR0 updates of record forms are lazy: the result is kept and the field is only built when the CR
+// is read, the XER is modified or the registers are flushed. Branches on CR0 test the value directly.
+//
+class JITRegisterCache {
+public:
+  void Init(asmjit::x86::Compiler *comp, ASMJitPtr<PPU_THREAD_REGISTERS> *ctx) {
+    compiler = comp;
+    threadCtx = ctx;
+  }
+
+  // Returns the host register holding a GPR, for reading.
+  asmjit::x86::Gp GPR(u32 index) {
+    return Get(gprs[index], GPRMem(index), true, false);
+  }
+  // Returns the host register for a GPR the instruction fully overwrites. Sources must be fetched
+  // before, as this skips the load.
+  asmjit::x86::Gp GPROut(u32 index) {
+    return Get(gprs[index], GPRMem(index), false, true);
+  }
+  // Returns the host register holding the CR, for reading.
+  asmjit::x86::Gp CR() {
+    ResolveCR0();
+    return Get(cr, CRMem(), true, false);
+  }
+  // Returns the host register holding the CR, for a partial update.
+  asmjit::x86::Gp CROut() {
+    ResolveCR0();
+    return Get(cr, CRMem(), true, true);
+  }
+  // Returns the host register holding the XER, for reading.
+  asmjit::x86::Gp XER() {
+    return Get(xer, XERMem(), true, false);
+  }
+  // Returns the host register holding the XER, for a partial update. A pending CR0 samples XER[SO],
+  // so it's built before.
+  asmjit::x86::Gp XEROut() {
+    ResolveCR0();
+    return Get(xer, XERMem(), true, true);
+  }
+  // Returns the XMM register holding a VR, for reading.
+  asmjit::x86::Xmm VR(u32 index) {
+    return GetVector(vrs[index], VRMem(index), true, false);
+  }
+  // Returns the XMM register for a VR the instruction fully overwrites. Sources must be fetched
+  // before, as this skips the load.
+  asmjit::x86::Xmm VROut(u32 index) {
+    return GetVector(vrs[index], VRMem(index), false, true);
+  }
+
+  // Records CR0 for the result of a record form instruction, compared as a 64 or 32 bit signed value
+  // depending on MSR[SF]. Must be called after the instruction updated the XER.
+  void RecordCR0(const asmjit::x86::Gp &value) {
+    asmjit::x86::Gp mode = DataMode();
+    if (!cr0.isValid()) {
+      cr0 = compiler->newGpq();
+    }
+    compiler->movsxd(cr0, value.r32());
+    compiler->test(mode, 0x10);
+    compiler->cmovnz(cr0, value.r64());
+    cr0Pending = true;
+  }
+  // Drops a pending CR0, used when the whole field gets overwritten.
+  void DiscardCR0() {
+    cr0Pending = false;
+  }
+  // True while CR0 is pending, its value is then the one returned by CR0Value().
+  bool CR0Pending() const {
+    return cr0Pending;
+  }
+  // Value CR0 gets compared against zero, sign extended to 64 bits.
+  asmjit::x86::Gp CR0Value() const {
+    return cr0;
+  }
+  // Returns the host register holding the D-ERAT mode tag (see ERAT::BuildMode) for the current MSR.
+  // The MSR only changes trough helper calls, so it's computed once until the next Invalidate().
+  asmjit::x86::Gp DataMode() {
+    if (dataModeValid)
+      return dataMode;
+    if (!dataMode.isValid()) {
+      dataMode = compiler->newGpd();
+    }
+    // SF (bit 63), HV (bit 60), PR (bit 14) and DR (bit 4) packed as in BuildMode, IR is unused
+    asmjit::x86::Gp msr = compiler->newGpq();
+    asmjit::x86::Gp bit = compiler->newGpq();
+    compiler->mov(msr, MSRMem());
+    const std::pair<u32, u32> bits[] = { { 59, 0x10 }, { 57, 0x08 }, { 12, 0x04 }, { 4, 0x01 } };
+    compiler->xor_(dataMode, dataMode);
+    for (const auto &[shift, mask] : bits) {
+      compiler->mov(bit, msr);
+      compiler->shr(bit, shift);
+      compiler->and_(bit.r32(), mask);
+      compiler->or_(dataMode, bit.r32());
+    }
+    dataModeValid = true;
+    return dataMode;
+  }
+  // True once MSR[VXU] has been checked, it stays valid until the next Invalidate() like DataMode().
+  bool VXUChecked() const {
+    return vxuChecked;
+  }
+  void SetVXUChecked() {
+    vxuChecked = true;
+  }
+  // Returns an XMM register with 0x7FFFFFFF in every word when VSCR[NJ] is set and zero otherwise,
+  // used to flush denormals. VSCR is only written by helpers too, so it's also kept until Invalidate().
+  asmjit::x86::Xmm VXUFlushMask() {
+    if (flushMaskValid)
+      return flushMask;
+    if (!flushMask.isValid()) {
+      flushMask = compiler->newXmm();
+    }
+    // NJ is bit 16, smeared to the low 31 bits
+    asmjit::x86::Gp mask = compiler->newGpd();
+    compiler->mov(mask, VSCRMem());
+    compiler->shl(mask, 15);
+    compiler->sar(mask, 31);
+    compiler->shr(mask, 1);
+    compiler->movd(flushMask, mask);
+    compiler->pshufd(flushMask, flushMask, 0);
+    flushMaskValid = true;
+    return flushMask;
+  }
+
+  // Writes every modified register back to the thread context. Values stay cached.
+  void Flush() {
+    for (u32 i = 0; i < 32; i++) {
+      Store(gprs[i], GPRMem(i));
+    }
+    if (cr0Pending) {
+      // May be on a side path, so the cached CR is left as is
+      asmjit::x86::Gp value = compiler->newGpd();
+      if (cr.loaded) {
+        compiler->mov(value, cr.reg);
+      } else {
+        compiler->mov(value, CRMem());
+      }
+      compiler->and_(value, 0x0FFFFFFF);
+      compiler->or_(value, BuildCR0());
+      compiler->mov(CRMem(), value);
+    } else {
+      Store(cr, CRMem());
+    }
+    Store(xer, XERMem());
+    for (u32 i = 0; i < 128; i++) {
+      if (vrs[i].dirty) {
+        compiler->movaps(VRMem(i), vrs[i].reg);
+      }
+    }
+  }
+  // Forgets every cached value, they get reloaded on next use. Used after calls that may change the
+  // thread context, always after a Flush().
+  void Invalidate() {
+    for (auto &entry : gprs) {
+      entry.loaded = entry.dirty = false;
+    }
+    cr.loaded = cr.dirty = false;
+    xer.loaded = xer.dirty = false;
+    for (auto &entry : vrs) {
+      entry.loaded = entry.dirty = false;
+    }
+    cr0Pending = false;
+    dataModeValid = false;
+    vxuChecked = false;
+    flushMaskValid = false;
+  }
+private:
+  struct Entry {
+    asmjit::x86::Gp reg{};
+    bool is64 = true;
+    bool loaded = false;
+    bool dirty = false;
+  };
+
+  asmjit::x86::Gp Get(Entry &entry, const asmjit::x86::Mem &mem, bool load, bool write) {
+    if (!entry.reg.isValid()) {
+      entry.reg = entry.is64 ? compiler->newGpq() : compiler->newGpd();
+    }
+    if (!entry.loaded && load) {
+      compiler->mov(entry.reg, mem);
+    }
+    entry.loaded = true;
+    entry.dirty |= write;
+    return entry.reg;
+  }
+  struct VectorEntry {
+    asmjit::x86::Xmm reg{};
+    bool loaded = false;
+    bool dirty = false;
+  };
+
+  asmjit::x86::Xmm GetVector(VectorEntry &entry, const asmjit::x86::Mem &mem, bool load, bool write) {
+    if (!entry.reg.isValid()) {
+      entry.reg = compiler->newXmm();
+    }
+    if (!entry.loaded && load) {
+      compiler->movaps(entry.reg, mem);
+    }
+    entry.loaded = true;
+    entry.dirty |= write;
+    return entry.reg;
+  }
+  void Store(Entry &entry, const asmjit::x86::Mem &mem) {
+    if (entry.dirty) {
+      compiler->mov(mem, entry.reg);
+    }
+  }
+
+  // Builds the CR0 field of the pending value, already shifted in place. Doesn't change any state.
+  asmjit::x86::Gp BuildCR0() {
+    asmjit::x86::Gp field = compiler->newGpd();
+    asmjit::x86::Gp flag = compiler->newGpd();
+    asmjit::x86::Gp lt = compiler->newGpb();
+    asmjit::x86::Gp gt = compiler->newGpb();
+    asmjit::x86::Gp eq = compiler->newGpb();
+    // SO is copied from the XER
+    if (xer.loaded) {
+      compiler->mov(field, xer.reg);
+    } else {
+      compiler->mov(field, XERMem());
+    }
+    compiler->shr(field, 31);
+    compiler->shl(field, 28);
+    compiler->test(cr0, cr0);
+    compiler->setl(lt);
+    compiler->setg(gt);
+    compiler->sete(eq);
+    const std::pair<asmjit::x86::Gp, u32> bits[] = { { lt, 31 }, { gt, 30 }, { eq, 29 } };
+    for (const auto &[bit, shift] : bits) {
+      compiler->movzx(flag, bit);
+      compiler->shl(flag, shift);
+      compiler->or_(field, flag);
+    }
+    return field;
+  }
+  // Merges a pending CR0 into the cached CR.
+  void ResolveCR0() {
+    if (!cr0Pending)
+      return;
+    cr0Pending = false;
+    asmjit::x86::Gp field = BuildCR0();
+    asmjit::x86::Gp reg = Get(cr, CRMem(), true, true);
+    compiler->and_(reg, 0x0FFFFFFF);
+    compiler->or_(reg, field);
+  }
+
+  asmjit::x86::Mem GPRMem(u32 index) const {
+    return threadCtx->array(&PPU_THREAD_REGISTERS::GPR).Ptr(index);
+  }
+  asmjit::x86::Mem CRMem() const {
+    return threadCtx->scalar(&PPU_THREAD_REGISTERS::CR).Ptr<u32>();
+  }
+  asmjit::x86::Mem XERMem() const {
+    return threadCtx->substruct(&PPU_THREAD_REGISTERS::SPR).scalar(&PPU_THREAD_SPRS::XER).Ptr<u32>();
+  }
+  asmjit::x86::Mem MSRMem() const {
+    return threadCtx->substruct(&PPU_THREAD_REGISTERS::SPR).scalar(&PPU_THREAD_SPRS::MSR).Ptr<u64>();
+  }
+  asmjit::x86::Mem VRMem(u32 index) const {
+    return asmjit::x86::xmmword_ptr(threadCtx->Base(),
+      static_cast<s32>(threadCtx->array(&PPU_THREAD_REGISTERS::VR).Offset() + index * sizeof(Base::Vector128)));
+  }
+  asmjit::x86::Mem VSCRMem() const {
+    return threadCtx->scalar(&PPU_THREAD_REGISTERS::VSCR).Ptr<u32>();
+  }
+
+  asmjit::x86::Compiler *compiler = nullptr;
+  ASMJitPtr<PPU_THREAD_REGISTERS> *threadCtx = nullptr;
+  Entry gprs[32]{};
+  Entry cr{ {}, false };
+  Entry xer{ {}, false };
+  VectorEntry vrs[128]{};
+  asmjit::x86::Gp dataMode{};
+  bool dataModeValid = false;
+  bool vxuChecked = false;
+  asmjit::x86::Xmm flushMask{};
+  bool flushMaskValid = false;
+  asmjit::x86::Gp cr0{};
+  bool cr0Pending = false;
+};
 #endif
 
 using namespace asmjit;
@@ -169,6 +484,18 @@ public:
   ASMJitPtr<PPU_THREAD_REGISTERS> *threadCtx = nullptr;
   // EnableHalt flag
   x86::Gp haltBool{};
+  // Guest registers cached in host registers
+  JITRegisterCache regs{};
+  // Emit an exception check after the current instruction, set when it calls helpers
+  bool checkExceptions = false;
+  // Shared exit back to the dispatcher
+  Label exitLabel{};
+  // Instruction budget of the running chain, exception exits account for what they executed
+  s64 *budget = nullptr;
+  // Index of the instruction being emitted
+  u64 instrIndex = 0;
+  // Host addresses embedded in the code
+  std::vector<JITReloc> relocs{};
   // asmjit Compiler
   x86::Compiler *compiler = nullptr;
 #endif
@@ -177,6 +504,27 @@ private:
   asmjit::JitRuntime *runtime = nullptr;
 };
 
+class JITBlock;
+
+// A static exit of a block (branch target or fall through), patched to point to the successor
+// block once it is compiled, so the blocks chain without going back to C++.
+struct JITBlockLink {
+  // Guest address this exit goes to
+  u64 target = XE_JIT_NO_LINK;
+  // Code of the successor block, nullptr while unlinked
+  void *code = nullptr;
+  // Successor block, used for unlinking
+  JITBlock *block = nullptr;
+};
+
+// Entry in the inline lookup cache used for indirect branches (bclr, bcctr, rfid).
+struct JITLookupEntry {
+  // Guest address of the block
+  u64 tag = XE_JIT_NO_LINK;
+  // Code of the block
+  void *code = nullptr;
+};
+
 class JITBlock {
 public:  
   JITBlock(asmjit::JitRuntime *rt, u64 ppuAddr, JITBlockBuilder *builder) :
@@ -214,8 +562,14 @@ public:
   bool isDirty = false;
   // Reference to JIT runtime
   asmjit::JitRuntime *runtime = nullptr;
-  // Hash of all opcodes
+  // Hash of all opcodes, used to revalidate blocks that aren't RAM backed
   u64 hash = 0;
+  // Code is entirely in RAM pages tracked for writes, no revalidation needed
+  bool codeTracked = true;
+  // Static exits of this block: [0] branch target, [1] fall through
+  JITBlockLink links[2];
+  // Exits of other blocks currently linked to this one
+  std::vector<JITBlockLink*> incomingLinks = {};
 };
 
 class PPU_JIT {
@@ -227,11 +581,66 @@ public:
   u64 ExecuteJITBlock(u64 addr, bool enableHalt); // returns step count
   std::shared_ptr<JITBlock> BuildJITBlock(u64 addr, u64 maxBlockSize);
   void setupContext(JITBlockBuilder *b);
-  void setupProl(JITBlockBuilder *b, u32 instrData, u32 decoded);
-  void patchSkips(JITBlockBuilder *b, u32 addr);
+  void setupProl(JITBlockBuilder *b, u64 pc, u32 instrData);
+  // Bakes the guest hooks at pc into the block. Returns true if the instruction must be skipped
+  bool patchHooks(JITBlockBuilder *b, u64 pc);
+  // Emits the block exit: chains to a linked successor or a cached indirect target when possible
+  void setupEpil(JITBlockBuilder *b, JITBlock *block, u64 instrCount, Label exitLabel);
 private:
+  // Generates the dispatcher that runs chained blocks
+  void BuildDispatcher();
+  // Links the exits of 'from' that go to 'to', or caches 'to' for indirect branches
+  void LinkBlock(JITBlock *from, JITBlock *to);
+  // Removes every link to and from a block, called before it's discarded
+  void UnlinkBlock(JITBlock *block);
+  // Marks the physical page of EA as holding code of the block at blockAddr, false if it isn't RAM backed
+  bool TrackCodePage(u64 blockAddr, u64 EA);
+  // Invalidates every block compiled from a RAM page written since the last check
+  void InvalidateDirtyCodePages();
+  // Unlinks and discards a block
+  void InvalidateBlock(u64 addr);
+  // Lookup cache slot for a guest address
+  static u32 LookupIndex(u64 addr) { return (addr >> 2) & (XE_JIT_LOOKUP_ENTRIES - 1); }
+
+  //
+  // Disk cache
+  //
+
+  // Loads the cache file for the current image, once the executor and the devices are set up
+  void LoadDiskCache();
+  // Writes the cache file back if blocks were added to it
+  void SaveDiskCache();
+  // Path of the cache file for the current image
+  std::filesystem::path DiskCachePath() const;
+  // Key of everything that changes the generated code: emulator build, executor and baked in options
+  u64 DiskCacheKey() const;
+  // Host address relocations of the given kind are relative to
+  u64 RelocBase(eJITReloc kind, const JITBlock *block) const;
+  // Creates a block from a cached one matching the guest code at addr, nullptr if there's none
+  std::shared_ptr<JITBlock> LoadCachedBlock(u64 addr);
+  // Adds a freshly compiled block to the disk cache
+  void StoreCachedBlock(const JITBlock *block, JITBlockBuilder *b, const std::vector<u32> &opcodes);
+
   PPU *ppu = nullptr; // "Linked" PPU
   PPU_STATE *ppuState = nullptr; // For easier thread access
   asmjit::JitRuntime jitRuntime;
   std::unordered_map<u64, std::shared_ptr<JITBlock>> jitBlocks = {};
+  // Block chain dispatcher
+  JITDispatchFunc dispatcher = nullptr;
+  // Instructions left to run in the current chain, decremented by every block on exit
+  s64 jitBudget = 0;
+  // Block whose exit missed, set by generated code so the dispatcher can link it
+  JITBlock *exitBlock = nullptr;
+  // Inline lookup cache for indirect branch targets, probed by generated code
+  std::array<JITLookupEntry, XE_JIT_LOOKUP_ENTRIES> lookupCache{};
+  // Blocks compiled from each physical RAM page
+  std::unordered_map<u32, std::vector<u64>> codePageBlocks = {};
+  // Scratch list of written code pages
+  std::vector<u32> dirtyCodePages = {};
+  // Blocks persisted across runs
+  JITBlockCache diskCache{};
+  // Set once the disk cache was loaded (or skipped)
+  bool diskCacheLoaded = false;
+  // Key computed on load, devices may already be gone when saving
+  u64 diskCacheKey = 0;
 };
\ No newline at end of file
@@ -0,0 +1,166 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#include <fstream>
+
+#include "Base/Logging/Log.h"
+
+#include "PPU_JITCache.h"
+
+// File magic, 'XJTC'
+#define XE_JIT_CACHE_MAGIC 0x43544A58
+// Version of the file layout
+#define XE_JIT_CACHE_FORMAT 1
+// Maximum amount of different blocks kept for the same guest address
+#define XE_JIT_CACHE_MAX_VARIANTS 4
+// Upper bound for the host code of a single block, anything bigger is a corrupt file
+#define XE_JIT_CACHE_MAX_CODE_SIZE 0x100000
+
+template <typename T>
+static bool ReadValue(std::ifstream &file, T &value) {
+  file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return file.good();
+}
+
+template <typename T>
+static void WriteValue(std::ofstream &file, const T &value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+bool JITBlockCache::Load(const std::filesystem::path &path, u64 key) {
+  std::error_code error;
+  if (!std::filesystem::exists(path, error))
+    return false;
+  std::ifstream file{ path, std::ios::in | std::ios::binary };
+  if (!file.is_open())
+    return false;
+
+  u32 magic = 0, format = 0;
+  u64 fileKey = 0, count = 0;
+  if (!ReadValue(file, magic) || !ReadValue(file, format) || !ReadValue(file, fileKey) || !ReadValue(file, count))
+    return false;
+  if (magic != XE_JIT_CACHE_MAGIC || format != XE_JIT_CACHE_FORMAT || fileKey != key) {
+    LOG_INFO(Xenon, "PPU_JIT: Discarding outdated block cache '{}'", path.filename().string());
+    return false;
+  }
+
+  std::unordered_map<u64, std::vector<JITCacheEntry>> loaded{};
+  u64 loadedCount = 0;
+  for (; loadedCount != count; loadedCount++) {
+    JITCacheEntry entry{};
+    u32 codeSize = 0, relocCount = 0;
+    if (!ReadValue(file, entry.ppuAddress) || !ReadValue(file, entry.size) || !ReadValue(file, entry.codeHash) ||
+        !ReadValue(file, entry.linkTargets[0]) || !ReadValue(file, entry.linkTargets[1]) ||
+        !ReadValue(file, codeSize) || !ReadValue(file, relocCount))
+      break;
+    if (codeSize > XE_JIT_CACHE_MAX_CODE_SIZE || relocCount > codeSize / 8)
+      break;
+    entry.code.resize(codeSize);
+    file.read(reinterpret_cast<char*>(entry.code.data()), codeSize);
+    if (!file.good())
+      break;
+    bool valid = true;
+    entry.relocs.resize(relocCount);
+    for (JITCacheReloc &reloc : entry.relocs) {
+      u8 kind = 0;
+      if (!ReadValue(file, reloc.offset) || !ReadValue(file, kind) || !ReadValue(file, reloc.addend) ||
+          kind > static_cast<u8>(eJITReloc::ReservationCount) || static_cast<u64>(reloc.offset) + 8 > codeSize) {
+        valid = false;
+        break;
+      }
+      reloc.kind = static_cast<eJITReloc>(kind);
+    }
+    if (!valid)
+      break;
+    loaded[entry.ppuAddress].push_back(std::move(entry));
+  }
+
+  if (loadedCount != count) {
+    LOG_WARNING(Xenon, "PPU_JIT: Block cache '{}' is corrupt, ignoring it", path.filename().string());
+    return false;
+  }
+  entries = std::move(loaded);
+  dirty = false;
+  LOG_INFO(Xenon, "PPU_JIT: Loaded {} cached blocks from '{}'", count, path.filename().string());
+  return true;
+}
+
+bool JITBlockCache::Save(const std::filesystem::path &path, u64 key) const {
+  // Written to a temporary file first, so an interrupted write can't leave a truncated cache
+  std::filesystem::path tempPath = path;
+  tempPath += ".tmp";
+  {
+    std::ofstream file{ tempPath, std::ios::out | std::ios::binary | std::ios::trunc };
+    if (!file.is_open()) {
+      LOG_ERROR(Xenon, "PPU_JIT: Unable to write block cache '{}'", tempPath.string());
+      return false;
+    }
+    u64 count = 0;
+    for (const auto &[addr, variants] : entries)
+      count += variants.size();
+    WriteValue(file, static_cast<u32>(XE_JIT_CACHE_MAGIC));
+    WriteValue(file, static_cast<u32>(XE_JIT_CACHE_FORMAT));
+    WriteValue(file, key);
+    WriteValue(file, count);
+    for (const auto &[addr, variants] : entries) {
+      for (const JITCacheEntry &entry : variants) {
+        WriteValue(file, entry.ppuAddress);
+        WriteValue(file, entry.size);
+        WriteValue(file, entry.codeHash);
+        WriteValue(file, entry.linkTargets[0]);
+        WriteValue(file, entry.linkTargets[1]);
+        WriteValue(file, static_cast<u32>(entry.code.size()));
+        WriteValue(file, static_cast<u32>(entry.relocs.size()));
+        file.write(reinterpret_cast<const char*>(entry.code.data()), entry.code.size());
+        for (const JITCacheReloc &reloc : entry.relocs) {
+          WriteValue(file, reloc.offset);
+          WriteValue(file, static_cast<u8>(reloc.kind));
+          WriteValue(file, reloc.addend);
+        }
+      }
+    }
+    if (!file.good()) {
+      LOG_ERROR(Xenon, "PPU_JIT: Failed writing block cache '{}'", tempPath.string());
+      return false;
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(tempPath, path, error);
+  if (error) {
+    LOG_ERROR(Xenon, "PPU_JIT: Unable to replace block cache '{}': {}", path.string(), error.message());
+    return false;
+  }
+  return true;
+}
+
+const std::vector<JITCacheEntry> *JITBlockCache::Find(u64 ppuAddress) const {
+  auto it = entries.find(ppuAddress);
+  return it == entries.end() ? nullptr : &it->second;
+}
+
+void JITBlockCache::Insert(JITCacheEntry &&entry) {
+  std::vector<JITCacheEntry> &variants = entries[entry.ppuAddress];
+  std::erase_if(variants, [&entry](const JITCacheEntry &other) {
+    return other.codeHash == entry.codeHash && other.size == entry.size;
+  });
+  // Oldest variants go first
+  if (variants.size() >= XE_JIT_CACHE_MAX_VARIANTS)
+    variants.erase(variants.begin());
+  variants.push_back(std::move(entry));
+  dirty = true;
+}
+
+u64 JITBlockCache::HashCode(const u32 *opcodes, size_t count) {
+  u64 hash = 0xCBF29CE484222325ULL;
+  for (size_t i = 0; i != count; i++) {
+    hash = HashCombine(hash, opcodes[i]);
+  }
+  return hash;
+}
+
+u64 JITBlockCache::HashCombine(u64 hash, u64 value) {
+  for (u32 byte = 0; byte != 8; byte++) {
+    hash ^= (value >> (byte * 8)) & 0xFF;
+    hash *= 0x100000001B3ULL;
+  }
+  return hash;
+}
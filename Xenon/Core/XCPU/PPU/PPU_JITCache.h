@@ -0,0 +1,78 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#pragma once
+
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+
+#include "Base/Types.h"
+
+//
+// Persistent JIT block cache.
+//
+// Compiled blocks are written to disk when the PPU goes away and loaded back on the next run, so
+// the same boot code doesn't have to go trough the compiler again. Every host address embedded in
+// a block is stored as a relocation (relative to a base of its kind) and rebased on load. Blocks
+// are keyed by guest address and a hash of the guest instructions, and are only used when the
+// code currently in memory matches. The whole file is discarded when the emulator build or any
+// option baked into the generated code changes.
+//
+
+// Kind of host address embedded in generated code, tells what it's relative to.
+enum class eJITReloc : u8 {
+  Image,           // Function in the emulator binary
+  JIT,             // Member of the owning PPU_JIT
+  Block,           // Member of the block itself
+  RAMBase,         // Host address of the start of RAM
+  CodePageMap,     // Code page map of RAM
+  DirtyCodePages,  // Dirty code pages flag of the owning PPU
+  ReservationCount // Active reservation count
+};
+
+// Relocation of a cached block, the 8 bytes at offset get the base of kind plus addend.
+struct JITCacheReloc {
+  u32 offset = 0;
+  eJITReloc kind = eJITReloc::Image;
+  s64 addend = 0;
+};
+
+// A compiled block as stored on disk.
+struct JITCacheEntry {
+  // Address of the PPC block
+  u64 ppuAddress = 0;
+  // PPC code size in bytes
+  u64 size = 0;
+  // Hash of the PPC instructions, see JITBlockCache::HashCode
+  u64 codeHash = 0;
+  // Targets of the static exits
+  u64 linkTargets[2] = {};
+  // Host code, with the relocated addresses zeroed
+  std::vector<u8> code{};
+  // Host addresses to patch in
+  std::vector<JITCacheReloc> relocs{};
+};
+
+class JITBlockCache {
+public:
+  // Loads a cache file, a file with a different key is ignored. Returns true if entries were loaded.
+  bool Load(const std::filesystem::path &path, u64 key);
+  // Writes every entry to a cache file.
+  bool Save(const std::filesystem::path &path, u64 key) const;
+
+  // Returns the entries cached for a guest address, nullptr if there are none.
+  const std::vector<JITCacheEntry> *Find(u64 ppuAddress) const;
+  // Adds an entry, replacing the one with the same address and code hash.
+  void Insert(JITCacheEntry &&entry);
+  // True when entries were added since the last Load/Save.
+  bool IsDirty() const { return dirty; }
+
+  // Hashes PPC instructions (FNV-1a, 64 bit).
+  static u64 HashCode(const u32 *opcodes, size_t count);
+  // Mixes a value into a hash, used to build cache keys.
+  static u64 HashCombine(u64 hash, u64 value);
+
+private:
+  std::unordered_map<u64, std::vector<JITCacheEntry>> entries = {};
+  bool dirty = false;
+};
@@ -7,8 +7,8 @@
 #include <unordered_map>
 
 #include "Base/Bitfield.h"
-#include "Base/LRUCache.h"
 #include "Base/Vector128.h"
+#include "Core/XCPU/PPU/ERAT.h"
 #include "Core/XCPU/XenonSOC.h"
 #include "Core/XCPU/IIC/IIC.h"
 #include "Core/XCPU/XenonReservations.h"
@@ -32,6 +32,7 @@ union PPCOpcode {
   PPCBitfield<u32, 6, 5> vs; // 6..10
   PPCBitfield<u32, 22, 4> vsh; // 22..25
   PPCBitfield<u32, 21, 1> oe; // 21
+  PPCBitfield<u32, 21, 1> vrc; // 21
   PPCBitfield<u32, 11, 10> spr; // 11..20
   PPCBitfield<u32, 21, 5> vc; // 21..25
   PPCBitfield<u32, 21, 11> xo; // 21..30
@@ -330,6 +331,13 @@ union FPSCRegister {
   void clearFIFR() { FI = 0; FR = 0; }
 };
 
+// Result class left pending in FPRF by the fast FPU mode, see PPCInterpreter::ppuResolveFPRF.
+enum class eFPRFPending : u8 {
+  None,
+  Double,
+  Single
+};
+
 /*
  XER Register (XER)
 */
@@ -706,6 +714,9 @@ struct PPU_THREAD_REGISTERS {
   CRegister CR;
   // Floating-Point Status Control Register
   FPSCRegister FPSCR;
+  // Fast FPU mode: last result whose class hasn't been written to FPSCR[FPRF] yet
+  u64 fprfPendingValue = 0;
+  eFPRFPending fprfPending = eFPRFPending::None;
   // Segment Lookaside Buffer
   SLBEntry SLB[64]{};
   // Vector Status and Control Register
@@ -713,8 +724,8 @@ struct PPU_THREAD_REGISTERS {
 
   // ERAT's
 
-  LRUCache iERAT{}; // Instruction effective to real address cache.
-  LRUCache dERAT{}; // Data effective to real address cache.
+  ERAT iERAT{}; // Instruction effective to real address cache.
+  ERAT dERAT{}; // Data effective to real address cache.
 
   // Exception Register
   u16 exceptReg = 0;
@@ -737,6 +748,24 @@ struct PPU_THREAD_REGISTERS {
   std::unique_ptr<PPU_RES> ppuRes{};
 };
 
+// Maximum amount of instructions the time base is left behind for, so a change in
+// timeBaseActive or HID6 is noticed
+#define PPU_TIME_BASE_MAX_BATCH 0x1000
+
+// Time base bookkeeping. TB and the decrementer aren't updated on every instruction, instead
+// instructions are counted and TB/DEC advance by count * ticksPerInstr when they're read or
+// written, or when the decrementer would underflow.
+struct PPU_TIME_BASE {
+  // Instructions run since TB and DEC were last brought up to date
+  u64 instrs = 0;
+  // Value of instrs at which they must be brought up to date
+  u64 eventInstrs = 0;
+  // Time base ticks per instruction (CPI)
+  u64 ticksPerInstr = 0;
+  // Thread whose decrementer the counted instructions belong to
+  ePPUThread thread = ePPUThread_Zero;
+};
+
 struct PPU_STATE {
   ~PPU_STATE() {
     for (u8 i = 0; i < 2; ++i) {
@@ -749,6 +778,8 @@ struct PPU_STATE {
   ePPUThread currentThread = ePPUThread_Zero;
   // Shared Special Purpose Registers.
   PPU_STATE_SPRS SPR{};
+  // Lazily updated time base and decrementer
+  PPU_TIME_BASE timeBase{};
   // Translation Lookaside Buffer
   TLB_Reg TLB{};
   // Address Translation Flag
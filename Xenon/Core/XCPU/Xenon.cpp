@@ -2,7 +2,10 @@
 
 #include "Xenon.h"
 
+#include <thread>
+
 #include "Base/Logging/Log.h"
+#include "Core/SaveState.h"
 #include "Interpreter/PPCInterpreter.h"
 
 Xenon::Xenon(RootBus *inBus, const std::string blPath, const std::string fusesPath) {
@@ -227,6 +230,36 @@ bool Xenon::IsHalted() {
   return false;
 }
 
+bool Xenon::WaitForParked(std::chrono::milliseconds timeout) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  for (PPU *ppu : { ppu0.get(), ppu1.get(), ppu2.get() }) {
+    while (ppu && !ppu->IsParked()) {
+      if (std::chrono::steady_clock::now() >= deadline)
+        return false;
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+  return true;
+}
+
+void Xenon::DoState(Xe::StateStream &stream) {
+  stream.DoMarker("Xenon");
+  stream.DoArray(xenonContext.SRAM, XE_SRAM_SIZE);
+  stream.Do(xenonContext.timeBaseActive);
+  // SoC blocks
+  stream.Do(*xenonContext.socSecOTPBlock);
+  stream.Do(*xenonContext.socSecEngBlock);
+  stream.Do(*xenonContext.socSecRNGBlock);
+  stream.Do(*xenonContext.socCBIBlock);
+  stream.Do(*xenonContext.socPMWBlock);
+  stream.Do(*xenonContext.socPRVBlock);
+  xenonContext.xenonIIC.DoState(stream);
+  for (PPU *ppu : { ppu0.get(), ppu1.get(), ppu2.get() }) {
+    if (ppu)
+      ppu->DoState(stream);
+  }
+}
+
 bool Xenon::IsHaltedByGuest() {
   if (ppu0.get() && ppu0->IsHaltedByGuest()) {
     return true;
@@ -16,6 +16,7 @@
 #include "Core/RootBus/RootBus.h"
 #include "Core/XCPU/PPU/PPU.h"
 
+#include <chrono>
 #include <filesystem>
 
 class Xenon {
@@ -43,6 +44,12 @@ public:
 
   bool IsHaltedByGuest();
 
+  // Waits for every PPU to stop running instructions after Halt. Returns false on timeout.
+  bool WaitForParked(std::chrono::milliseconds timeout);
+
+  // Saves or restores the CPU state, must only be done while parked
+  void DoState(Xe::StateStream &stream);
+
   Xe::XCPU::IIC::XenonIIC *GetIICPointer() { return &xenonContext.xenonIIC; }
 
   PPU *GetPPU(u8 ppuID);
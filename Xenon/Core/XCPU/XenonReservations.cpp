@@ -1,31 +1,46 @@
 // Copyright 2025 Xenon Emulator Project. All rights reserved.
 
+#include <algorithm>
+
 #include "XenonReservations.h"
 
 XenonReservations::XenonReservations() {
-  std::lock_guard lock(reservationLock);
-  numReservations = 0;
-  processors = 0;
-  reservations[0] = nullptr;
+  versions = std::make_unique<ReservationSlot[]>(XE_RES_TABLE_SIZE);
 }
 
 bool XenonReservations::Register(PPU_RES *Res) {
-  std::lock_guard lock(reservationLock);
-  reservations[processors] = Res;
-  processors++;
+  Res->valid = false;
+  Res->reservedAddr = 0;
+  Res->version = 0;
   return true;
 }
 
-void XenonReservations::Scan(u64 PhysAddress) {
-  std::lock_guard lock(reservationLock);
-  // Address must be aligned.
-  PhysAddress &= ~7;
+void XenonReservations::Reserve(PPU_RES *Res, u64 PhysAddress) {
+  // The count goes up before the version is read, a plain store that doesn't see it yet is then
+  // ordered before the version load (see Check)
+  if (!Res->valid) {
+    Res->valid = true;
+    numReservations.fetch_add(1, std::memory_order_seq_cst);
+  }
+  // Acquire, so the reserved data is read after the version
+  Res->version = GetVersion(PhysAddress).load(std::memory_order_acquire);
+  Res->reservedAddr = PhysAddress;
+}
+
+void XenonReservations::Release(PPU_RES *Res) {
+  if (Res->valid) {
+    Res->valid = false;
+    numReservations.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
 
-  for (int i = 0; i < processors; i++) {
-    // NB: order of checks matters!
-    if (reservations[i]->valid && PhysAddress >= reservations[i]->reservedAddr) {
-      reservations[i]->valid = false;
-      numReservations--;
-    }
+void XenonReservations::Invalidate(u64 PhysAddress, u64 size) {
+  const u64 first = PhysAddress >> XE_RES_GRANULE_SHIFT;
+  const u64 last = (PhysAddress + (size ? size : 1) - 1) >> XE_RES_GRANULE_SHIFT;
+  // Big writes wrap around the whole table, no need to bump a slot more than once
+  const u64 count = std::min<u64>(last - first + 1, XE_RES_TABLE_SIZE);
+  for (u64 i = 0; i != count; i++) {
+    // Steps of 2 keep the version even, the low bit is the store conditional lock
+    GetVersion((first + i) << XE_RES_GRANULE_SHIFT).fetch_add(2, std::memory_order_release);
   }
 }
@@ -2,42 +2,83 @@
 
 #pragma once
 
-#include <functional>
-#include <mutex>
-#include <vector>
+#include <atomic>
+#include <memory>
+
+// Reservations are tracked per 128 byte cache line, like on hardware
+#define XE_RES_GRANULE_SHIFT 7
+#define XE_RES_GRANULE_SIZE (1ULL << XE_RES_GRANULE_SHIFT)
+// Amount of version slots, granules are hashed into them. Must be a power of 2.
+#define XE_RES_TABLE_SIZE 0x1000
 
 struct PPU_RES {
   u8 ppuID;
   volatile bool valid;
   volatile u64 reservedAddr;
+  // Version of the reserved granule when the reservation was taken
+  u64 version;
 };
 
+//
+// Reservation table for lwarx/ldarx and stwcx./stdcx.
+//
+// Every granule hashes to a version slot. Plain stores bump the version of the slot they hit once
+// the data is written, a reservation remembers the version it saw and a store conditional only
+// succeeds if it can swap that same version for a locked (odd) one. The store is done while the
+// slot is locked and unlocking bumps the version again, so any other reservation on the granule
+// fails. Collisions in the table only cause spurious failures, which the guest must handle anyway.
+//
 class XenonReservations {
 public:
   XenonReservations();
+  // Resets a thread's reservation.
   virtual bool Register(PPU_RES *Res);
-  void Increment(void) {
-    std::lock_guard lock(reservationLock);
-    numReservations++;
-  }
-  void Decrement(void) {
-    std::lock_guard lock(reservationLock);
-    numReservations--;
+  // Takes a reservation on PhysAddress, must be done before reading the reserved data.
+  void Reserve(PPU_RES *Res, u64 PhysAddress);
+  // Drops a reservation, if there's one.
+  void Release(PPU_RES *Res);
+  // Runs store if Res still holds a reservation on PhysAddress and nothing wrote to its granule
+  // since. The reservation is consumed either way. Returns whether the store was done.
+  template <typename F>
+  bool StoreConditional(PPU_RES *Res, u64 PhysAddress, F &&store) {
+    if (!Res->valid)
+      return false;
+    Release(Res);
+    u64 expected = Res->version;
+    // An odd version was seen while another store conditional was in progress
+    if (Res->reservedAddr != PhysAddress || (expected & 1))
+      return false;
+    std::atomic<u64> &version = GetVersion(PhysAddress);
+    if (!version.compare_exchange_strong(expected, expected | 1, std::memory_order_acquire, std::memory_order_relaxed))
+      return false;
+    store();
+    version.fetch_add(1, std::memory_order_release);
+    return true;
   }
-  void Check(u64 x) {
-    if (numReservations)
-      Scan(x);
+  // Invalidates reservations on the granules written to, must be done after the write.
+  void Check(u64 PhysAddress, u64 size = 1) {
+    // Pairs with the count increment in Reserve: either the write is seen by the reserving thread or
+    // the count is seen here
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (numReservations.load(std::memory_order_relaxed))
+      Invalidate(PhysAddress, size);
   }
-  virtual void Scan(u64 PhysAddress);
-  void LockGuard(std::function<void()> callback) {
-    std::lock_guard lock(reservationLock);
-    if (callback) {
-      callback();
-    }
+  // Amount of valid reservations, polled by JIT stores that write to host memory directly.
+  const s32 *GetReservationCount() const {
+    return reinterpret_cast<const s32*>(&numReservations);
   }
 private:
-  s32 numReservations;
-  std::recursive_mutex reservationLock;
-  s32 processors;
-  struct PPU_RES *reservations[6];
+  std::atomic<u64> &GetVersion(u64 PhysAddress) {
+    return versions[(PhysAddress >> XE_RES_GRANULE_SHIFT) & (XE_RES_TABLE_SIZE - 1)].version;
+  }
+  void Invalidate(u64 PhysAddress, u64 size);
+
+  // One slot per cache line, so threads working on different granules don't contend
+  struct alignas(64) ReservationSlot {
+    std::atomic<u64> version = 0;
+  };
+  static_assert(sizeof(std::atomic<s32>) == sizeof(s32) && std::atomic<s32>::is_always_lock_free,
+    "The JIT reads the reservation count as a plain s32");
+  std::atomic<s32> numReservations = 0;
+  std::unique_ptr<ReservationSlot[]> versions;
 };
@@ -21,6 +21,8 @@
 #include "Base/CRCHash.h"
 #include "Base/Thread.h"
 
+#include "Core/Scheduler.h"
+
 #include "Render/Abstractions/Renderer.h"
 
 namespace Xe::XGPU {
@@ -28,7 +30,11 @@ namespace Xe::XGPU {
 CommandProcessor::CommandProcessor(RAM *ramPtr, XenosState *statePtr, Render::Renderer *renderer, PCIBridge *pciBridge) :
   ram(ramPtr),
   state(statePtr), render(renderer),
-  parentBus(pciBridge) {
+  parentBus(pciBridge),
+  shaderCache([this](const TranslatedShader &shader) { OnShaderTranslated(shader); }) {
+  // Take turns with the PPUs, so packets run at a deterministic point
+  if (XeMain::GetScheduler()->IsDeterministic())
+    schedulerId = XeMain::GetScheduler()->Register("CP");
   cpWorkerThread = std::thread(&CommandProcessor::cpWorkerThreadLoop, this);
 
   // According to free60/libxenon, these are the correct uCode sizes
@@ -38,6 +44,9 @@ CommandProcessor::CommandProcessor(RAM *ramPtr, XenosState *statePtr, Render::Re
 
 CommandProcessor::~CommandProcessor() {
   cpWorkerThreadRunning = false;
+  cpWorker.Stop();
+  if (schedulerId)
+    XeMain::GetScheduler()->Unregister(schedulerId);
   if (cpWorkerThread.joinable()) {
     cpWorkerThread.join();
   }
@@ -92,10 +101,12 @@ void CommandProcessor::CPUpdateRBBase(u32 address) {
     return;
 
   cpRingBufferBasePtr = ram->GetPointerToAddress(address);
+  cpRingBufferBaseAddress = address;
   LOG_DEBUG(Xenos, "CP: Updating RingBuffer Base Address: 0x{:X}", address);
   
   // Reset CP Read pointer index
   cpReadPtrIndex = 0;
+  cpWorker.Notify();
 }
 
 void CommandProcessor::CPUpdateRBSize(size_t newSize) {
@@ -108,16 +119,75 @@ void CommandProcessor::CPUpdateRBSize(size_t newSize) {
 
 void CommandProcessor::CPUpdateRBWritePointer(u32 offset) {
   cpWritePtrIndex = offset;
+  cpWorker.Notify();
+}
+
+bool CommandProcessor::WaitForIdle(std::chrono::milliseconds timeout) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (cpRingBufferBasePtr != nullptr && cpReadPtrIndex != cpWritePtrIndex.load()) {
+    if (!cpWorkerThreadRunning || std::chrono::steady_clock::now() >= deadline)
+      return false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+void CommandProcessor::DoState(StateStream &stream) {
+  // The read index is only updated once a whole primary buffer ran
+  if (!WaitForIdle(std::chrono::milliseconds(1000)))
+    LOG_WARNING(Xenos, "CP: Still busy, packets in flight may run twice after loading this state.");
+  stream.DoMarker("CommandProcessor");
+  stream.Do(cpPFPuCodeAddress);
+  stream.Do(cpMEuCodeWriteAddress);
+  stream.Do(cpMEuCodeReadAddress);
+  stream.Do(cpMEuCodeSize);
+  stream.DoMap(cpMEuCodeData);
+  stream.Do(cpPFPuCodeSize);
+  stream.DoMap(cpPFPuCodeData);
+  stream.DoVector(cpME_PM4_ME_INIT_Data);
+  stream.Do(binSelect);
+  stream.Do(binMask);
+  u32 swaps = swapCount.load();
+  u32 vblanks = vblankCount.load();
+  stream.Do(swaps);
+  stream.Do(vblanks);
+  // Ring buffer
+  u64 ringSize = cpRingBufferSize.load();
+  u32 readIndex = cpReadPtrIndex.load();
+  u32 writeIndex = cpWritePtrIndex.load();
+  stream.Do(cpRingBufferBaseAddress);
+  stream.Do(ringSize);
+  stream.Do(readIndex);
+  stream.Do(writeIndex);
+  if (!stream.IsLoading() || stream.Failed())
+    return;
+
+  swapCount = swaps;
+  vblankCount = vblanks;
+  cpRingBufferSize = static_cast<size_t>(ringSize);
+  cpRingBufferBasePtr = cpRingBufferBaseAddress ? ram->GetPointerToRange(cpRingBufferBaseAddress, ringSize) : nullptr;
+  cpReadPtrIndex = readIndex;
+  cpWritePtrIndex = writeIndex;
+  cpWorker.Notify();
 }
 
 void CommandProcessor::cpWorkerThreadLoop() {
   Base::SetCurrentThreadName("[Xe] Command Processor");
+  Xe::Scheduler *scheduler = XeMain::GetScheduler();
   while (cpWorkerThreadRunning) {
-    u32 writePtrIndex = cpWritePtrIndex.load();
-    while (cpWorkerThreadRunning && (cpRingBufferBasePtr == nullptr || cpReadPtrIndex == writePtrIndex)) {
-      // Stall until we're told otherwise
-      std::this_thread::sleep_for(10ns);
-      writePtrIndex = cpWritePtrIndex.load();
+    if (schedulerId) {
+      // Scheduled, the turn is taken even with nothing to do so the others keep going
+      if (!scheduler->BeginSlice(schedulerId))
+        break;
+    } else if (!cpWorker.Wait([this] { return cpRingBufferBasePtr != nullptr && cpReadPtrIndex != cpWritePtrIndex.load(); })) {
+      // Stall until the write pointer moves
+      break;
+    }
+    const u32 writePtrIndex = cpWritePtrIndex.load();
+    if (cpRingBufferBasePtr == nullptr || cpReadPtrIndex == writePtrIndex) {
+      if (schedulerId)
+        scheduler->EndSlice(schedulerId);
+      continue;
     }
 
     // Shutdown if we were told to
@@ -128,7 +198,12 @@ void CommandProcessor::cpWorkerThreadLoop() {
     LOG_INFO(Xenos, "CP: Command processor setup.");
 
     cpReadPtrIndex = cpExecutePrimaryBuffer(cpReadPtrIndex, writePtrIndex);
+    if (schedulerId)
+      scheduler->EndSlice(schedulerId);
   }
+  // Leave the turn order, so nobody waits on us
+  if (schedulerId)
+    scheduler->Unregister(schedulerId);
 }
 
 u32 CommandProcessor::cpExecutePrimaryBuffer(u32 readIndex, u32 writeIndex) {
@@ -156,8 +231,13 @@ u32 CommandProcessor::cpExecutePrimaryBuffer(u32 readIndex, u32 writeIndex) {
 }
 
 void CommandProcessor::cpExecuteIndirectBuffer(u32 bufferPtr, u32 bufferSize) {
+  u8 *bufferHostPtr = ram->GetPointerToRange(bufferPtr, bufferSize * sizeof(u32));
+  if (!bufferHostPtr) {
+    LOG_ERROR(Xenos, "CP[IndirectRingBuffer]: Buffer 0x{:X} (0x{:X} dwords) is outside of RAM.", bufferPtr, bufferSize);
+    return;
+  }
   // Create the ring buffer instance for the indirect buffer.
-  RingBuffer ringBufer(ram->GetPointerToAddress(bufferPtr), bufferSize * sizeof(u32));
+  RingBuffer ringBufer(bufferHostPtr, bufferSize * sizeof(u32));
 
   // Set write offset.
   ringBufer.setWriteOffset(bufferSize * sizeof(u32));
@@ -605,6 +685,7 @@ bool CommandProcessor::ExecutePacketType3_COND_WRITE(RingBuffer *ringBuffer, u32
     if (waitInfo & 0x100) {
       u8 *addrPtr = ram->GetPointerToAddress(static_cast<u32>(writeReg));
       memcpy(addrPtr, &writeData, sizeof(writeData));
+      ram->NotifyHostWrite(addrPtr, sizeof(writeData));
     } else {
       state->WriteRegister(writeReg, writeData);
     }
@@ -696,36 +777,17 @@ void VisitAll(const Microcode::AST::ControlFlowGraph *cf, Microcode::AST::Statem
   }
 }
 
-std::pair<Microcode::AST::Shader*, std::vector<u32>> LoadShader(eShaderType shaderType, const std::vector<u32> &data, std::string baseString) {
-  fs::path shaderPath{ Base::FS::GetUserPath(Base::FS::PathType::ShaderDir) / "cache" };
-  fs::path path{ shaderPath / (baseString + ".spv") };
-  std::vector<u32> code{};
-  // Vali: Temporarily disable cache, emitting isn't 100% yet
-  // Plus, I need to figure Shader ptr out
-  /*{
-    std::ifstream file{ path, std::ios::in | std::ios::binary };
-    std::error_code error;
-    if (fs::exists(path, error) && file.is_open()) {
-      u64 fileSize = fs::file_size(path);
-      code.resize(fileSize / 4);
-      file.read(reinterpret_cast<char*>(code.data()), fileSize);
-      file.close();
-      return code;
-    }
-    file.close();
-  }*/
-  Microcode::AST::Shader *shader = Microcode::AST::Shader::DecompileMicroCode(reinterpret_cast<const u8*>(data.data()), data.size() * 4, shaderType);
+void CommandProcessor::OnShaderTranslated(const TranslatedShader &shader) {
 #ifndef NO_GFX
-  Microcode::AST::ShaderCodeWriterSirit writer{ shaderType, shader };
-  if (shader) {
-    shader->EmitShaderCode(writer);
-  }
-  code = writer.module.Assemble();
-  std::ofstream f{ shaderPath / (baseString + ".spv"), std::ios::out | std::ios::binary };
-  f.write(reinterpret_cast<char*>(code.data()), code.size() * 4);
-  f.close();
+  std::lock_guard<std::mutex> lock(render->shaderQueueMutex);
+  render->shaderLoadQueue.push({
+    shader.type,
+    shader.crc,
+    ShaderCache::BaseName(shader.type, shader.crc),
+    shader.shader.get(),
+    shader.spirv
+  });
 #endif
-  return { shader, code };
 }
 
 bool CommandProcessor::ExecutePacketType3_IM_LOAD(RingBuffer *ringBuffer, u32 packetData, u32 dataCount) {
@@ -736,8 +798,12 @@ bool CommandProcessor::ExecutePacketType3_IM_LOAD(RingBuffer *ringBuffer, u32 pa
   const u32 startSize = ringBuffer->ReadAndSwap<u32>();
   const u32 start = startSize >> 16;
   const u64 size = (startSize & 0xFFFF) * 4;
-  u8 *addrPtr = ram->GetPointerToAddress(addr);
+  u8 *addrPtr = ram->GetPointerToRange(addr, size);
   LOG_DEBUG(Xenos, "[CP::IM_LOAD] Shader Address: 0x{:X} | Shader Size: 0x{:X} (0x{:X}, 0x{:X})", addr, startSize, start, size);
+  if (!addrPtr) {
+    LOG_ERROR(Xenos, "[CP::IM_LOAD] Shader at 0x{:X} is outside of RAM.", addr);
+    return false;
+  }
 
   std::vector<u32> data{};
   u32 dwordCount = size / 4;
@@ -747,30 +813,10 @@ bool CommandProcessor::ExecutePacketType3_IM_LOAD(RingBuffer *ringBuffer, u32 pa
     value = byteswap_be(value);
   }
   
-  fs::path shaderPath{ Base::FS::GetUserPath(Base::FS::PathType::ShaderDir) / "cache" };
-  std::string typeString = shaderType == Xe::eShaderType::Pixel ? "pixel" : "vertex";
   u32 crc = CRC32::CRC32::calc(reinterpret_cast<const u8 *>(data.data()), data.size() * 4);
-  std::string baseString = fmt::format("{}_shader_{:X}", typeString, crc);
-  {
-    std::ofstream f{ shaderPath / (baseString + ".bin"), std::ios::out | std::ios::binary };
-    f.write(reinterpret_cast<char *>(data.data()), data.size() * 4);
-    f.close();
-  }
-
-  std::pair<Microcode::AST::Shader*, std::vector<u32>> shader = LoadShader(shaderType, data, baseString);
-
-#ifndef NO_GFX
-  {
-    std::lock_guard<std::mutex> lock(render->shaderQueueMutex);
-    render->shaderLoadQueue.push({
-      shaderType,
-      crc,
-      baseString,
-      shader.first,
-      shader.second
-    });
-  }
-#endif
+  // Translated on the shader workers, the renderer gets it once it's done
+  if (!shaderCache.Request(shaderType, crc, data))
+    LOG_DEBUG(Xenos, "[CP::IM_LOAD] Translating {}", ShaderCache::BaseName(shaderType, crc));
 
   switch (shaderType) {
   case eShaderType::Pixel:{
@@ -809,30 +855,10 @@ bool CommandProcessor::ExecutePacketType3_IM_LOAD_IMMEDIATE(RingBuffer *ringBuff
     value = byteswap_be(value);
   }
 
-  fs::path shaderPath{ Base::FS::GetUserPath(Base::FS::PathType::ShaderDir) / "cache" };
-  std::string typeString = shaderType == Xe::eShaderType::Pixel ? "pixel" : "vertex";
   u32 crc = CRC32::CRC32::calc(reinterpret_cast<const u8 *>(data.data()), data.size() * 4);
-  std::string baseString = fmt::format("{}_shader_{:X}", typeString, crc);
-  {
-    std::ofstream f{ shaderPath / (baseString + ".bin"), std::ios::out | std::ios::binary };
-    f.write(reinterpret_cast<char *>(data.data()), data.size() * 4);
-    f.close();
-  }
-  
-  std::pair<Microcode::AST::Shader*, std::vector<u32>> shader = LoadShader(shaderType, data, baseString);
-
-#ifndef NO_GFX
-  {
-    std::lock_guard<std::mutex> lock(render->shaderQueueMutex);
-    render->shaderLoadQueue.push({
-      shaderType,
-      crc,
-      baseString,
-      shader.first,
-      shader.second
-    });
-  }
-#endif
+  // Translated on the shader workers, the renderer gets it once it's done
+  if (!shaderCache.Request(shaderType, crc, data))
+    LOG_DEBUG(Xenos, "[CP::IM_LOAD_IMMEDIATE] Translating {}", ShaderCache::BaseName(shaderType, crc));
 
   switch (shaderType) {
   case eShaderType::Pixel:{
@@ -952,6 +978,7 @@ bool CommandProcessor::ExecutePacketType3_EVENT_WRITE_SHD(RingBuffer *ringBuffer
 
   u8 *addrPtr = ram->GetPointerToAddress(address);
   memcpy(addrPtr, &writeValue, sizeof(writeValue));
+  ram->NotifyHostWrite(addrPtr, sizeof(writeValue));
 
   return true;
 }
@@ -1003,7 +1030,11 @@ bool CommandProcessor::ExecutePacketType3_WAIT_REG_MEM(RingBuffer *ringBuffer, u
     }
 
     if (!matched) {
-      if (wait >= 0x100) {
+      if (schedulerId) {
+        // Whoever we're waiting on can only run once we give the turn away
+        if (!XeMain::GetScheduler()->Yield(schedulerId))
+          return false;
+      } else if (wait >= 0x100) {
         // Wait
         std::this_thread::sleep_for(std::chrono::milliseconds(wait / 0x100));
       } else {
@@ -1101,10 +1132,14 @@ bool CommandProcessor::ExecutePacketType3_DRAW(RingBuffer *ringBuffer, u32 packe
 
     // The base address must already be word-aligned according to the R6xx documentation.
     indexBufferInfo.guestBase = state->vgtDMABase & ~(indexSizeInBytes - 1);
-    indexBufferInfo.elements = ram->GetPointerToAddress(indexBufferInfo.guestBase);
     indexBufferInfo.endianness = state->vgtDMASize.swapMode;
     indexBufferInfo.indexFormat = state->vgtDrawInitiator.indexSize;
     indexBufferInfo.length = state->vgtDMASize.numWords * indexSizeInBytes;
+    indexBufferInfo.elements = ram->GetPointerToRange(indexBufferInfo.guestBase, indexBufferInfo.length);
+    if (!indexBufferInfo.elements) {
+      LOG_ERROR(Xenos, "[CP, PT3]: DRAW failed, index buffer 0x{:X} is outside of RAM.", indexBufferInfo.guestBase);
+      return false; // Failed
+    }
     indexBufferInfo.count = state->vgtDrawInitiator.numIndices;
   } break;
   case eSourceSelect::xeImmediate: {
@@ -1160,15 +1195,9 @@ bool CommandProcessor::ExecutePacketType3_DRAW(RingBuffer *ringBuffer, u32 packe
       params.state = state;
       params.indexBufferInfo = indexBufferInfo;
       params.vgtDrawInitiator = state->vgtDrawInitiator;
-#ifndef NO_GFX
-      if (render->linkedShaderPrograms.find(combinedShaderHash) == render->linkedShaderPrograms.end()) {
-        LOG_ERROR(Xenos, "Shader hash 0x{:X} (VS:0x{:X}, PS:0x{:X}) not found in linkedShaderPrograms!", combinedShaderHash, render->currentVertexShader.load(), render->currentPixelShader.load());
-      }
-      params.shader = render->linkedShaderPrograms[combinedShaderHash];
-#endif
       if (state->vertexData.address > 0) {
-        params.vertexBufferPtr = ram->GetPointerToAddress(state->vertexData.address);
-        params.vertexBufferSize = state->vertexData.size;
+        params.vertexBufferPtr = ram->GetPointerToRange(state->vertexData.address, state->vertexData.size);
+        params.vertexBufferSize = params.vertexBufferPtr ? state->vertexData.size : 0;
       }
       params.maxVertexIndex = state->maxVertexIndex;
       params.minVertexIndex = state->minVertexIndex;
@@ -1182,7 +1211,7 @@ bool CommandProcessor::ExecutePacketType3_DRAW(RingBuffer *ringBuffer, u32 packe
       drawJob.shaderPS = render->currentPixelShader.load();
       drawJob.shaderVS = render->currentVertexShader.load();
       drawJob.shaderHash = combinedShaderHash;
-      // Queue off to the Renderer
+      // Queue off to the Renderer, it links the program (or skips the draw) once the shaders are translated
       render->drawQueue.push(drawJob);
 #endif
     }
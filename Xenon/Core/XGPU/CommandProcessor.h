@@ -16,10 +16,12 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <thread>
 #include <memory>
 #include <unordered_map>
 
+#include "Base/DeviceWorker.h"
 #include "Base/Logging/Log.h"
 #include "Base/Types.h"
 
@@ -28,6 +30,7 @@
 #include "Core/XGPU/Microcode/ASTBlock.h"
 #include "Core/XGPU/PM4Opcodes.h"
 #include "Core/XGPU/RingBuffer.h"
+#include "Core/XGPU/ShaderCache.h"
 #include "Core/XGPU/XenosRegisters.h"
 #include "Core/XGPU/Xenos.h"
 #include "Core/XGPU/XenosState.h"
@@ -99,6 +102,9 @@ public:
   // CP RB Write Ptr offset (from base in words)
   void CPUpdateRBWritePointer(u32 offset);
 
+  // Saves or restores the microcode and ring buffer state, waits for pending packets first
+  void DoState(StateStream &stream);
+
 private:
   // PCI Bridge pointer. Used for interrupts
   PCIBridge *parentBus{};
@@ -109,6 +115,12 @@ private:
   // Render handle
   Render::Renderer *render;
 
+  // Translated shaders, by type and microcode CRC
+  ShaderCache shaderCache;
+
+  // Called from the shader workers, hands a new shader to the renderer
+  void OnShaderTranslated(const TranslatedShader &shader);
+
   // Xenos State, contains register data
   XenosState *state{};
 
@@ -118,6 +130,12 @@ private:
   // Worker thread running
   volatile bool cpWorkerThreadRunning = true;
 
+  // Parks the worker thread until the write pointer moves
+  Base::DeviceWorker cpWorker;
+
+  // Turn id in the deterministic scheduler, 0 when running free
+  u32 schedulerId = 0;
+
   // Command Processor Worker Thread Loop
   // Whenever there's valid commands in the read/write Ptrs, this will process 
   // all commands and perform tasks associated with them
@@ -151,14 +169,19 @@ private:
 
   // CP RingBuffer Base Address in memory.
   std::atomic<u8*> cpRingBufferBasePtr = nullptr;
+  // Guest address of the above, for save states.
+  u32 cpRingBufferBaseAddress = 0;
   
   // RingBuffer Size.
   std::atomic<size_t> cpRingBufferSize = 0;
 
   // Read/Write indexes.
-  u32 cpReadPtrIndex = 0;
+  std::atomic<u32> cpReadPtrIndex = 0;
   std::atomic<u32> cpWritePtrIndex = 0;
 
+  // Waits until the CP caught up with the write pointer. Returns false on timeout.
+  bool WaitForIdle(std::chrono::milliseconds timeout);
+
   // Execute primary buffer from CP_RB_BASE.
   u32 cpExecutePrimaryBuffer(u32 readIndex, u32 writeIndex);
 
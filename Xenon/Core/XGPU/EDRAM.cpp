@@ -123,3 +123,21 @@ u32 Xe::XGPU::EDRAM::ReadCRC_AZ1_BC() {
   if (edramState.get()->az1BCRegIndex >= 6) { edramState.get()->az1BCRegIndex = 0; }
   return byteswap_be<u32>(data);
 }
+
+void Xe::XGPU::EDRAM::DoState(StateStream &stream) {
+  EDRAMState *state = edramState.get();
+  stream.DoMarker("EDRAM");
+  stream.Do(state->edramBusy);
+  stream.Do(state->readRegisterIndex);
+  stream.Do(state->writeRegisterIndex);
+  stream.Do(state->readData);
+  stream.DoVector(state->edramRegs);
+  stream.Do(state->az0BCRegIndex);
+  stream.Do(state->az1BCRegIndex);
+  stream.Do(state->reg41Index);
+  stream.Do(state->reg1041Index);
+  stream.DoVector(state->az0Data);
+  stream.DoVector(state->az1Data);
+  stream.DoVector(state->reg41Data);
+  stream.DoVector(state->reg1041Data);
+}
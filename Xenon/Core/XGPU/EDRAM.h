@@ -7,6 +7,8 @@
 #include "Base/Types.h"
 #include "Base/Logging/Log.h"
 
+#include "Core/SaveState.h"
+
 namespace Xe::XGPU {
 
 // In reality the higher register i've seen in use is 0x1403, but just for safety i'll set this to a higher value.
@@ -81,6 +83,8 @@ public:
 
   // Returns true if the edram is currently busy with work.
   bool isEdramBusy() { return edramState.get()->edramBusy; };
+  // Saves or restores the register set and CRC state.
+  void DoState(StateStream &stream);
 private:
   std::unique_ptr<EDRAMState> edramState = {};
 };
@@ -0,0 +1,265 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "Base/Config.h"
+#include "Base/Hash.h"
+#include "Base/Logging/Log.h"
+#include "Base/PathUtil.h"
+#include "Base/Thread.h"
+#include "Base/Version.h"
+
+#include "ShaderCache.h"
+
+// File magic, 'XSHC'
+#define XE_SHADER_CACHE_MAGIC 0x43485358
+// Version of the file layout
+#define XE_SHADER_CACHE_FORMAT 1
+// Bump whenever the decompiler or the SPIR-V emitter change their output
+#define XE_SHADER_TRANSLATOR_VERSION 1
+// Extension of the cache files
+#define XE_SHADER_CACHE_EXT ".xsc"
+// Upper bound for either section of a file, anything bigger is a corrupt file
+#define XE_SHADER_CACHE_MAX_WORDS 0x100000
+// Translation workers, the PPUs, CP and render thread need the rest of the host
+#define XE_SHADER_MAX_WORKERS 4
+
+namespace Xe::XGPU {
+
+// Header of a cache file, followed by the microcode and the SPIR-V
+struct ShaderCacheHeader {
+  u32 magic = XE_SHADER_CACHE_MAGIC;
+  u32 format = XE_SHADER_CACHE_FORMAT;
+  u64 key = 0;
+  u32 type = 0;
+  u32 crc = 0;
+  u32 microcodeWords = 0;
+  u32 spirvWords = 0;
+};
+
+ShaderCache::ShaderCache(ReadyCallback onReady) :
+  onReady(std::move(onReady)) {
+  const fs::path shaderDir = Base::FS::GetUserPath(Base::FS::PathType::ShaderDir);
+  cachePath = shaderDir / "cache";
+  dumpPath = shaderDir / "spirv";
+  diskCacheKey = (static_cast<u64>(XE_SHADER_TRANSLATOR_VERSION) << 32) | Base::JoaatStringHash(Base::Version, false);
+  if (Config::xgpu.shaderCache)
+    LoadDiskCache();
+  writerThread = std::thread(&ShaderCache::WriterThreadLoop, this);
+  const u32 workerCount = std::clamp<u32>(std::thread::hardware_concurrency() / 4, 1, XE_SHADER_MAX_WORKERS);
+  for (u32 i = 0; i != workerCount; i++)
+    workerThreads.emplace_back(&ShaderCache::WorkerThreadLoop, this);
+}
+
+ShaderCache::~ShaderCache() {
+  // Queued translations are dropped, nobody is left to draw them
+  {
+    std::lock_guard lock(entryMutex);
+    workersRunning = false;
+  }
+  translateCondition.notify_all();
+  for (std::thread &worker : workerThreads) {
+    if (worker.joinable())
+      worker.join();
+  }
+  {
+    std::lock_guard lock(writeMutex);
+    writerRunning = false;
+  }
+  writeCondition.notify_all();
+  if (writerThread.joinable())
+    writerThread.join();
+}
+
+bool ShaderCache::Request(eShaderType type, u32 crc, const std::vector<u32> &microcode) {
+  std::lock_guard lock(entryMutex);
+  auto it = entries.find(Key(type, crc));
+  if (it != entries.end() && it->second->microcode != microcode) {
+    LOG_WARNING(Xenos, "ShaderCache: CRC collision on {}, retranslating", BaseName(type, crc));
+    retired.push_back(std::move(it->second));
+    entries.erase(it);
+    it = entries.end();
+  }
+
+  if (it != entries.end()) {
+    TranslatedShader *entry = it->second.get();
+    if (entry->ready)
+      return true;
+    // Loaded from disk, the SPIR-V is there but the renderer needs the AST too
+    if (!entry->queued) {
+      entry->queued = true;
+      translateQueue.push_back(entry);
+      translateCondition.notify_one();
+    }
+    return false;
+  }
+
+  std::unique_ptr<TranslatedShader> entry = std::make_unique<TranslatedShader>();
+  entry->type = type;
+  entry->crc = crc;
+  entry->microcode = microcode;
+  entry->queued = true;
+  translateQueue.push_back(entry.get());
+  entries.insert({ Key(type, crc), std::move(entry) });
+  translateCondition.notify_one();
+  return false;
+}
+
+std::string ShaderCache::BaseName(eShaderType type, u32 crc) {
+  return fmt::format("{}_shader_{:X}", type == eShaderType::Pixel ? "pixel" : "vertex", crc);
+}
+
+void ShaderCache::LoadDiskCache() {
+  std::error_code error;
+  if (!fs::is_directory(cachePath, error))
+    return;
+
+  u32 loaded = 0, stale = 0;
+  for (const fs::directory_entry &file : fs::directory_iterator{ cachePath, error }) {
+    if (!file.is_regular_file(error) || file.path().extension() != XE_SHADER_CACHE_EXT)
+      continue;
+    std::ifstream stream{ file.path(), std::ios::in | std::ios::binary };
+    ShaderCacheHeader header{};
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    const eShaderType type = static_cast<eShaderType>(header.type);
+    const bool valid = stream.good() && header.magic == XE_SHADER_CACHE_MAGIC &&
+      (type == eShaderType::Vertex || type == eShaderType::Pixel) &&
+      header.microcodeWords <= XE_SHADER_CACHE_MAX_WORDS && header.spirvWords <= XE_SHADER_CACHE_MAX_WORDS;
+    if (!valid || header.format != XE_SHADER_CACHE_FORMAT || header.key != diskCacheKey) {
+      stream.close();
+      fs::remove(file.path(), error);
+      stale++;
+      continue;
+    }
+    std::unique_ptr<TranslatedShader> entry = std::make_unique<TranslatedShader>();
+    entry->type = type;
+    entry->crc = header.crc;
+    entry->microcode.resize(header.microcodeWords);
+    entry->spirv.resize(header.spirvWords);
+    stream.read(reinterpret_cast<char*>(entry->microcode.data()), entry->microcode.size() * 4);
+    stream.read(reinterpret_cast<char*>(entry->spirv.data()), entry->spirv.size() * 4);
+    if (!stream.good()) {
+      LOG_WARNING(Xenos, "ShaderCache: '{}' is corrupt, deleting it", file.path().filename().string());
+      stream.close();
+      fs::remove(file.path(), error);
+      stale++;
+      continue;
+    }
+    entries.insert_or_assign(Key(entry->type, entry->crc), std::move(entry));
+    loaded++;
+  }
+  if (stale)
+    LOG_INFO(Xenos, "ShaderCache: Deleted {} outdated or corrupt shaders", stale);
+  if (loaded)
+    LOG_INFO(Xenos, "ShaderCache: Loaded {} shaders from disk", loaded);
+}
+
+void ShaderCache::Translate(TranslatedShader &entry) {
+  entry.shader.reset(Microcode::AST::Shader::DecompileMicroCode(entry.microcode.data(), static_cast<u32>(entry.microcode.size() * 4), entry.type));
+#ifndef NO_GFX
+  if (entry.spirv.empty()) {
+    Microcode::AST::ShaderCodeWriterSirit writer{ entry.type, entry.shader.get() };
+    if (entry.shader) {
+      entry.shader->EmitShaderCode(writer);
+    }
+    entry.spirv = writer.module.Assemble();
+    QueueWrite(entry);
+  }
+#else
+  QueueWrite(entry);
+#endif
+}
+
+void ShaderCache::WorkerThreadLoop() {
+  Base::SetCurrentThreadName("[Xe] ShaderWorker");
+  std::unique_lock lock(entryMutex);
+  while (true) {
+    translateCondition.wait(lock, [this] { return !workersRunning || !translateQueue.empty(); });
+    if (!workersRunning)
+      break;
+    TranslatedShader *entry = translateQueue.front();
+    translateQueue.pop_front();
+    // Only the worker that took it off the queue touches the entry until it's ready
+    lock.unlock();
+    Translate(*entry);
+    lock.lock();
+    entry->ready = true;
+    // Replaced after a collision while we were on it, the new entry reports for that CRC
+    auto it = entries.find(Key(entry->type, entry->crc));
+    if (it == entries.end() || it->second.get() != entry)
+      continue;
+    lock.unlock();
+    if (onReady)
+      onReady(*entry);
+    lock.lock();
+  }
+}
+
+void ShaderCache::QueueWrite(const TranslatedShader &entry) {
+  const std::string baseName = BaseName(entry.type, entry.crc);
+  const u64 microcodeSize = entry.microcode.size() * 4;
+  const u64 spirvSize = entry.spirv.size() * 4;
+  if (Config::xgpu.shaderCache && !entry.spirv.empty()) {
+    ShaderCacheHeader header{};
+    header.key = diskCacheKey;
+    header.type = static_cast<u32>(entry.type);
+    header.crc = entry.crc;
+    header.microcodeWords = static_cast<u32>(entry.microcode.size());
+    header.spirvWords = static_cast<u32>(entry.spirv.size());
+    std::vector<u8> data(sizeof(header) + microcodeSize + spirvSize);
+    memcpy(data.data(), &header, sizeof(header));
+    memcpy(data.data() + sizeof(header), entry.microcode.data(), microcodeSize);
+    memcpy(data.data() + sizeof(header) + microcodeSize, entry.spirv.data(), spirvSize);
+    QueueFile(cachePath / (baseName + XE_SHADER_CACHE_EXT), std::move(data));
+  }
+  if (Config::xgpu.dumpShaders) {
+    const u8 *microcode = reinterpret_cast<const u8*>(entry.microcode.data());
+    const u8 *spirv = reinterpret_cast<const u8*>(entry.spirv.data());
+    QueueFile(dumpPath / (baseName + ".bin"), { microcode, microcode + microcodeSize });
+    if (!entry.spirv.empty())
+      QueueFile(dumpPath / (baseName + ".spv"), { spirv, spirv + spirvSize });
+  }
+}
+
+void ShaderCache::QueueFile(std::filesystem::path path, std::vector<u8> &&data) {
+  {
+    std::lock_guard lock(writeMutex);
+    writeQueue.push({ std::move(path), std::move(data) });
+  }
+  writeCondition.notify_one();
+}
+
+void ShaderCache::WriterThreadLoop() {
+  Base::SetCurrentThreadName("[Xe] ShaderCache");
+  std::unique_lock lock(writeMutex);
+  // Drains the queue before exiting, so nothing translated is lost on shutdown
+  while (writerRunning || !writeQueue.empty()) {
+    writeCondition.wait(lock, [this] { return !writerRunning || !writeQueue.empty(); });
+    while (!writeQueue.empty()) {
+      WriteJob job = std::move(writeQueue.front());
+      writeQueue.pop();
+      lock.unlock();
+      // Written to a temporary file first, so an interrupted write can't leave a truncated shader
+      fs::path tempPath = job.path;
+      tempPath += ".tmp";
+      std::error_code error;
+      {
+        std::ofstream file{ tempPath, std::ios::out | std::ios::binary | std::ios::trunc };
+        file.write(reinterpret_cast<const char*>(job.data.data()), job.data.size());
+        if (!file.good())
+          error = std::make_error_code(std::errc::io_error);
+      }
+      if (!error)
+        fs::rename(tempPath, job.path, error);
+      if (error) {
+        LOG_ERROR(Xenos, "ShaderCache: Unable to write '{}': {}", job.path.string(), error.message());
+        fs::remove(tempPath, error);
+      }
+      lock.lock();
+    }
+  }
+}
+
+} // namespace Xe::XGPU
@@ -0,0 +1,113 @@
+// Copyright 2025 Xenon Emulator Project. All rights reserved.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Base/Types.h"
+
+#include "Core/XGPU/Microcode/ASTBlock.h"
+#include "Core/XGPU/ShaderConstants.h"
+
+//
+// Shader translation cache.
+//
+// Guests reload the same microcode all the time (IM_LOAD on every shader switch), so translated
+// shaders are kept in memory, keyed by shader type and microcode CRC, and a repeated load is a
+// lookup. The SPIR-V is also stored on disk, one file per shader, and every file is read back on
+// startup: a shader seen in an earlier run still gets its AST rebuilt (the renderer needs the
+// fetches and textures from it) but skips code emission. Files go through a writer thread, so the
+// command processor never waits on the disk, and files from another translator version are deleted.
+//
+// Translation itself runs on a pool of workers. Request only queues new microcode and returns, the
+// ready callback is then called once per shader from the worker that translated it.
+//
+
+namespace Xe::XGPU {
+
+// A shader translated from Xenos microcode.
+struct TranslatedShader {
+  eShaderType type = eShaderType::Unknown;
+  // CRC32 of the microcode
+  u32 crc = 0;
+  // Microcode, kept to tell apart shaders with the same CRC
+  std::vector<u32> microcode{};
+  // Decompiled shader, entries loaded from disk only get it once requested
+  std::unique_ptr<Microcode::AST::Shader> shader{};
+  // SPIR-V module, empty without a renderer
+  std::vector<u32> spirv{};
+  // Handed to the translation workers
+  bool queued = false;
+  // Set once a worker is done with it, the entry doesn't change afterwards
+  bool ready = false;
+};
+
+class ShaderCache {
+public:
+  using ReadyCallback = std::function<void(const TranslatedShader &shader)>;
+
+  explicit ShaderCache(ReadyCallback onReady);
+  ~ShaderCache();
+
+  // Queues the microcode for translation unless it's known already. Returns true if the shader is
+  // translated, false while a worker is still on it.
+  bool Request(eShaderType type, u32 crc, const std::vector<u32> &microcode);
+
+  // Name used for the files of a shader, e.g. 'pixel_shader_1234ABCD'.
+  static std::string BaseName(eShaderType type, u32 crc);
+
+private:
+  // A file for the writer thread
+  struct WriteJob {
+    std::filesystem::path path{};
+    std::vector<u8> data{};
+  };
+
+  // Reads every shader file from the cache directory, deleting stale ones
+  void LoadDiskCache();
+  // Decompiles an entry, and emits its SPIR-V unless it came from disk
+  void Translate(TranslatedShader &entry);
+  void WorkerThreadLoop();
+  // Queues the cache file of an entry, and the debug dumps if enabled
+  void QueueWrite(const TranslatedShader &entry);
+  void QueueFile(std::filesystem::path path, std::vector<u8> &&data);
+  void WriterThreadLoop();
+
+  static u64 Key(eShaderType type, u32 crc) { return (static_cast<u64>(type) << 32) | crc; }
+
+  std::filesystem::path cachePath{};
+  std::filesystem::path dumpPath{};
+  // Translator version and emulator build, see ShaderCache.cpp
+  u64 diskCacheKey = 0;
+
+  ReadyCallback onReady{};
+
+  // Guards entries, retired and the translation queue
+  std::mutex entryMutex{};
+  std::unordered_map<u64, std::unique_ptr<TranslatedShader>> entries{};
+  // Entries replaced after a CRC collision, the renderer may still point into them
+  std::vector<std::unique_ptr<TranslatedShader>> retired{};
+
+  std::condition_variable translateCondition{};
+  std::deque<TranslatedShader*> translateQueue{};
+  bool workersRunning = true;
+  std::vector<std::thread> workerThreads{};
+
+  std::mutex writeMutex{};
+  std::condition_variable writeCondition{};
+  std::queue<WriteJob> writeQueue{};
+  bool writerRunning = true;
+  std::thread writerThread{};
+};
+
+} // namespace Xe::XGPU
@@ -197,6 +197,16 @@ void Xe::Xenos::XGPU::ConfigWrite(u64 writeAddress, const u8 *data, u64 size) {
   memcpy(&xgpuConfigSpace.data[writeAddress & 0xFF], &tmp, size);
 }
 
+void Xe::Xenos::XGPU::DoState(StateStream &stream) {
+  std::lock_guard lck(mutex);
+  stream.DoMarker("XGPU");
+  stream.Do(xgpuConfigSpace);
+  stream.Do(pciDevSizes);
+  xenosState->DoState(stream);
+  edram->DoState(stream);
+  commandProcessor->DoState(stream);
+}
+
 bool Xe::Xenos::XGPU::IsAddressMappedInBAR(u32 address) {
   #define ADDRESS_BOUNDS_CHECK(a, b) (address >= a && address <= (a + b))
   if (ADDRESS_BOUNDS_CHECK(xgpuConfigSpace.configSpaceHeader.BAR0, XGPU_DEVICE_SIZE) ||
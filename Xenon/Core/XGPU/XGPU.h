@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <array>
 #include <fstream>
 #include <filesystem>
 #include <memory>
@@ -40,8 +41,18 @@ public:
   void ConfigRead(u64 readAddress, u8 *data, u64 size);
   void ConfigWrite(u64 writeAddress, const u8 *data, u64 size);
 
+  // Saves or restores the config space, registers, EDRAM and CP state
+  void DoState(StateStream &stream);
+
   bool IsAddressMappedInBAR(u32 address);
 
+  // Returns the BAR's currently programmed in config space
+  std::array<u32, 6> GetBARs() {
+    return { xgpuConfigSpace.configSpaceHeader.BAR0, xgpuConfigSpace.configSpaceHeader.BAR1,
+             xgpuConfigSpace.configSpaceHeader.BAR2, xgpuConfigSpace.configSpaceHeader.BAR3,
+             xgpuConfigSpace.configSpaceHeader.BAR4, xgpuConfigSpace.configSpaceHeader.BAR5 };
+  }
+
   // Dump framebuffer from RAM
   void DumpFB(const std::filesystem::path &path, int pitch);
 
@@ -455,6 +455,7 @@ void Xe::XGPU::XenosState::WriteRawRegister(u32 addr, u32 value) {
       LOG_DEBUG(Xenos, "[CP] Scratch {} was accessed, writing back to 0x{:X} with 0x{:X}", scratchRegIndex, memAddr, tmp);
       u8 *memPtr = ramPtr->GetPointerToAddress(memAddr);
       memcpy(memPtr, &scratch[scratchRegIndex], sizeof(scratch[scratchRegIndex]));
+      ramPtr->NotifyHostWrite(memPtr, sizeof(scratch[scratchRegIndex]));
     }
   } break;
   case XeRegister::MH_STATUS:
@@ -725,3 +726,111 @@ void Xe::XGPU::XenosState::WriteRawRegister(u32 addr, u32 value) {
   const u64 mask = 1ull << (addr % BitCount);
   RegMask[(addr / 4) / BitCount] |= mask;
 }
+
+void Xe::XGPU::XenosState::DoState(StateStream &stream) {
+  std::lock_guard lck(mutex);
+  stream.DoMarker("XenosState");
+  stream.Do(fbSurfaceAddress);
+  stream.Do(framebufferDisable);
+  stream.Do(configControl);
+  // Scratch
+  stream.Do(scratchMask);
+  stream.Do(scratchAddr);
+  stream.Do(scratch);
+  stream.Do(waitUntil);
+  // RBBM
+  stream.Do(rbbmControl);
+  stream.Do(rbbmDebug);
+  stream.Do(rbbmStatus);
+  stream.Do(rbbmSoftReset);
+  // RB
+  stream.Do(surfaceInfo);
+  stream.Do(colorInfo);
+  stream.Do(depthInfo);
+  stream.Do(color1Info);
+  stream.Do(color2Info);
+  stream.Do(color3Info);
+  stream.Do(blendRed);
+  stream.Do(blendGreen);
+  stream.Do(blendBlue);
+  stream.Do(blendAlpha);
+  stream.Do(stencilReferenceMask);
+  stream.Do(depthControl);
+  stream.Do(blendControl0);
+  stream.Do(tileControl);
+  stream.Do(modeControl);
+  stream.Do(blendControl1);
+  stream.Do(blendControl2);
+  stream.Do(blendControl3);
+  stream.Do(copyControl);
+  stream.Do(copyDestBase);
+  stream.Do(copyDestPitch);
+  stream.Do(copyDestInfo);
+  stream.Do(depthClear);
+  stream.Do(clearColor);
+  stream.Do(clearColorLo);
+  stream.Do(copyFunction);
+  stream.Do(copyReference);
+  stream.Do(copyMask);
+  // VGT
+  stream.Do(maxVertexIndex);
+  stream.Do(minVertexIndex);
+  stream.Do(indexOffset);
+  stream.Do(multiPrimitiveIndexBufferResetIndex);
+  stream.Do(currentBinIdMin);
+  stream.Do(vertexData);
+  stream.Do(vgtDrawInitiator);
+  stream.Do(vgtDMABase);
+  stream.Do(vgtDMASize);
+  // PA
+  stream.Do(viewportControl);
+  stream.Do(windowOffset);
+  stream.Do(windowScissorTl);
+  stream.Do(windowScissorBr);
+  stream.Do(viewportXOffset);
+  stream.Do(viewportYOffset);
+  stream.Do(viewportZOffset);
+  stream.Do(viewportXScale);
+  stream.Do(viewportYScale);
+  stream.Do(viewportZScale);
+  // D1CRTC/D1MODE
+  stream.Do(crtcControl);
+  stream.Do(modeViewportSize);
+  stream.Do(vCounter);
+  stream.Do(vblankStatus);
+  stream.Do(vblankVlineStatus);
+  // MH/Coherency
+  stream.Do(mhStatus);
+  stream.Do(coherencySizeHost);
+  stream.Do(coherencyBaseHost);
+  stream.Do(coherencyStatusHost);
+  // EDRAM
+  stream.Do(edramTiming);
+  stream.Do(edramInfo);
+  // DC
+  stream.Do(dcLutAutofill);
+  // XDVO
+  stream.Do(xdvoEnable);
+  stream.Do(xdvoBitDepthControl);
+  stream.Do(xdvoClockInv);
+  stream.Do(xdvoControl);
+  stream.Do(xdvoCrcEnable);
+  stream.Do(xdvoCrcControl);
+  stream.Do(xdvoCrcMaskSignalRGB);
+  stream.Do(xdvoCrcMaskSignalControl);
+  stream.Do(xdvoCrcSignalRGB);
+  stream.Do(xdvoCrcSignalControl);
+  stream.Do(xdvoStrengthControl);
+  stream.Do(xdvoDataStrengthControl);
+  stream.Do(xdvoForceOutputControl);
+  stream.Do(xdvoRegisterIndex);
+  stream.Do(xdvoRegisterData);
+  // Internal width/height come from the config, they're kept
+  stream.Do(vsConsts);
+  stream.Do(psConsts);
+  stream.Do(boolConsts);
+  stream.DoArray(Regs.get(), 0xFFFFF);
+  // Everything changed as far as the renderer knows
+  if (stream.IsLoading())
+    memset(RegMask, 0xFF, sizeof(RegMask));
+}
@@ -7,6 +7,7 @@
 #include <string>
 
 #include "Core/RAM/RAM.h"
+#include "Core/SaveState.h"
 
 #include "EDRAM.h"
 #include "ShaderConstants.h"
@@ -78,6 +79,9 @@ public:
     return RegMask[firstIndex / BitCount];
   }
 
+  // Saves or restores every register, loading marks them all dirty
+  void DoState(StateStream &stream);
+
   // Mutex
   std::recursive_mutex mutex{};
 
@@ -2,6 +2,8 @@
 
 #include "XeMain.h"
 
+#include "Core/XCPU/Interpreter/PPCInterpreter.h"
+
 void XeMain::Create() {
   MICROPROFILE_SCOPEI("[Xe::Main]", "Create", MP_AUTO);
   Base::Log::Initialize();
@@ -11,6 +13,21 @@ void XeMain::Create() {
   LoadConfig();
   Base::Log::Filter logFilter{ Config::log.currentLevel };
   Base::Log::SetGlobalFilter(logFilter);
+  // Guest hooks, must be there before any PPU runs
+  PPCInterpreter::ppcHooks.Load(Config::filepaths.hooks);
+  // Must be set before anything that registers with it is created
+  switch (Base::JoaatStringHash(Config::highlyExperimental.scheduler)) {
+  case "Relaxed"_jLower:
+    scheduler.Configure(Xe::eSchedulerMode::Relaxed, Config::highlyExperimental.schedulerQuantum);
+    break;
+  case "Deterministic"_jLower:
+    scheduler.Configure(Xe::eSchedulerMode::Deterministic, Config::highlyExperimental.schedulerQuantum);
+    break;
+  default:
+    LOG_WARNING(System, "Invalid scheduler mode '{}'! Defaulting to Relaxed", Config::highlyExperimental.scheduler);
+    scheduler.Configure(Xe::eSchedulerMode::Relaxed, Config::highlyExperimental.schedulerQuantum);
+    break;
+  }
   CreatePCIDevices();
 #ifndef NO_GFX
   switch (Base::JoaatStringHash(Config::rendering.backend, false)) {
@@ -258,4 +275,8 @@ void XeMain::CreatePCIDevices() {
 
 Xenon *XeMain::GetCPU() {
   return xenonCPU.get();
+}
+
+Xe::Scheduler *XeMain::GetScheduler() {
+  return &scheduler;
 }
\ No newline at end of file
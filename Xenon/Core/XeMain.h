@@ -23,6 +23,7 @@
 #include "Core/RootBus/HostBridge/PCIBridge/SMC/SMC.h"
 #include "Core/RootBus/HostBridge/PCIBridge/XMA/XMA.h"
 #include "Core/RootBus/RootBus.h"
+#include "Core/Scheduler.h"
 #include "Core/XCPU/Xenon.h"
 #include "Core/XGPU/XGPU.h"
 
@@ -52,6 +53,8 @@ extern void CreateRootBus();
 
 extern Xenon *GetCPU();
 
+extern Xe::Scheduler *GetScheduler();
+
 // Main objects
 //  Base path
 inline std::filesystem::path rootDirectory = {};
@@ -67,6 +70,8 @@ inline std::unique_ptr<Render::Renderer> renderer{};
 #endif
 // CPU started flag
 inline bool CPUStarted = false;
+// PPU and device scheduling
+inline Xe::Scheduler scheduler{};
 
 // PCI Devices
 //  SMC
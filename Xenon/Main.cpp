@@ -1,6 +1,7 @@
 // Copyright 2025 Xenon Emulator Project. All rights reserved.
 
 #include "Core/XeMain.h"
+#include "Core/SaveState.h"
 #include "Base/Param.h"
 #include "Base/Exit.h"
 #include "Base/Thread.h"
@@ -86,6 +87,7 @@ s32 removeHangup() {
 #endif
 
 PARAM(help, "Prints this message", false);
+PARAM(load_state, "Loads the given save state once the system started");
 
 #define AUTO_FLIP 1
 s32 main(s32 argc, char *argv[]) {
@@ -115,6 +117,9 @@ s32 main(s32 argc, char *argv[]) {
     }
     // Start execution of the emulator
     XeMain::StartCPU();
+    // Resume from a save state if asked
+    if (PARAM_load_state.Present())
+      Xe::LoadSystemState(PARAM_load_state.Get());
   }
   // Inf wait until told otherwise
   while (XeRunning) {
@@ -15,6 +15,10 @@
 #include "Render/GUI/GUI.h"
 #endif
 
+// Frames a draw may hold back the ones after it while its shaders translate, without async shaders.
+// Past that the shader is taken as never coming (bad microcode, never loaded) and the draw dropped.
+#define XE_RENDER_MAX_DRAW_WAIT 300
+
 namespace Render {
 
 Renderer::Renderer(RAM *ram) :
@@ -377,61 +381,24 @@ void Renderer::Thread() {
       break;
 
     {
-      std::lock_guard<std::mutex> lock(shaderQueueMutex);
-      while (threadRunning && !shaderLoadQueue.empty()) {
-        if (!threadRunning || !XeRunning)
-          break;
-        ShaderLoadJob job = shaderLoadQueue.front();
-        shaderLoadQueue.pop();
-
-        Render::eShaderType shaderType = job.shaderType == Xe::eShaderType::Pixel
-          ? Render::eShaderType::Fragment
-          : Render::eShaderType::Vertex;
-
-        if (shaderType == Render::eShaderType::Vertex) {
-          pendingVertexShaders[job.shaderCRC] = std::make_pair(job.shaderTree, job.binary);
-        } else {
-          pendingPixelShaders[job.shaderCRC] = std::make_pair(job.shaderTree, job.binary);
-        }
-
-        // See if we have both shaders now
-        if (currentVertexShader.load() != 0 && currentPixelShader.load() != 0) {
-          auto vsIt = pendingVertexShaders.find(currentVertexShader.load());
-          auto psIt = pendingPixelShaders.find(currentPixelShader.load());
-
-          if (vsIt != pendingVertexShaders.end() && psIt != pendingPixelShaders.end()) {
-            u64 combinedHash = (static_cast<u64>(currentVertexShader.load()) << 32) | currentPixelShader.load();
-            if (linkedShaderPrograms.find(combinedHash) == linkedShaderPrograms.end()) {
-              std::shared_ptr<Shader> shader = shaderFactory->LoadFromBinary(job.name, {
-                { Render::eShaderType::Vertex, vsIt->second.second },
-                { Render::eShaderType::Fragment, psIt->second.second }
-              });
-              if (shader) {
-                Xe::XGPU::XeShader xeShader{};
-                xeShader.program = std::move(shader);
-                xeShader.pixelShader = psIt->second.first;
-                xeShader.pixelShaderHash = psIt->first;
-                xeShader.vertexShaderHash = vsIt->first;
-                xeShader.vertexShader = vsIt->second.first;
-                if (xeShader.textures.empty()) {
-                  for (u64 i = 0; i != xeShader.pixelShader->usedTextures.size(); ++i) {
-                    xeShader.textures.push_back(resourceFactory->CreateTexture());
-                  }
-                  for (u64 i = 0; i != xeShader.vertexShader->usedTextures.size(); ++i) {
-                    xeShader.textures.push_back(resourceFactory->CreateTexture());
-                  }
-                  for (auto &texture : xeShader.textures) {
-                    texture->CreateTextureHandle(width, height, GetXenosFlags());
-                  }
-                }
-                linkedShaderPrograms.insert({ combinedHash, xeShader });
-                LOG_INFO(Xenos, "Linked shader program 0x{:X} (VS:0x{:X}, PS:0x{:X})", combinedHash, currentVertexShader.load(), currentPixelShader.load());
-              } else {
-                LOG_ERROR(Xenos, "Failed to link shader program '0x{:X}'! VS: 0x{:08X}, PS: 0x{:08X}", combinedHash, currentVertexShader.load(), currentPixelShader.load());
-              }
-            }
-          }
+      // Only swap the queue under the lock, the shader workers never wait on us
+      std::queue<ShaderLoadJob> shaderJobs{};
+      {
+        std::lock_guard<std::mutex> lock(shaderQueueMutex);
+        shaderJobs.swap(shaderLoadQueue);
+      }
+      while (!shaderJobs.empty()) {
+        ShaderLoadJob &job = shaderJobs.front();
+        const bool pixel = job.shaderType == Xe::eShaderType::Pixel;
+        auto &shaders = pixel ? pendingPixelShaders : pendingVertexShaders;
+        // Replaced after a CRC collision, programs linked with the old one are stale
+        if (shaders.contains(job.shaderCRC)) {
+          std::erase_if(linkedShaderPrograms, [&](const auto &entry) {
+            return (pixel ? entry.second.pixelShaderHash : entry.second.vertexShaderHash) == job.shaderCRC;
+          });
         }
+        shaders[job.shaderCRC] = std::make_pair(job.shaderTree, std::move(job.binary));
+        shaderJobs.pop();
       }
     }
 
@@ -494,27 +461,38 @@ void Renderer::Thread() {
       renderShaderPrograms->Unbind();
     }
 
-    while (threadRunning && !drawQueue.empty()) {
-      if (!threadRunning || !XeRunning)
-        break;
-      DrawJob drawJob = drawQueue.front();
-      u64 combinedHash = (static_cast<u64>(currentVertexShader.load()) << 32) | currentPixelShader.load();
-      if (!linkedShaderPrograms.contains(combinedHash)) {
-        // Optionally log or delay the job
-        LOG_WARNING(Xenos, "Draw deferred: shader program 0x{:X} not linked yet", combinedHash);
-        continue;
+    {
+      std::lock_guard<std::mutex> lock(drawQueueMutex);
+      while (!drawQueue.empty()) {
+        pendingDraws.push_back(std::move(drawQueue.front()));
+        drawQueue.pop();
       }
-      // Update shader after it's loaded
-      if (auto it = linkedShaderPrograms.find(combinedHash); it != linkedShaderPrograms.end()) {
-        drawJob.params.shader = it->second;
-        if (drawJob.params.shader.program) {
-          drawJob.params.shader.program->Bind();
+    }
+
+    while (threadRunning && XeRunning && !pendingDraws.empty()) {
+      DrawJob &drawJob = pendingDraws.front();
+      const Xe::XGPU::XeShader *program = GetShaderProgram(drawJob.shaderVS, drawJob.shaderPS);
+      if (!program) {
+        // Shaders still being translated. No shader loaded at all won't ever get one.
+        const bool loaded = drawJob.shaderVS && drawJob.shaderPS;
+        if (!Config::xgpu.asyncShaders && loaded && drawJob.waitedFrames++ < XE_RENDER_MAX_DRAW_WAIT) {
+          // Keep the draw order, try again next frame
+          break;
         }
-      } else {
-        LOG_WARNING(Xenos, "Draw deferred: shader program 0x{:X} not linked yet", combinedHash);
+        if (Config::xgpu.asyncShaders)
+          LOG_DEBUG(Xenos, "Draw skipped: shader program 0x{:X} isn't ready", drawJob.shaderHash);
+        else
+          LOG_WARNING(Xenos, "Draw dropped: shader program 0x{:X} never got ready", drawJob.shaderHash);
+        pendingDraws.pop_front();
+        continue;
+      }
+      // Failed to link, nothing to draw with
+      if (!program->program) {
+        pendingDraws.pop_front();
         continue;
       }
-      drawQueue.pop();
+      drawJob.params.shader = *program;
+      drawJob.params.shader.program->Bind();
 
       // Draw
       if (drawJob.indexed) {
@@ -522,6 +500,7 @@ void Renderer::Thread() {
       } else {
         Draw(drawJob.params);
       }
+      pendingDraws.pop_front();
     }
 
     // Render the GUI
@@ -536,6 +515,45 @@ void Renderer::Thread() {
   }
 }
 
+const Xe::XGPU::XeShader *Renderer::GetShaderProgram(u32 vertexShader, u32 pixelShader) {
+  const u64 combinedHash = (static_cast<u64>(vertexShader) << 32) | pixelShader;
+  if (auto it = linkedShaderPrograms.find(combinedHash); it != linkedShaderPrograms.end())
+    return &it->second;
+
+  auto vsIt = pendingVertexShaders.find(vertexShader);
+  auto psIt = pendingPixelShaders.find(pixelShader);
+  if (vsIt == pendingVertexShaders.end() || psIt == pendingPixelShaders.end())
+    return nullptr;
+
+  // Failures are kept too (without a program), so we don't try linking them on every draw
+  Xe::XGPU::XeShader xeShader{};
+  xeShader.pixelShader = psIt->second.first;
+  xeShader.pixelShaderHash = psIt->first;
+  xeShader.vertexShader = vsIt->second.first;
+  xeShader.vertexShaderHash = vsIt->first;
+  if (xeShader.vertexShader && xeShader.pixelShader) {
+    xeShader.program = shaderFactory->LoadFromBinary(fmt::format("program_{:X}", combinedHash), {
+      { Render::eShaderType::Vertex, vsIt->second.second },
+      { Render::eShaderType::Fragment, psIt->second.second }
+    });
+  }
+  if (xeShader.program) {
+    for (u64 i = 0; i != xeShader.pixelShader->usedTextures.size(); ++i) {
+      xeShader.textures.push_back(resourceFactory->CreateTexture());
+    }
+    for (u64 i = 0; i != xeShader.vertexShader->usedTextures.size(); ++i) {
+      xeShader.textures.push_back(resourceFactory->CreateTexture());
+    }
+    for (auto &texture : xeShader.textures) {
+      texture->CreateTextureHandle(width, height, GetXenosFlags());
+    }
+    LOG_INFO(Xenos, "Linked shader program 0x{:X} (VS:0x{:X}, PS:0x{:X})", combinedHash, vertexShader, pixelShader);
+  } else {
+    LOG_ERROR(Xenos, "Failed to link shader program '0x{:X}'! VS: 0x{:08X}, PS: 0x{:08X}", combinedHash, vertexShader, pixelShader);
+  }
+  return &linkedShaderPrograms.insert_or_assign(combinedHash, std::move(xeShader)).first->second;
+}
+
 bool Renderer::DebuggerActive() {
   if (!gui.get())
     return false;
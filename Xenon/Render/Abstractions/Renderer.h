@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <deque>
 #include <fstream>
 #include <thread>
 #include <unordered_map>
@@ -37,6 +38,8 @@ struct DrawJob {
   Xe::XGPU::XeDrawParams params = {};
   u32 shaderVS = 0, shaderPS = 0;
   u64 shaderHash = 0;
+  // Frames spent waiting on its shaders, see XE_RENDER_MAX_DRAW_WAIT
+  u32 waitedFrames = 0;
 };
 
 struct ShaderLoadJob {
@@ -151,6 +154,10 @@ public:
 
   void SetDebuggerActive(s8 specificPPU = -1);
   
+  // Returns the program for a shader pair, linking it if both shaders are translated. nullptr
+  // while they aren't, a program that failed to link has no handle.
+  const Xe::XGPU::XeShader *GetShaderProgram(u32 vertexShader, u32 pixelShader);
+
   // Recompiled shaders
   std::mutex programLinkMutex{};
   std::unordered_map<u32, std::pair<Xe::Microcode::AST::Shader*, std::vector<u32>>> pendingVertexShaders{};
@@ -164,6 +171,9 @@ private:
   // Thread handle
   std::thread thread;
 
+  // Draws taken from drawQueue, only touched by the render thread
+  std::deque<DrawJob> pendingDraws{};
+
   // GUI handle
   std::unique_ptr<GUI> gui{};
 
@@ -5,6 +5,7 @@
 
 #ifndef NO_GFX
 #include "Core/XeMain.h"
+#include "Core/SaveState.h"
 #include "Base/Exit.h"
 #include "Core/XCPU/Interpreter/PPCInterpreter.h"
 
@@ -1085,6 +1086,35 @@ void Render::GUI::OnSwap(Texture *texture) {
             f.close();
           });
         });
+        TabItem("States", [&] {
+          // Incremental states only store the pages changed since the last save or load
+          Button("Save State", [&] {
+            const auto StateDir = Base::FS::GetUserPath(Base::FS::PathType::SaveStateDir);
+            const auto timestamp = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+            Xe::SaveSystemState(StateDir / fmt::format("state_{}.xst", timestamp), true);
+          });
+          Tooltip("Saves the RAM pages changed since the last save or load, on top of that state");
+          Button("Save Full State", [&] {
+            const auto StateDir = Base::FS::GetUserPath(Base::FS::PathType::SaveStateDir);
+            Xe::SaveSystemState(StateDir / "quick.xst", false);
+          });
+          Button("Load Latest State", [&] {
+            const auto StateDir = Base::FS::GetUserPath(Base::FS::PathType::SaveStateDir);
+            std::error_code error;
+            std::filesystem::path latest = {};
+            std::filesystem::file_time_type latestTime = {};
+            for (const auto &entry : std::filesystem::directory_iterator(StateDir, error)) {
+              if (entry.path().extension() != ".xst" || entry.last_write_time(error) < latestTime)
+                continue;
+              latest = entry.path();
+              latestTime = entry.last_write_time(error);
+            }
+            if (latest.empty())
+              LOG_WARNING(System, "No save states in {}", StateDir.string());
+            else
+              Xe::LoadSystemState(latest);
+          });
+        });
         TabItem("Settings", [&] {
           TabBar("##settings", [&] {
             TabItem("CPU", [&] {